@@ -0,0 +1,927 @@
+#include "buffercalc.h"
+#include "tokenize.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+using namespace std;
+using namespace swss;
+
+// The plugins parse numbers with tonumber, which fails on an empty or partially numeric string
+static bool toNumber(const string &str, double &value)
+{
+    const char *begin = str.c_str();
+    char *end = nullptr;
+
+    value = strtod(begin, &end);
+    if (end == begin)
+        return false;
+    while (isspace(static_cast<unsigned char>(*end)))
+        end++;
+
+    return *end == '\0';
+}
+
+static bool toNumber(const map<string, string> &fields, const string &field, double &value)
+{
+    auto fieldRef = fields.find(field);
+    if (fieldRef == fields.end())
+        return false;
+
+    return toNumber(fieldRef->second, value);
+}
+
+// Lua 5.1 converts a number to a string with "%.14g"
+static string luaNumber(double value)
+{
+    char buf[32];
+    snprintf(buf, sizeof(buf), "%.14g", value);
+    return buf;
+}
+
+static const string *getField(const map<string, string> &fields, const string &field)
+{
+    auto fieldRef = fields.find(field);
+    if (fieldRef == fields.end())
+        return nullptr;
+
+    return &fieldRef->second;
+}
+
+// Same as string.match(key, "Ethernet%d+") and string.match(key, "Ethernet%d+:([^%s]+)$") in the pool plugin
+static bool parseObjectKey(const string &key, string &port, string &ids)
+{
+    const string prefix = "Ethernet";
+    size_t pos = 0;
+
+    while ((pos = key.find(prefix, pos)) != string::npos)
+    {
+        size_t end = pos + prefix.size();
+        while (end < key.size() && isdigit(static_cast<unsigned char>(key[end])))
+            end++;
+
+        if (end > pos + prefix.size())
+        {
+            port = key.substr(pos, end - pos);
+            if (end + 1 < key.size() && key[end] == ':')
+                ids = key.substr(end + 1);
+            else
+                ids.clear();
+            return true;
+        }
+        pos++;
+    }
+
+    return false;
+}
+
+// Number of priorities or queues in an ID range, counted as the pool plugin does, which supports single digit IDs only
+static long countObjectIds(const string &ids)
+{
+    if (ids.size() <= 1)
+        return 1;
+
+    char first = ids.front(), last = ids.back();
+    if (!isdigit(static_cast<unsigned char>(first)) || !isdigit(static_cast<unsigned char>(last)))
+        return 1;
+
+    return 1 + (last - '0') - (first - '0');
+}
+
+bool BufferCalculator::setVendor(const string &vendor)
+{
+    if (vendor == "mellanox" || vendor == "vs")
+    {
+        m_barefoot = false;
+        return true;
+    }
+
+    if (vendor == "barefoot")
+    {
+        m_barefoot = true;
+        return true;
+    }
+
+    return false;
+}
+
+void BufferCalculator::setPort(const string &port, const vector<FieldValueTuple> &fvs)
+{
+    port_t newPort;
+    for (auto &fv : fvs)
+    {
+        if (fvField(fv) == "lanes")
+        {
+            // Same as the number of commas plus one the pool plugin counts
+            newPort.eight_lanes = (count(fvValue(fv).begin(), fvValue(fv).end(), ',') == 7);
+        }
+        else if (fvField(fv) == "admin_status")
+        {
+            newPort.admin_up = (fvValue(fv) == "up");
+        }
+    }
+
+    delPort(port);
+
+    m_ports[port] = newPort;
+    if (newPort.eight_lanes)
+        m_ports8Lanes++;
+    if (newPort.admin_up)
+    {
+        m_adminUpPorts++;
+        if (newPort.eight_lanes)
+            m_adminUp8LanesPorts++;
+    }
+
+    if (newPort.eight_lanes)
+    {
+        auto refsRef = m_portRefs.find(port);
+        if (refsRef != m_portRefs.end())
+        {
+            for (auto &it : refsRef->second.objects)
+                m_profiles[it.first].refs_8lanes += it.second;
+        }
+    }
+}
+
+void BufferCalculator::delPort(const string &port)
+{
+    auto portRef = m_ports.find(port);
+    if (portRef == m_ports.end())
+        return;
+
+    auto &oldPort = portRef->second;
+    if (oldPort.eight_lanes)
+        m_ports8Lanes--;
+    if (oldPort.admin_up)
+    {
+        m_adminUpPorts--;
+        if (oldPort.eight_lanes)
+            m_adminUp8LanesPorts--;
+    }
+
+    if (oldPort.eight_lanes)
+    {
+        auto refsRef = m_portRefs.find(port);
+        if (refsRef != m_portRefs.end())
+        {
+            for (auto &it : refsRef->second.objects)
+                m_profiles[it.first].refs_8lanes -= it.second;
+        }
+    }
+
+    m_ports.erase(portRef);
+}
+
+void BufferCalculator::setPool(const string &pool, const vector<FieldValueTuple> &fvs)
+{
+    auto &fields = m_pools[pool];
+    fields.clear();
+    for (auto &fv : fvs)
+        fields[fvField(fv)] = fvValue(fv);
+
+    // Whether a profile is ingress depends on the type of its pool
+    for (auto &it : m_profiles)
+        reclassifyProfile(it.first);
+}
+
+void BufferCalculator::delPool(const string &pool)
+{
+    m_pools.erase(pool);
+
+    for (auto &it : m_profiles)
+        reclassifyProfile(it.first);
+}
+
+void BufferCalculator::setApplEntry(appl_table_t table, const string &key, const vector<FieldValueTuple> &fvs)
+{
+    switch (table)
+    {
+    case APPL_BUFFER_POOL:
+        for (auto &fv : fvs)
+            m_applPools[key][fvField(fv)] = fvValue(fv);
+        break;
+    case APPL_BUFFER_PROFILE:
+    {
+        auto &profile = m_profiles[key];
+        for (auto &fv : fvs)
+            profile.fields[fvField(fv)] = fvValue(fv);
+        profile.present = true;
+        reclassifyProfile(key);
+        break;
+    }
+    case APPL_BUFFER_PG:
+        setObject(true, key, fvs);
+        break;
+    case APPL_BUFFER_QUEUE:
+        setObject(false, key, fvs);
+        break;
+    case APPL_BUFFER_INGRESS_PROFILE_LIST:
+        setProfileList(true, key, fvs);
+        break;
+    case APPL_BUFFER_EGRESS_PROFILE_LIST:
+        setProfileList(false, key, fvs);
+        break;
+    }
+}
+
+void BufferCalculator::delApplEntry(appl_table_t table, const string &key)
+{
+    switch (table)
+    {
+    case APPL_BUFFER_POOL:
+        m_applPools.erase(key);
+        break;
+    case APPL_BUFFER_PROFILE:
+    {
+        auto profileRef = m_profiles.find(key);
+        if (profileRef == m_profiles.end())
+            break;
+        profileRef->second.fields.clear();
+        profileRef->second.present = false;
+        reclassifyProfile(key);
+        releaseProfile(key);
+        break;
+    }
+    case APPL_BUFFER_PG:
+        delObject(true, key);
+        break;
+    case APPL_BUFFER_QUEUE:
+        delObject(false, key);
+        break;
+    case APPL_BUFFER_INGRESS_PROFILE_LIST:
+        delProfileList(true, key);
+        break;
+    case APPL_BUFFER_EGRESS_PROFILE_LIST:
+        delProfileList(false, key);
+        break;
+    }
+}
+
+BufferCalculator::profile_kind_t BufferCalculator::classifyProfile(const profile_t &profile) const
+{
+    if (!profile.present)
+        return PROFILE_NOT_INGRESS;
+
+    auto pool = getField(profile.fields, "pool");
+    if (!pool)
+        return PROFILE_NOT_INGRESS;
+
+    auto poolRef = m_pools.find(*pool);
+    if (poolRef == m_pools.end())
+        return PROFILE_NOT_INGRESS;
+
+    auto type = getField(poolRef->second, "type");
+    if (!type || *type != "ingress")
+        return PROFILE_NOT_INGRESS;
+
+    return profile.fields.count("xoff") ? PROFILE_INGRESS_LOSSLESS : PROFILE_INGRESS_LOSSY;
+}
+
+// Only happens when a profile is created or removed, or a pool changes type
+void BufferCalculator::reclassifyProfile(const string &name)
+{
+    auto &profile = m_profiles[name];
+    auto kind = classifyProfile(profile);
+    if (kind == profile.kind)
+        return;
+
+    bool wasLossless = (profile.kind == PROFILE_INGRESS_LOSSLESS);
+    bool isLossless = (kind == PROFILE_INGRESS_LOSSLESS);
+    profile.kind = kind;
+
+    if (wasLossless == isLossless)
+        return;
+
+    for (auto &it : m_portRefs)
+    {
+        auto pgRef = it.second.pgs.find(name);
+        if (pgRef != it.second.pgs.end())
+            updateLosslessPgs(it.second, isLossless ? pgRef->second : -pgRef->second);
+    }
+}
+
+void BufferCalculator::releaseProfile(const string &name)
+{
+    auto profileRef = m_profiles.find(name);
+    if (profileRef == m_profiles.end())
+        return;
+
+    auto &profile = profileRef->second;
+    if (!profile.present && profile.refs == 0 && profile.list_refs == 0)
+        m_profiles.erase(profileRef);
+}
+
+void BufferCalculator::updateLosslessPgs(port_refs_t &refs, long count)
+{
+    bool wasLossless = (refs.lossless_pgs > 0);
+    refs.lossless_pgs += count;
+    bool isLossless = (refs.lossless_pgs > 0);
+
+    if (wasLossless != isLossless)
+        m_losslessPorts += isLossless ? 1 : -1;
+}
+
+void BufferCalculator::referenceObject(bool pg, const object_t &object, long sign)
+{
+    long count = sign * object.count;
+
+    auto &profile = m_profiles[object.profile];
+    profile.refs += count;
+
+    auto portRef = m_ports.find(object.port);
+    if (portRef != m_ports.end() && portRef->second.eight_lanes)
+        profile.refs_8lanes += count;
+
+    auto &refs = m_portRefs[object.port];
+    if ((refs.objects[object.profile] += count) == 0)
+        refs.objects.erase(object.profile);
+    if (pg)
+    {
+        if ((refs.pgs[object.profile] += count) == 0)
+            refs.pgs.erase(object.profile);
+        if (profile.kind == PROFILE_INGRESS_LOSSLESS)
+            updateLosslessPgs(refs, count);
+    }
+
+    if (refs.objects.empty())
+        m_portRefs.erase(object.port);
+    if (sign < 0)
+        releaseProfile(object.profile);
+}
+
+void BufferCalculator::setObject(bool pg, const string &key, const vector<FieldValueTuple> &fvs)
+{
+    const string *profile = nullptr;
+    for (auto &fv : fvs)
+    {
+        if (fvField(fv) == "profile")
+            profile = &fvValue(fv);
+    }
+    if (!profile)
+        return;
+
+    // The pool plugin skips the items on ports it doesn't recognize
+    string port, ids;
+    if (!parseObjectKey(key, port, ids))
+        return;
+
+    delObject(pg, key);
+
+    object_t object = {port, *profile, countObjectIds(ids)};
+    referenceObject(pg, object, 1);
+    m_objects[pg ? 0 : 1][key] = object;
+}
+
+void BufferCalculator::delObject(bool pg, const string &key)
+{
+    auto &objects = m_objects[pg ? 0 : 1];
+    auto objectRef = objects.find(key);
+    if (objectRef == objects.end())
+        return;
+
+    object_t object = objectRef->second;
+    objects.erase(objectRef);
+    referenceObject(pg, object, -1);
+}
+
+void BufferCalculator::setProfileList(bool ingress, const string &port, const vector<FieldValueTuple> &fvs)
+{
+    const string *profileList = nullptr;
+    for (auto &fv : fvs)
+    {
+        if (fvField(fv) == "profile_list")
+            profileList = &fvValue(fv);
+    }
+    if (!profileList)
+        return;
+
+    vector<string> profiles;
+    for (auto &profile : tokenize(*profileList, ','))
+    {
+        if (!profile.empty())
+            profiles.push_back(profile);
+    }
+
+    delProfileList(ingress, port);
+
+    for (auto &profile : profiles)
+        m_profiles[profile].list_refs++;
+    m_profileLists[ingress ? 0 : 1][port] = move(profiles);
+}
+
+void BufferCalculator::delProfileList(bool ingress, const string &port)
+{
+    auto &lists = m_profileLists[ingress ? 0 : 1];
+    auto listRef = lists.find(port);
+    if (listRef == lists.end())
+        return;
+
+    auto profiles = move(listRef->second);
+    lists.erase(listRef);
+
+    for (auto &profile : profiles)
+    {
+        m_profiles[profile].list_refs--;
+        releaseProfile(profile);
+    }
+}
+
+bool BufferCalculator::calculateHeadroom(const buffer_calc_parameters_t &params, const string &speed, const string &cable_length,
+                                         const string &port_mtu, const string &gearbox_delay, long lane_count,
+                                         vector<string> &result) const
+{
+    if (m_barefoot)
+        return calculateHeadroomBarefoot(params, speed, cable_length, port_mtu, gearbox_delay, result);
+
+    return calculateHeadroomMellanox(params, speed, cable_length, port_mtu, gearbox_delay, lane_count, result);
+}
+
+bool BufferCalculator::calculatePools(const buffer_calc_parameters_t &params, vector<string> &result) const
+{
+    if (m_barefoot)
+        return calculatePoolsBarefoot(params, result);
+
+    return calculatePoolsMellanox(params, result);
+}
+
+// buffer_headroom_mellanox.lua
+bool BufferCalculator::calculateHeadroomMellanox(const buffer_calc_parameters_t &params, const string &speed, const string &cable_length,
+                                                 const string &port_mtu, const string &gearbox_delay, long lane_count,
+                                                 vector<string> &result) const
+{
+    static const map<double, double> pause_quanta_per_speed = {
+        {800000, 905}, {400000, 905}, {200000, 453}, {100000, 394}, {50000, 147},
+        {40000, 118}, {25000, 80}, {10000, 67}, {1000, 2}, {100, 1}
+    };
+    const double speed_of_light = 198000000;
+    const double minimal_packet_size = 64;
+
+    double port_speed, cable, mtu, gearbox;
+    if (!toNumber(speed, port_speed) || cable_length.empty()
+        || !toNumber(cable_length.substr(0, cable_length.size() - 1), cable)
+        || !toNumber(port_mtu, mtu))
+        return false;
+    if (!toNumber(gearbox_delay, gearbox))
+        gearbox = 0;
+
+    auto pauseQuantaRef = pause_quanta_per_speed.find(port_speed);
+    bool has_pause_quanta = (pauseQuantaRef != pause_quanta_per_speed.end());
+
+    double cell_size, pipeline_latency, mac_phy_delay, peer_response_time = 0;
+    if (!toNumber(params.asic_table, "cell_size", cell_size)
+        || !toNumber(params.asic_table, "pipeline_latency", pipeline_latency)
+        || !toNumber(params.asic_table, "mac_phy_delay", mac_phy_delay))
+        return false;
+    pipeline_latency = pipeline_latency * 1024;
+    mac_phy_delay = mac_phy_delay * 1024;
+    if (!has_pause_quanta)
+    {
+        if (!toNumber(params.asic_table, "peer_response_time", peer_response_time))
+            return false;
+        peer_response_time = peer_response_time * 1024;
+    }
+
+    double kb_on_tile = 0;
+    if (!params.asic_name.empty() && (params.asic_name.back() == '4' || params.asic_name.back() == '5'))
+    {
+        // Spectrum-4 and Spectrum-5
+        kb_on_tile = port_speed / 1000 * 120 / 8;
+    }
+
+    double lossless_mtu, small_packet_percentage;
+    if (!toNumber(params.lossless_traffic_pattern, "mtu", lossless_mtu)
+        || !toNumber(params.lossless_traffic_pattern, "small_packet_percentage", small_packet_percentage))
+        return false;
+
+    double over_subscribe_ratio, shp_size;
+    bool has_ratio = toNumber(params.over_subscribe_ratio, over_subscribe_ratio);
+    bool has_shp_size = false;
+    auto poolRef = m_pools.find("ingress_lossless_pool");
+    if (poolRef != m_pools.end())
+        has_shp_size = toNumber(poolRef->second, "xoff", shp_size);
+    bool shp_enabled = (has_shp_size && shp_size != 0) || (has_ratio && over_subscribe_ratio != 0);
+
+    double speed_overhead = 0;
+    if (lane_count == 8)
+    {
+        pipeline_latency = pipeline_latency * 2;
+        speed_overhead = mtu;
+    }
+
+    double worst_case_factor;
+    if (cell_size > 2 * minimal_packet_size)
+        worst_case_factor = cell_size / minimal_packet_size;
+    else
+        worst_case_factor = (2 * cell_size) / (1 + cell_size);
+    worst_case_factor = ceil(worst_case_factor);
+
+    double small_packet_percentage_by_byte = 100 * minimal_packet_size / ((small_packet_percentage * minimal_packet_size + (100 - small_packet_percentage) * lossless_mtu) / 100);
+    double cell_occupancy = (100 - small_packet_percentage_by_byte + small_packet_percentage_by_byte * worst_case_factor) / 100;
+
+    double bytes_on_gearbox = 0;
+    if (gearbox != 0)
+        bytes_on_gearbox = port_speed * gearbox / (8 * 1024);
+
+    if (has_pause_quanta)
+        peer_response_time = pauseQuantaRef->second * 512 / 8;
+
+    double bytes_on_cable = 2 * cable * port_speed * 1000000000 / speed_of_light / (8 * 1000);
+    double propagation_delay = mtu + bytes_on_cable + 2 * bytes_on_gearbox + mac_phy_delay + peer_response_time + kb_on_tile;
+
+    double xoff_value = lossless_mtu + propagation_delay * cell_occupancy;
+    xoff_value = ceil(xoff_value / 1024) * 1024;
+    double xon_value = ceil(pipeline_latency / 1024) * 1024;
+
+    double headroom_size;
+    if (shp_enabled)
+        headroom_size = xon_value;
+    else
+        headroom_size = xoff_value + xon_value + speed_overhead;
+    headroom_size = ceil(headroom_size / 1024) * 1024;
+
+    result.push_back("xon:" + luaNumber(ceil(xon_value)));
+    result.push_back("xoff:" + luaNumber(ceil(xoff_value)));
+    result.push_back("size:" + luaNumber(ceil(headroom_size)));
+
+    return true;
+}
+
+// buffer_headroom_barefoot.lua
+bool BufferCalculator::calculateHeadroomBarefoot(const buffer_calc_parameters_t &params, const string &speed, const string &cable_length,
+                                                 const string &port_mtu, const string &gearbox_delay,
+                                                 vector<string> &result) const
+{
+    static const map<double, double> pause_quanta_per_speed = {
+        {400000, 905}, {200000, 453}, {100000, 394}, {50000, 147},
+        {40000, 118}, {25000, 80}, {10000, 67}, {1000, 2}, {100, 1}
+    };
+    const double speed_of_light = 198000000;
+    const double minimal_packet_size = 64;
+
+    double port_speed, cable, mtu, gearbox;
+    if (!toNumber(speed, port_speed) || cable_length.empty()
+        || !toNumber(cable_length.substr(0, cable_length.size() - 1), cable)
+        || !toNumber(port_mtu, mtu))
+        return false;
+    if (!toNumber(gearbox_delay, gearbox))
+        gearbox = 0;
+
+    auto pauseQuantaRef = pause_quanta_per_speed.find(port_speed);
+    bool has_pause_quanta = (pauseQuantaRef != pause_quanta_per_speed.end());
+
+    double cell_size, pipeline_latency, mac_phy_delay, peer_response_time = 0;
+    if (!toNumber(params.asic_table, "cell_size", cell_size)
+        || !toNumber(params.asic_table, "pipeline_latency", pipeline_latency)
+        || !toNumber(params.asic_table, "mac_phy_delay", mac_phy_delay))
+        return false;
+    pipeline_latency = pipeline_latency * 1024;
+    mac_phy_delay = mac_phy_delay * 1024;
+    if (!has_pause_quanta)
+    {
+        if (!toNumber(params.asic_table, "peer_response_time", peer_response_time))
+            return false;
+        peer_response_time = peer_response_time * 1024;
+    }
+
+    double lossless_mtu, small_packet_percentage;
+    if (!toNumber(params.lossless_traffic_pattern, "mtu", lossless_mtu)
+        || !toNumber(params.lossless_traffic_pattern, "small_packet_percentage", small_packet_percentage))
+        return false;
+
+    double worst_case_factor;
+    if (cell_size > 2 * minimal_packet_size)
+        worst_case_factor = cell_size / minimal_packet_size;
+    else
+        worst_case_factor = (2 * cell_size) / (1 + cell_size);
+
+    double cell_occupancy = (100 - small_packet_percentage + small_packet_percentage * worst_case_factor) / 100;
+
+    double bytes_on_gearbox = 0;
+    if (gearbox != 0)
+        bytes_on_gearbox = port_speed * gearbox / (8 * 1024);
+
+    if (has_pause_quanta)
+        peer_response_time = pauseQuantaRef->second * 512 / 8;
+
+    if (port_speed == 400000)
+        peer_response_time = 2 * peer_response_time;
+
+    double bytes_on_cable = 2 * cable * port_speed * 1000000000 / speed_of_light / (8 * 1024);
+    double propagation_delay = mtu + bytes_on_cable + 2 * bytes_on_gearbox + mac_phy_delay + peer_response_time;
+
+    double xoff_value = lossless_mtu + propagation_delay * cell_occupancy;
+    xoff_value = ceil(xoff_value / 1024) * 1024;
+    double xon_value = ceil(pipeline_latency / 1024) * 1024;
+
+    double headroom_size = ceil(xon_value / 1024) * 1024;
+
+    result.push_back("xon:" + luaNumber(ceil(xon_value)));
+    result.push_back("xoff:" + luaNumber(ceil(xoff_value)));
+    result.push_back("size:" + luaNumber(ceil(headroom_size)));
+
+    return true;
+}
+
+// When the sizes can't be calculated, the pool plugin returns the sizes in APPL_DB
+void BufferCalculator::fetchPoolSizesFromAppl(bool shp_enabled, vector<string> &result) const
+{
+    static const map<string, string> noFields;
+
+    for (auto &poolRef : m_pools)
+    {
+        if (poolRef.second.count("size"))
+            continue;
+
+        auto &name = poolRef.first;
+        auto applPoolRef = m_applPools.find(name);
+        auto &fields = applPoolRef != m_applPools.end() ? applPoolRef->second : noFields;
+
+        auto size = getField(fields, "size");
+        string sizeStr = size ? *size : "0";
+        auto xoff = getField(fields, "xoff");
+        if (!xoff)
+        {
+            if (shp_enabled && sizeStr == "0" && name == "ingress_lossless_pool")
+            {
+                // Indicate the shared headroom pool is enabled with tiny pool sizes until the sizes are calculated
+                result.push_back(name + ":2048:1024");
+            }
+            else
+            {
+                result.push_back(name + ":" + sizeStr);
+            }
+        }
+        else
+        {
+            result.push_back(name + ":" + sizeStr + ":" + *xoff);
+        }
+    }
+}
+
+// buffer_pool_mellanox.lua
+bool BufferCalculator::calculatePoolsMellanox(const buffer_calc_parameters_t &params, vector<string> &result) const
+{
+    const double private_headroom = 10 * 1024;
+    const double mgmt_pool_size = 256 * 1024;
+    const double egress_mirror_headroom = 10 * 1024;
+
+    vector<string> ipools, epools;
+    for (auto &poolRef : m_pools)
+    {
+        auto type = getField(poolRef.second, "type");
+        if (!type)
+            continue;
+        if (*type == "ingress")
+            ipools.push_back(poolRef.first);
+        else if (*type == "egress")
+            epools.push_back(poolRef.first);
+    }
+
+    double total_port = static_cast<double>(m_ports.size());
+    double port_count_8lanes = static_cast<double>(m_ports8Lanes);
+    double admin_up_port = static_cast<double>(m_adminUpPorts);
+    double admin_up_8lanes_port = static_cast<double>(m_adminUp8LanesPorts);
+    double lossless_port_count = static_cast<double>(m_losslessPorts);
+
+    double over_subscribe_ratio;
+    if (!toNumber(params.over_subscribe_ratio, over_subscribe_ratio))
+        over_subscribe_ratio = 0;
+
+    double shp_size = 0;
+    auto losslessPoolRef = m_pools.find("ingress_lossless_pool");
+    if (losslessPoolRef == m_pools.end() || !toNumber(losslessPoolRef->second, "xoff", shp_size))
+        shp_size = 0;
+
+    bool shp_enabled = (over_subscribe_ratio != 0 || shp_size != 0);
+
+    double mmu_size;
+    if (!toNumber(params.mmu_size, mmu_size))
+    {
+        auto egressPoolRef = m_pools.find("egress_lossless_pool");
+        if (egressPoolRef == m_pools.end() || !toNumber(egressPoolRef->second, "size", mmu_size))
+            return false;
+    }
+
+    double cell_size, pipeline_latency;
+    if (!toNumber(params.asic_table, "cell_size", cell_size)
+        || !toNumber(params.asic_table, "pipeline_latency", pipeline_latency))
+        return false;
+
+    double lossypg_reserved = pipeline_latency * 1024;
+    double lossypg_reserved_8lanes = (2 * pipeline_latency - 1) * 1024;
+
+    // Align mmu_size at cell size boundary
+    double number_of_cells = floor(mmu_size / cell_size);
+    double ceiling_mmu_size = number_of_cells * cell_size;
+
+    // Items referencing profiles that have not been produced
+    for (auto &profileRef : m_profiles)
+    {
+        auto &profile = profileRef.second;
+        if (!profile.present && (profile.refs || profile.list_refs))
+        {
+            fetchPoolSizesFromAppl(shp_enabled, result);
+            return true;
+        }
+    }
+
+    vector<string> statistics;
+    double accumulative_occupied_buffer = 0;
+    double accumulative_xoff = 0;
+    double lossypg_8lanes = 0;
+
+    for (auto &profileRef : m_profiles)
+    {
+        auto &profile = profileRef.second;
+        if (!profile.present)
+            continue;
+
+        bool lossy = (profile.kind == PROFILE_INGRESS_LOSSY);
+        // A lossy ingress profile occupies no buffer when referenced by a profile list
+        double refs = static_cast<double>(profile.refs + (lossy ? 0 : profile.list_refs));
+        const string name = "BUFFER_PROFILE_TABLE:" + profileRef.first;
+
+        if (lossy)
+        {
+            lossypg_8lanes += static_cast<double>(profile.refs_8lanes);
+            if (profile.list_refs)
+                statistics.push_back(name + "_list:-:" + luaNumber(static_cast<double>(profile.list_refs)));
+        }
+
+        double size;
+        if (toNumber(profile.fields, "size", size))
+        {
+            if (lossy)
+                size = size + lossypg_reserved;
+            if (size != 0)
+            {
+                if (shp_size == 0)
+                {
+                    double xon, xoff;
+                    if (toNumber(profile.fields, "xon", xon) && toNumber(profile.fields, "xoff", xoff) && xon + xoff > size)
+                        accumulative_xoff = accumulative_xoff + (xon + xoff - size) * refs;
+                }
+                accumulative_occupied_buffer = accumulative_occupied_buffer + size * refs;
+            }
+            statistics.push_back(name + ":" + luaNumber(size) + ":" + luaNumber(refs));
+        }
+        else
+        {
+            statistics.push_back(name + ":-:" + luaNumber(refs));
+        }
+    }
+
+    // Extra lossy xon buffer for ports with 8 lanes
+    double lossypg_extra_for_8lanes = (lossypg_reserved_8lanes - lossypg_reserved) * lossypg_8lanes;
+    accumulative_occupied_buffer = accumulative_occupied_buffer + lossypg_extra_for_8lanes;
+
+    // Accumulate sizes for private headrooms
+    double accumulative_private_headroom = 0;
+    bool force_enable_shp = false;
+    if (accumulative_xoff > 0 && !shp_enabled)
+    {
+        force_enable_shp = true;
+        shp_size = 655360;
+        shp_enabled = true;
+    }
+    if (shp_enabled)
+    {
+        accumulative_private_headroom = lossless_port_count * private_headroom;
+        accumulative_occupied_buffer = accumulative_occupied_buffer + accumulative_private_headroom;
+        accumulative_xoff = accumulative_xoff - accumulative_private_headroom;
+        if (accumulative_xoff < 0)
+            accumulative_xoff = 0;
+    }
+
+    // Accumulate sizes for management PGs
+    double accumulative_management_pg = (admin_up_port - admin_up_8lanes_port) * lossypg_reserved + admin_up_8lanes_port * lossypg_reserved_8lanes;
+    accumulative_occupied_buffer = accumulative_occupied_buffer + accumulative_management_pg;
+
+    // Accumulate sizes for egress mirror and management pool
+    double accumulative_egress_mirror_overhead = admin_up_port * egress_mirror_headroom;
+    accumulative_occupied_buffer = accumulative_occupied_buffer + accumulative_egress_mirror_overhead + mgmt_pool_size;
+
+    // Fetch all the pools that need update
+    vector<string> pools_need_update;
+    int ingress_pool_count = 0;
+    bool has_ingress_lossless_pool_size = false;
+    double ingress_lossless_pool_size = 0;
+    for (auto &pool : ipools)
+    {
+        double size;
+        if (!toNumber(m_pools.at(pool), "size", size))
+        {
+            pools_need_update.push_back(pool);
+            ingress_pool_count++;
+        }
+        else if (pool == "ingress_lossless_pool" && shp_enabled && shp_size == 0)
+        {
+            has_ingress_lossless_pool_size = true;
+            ingress_lossless_pool_size = size;
+        }
+    }
+
+    for (auto &pool : epools)
+    {
+        if (!m_pools.at(pool).count("size"))
+            pools_need_update.push_back(pool);
+    }
+
+    if (shp_enabled && shp_size == 0)
+    {
+        shp_size = ceil(accumulative_xoff / over_subscribe_ratio);
+        if (shp_size == 0)
+            shp_size = 655360;
+    }
+
+    accumulative_occupied_buffer = accumulative_occupied_buffer + shp_size;
+
+    double available_buffer = mmu_size - accumulative_occupied_buffer;
+    double pool_size;
+    if (ingress_pool_count == 1)
+        pool_size = available_buffer;
+    else
+        pool_size = available_buffer / 2;
+
+    if (pool_size > ceiling_mmu_size)
+        pool_size = ceiling_mmu_size;
+
+    bool shp_deployed = false;
+    for (auto &pool : pools_need_update)
+    {
+        double percentage;
+        double effective_pool_size;
+        if (toNumber(m_pools.at(pool), "percentage", percentage) && percentage >= 0)
+            effective_pool_size = available_buffer * percentage / 100;
+        else
+            effective_pool_size = pool_size;
+
+        if (shp_size != 0 && pool == "ingress_lossless_pool")
+        {
+            result.push_back(pool + ":" + luaNumber(ceil(effective_pool_size)) + ":" + luaNumber(ceil(shp_size)));
+            shp_deployed = true;
+        }
+        else
+        {
+            result.push_back(pool + ":" + luaNumber(ceil(effective_pool_size)));
+        }
+    }
+
+    if (!shp_deployed && shp_size != 0 && has_ingress_lossless_pool_size)
+        result.push_back("ingress_lossless_pool:" + luaNumber(ceil(ingress_lossless_pool_size)) + ":" + luaNumber(ceil(shp_size)));
+
+    result.push_back("debug:mmu_size:" + luaNumber(mmu_size));
+    result.push_back("debug:accumulative size:" + luaNumber(accumulative_occupied_buffer));
+    for (auto &line : statistics)
+        result.push_back("debug:" + line);
+    result.push_back("debug:extra_8lanes:" + luaNumber(lossypg_reserved_8lanes - lossypg_reserved) + ":" + luaNumber(lossypg_8lanes) + ":" + luaNumber(port_count_8lanes));
+    result.push_back("debug:mgmt_pool:" + luaNumber(mgmt_pool_size));
+    if (shp_enabled)
+    {
+        result.push_back("debug:accumulative_private_headroom:" + luaNumber(accumulative_private_headroom));
+        result.push_back("debug:accumulative xoff:" + luaNumber(accumulative_xoff));
+        result.push_back(string("debug:force enabled shp:") + (force_enable_shp ? "true" : "false"));
+    }
+    result.push_back("debug:accumulative_mgmt_pg:" + luaNumber(accumulative_management_pg));
+    result.push_back("debug:egress_mirror:" + luaNumber(accumulative_egress_mirror_overhead));
+    result.push_back(string("debug:shp_enabled:") + (shp_enabled ? "true" : "false"));
+    result.push_back("debug:shp_size:" + luaNumber(shp_size));
+    result.push_back("debug:total port:" + luaNumber(total_port) + " ports with 8 lanes:" + luaNumber(port_count_8lanes));
+    result.push_back("debug:admin up port:" + luaNumber(admin_up_port) + " admin up ports with 8 lanes:" + luaNumber(admin_up_8lanes_port));
+
+    return true;
+}
+
+// buffer_pool_barefoot.lua
+bool BufferCalculator::calculatePoolsBarefoot(const buffer_calc_parameters_t &params, vector<string> &result) const
+{
+    double cell_size;
+    if (!toNumber(params.asic_table, "cell_size", cell_size))
+        return false;
+
+    // Based on cell_size, calculate singular headroom
+    double ppg_headroom = 400 * cell_size;
+    double ports_num = static_cast<double>(m_ports.size());
+
+    // 2 PPGs per port, 70% of possible maximum value
+    double shp_size = ceil(ports_num * 2 * ppg_headroom * 0.7);
+
+    double ingress_lossless_pool_size_fixed, ingress_lossy_pool_size_fixed, egress_lossy_pool_size_fixed;
+    auto ingressLosslessRef = m_pools.find("ingress_lossless_pool");
+    auto ingressLossyRef = m_pools.find("ingress_lossy_pool");
+    auto egressLossyRef = m_pools.find("egress_lossy_pool");
+    if (ingressLosslessRef == m_pools.end() || !toNumber(ingressLosslessRef->second, "size", ingress_lossless_pool_size_fixed)
+        || ingressLossyRef == m_pools.end() || !toNumber(ingressLossyRef->second, "size", ingress_lossy_pool_size_fixed)
+        || egressLossyRef == m_pools.end() || !toNumber(egressLossyRef->second, "size", egress_lossy_pool_size_fixed))
+        return false;
+
+    result.push_back("ingress_lossless_pool:" + luaNumber(ingress_lossless_pool_size_fixed) + ":" + luaNumber(shp_size));
+    result.push_back("ingress_lossy_pool:" + luaNumber(ingress_lossy_pool_size_fixed));
+    result.push_back("egress_lossy_pool:" + luaNumber(egress_lossy_pool_size_fixed));
+
+    return true;
+}
@@ -0,0 +1,147 @@
+#ifndef __BUFFERCALC__
+#define __BUFFERCALC__
+
+#include "table.h"
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace swss {
+
+#define BUFFER_ASIC_TABLE_NAME                  "ASIC_TABLE"
+#define LOSSLESS_TRAFFIC_PATTERN_TABLE_NAME     "LOSSLESS_TRAFFIC_PATTERN"
+
+// The inputs of the calculation that are read from the databases rather than tracked
+typedef struct {
+    // Key and fields of STATE_DB.ASIC_TABLE
+    std::string asic_name;
+    std::map<std::string, std::string> asic_table;
+    // Fields of CONFIG_DB.LOSSLESS_TRAFFIC_PATTERN
+    std::map<std::string, std::string> lossless_traffic_pattern;
+    // CONFIG_DB.DEFAULT_LOSSLESS_BUFFER_PARAMETER over_subscribe_ratio
+    std::string over_subscribe_ratio;
+    // STATE_DB.BUFFER_MAX_PARAM_TABLE|global mmu_size
+    std::string mmu_size;
+} buffer_calc_parameters_t;
+
+// BufferCalculator calculates the headroom of lossless profiles and the sizes of the shared buffer pools
+// the way buffer_headroom_<vendor>.lua and buffer_pool_<vendor>.lua do, and returns the same lines.
+//
+// The pool plugin reads every port, pool, profile, PG, queue and profile list from the databases each time it runs.
+// Here the ports and pools are fed as they are handled from CONFIG_DB and the buffer items as they are produced to APPL_DB,
+// and the reference counts the plugin builds are kept up to date in O(1) per update.
+// Calculating the pool sizes only walks the profiles and the pools.
+class BufferCalculator
+{
+public:
+    typedef enum {
+        APPL_BUFFER_POOL,
+        APPL_BUFFER_PROFILE,
+        APPL_BUFFER_PG,
+        APPL_BUFFER_QUEUE,
+        APPL_BUFFER_INGRESS_PROFILE_LIST,
+        APPL_BUFFER_EGRESS_PROFILE_LIST
+    } appl_table_t;
+
+    // Select the vendor whose plugins are reproduced, returns false if they haven't been ported
+    bool setVendor(const std::string &vendor);
+
+    // CONFIG_DB.PORT and CONFIG_DB.BUFFER_POOL
+    void setPort(const std::string &port, const std::vector<FieldValueTuple> &fvs);
+    void delPort(const std::string &port);
+    void setPool(const std::string &pool, const std::vector<FieldValueTuple> &fvs);
+    void delPool(const std::string &pool);
+
+    // APPL_DB buffer tables, fields are merged as the consumer of a ProducerStateTable does
+    void setApplEntry(appl_table_t table, const std::string &key, const std::vector<FieldValueTuple> &fvs);
+    void delApplEntry(appl_table_t table, const std::string &key);
+
+    // Same arguments and result as buffer_headroom_<vendor>.lua, eg. "xon:18432", "xoff:38912", "size:57344"
+    bool calculateHeadroom(const buffer_calc_parameters_t &params, const std::string &speed, const std::string &cable_length,
+                           const std::string &port_mtu, const std::string &gearbox_delay, long lane_count,
+                           std::vector<std::string> &result) const;
+    // Same result as buffer_pool_<vendor>.lua, eg. "ingress_lossless_pool:3200000:1024000", "debug:..."
+    bool calculatePools(const buffer_calc_parameters_t &params, std::vector<std::string> &result) const;
+
+private:
+    typedef enum {
+        PROFILE_NOT_INGRESS,
+        PROFILE_INGRESS_LOSSY,
+        PROFILE_INGRESS_LOSSLESS
+    } profile_kind_t;
+
+    typedef std::map<std::string, std::string> fields_t;
+
+    typedef struct {
+        fields_t fields;
+        bool present = false;
+        profile_kind_t kind = PROFILE_NOT_INGRESS;
+        // Number of PGs and queues referencing the profile
+        long refs = 0;
+        // Number of PGs and queues referencing the profile on ports with 8 lanes
+        long refs_8lanes = 0;
+        // Number of profile lists referencing the profile
+        long list_refs = 0;
+    } profile_t;
+
+    typedef struct {
+        bool eight_lanes = false;
+        bool admin_up = false;
+    } port_t;
+
+    // The buffer items on a port, by the name of the profiles they reference
+    typedef struct {
+        std::map<std::string, long> pgs;
+        std::map<std::string, long> objects;
+        long lossless_pgs = 0;
+    } port_refs_t;
+
+    typedef struct {
+        std::string port;
+        std::string profile;
+        long count;
+    } object_t;
+
+    bool m_barefoot = false;
+
+    std::map<std::string, fields_t> m_pools;
+    std::map<std::string, fields_t> m_applPools;
+    std::unordered_map<std::string, port_t> m_ports;
+    long m_ports8Lanes = 0;
+    long m_adminUpPorts = 0;
+    long m_adminUp8LanesPorts = 0;
+
+    std::map<std::string, profile_t> m_profiles;
+    // key: PG or queue without table name, eg. Ethernet0:3-4
+    std::unordered_map<std::string, object_t> m_objects[2];
+    std::unordered_map<std::string, std::vector<std::string>> m_profileLists[2];
+    std::unordered_map<std::string, port_refs_t> m_portRefs;
+    // Number of ports with lossless PGs
+    long m_losslessPorts = 0;
+
+    profile_kind_t classifyProfile(const profile_t &profile) const;
+    void reclassifyProfile(const std::string &name);
+    void releaseProfile(const std::string &name);
+    void referenceObject(bool pg, const object_t &object, long sign);
+    void updateLosslessPgs(port_refs_t &refs, long count);
+    void setObject(bool pg, const std::string &key, const std::vector<FieldValueTuple> &fvs);
+    void delObject(bool pg, const std::string &key);
+    void setProfileList(bool ingress, const std::string &port, const std::vector<FieldValueTuple> &fvs);
+    void delProfileList(bool ingress, const std::string &port);
+
+    bool calculateHeadroomMellanox(const buffer_calc_parameters_t &params, const std::string &speed, const std::string &cable_length,
+                                   const std::string &port_mtu, const std::string &gearbox_delay, long lane_count,
+                                   std::vector<std::string> &result) const;
+    bool calculateHeadroomBarefoot(const buffer_calc_parameters_t &params, const std::string &speed, const std::string &cable_length,
+                                   const std::string &port_mtu, const std::string &gearbox_delay,
+                                   std::vector<std::string> &result) const;
+    bool calculatePoolsMellanox(const buffer_calc_parameters_t &params, std::vector<std::string> &result) const;
+    bool calculatePoolsBarefoot(const buffer_calc_parameters_t &params, std::vector<std::string> &result) const;
+    void fetchPoolSizesFromAppl(bool shp_enabled, std::vector<std::string> &result) const;
+};
+
+}
+
+#endif /* __BUFFERCALC__ */
@@ -23,13 +23,14 @@ using json = nlohmann::json;
 
 void usage()
 {
-    cout << "Usage: buffermgrd <-l pg_lookup.ini|-a asic_table.json [-p peripheral_table.json] [-z zero_profiles.json]>" << endl;
+    cout << "Usage: buffermgrd <-l pg_lookup.ini|-a asic_table.json [-p peripheral_table.json] [-z zero_profiles.json] [-N]>" << endl;
     cout << "       -l pg_lookup.ini: PG profile look up table file (mandatory for static mode)" << endl;
     cout << "           format: csv" << endl;
     cout << "           values: 'speed, cable, size, xon,  xoff, dynamic_threshold, xon_offset'" << endl;
     cout << "       -a asic_table.json: ASIC-specific parameters definition (mandatory for dynamic mode)" << endl;
     cout << "       -p peripheral_table.json: Peripheral (eg. gearbox) parameters definition (optional for dynamic mode)" << endl;
     cout << "       -z zero_profiles.json: Zero profiles definition for reclaiming unused buffers (optional for dynamic mode)" << endl;
+    cout << "       -N: Calculate headroom and buffer pool sizes natively instead of with the vendor lua plugins (optional for dynamic mode)" << endl;
 }
 
 void dump_db_item(KeyOpFieldsValuesTuple &db_item)
@@ -96,12 +97,13 @@ int main(int argc, char **argv)
     string asic_table_file = "";
     string peripherial_table_file = "";
     string zero_profile_file = "";
+    bool nativeBufferCalculation = false;
     Logger::linkToDbNative("buffermgrd");
     SWSS_LOG_ENTER();
 
     SWSS_LOG_NOTICE("--- Starting buffermgrd ---");
 
-    while ((opt = getopt(argc, argv, "l:a:p:z:h")) != -1 )
+    while ((opt = getopt(argc, argv, "l:a:p:z:Nh")) != -1 )
     {
         switch (opt)
         {
@@ -120,6 +122,9 @@ int main(int argc, char **argv)
         case 'z':
             zero_profile_file = optarg;
             break;
+        case 'N':
+            nativeBufferCalculation = true;
+            break;
         default: /* '?' */
             usage();
             return EXIT_FAILURE;
@@ -184,7 +189,7 @@ int main(int argc, char **argv)
                 TableConnector(&stateDb, STATE_BUFFER_MAXIMUM_VALUE_TABLE),
                 TableConnector(&stateDb, STATE_PORT_TABLE_NAME)
             };
-            cfgOrchList.emplace_back(new BufferMgrDynamic(&cfgDb, &stateDb, &applDb, &applStateDb, buffer_table_connectors, peripherial_table_ptr, zero_profiles_ptr));
+            cfgOrchList.emplace_back(new BufferMgrDynamic(&cfgDb, &stateDb, &applDb, &applStateDb, buffer_table_connectors, peripherial_table_ptr, zero_profiles_ptr, nativeBufferCalculation));
         }
         else if (!pg_lookup_file.empty())
         {
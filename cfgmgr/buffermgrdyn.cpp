@@ -26,7 +26,7 @@
 using namespace std;
 using namespace swss;
 
-BufferMgrDynamic::BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBConnector *applDb, DBConnector *applStateDb, const vector<TableConnector> &tables, shared_ptr<vector<KeyOpFieldsValuesTuple>> gearboxInfo, shared_ptr<vector<KeyOpFieldsValuesTuple>> zeroProfilesInfo) :
+BufferMgrDynamic::BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBConnector *applDb, DBConnector *applStateDb, const vector<TableConnector> &tables, shared_ptr<vector<KeyOpFieldsValuesTuple>> gearboxInfo, shared_ptr<vector<KeyOpFieldsValuesTuple>> zeroProfilesInfo, bool nativeBufferCalculation) :
         Orch(tables),
         m_platform(),
         m_bufferDirections{BUFFER_INGRESS, BUFFER_EGRESS},
@@ -37,11 +37,18 @@ BufferMgrDynamic::BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBC
         m_supportRemoving(true),
         m_cfgDefaultLosslessBufferParam(cfgDb, CFG_DEFAULT_LOSSLESS_BUFFER_PARAMETER),
         m_cfgDeviceMetaDataTable(cfgDb, CFG_DEVICE_METADATA_TABLE_NAME),
-        m_applBufferPoolTable(applDb, APP_BUFFER_POOL_TABLE_NAME),
+        m_nativeBufferCalculation(false),
+        m_bufferCalcParametersLoaded(false),
+        m_stateAsicTable(stateDb, BUFFER_ASIC_TABLE_NAME),
+        m_cfgLosslessTrafficPatternTable(cfgDb, LOSSLESS_TRAFFIC_PATTERN_TABLE_NAME),
+        m_sharedBufferPoolCheckPending(false),
+        m_applBufferPoolTable(applDb, APP_BUFFER_POOL_TABLE_NAME, &m_bufferCalculator, BufferCalculator::APPL_BUFFER_POOL),
         m_applStateBufferPoolTable(applStateDb, APP_BUFFER_POOL_TABLE_NAME),
-        m_applBufferProfileTable(applDb, APP_BUFFER_PROFILE_TABLE_NAME),
-        m_applBufferObjectTables{ProducerStateTable(applDb, APP_BUFFER_PG_TABLE_NAME), ProducerStateTable(applDb, APP_BUFFER_QUEUE_TABLE_NAME)},
-        m_applBufferProfileListTables{ProducerStateTable(applDb, APP_BUFFER_PORT_INGRESS_PROFILE_LIST_NAME), ProducerStateTable(applDb, APP_BUFFER_PORT_EGRESS_PROFILE_LIST_NAME)},
+        m_applBufferProfileTable(applDb, APP_BUFFER_PROFILE_TABLE_NAME, &m_bufferCalculator, BufferCalculator::APPL_BUFFER_PROFILE),
+        m_applBufferObjectTables{BufferApplTable(applDb, APP_BUFFER_PG_TABLE_NAME, &m_bufferCalculator, BufferCalculator::APPL_BUFFER_PG),
+                                 BufferApplTable(applDb, APP_BUFFER_QUEUE_TABLE_NAME, &m_bufferCalculator, BufferCalculator::APPL_BUFFER_QUEUE)},
+        m_applBufferProfileListTables{BufferApplTable(applDb, APP_BUFFER_PORT_INGRESS_PROFILE_LIST_NAME, &m_bufferCalculator, BufferCalculator::APPL_BUFFER_INGRESS_PROFILE_LIST),
+                                      BufferApplTable(applDb, APP_BUFFER_PORT_EGRESS_PROFILE_LIST_NAME, &m_bufferCalculator, BufferCalculator::APPL_BUFFER_EGRESS_PROFILE_LIST)},
         m_statePortTable(stateDb, STATE_PORT_TABLE_NAME),
         m_stateBufferMaximumTable(stateDb, STATE_BUFFER_MAXIMUM_VALUE_TABLE),
         m_stateBufferPoolTable(stateDb, STATE_BUFFER_POOL_TABLE_NAME),
@@ -119,6 +126,21 @@ BufferMgrDynamic::BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBC
         }
     }
 
+    // On request, the headroom and pool sizes are calculated natively for the vendors whose plugins have been ported
+    // The plugins are still used for checking the headroom
+    if (nativeBufferCalculation)
+    {
+        if (m_bufferCalculator.setVendor(platform))
+        {
+            m_nativeBufferCalculation = true;
+            SWSS_LOG_NOTICE("Headroom and buffer pool sizes are calculated natively for %s", platform.c_str());
+        }
+        else
+        {
+            SWSS_LOG_NOTICE("Native buffer calculation is not supported for %s, using the lua plugins", platform.c_str());
+        }
+    }
+
     // Init timer
     auto interv = timespec { .tv_sec = BUFFERMGR_TIMER_PERIOD, .tv_nsec = 0 };
     m_buffermgrPeriodtimer = new SelectableTimer(interv);
@@ -596,6 +618,46 @@ bool BufferMgrDynamic::needRefreshPortDueToEffectiveSpeed(port_info_t &portInfo,
 }
 
 // Meta flows which are called by main flows
+
+// Fetch the parameters the lua plugins read from the databases for the native calculation
+// They are fetched at most once per batch of updates
+bool BufferMgrDynamic::loadBufferCalcParameters()
+{
+    if (!m_bufferCalcParametersLoaded)
+    {
+        vector<string> keys;
+        vector<FieldValueTuple> fvs;
+
+        m_stateAsicTable.getKeys(keys);
+        if (keys.empty() || !m_stateAsicTable.get(keys[0], fvs))
+        {
+            SWSS_LOG_WARN("No ASIC table in STATE_DB, unable to calculate buffer sizes");
+            return false;
+        }
+        m_bufferCalcParameters.asic_name = keys[0];
+        m_bufferCalcParameters.asic_table.clear();
+        for (auto &fv : fvs)
+            m_bufferCalcParameters.asic_table[fvField(fv)] = fvValue(fv);
+
+        keys.clear();
+        fvs.clear();
+        m_bufferCalcParameters.lossless_traffic_pattern.clear();
+        m_cfgLosslessTrafficPatternTable.getKeys(keys);
+        if (!keys.empty() && m_cfgLosslessTrafficPatternTable.get(keys[0], fvs))
+        {
+            for (auto &fv : fvs)
+                m_bufferCalcParameters.lossless_traffic_pattern[fvField(fv)] = fvValue(fv);
+        }
+
+        m_bufferCalcParametersLoaded = true;
+    }
+
+    m_bufferCalcParameters.over_subscribe_ratio = m_overSubscribeRatio;
+    m_bufferCalcParameters.mmu_size = m_mmuSize;
+
+    return true;
+}
+
 void BufferMgrDynamic::calculateHeadroomSize(buffer_profile_t &headroom)
 {
     // Call vendor-specific lua plugin to calculate the xon, xoff, xon_offset, size and threshold
@@ -611,7 +673,19 @@ void BufferMgrDynamic::calculateHeadroomSize(buffer_profile_t &headroom)
 
     try
     {
-        auto ret = swss::runRedisScript(*m_applDb, m_headroomSha, keys, argv);
+        vector<string> ret;
+        if (m_nativeBufferCalculation)
+        {
+            if (loadBufferCalcParameters())
+            {
+                m_bufferCalculator.calculateHeadroom(m_bufferCalcParameters, headroom.speed, headroom.cable_length, headroom.port_mtu,
+                                                     m_identifyGearboxDelay, headroom.lane_count, ret);
+            }
+        }
+        else
+        {
+            ret = swss::runRedisScript(*m_applDb, m_headroomSha, keys, argv);
+        }
 
         if (ret.empty())
         {
@@ -688,7 +762,16 @@ void BufferMgrDynamic::recalculateSharedBufferPool()
             }
         }
 
-        auto ret = runRedisScript(*m_applDb, m_bufferpoolSha, keys, argv);
+        vector<string> ret;
+        if (m_nativeBufferCalculation)
+        {
+            if (loadBufferCalcParameters())
+                m_bufferCalculator.calculatePools(m_bufferCalcParameters, ret);
+        }
+        else
+        {
+            ret = runRedisScript(*m_applDb, m_bufferpoolSha, keys, argv);
+        }
 
         // The format of the result:
         // a list of lines containing key, value pairs with colon as separator
@@ -1525,7 +1608,7 @@ task_process_status BufferMgrDynamic::refreshPgsForPort(const string &port, cons
 
     if (isHeadroomUpdated)
     {
-        checkSharedBufferPoolSize();
+        m_sharedBufferPoolCheckPending = true;
     }
     else
     {
@@ -1643,7 +1726,7 @@ void BufferMgrDynamic::refreshSharedHeadroomPool(bool enable_state_updated_by_ra
 
     if (m_portInitDone)
     {
-        checkSharedBufferPoolSize();
+        m_sharedBufferPoolCheckPending = true;
     }
 }
 
@@ -1713,7 +1796,7 @@ task_process_status BufferMgrDynamic::doRemovePgTask(const string &pg_key, const
     SWSS_LOG_NOTICE("Remove BUFFER_PG %s (profile %s, %s)", pg_key.c_str(), bufferPg.running_profile_name.c_str(), bufferPg.configured_profile_name.c_str());
 
     // Recalculate pool size
-    checkSharedBufferPoolSize();
+    m_sharedBufferPoolCheckPending = true;
 
     if (portInfo.state != PORT_ADMIN_DOWN)
     {
@@ -1766,7 +1849,7 @@ task_process_status BufferMgrDynamic::doUpdateBufferProfileForDynamicTh(buffer_p
         }
     }
 
-    checkSharedBufferPoolSize();
+    m_sharedBufferPoolCheckPending = true;
 
     return task_process_status::task_success;
 }
@@ -1802,7 +1885,7 @@ task_process_status BufferMgrDynamic::doUpdateBufferProfileForSize(buffer_profil
     }
 
     if (update_pool_size)
-        checkSharedBufferPoolSize();
+        m_sharedBufferPoolCheckPending = true;
 
     return task_process_status::task_success;
 }
@@ -2321,7 +2404,7 @@ task_process_status BufferMgrDynamic::handlePortTable(KeyOpFieldsValuesTuple &tu
                 {
                     reclaimReservedBufferForPort(port, m_portPgLookup, BUFFER_PG);
                     reclaimReservedBufferForPort(port, m_portQueueLookup, BUFFER_QUEUE);
-                    checkSharedBufferPoolSize();
+                    m_sharedBufferPoolCheckPending = true;
                 }
                 else
                 {
@@ -3214,7 +3297,7 @@ task_process_status BufferMgrDynamic::handleSingleBufferPortProfileListEntry(con
     const string &port = key;
     const string &op = kfvOp(tuple);
     const string &tableName = dir == BUFFER_INGRESS ? APP_BUFFER_PORT_INGRESS_PROFILE_LIST_NAME : APP_BUFFER_PORT_EGRESS_PROFILE_LIST_NAME;
-    ProducerStateTable &appTable = m_applBufferProfileListTables[dir];
+    BufferApplTable &appTable = m_applBufferProfileListTables[dir];
     port_profile_list_lookup_t &profileListLookup = m_portProfileListLookups[dir];
 
     if (op == SET_COMMAND)
@@ -3418,8 +3501,16 @@ void BufferMgrDynamic::doTask(Consumer &consumer)
         return;
     }
 
+    m_bufferCalcParametersLoaded = false;
+
     while (it != consumer.m_toSync.end())
     {
+        // The pool sizes are calculated from the ports and pools in CONFIG_DB, whether or not they have been handled
+        if (table_name == CFG_PORT_TABLE_NAME || table_name == CFG_BUFFER_POOL_TABLE_NAME)
+        {
+            updateBufferCalculatorConfig(table_name, it->second);
+        }
+
         auto task_status = (this->*(m_bufferTableHandlerMap[table_name]))(it->second);
         switch (task_status)
         {
@@ -3440,6 +3531,34 @@ void BufferMgrDynamic::doTask(Consumer &consumer)
                 break;
         }
     }
+
+    // Recalculate the pool sizes once for all the updates handled above
+    if (m_sharedBufferPoolCheckPending)
+    {
+        m_sharedBufferPoolCheckPending = false;
+        checkSharedBufferPoolSize(false);
+    }
+}
+
+void BufferMgrDynamic::updateBufferCalculatorConfig(const string &table_name, const KeyOpFieldsValuesTuple &tuple)
+{
+    const string &key = kfvKey(tuple);
+    bool isSet = (kfvOp(tuple) == SET_COMMAND);
+
+    if (table_name == CFG_PORT_TABLE_NAME)
+    {
+        if (isSet)
+            m_bufferCalculator.setPort(key, kfvFieldsValues(tuple));
+        else
+            m_bufferCalculator.delPort(key);
+    }
+    else
+    {
+        if (isSet)
+            m_bufferCalculator.setPool(key, kfvFieldsValues(tuple));
+        else
+            m_bufferCalculator.delPool(key);
+    }
 }
 
 /*
@@ -3623,9 +3742,17 @@ void BufferMgrDynamic::cleanUpItemsForReclaimingBuffer(const string &port)
 
 void BufferMgrDynamic::doTask(SelectableTimer &timer)
 {
+    m_bufferCalcParametersLoaded = false;
+
     checkSharedBufferPoolSize(true);
     if (!m_bufferCompletelyInitialized)
     {
         handlePendingBufferObjects();
     }
+
+    if (m_sharedBufferPoolCheckPending)
+    {
+        m_sharedBufferPoolCheckPending = false;
+        checkSharedBufferPoolSize(false);
+    }
 }
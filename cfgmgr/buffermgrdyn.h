@@ -4,6 +4,7 @@
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "orch.h"
+#include "buffercalc.h"
 
 #include <map>
 #include <set>
@@ -144,10 +145,44 @@ typedef std::map<std::string, std::string> port_profile_list_lookup_t;
 //map from gearbox model to gearbox delay
 typedef std::map<std::string, std::string> gearbox_delay_t;
 
+// Produces the buffer items to APPL_DB and feeds them to the buffer calculator
+class BufferApplTable
+{
+public:
+    BufferApplTable(DBConnector *db, const std::string &tableName, BufferCalculator *calculator, BufferCalculator::appl_table_t table) :
+        m_producer(db, tableName),
+        m_calculator(calculator),
+        m_table(table)
+    {
+    }
+
+    void set(const std::string &key, const std::vector<FieldValueTuple> &values)
+    {
+        m_producer.set(key, values);
+        m_calculator->setApplEntry(m_table, key, values);
+    }
+
+    void del(const std::string &key)
+    {
+        m_producer.del(key);
+        m_calculator->delApplEntry(m_table, key);
+    }
+
+    void flush()
+    {
+        m_producer.flush();
+    }
+
+private:
+    ProducerStateTable m_producer;
+    BufferCalculator *m_calculator;
+    BufferCalculator::appl_table_t m_table;
+};
+
 class BufferMgrDynamic : public Orch
 {
 public:
-    BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBConnector *applDb, DBConnector *applStateDb, const std::vector<TableConnector> &tables, std::shared_ptr<std::vector<KeyOpFieldsValuesTuple>> gearboxInfo, std::shared_ptr<std::vector<KeyOpFieldsValuesTuple>> zeroProfilesInfo);
+    BufferMgrDynamic(DBConnector *cfgDb, DBConnector *stateDb, DBConnector *applDb, DBConnector *applStateDb, const std::vector<TableConnector> &tables, std::shared_ptr<std::vector<KeyOpFieldsValuesTuple>> gearboxInfo, std::shared_ptr<std::vector<KeyOpFieldsValuesTuple>> zeroProfilesInfo, bool nativeBufferCalculation = false);
     using Orch::doTask;
 
 private:
@@ -190,6 +225,18 @@ private:
     std::string m_bufferZeroProfileName[BUFFER_DIR_MAX];
     std::string m_bufferObjectIdsToZero[BUFFER_DIR_MAX];
 
+    // Native calculation of the headroom and the pool sizes
+    // Used instead of the lua plugins unless they are required on the command line
+    BufferCalculator m_bufferCalculator;
+    bool m_nativeBufferCalculation;
+    // Reloaded once per batch of updates
+    buffer_calc_parameters_t m_bufferCalcParameters;
+    bool m_bufferCalcParametersLoaded;
+    Table m_stateAsicTable;
+    Table m_cfgLosslessTrafficPatternTable;
+    // The pool sizes are recalculated once all the updates in a batch have been handled
+    bool m_sharedBufferPoolCheckPending;
+
     // PORT table and caches
     Table m_statePortTable;
     // m_portInfoLookup
@@ -203,13 +250,13 @@ private:
     int m_waitApplyAdditionalZeroProfiles;
 
     // BUFFER_POOL table and cache
-    ProducerStateTable m_applBufferPoolTable;
+    BufferApplTable m_applBufferPoolTable;
     Table m_applStateBufferPoolTable;
     Table m_stateBufferPoolTable;
     buffer_pool_lookup_t m_bufferPoolLookup;
 
     // BUFFER_PROFILE table and caches
-    ProducerStateTable m_applBufferProfileTable;
+    BufferApplTable m_applBufferProfileTable;
     Table m_stateBufferProfileTable;
     // m_bufferProfileLookup - the cache for the following set:
     // 1. CFG_BUFFER_PROFILE
@@ -218,7 +265,7 @@ private:
     buffer_profile_lookup_t m_bufferProfileLookup;
 
     // BUFFER_PG table and caches
-    ProducerStateTable m_applBufferObjectTables[BUFFER_DIR_MAX];
+    BufferApplTable m_applBufferObjectTables[BUFFER_DIR_MAX];
     // m_portPgLookup - the cache for CFG_BUFFER_PG and APPL_BUFFER_PG
     // 1st level key: port name, 2nd level key: PGs
     // Updated in:
@@ -232,7 +279,7 @@ private:
     port_object_lookup_t m_portQueueLookup;
 
     // BUFFER_INGRESS_PROFILE_LIST/BUFFER_EGRESS_PROFILE_LIST table and caches
-    ProducerStateTable m_applBufferProfileListTables[BUFFER_DIR_MAX];
+    BufferApplTable m_applBufferProfileListTables[BUFFER_DIR_MAX];
     port_profile_list_lookup_t m_portProfileListLookups[BUFFER_DIR_MAX];
 
     //  table and caches
@@ -289,6 +336,7 @@ private:
 
     // Meta flows
     bool needRefreshPortDueToEffectiveSpeed(port_info_t &portInfo, std::string &portName);
+    bool loadBufferCalcParameters();
     void calculateHeadroomSize(buffer_profile_t &headroom);
     void checkSharedBufferPoolSize(bool force_update_during_initialization);
     void recalculateSharedBufferPool();
@@ -333,6 +381,7 @@ private:
     task_process_status handleBufferQueueTable(KeyOpFieldsValuesTuple &tuple);
     task_process_status handleBufferPortIngressProfileListTable(KeyOpFieldsValuesTuple &tuple);
     task_process_status handleBufferPortEgressProfileListTable(KeyOpFieldsValuesTuple &tuple);
+    void updateBufferCalculatorConfig(const std::string &table_name, const KeyOpFieldsValuesTuple &tuple);
     void doTask(Consumer &consumer);
     void doTask(SelectableTimer &timer);
 };
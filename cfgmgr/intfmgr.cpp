@@ -1,4 +1,5 @@
 #include <string.h>
+#include <net/ethernet.h>
 #include "logger.h"
 #include "dbconnector.h"
 #include "producerstatetable.h"
@@ -75,6 +76,20 @@ IntfMgr::IntfMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, c
     }
 }
 
+void IntfMgr::enableNetlinkExec()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_netlink.open())
+    {
+        SWSS_LOG_NOTICE("Host interfaces programmed over rtnetlink");
+    }
+    else
+    {
+        SWSS_LOG_WARN("Failed to open rtnetlink socket, host interfaces programmed with shell commands");
+    }
+}
+
 void IntfMgr::setIntfIp(const string &alias, const string &opCmd,
                         const IpPrefix &ipPrefix)
 {
@@ -84,6 +99,18 @@ void IntfMgr::setIntfIp(const string &alias, const string &opCmd,
     string          broadcastIpStr = ipPrefix.getBroadcastIp().to_string();
     int             prefixLen = ipPrefix.getMaskLength();
 
+    if (m_netlink.isOpen())
+    {
+        bool broadcast = ipPrefix.isV4() && prefixLen < 31;
+        uint32_t metric = (!ipPrefix.isV4() && mySwitchType == "voq") ? 256 : 0;
+
+        if ((opCmd == "add" && m_netlink.addAddress(alias, ipPrefix, broadcast, metric)) ||
+            (opCmd == "del" && m_netlink.delAddress(alias, ipPrefix)))
+        {
+            return;
+        }
+    }
+
     if (ipPrefix.isV4())
     {
         (prefixLen < 31) ?
@@ -137,6 +164,13 @@ void IntfMgr::setIntfMac(const string &alias, const string &mac_str)
     stringstream cmd;
     string res;
 
+    uint8_t mac[ETHER_ADDR_LEN];
+    if (m_netlink.isOpen() && MacAddress::parseMacString(mac_str, mac) &&
+        m_netlink.setLinkAddress(alias, MacAddress(mac)))
+    {
+        return;
+    }
+
     cmd << IP_CMD << " link set " << alias << " address " << mac_str;
 
     int ret = swss::exec(cmd.str(), res);
@@ -151,6 +185,11 @@ void IntfMgr::setIntfVrf(const string &alias, const string &vrfName)
     stringstream cmd;
     string res;
 
+    if (m_netlink.isOpen() && m_netlink.setLinkMaster(alias, vrfName))
+    {
+        return;
+    }
+
     if (!vrfName.empty())
     {
         cmd << IP_CMD << " link set " << shellquote(alias) << " master " << shellquote(vrfName);
@@ -198,6 +237,12 @@ void IntfMgr::addLoopbackIntf(const string &alias)
     stringstream cmd;
     string res;
 
+    if (m_netlink.isOpen() &&
+        m_netlink.addLink(alias, "dummy", static_cast<uint32_t>(stoul(LOOPBACK_DEFAULT_MTU_STR)), true))
+    {
+        return;
+    }
+
     cmd << IP_CMD << " link add " << alias << " mtu " << LOOPBACK_DEFAULT_MTU_STR << " type dummy && ";
     cmd << IP_CMD << " link set " << alias << " up";
     int ret = swss::exec(cmd.str(), res);
@@ -212,6 +257,11 @@ void IntfMgr::delLoopbackIntf(const string &alias)
     stringstream cmd;
     string res;
 
+    if (m_netlink.isOpen() && m_netlink.delLink(alias))
+    {
+        return;
+    }
+
     cmd << IP_CMD << " link del " << alias;
     int ret = swss::exec(cmd.str(), res);
     if (ret)
@@ -334,6 +384,15 @@ void IntfMgr::addHostSubIntf(const string&intf, const string &subIntf, const str
     stringstream cmd;
     string res;
 
+    /* The vlan id comes from configuration, let "ip" reject invalid ones */
+    char *end = nullptr;
+    unsigned long vlan_id = strtoul(vlan.c_str(), &end, 10);
+    if (m_netlink.isOpen() && !vlan.empty() && *end == '\0' && vlan_id < 4096 &&
+        m_netlink.addVlanLink(subIntf, intf, static_cast<uint16_t>(vlan_id)))
+    {
+        return;
+    }
+
     cmd << IP_CMD " link add link " << shellquote(intf) << " name " << shellquote(subIntf) << " type vlan id " << shellquote(vlan);
     EXEC_WITH_ERROR_THROW(cmd.str(), res);
 }
@@ -445,6 +504,11 @@ std::string IntfMgr::setHostSubIntfMtu(const string &alias, const string &mtu, c
         subifMtu = parent_mtu;
     }
     SWSS_LOG_INFO("subintf %s active mtu: %s", alias.c_str(), subifMtu.c_str());
+    if (m_netlink.isOpen() && m_netlink.setLinkMtu(alias, static_cast<uint32_t>(stoul(subifMtu))))
+    {
+        return subifMtu;
+    }
+
     cmd << IP_CMD " link set " << shellquote(alias) << " mtu " << shellquote(subifMtu);
     std::string cmd_str = cmd.str();
     int ret = swss::exec(cmd_str, res);
@@ -495,6 +559,12 @@ std::string IntfMgr::setHostSubIntfAdminStatus(const string &alias, const string
     if (parent_admin_status == "up" || admin_status == "down")
     {
         SWSS_LOG_INFO("subintf %s admin_status: %s", alias.c_str(), admin_status.c_str());
+        if (m_netlink.isOpen() && (admin_status == "up" || admin_status == "down") &&
+            m_netlink.setLinkAdminState(alias, admin_status == "up"))
+        {
+            return admin_status;
+        }
+
         cmd << IP_CMD " link set " << shellquote(alias) << " " << shellquote(admin_status);
         cmd_str = cmd.str();
         int ret = swss::exec(cmd_str, res);
@@ -521,6 +591,11 @@ void IntfMgr::removeHostSubIntf(const string &subIntf)
     stringstream cmd;
     string res;
 
+    if (m_netlink.isOpen() && m_netlink.delLink(subIntf))
+    {
+        return;
+    }
+
     cmd << IP_CMD " link del " << shellquote(subIntf);
     EXEC_WITH_ERROR_THROW(cmd.str(), res);
 }
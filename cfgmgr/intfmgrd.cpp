@@ -42,6 +42,7 @@ int main(int argc, char **argv)
         WarmStart::checkWarmStart("intfmgrd", "swss");
 
         IntfMgr intfmgr(&cfgDb, &appDb, &stateDb, cfg_intf_tables);
+        intfmgr.enableNetlinkExec();
         std::vector<Orch *> cfgOrchList = {&intfmgr};
 
         swss::Select s;
@@ -0,0 +1,701 @@
+#include <errno.h>
+#include <net/ethernet.h>
+#include <net/if.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <linux/if_addr.h>
+#include <linux/if_bridge.h>
+#include <linux/if_link.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+
+#include "logger.h"
+#include "netlinkexec.h"
+
+using namespace std;
+using namespace swss;
+
+namespace {
+
+/* Builds a rtnetlink request: netlink header, family header, then attributes */
+class NetlinkRequest
+{
+public:
+    NetlinkRequest(uint16_t type, uint16_t flags, const void *hdr, size_t hdrLen) :
+        m_buf(NLMSG_SPACE(hdrLen))
+    {
+        auto nlh = reinterpret_cast<struct nlmsghdr *>(m_buf.data());
+        nlh->nlmsg_type = type;
+        nlh->nlmsg_flags = static_cast<uint16_t>(NLM_F_REQUEST | flags);
+        memcpy(NLMSG_DATA(nlh), hdr, hdrLen);
+    }
+
+    void put(uint16_t type, const void *data, size_t len)
+    {
+        size_t offset = m_buf.size();
+        m_buf.resize(offset + RTA_SPACE(len));
+
+        auto rta = reinterpret_cast<struct rtattr *>(m_buf.data() + offset);
+        rta->rta_type = type;
+        rta->rta_len = static_cast<unsigned short>(RTA_LENGTH(len));
+        if (len)
+        {
+            memcpy(RTA_DATA(rta), data, len);
+        }
+    }
+
+    void putU16(uint16_t type, uint16_t value)
+    {
+        put(type, &value, sizeof(value));
+    }
+
+    void putU32(uint16_t type, uint32_t value)
+    {
+        put(type, &value, sizeof(value));
+    }
+
+    void putStr(uint16_t type, const string &value)
+    {
+        put(type, value.c_str(), value.size() + 1);
+    }
+
+    size_t beginNest(uint16_t type)
+    {
+        size_t offset = m_buf.size();
+        put(type, nullptr, 0);
+        return offset;
+    }
+
+    void endNest(size_t offset)
+    {
+        auto rta = reinterpret_cast<struct rtattr *>(m_buf.data() + offset);
+        rta->rta_len = static_cast<unsigned short>(m_buf.size() - offset);
+    }
+
+    vector<uint8_t> &finish()
+    {
+        auto nlh = reinterpret_cast<struct nlmsghdr *>(m_buf.data());
+        nlh->nlmsg_len = static_cast<uint32_t>(m_buf.size());
+        return m_buf;
+    }
+
+private:
+    vector<uint8_t> m_buf;
+};
+
+/* Receive one datagram from the socket, growing the buffer to fit it */
+ssize_t receive(int fd, vector<uint8_t> &buf, int flags = 0)
+{
+    while (true)
+    {
+        ssize_t len = recv(fd, nullptr, 0, MSG_PEEK | MSG_TRUNC | flags);
+        if (len < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return len;
+        }
+
+        if (buf.size() < static_cast<size_t>(len))
+        {
+            buf.resize(static_cast<size_t>(len));
+        }
+
+        len = recv(fd, buf.data(), buf.size(), flags);
+        if (len < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        return len;
+    }
+}
+
+}
+
+NetlinkExec::~NetlinkExec()
+{
+    close();
+}
+
+bool NetlinkExec::open()
+{
+    SWSS_LOG_ENTER();
+
+    if (isOpen())
+    {
+        return true;
+    }
+
+    int fd = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+    if (fd < 0)
+    {
+        m_lastError = errno;
+        SWSS_LOG_WARN("Failed to open rtnetlink socket: %s", strerror(errno));
+        return false;
+    }
+
+    /* Acks only carry the header of the request they answer */
+    int one = 1;
+    setsockopt(fd, SOL_NETLINK, NETLINK_CAP_ACK, &one, sizeof(one));
+
+    int bufSize = NETLINK_EXEC_MAX_BATCH_BYTES * 4;
+    setsockopt(fd, SOL_SOCKET, SO_SNDBUF, &bufSize, sizeof(bufSize));
+    setsockopt(fd, SOL_SOCKET, SO_RCVBUF, &bufSize, sizeof(bufSize));
+
+    struct timeval tv = { NETLINK_EXEC_ACK_TIMEOUT_SEC, 0 };
+    setsockopt(fd, SOL_SOCKET, SO_RCVTIMEO, &tv, sizeof(tv));
+
+    struct sockaddr_nl addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.nl_family = AF_NETLINK;
+    if (bind(fd, reinterpret_cast<struct sockaddr *>(&addr), sizeof(addr)) < 0)
+    {
+        m_lastError = errno;
+        SWSS_LOG_WARN("Failed to bind rtnetlink socket: %s", strerror(errno));
+        ::close(fd);
+        return false;
+    }
+
+    m_fd = fd;
+    return true;
+}
+
+void NetlinkExec::close()
+{
+    if (isOpen())
+    {
+        ::close(m_fd);
+        m_fd = -1;
+    }
+    abortBatch();
+}
+
+void NetlinkExec::beginBatch()
+{
+    abortBatch();
+    m_batching = true;
+}
+
+void NetlinkExec::abortBatch()
+{
+    m_batching = false;
+    m_batch.clear();
+    m_pending.clear();
+}
+
+bool NetlinkExec::fail(const string &desc)
+{
+    m_pending.push_back({0, desc, false});
+
+    if (!m_batching)
+    {
+        commit();
+    }
+    return false;
+}
+
+bool NetlinkExec::queue(vector<uint8_t> &msg, const string &desc)
+{
+    if (!isOpen())
+    {
+        m_lastError = ENOTCONN;
+        return fail(desc);
+    }
+
+    auto nlh = reinterpret_cast<struct nlmsghdr *>(msg.data());
+    nlh->nlmsg_flags = static_cast<uint16_t>(nlh->nlmsg_flags | NLM_F_ACK);
+    nlh->nlmsg_seq = ++m_seq;
+
+    m_batch.insert(m_batch.end(), msg.begin(), msg.end());
+    m_pending.push_back({nlh->nlmsg_seq, desc, true});
+
+    if (m_batching)
+    {
+        return true;
+    }
+
+    return commit();
+}
+
+bool NetlinkExec::commit()
+{
+    SWSS_LOG_ENTER();
+
+    m_results.assign(m_pending.size(), false);
+
+    if (!isOpen())
+    {
+        abortBatch();
+        m_lastError = ENOTCONN;
+        return false;
+    }
+
+    /* Split the batch at message boundaries so each sendmsg stays within the socket buffers */
+    bool success = true;
+    size_t begin = 0, offset = 0;
+    vector<size_t> members;
+    for (size_t i = 0; i < m_pending.size(); i++)
+    {
+        if (!m_pending[i].queued)
+        {
+            success = false;
+            continue;
+        }
+
+        auto nlh = reinterpret_cast<struct nlmsghdr *>(m_batch.data() + offset);
+        size_t len = NLMSG_ALIGN(nlh->nlmsg_len);
+
+        if (offset > begin && (offset + len - begin > NETLINK_EXEC_MAX_BATCH_BYTES ||
+                               members.size() >= NETLINK_EXEC_MAX_BATCH_MSGS))
+        {
+            success = sendChunk(begin, offset, members) && success;
+            begin = offset;
+            members.clear();
+        }
+        members.push_back(i);
+        offset += len;
+    }
+
+    if (offset > begin)
+    {
+        success = sendChunk(begin, offset, members) && success;
+    }
+
+    abortBatch();
+    return success;
+}
+
+bool NetlinkExec::sendChunk(size_t begin, size_t end, const vector<size_t> &members)
+{
+    struct sockaddr_nl addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.nl_family = AF_NETLINK;
+
+    struct iovec iov = { m_batch.data() + begin, end - begin };
+    struct msghdr msg;
+    memset(&msg, 0, sizeof(msg));
+    msg.msg_name = &addr;
+    msg.msg_namelen = sizeof(addr);
+    msg.msg_iov = &iov;
+    msg.msg_iovlen = 1;
+
+    if (sendmsg(m_fd, &msg, 0) < 0)
+    {
+        m_lastError = errno;
+        SWSS_LOG_ERROR("Failed to send %zu rtnetlink requests: %s", members.size(), strerror(errno));
+        return false;
+    }
+
+    bool success = true;
+    uint32_t firstSeq = m_pending[members.front()].seq;
+    size_t count = members.size();
+    vector<bool> acked(count, false);
+    size_t ackCount = 0;
+    vector<uint8_t> buf(NETLINK_EXEC_MAX_BATCH_BYTES);
+
+    while (ackCount < count)
+    {
+        ssize_t len = receive(m_fd, buf);
+        if (len < 0)
+        {
+            m_lastError = errno;
+            SWSS_LOG_ERROR("Failed to receive rtnetlink acks, %zu of %zu requests acked: %s",
+                           ackCount, count, strerror(errno));
+
+            /*
+             * Acks were dropped, discard the ones still queued so they do not
+             * answer the next batch. The unacked requests are reported failed.
+             */
+            while (receive(m_fd, buf, MSG_DONTWAIT) >= 0);
+            return false;
+        }
+
+        int remaining = static_cast<int>(len);
+        for (auto nlh = reinterpret_cast<struct nlmsghdr *>(buf.data());
+             NLMSG_OK(nlh, remaining); nlh = NLMSG_NEXT(nlh, remaining))
+        {
+            /* Sequence numbers wrap around, the difference is still the index in the chunk */
+            size_t idx = static_cast<uint32_t>(nlh->nlmsg_seq - firstSeq);
+            if (nlh->nlmsg_type != NLMSG_ERROR || idx >= count || acked[idx])
+            {
+                /* Stale ack of a request which timed out earlier */
+                continue;
+            }
+
+            acked[idx] = true;
+            ackCount++;
+
+            auto err = reinterpret_cast<struct nlmsgerr *>(NLMSG_DATA(nlh));
+            if (err->error)
+            {
+                m_lastError = -err->error;
+                SWSS_LOG_INFO("Netlink request '%s' failed: %s",
+                              m_pending[members[idx]].desc.c_str(), strerror(-err->error));
+                success = false;
+            }
+            else
+            {
+                m_results[members[idx]] = true;
+            }
+        }
+    }
+
+    return success;
+}
+
+bool NetlinkExec::ifIndex(const string &name, uint32_t &index)
+{
+    index = if_nametoindex(name.c_str());
+    if (!index)
+    {
+        m_lastError = errno;
+        SWSS_LOG_INFO("Failed to get ifindex of %s: %s", name.c_str(), strerror(errno));
+        return false;
+    }
+    return true;
+}
+
+bool NetlinkExec::addLink(const string &name, const string &kind, uint32_t mtu, bool up)
+{
+    struct ifinfomsg ifi;
+    memset(&ifi, 0, sizeof(ifi));
+    ifi.ifi_family = AF_UNSPEC;
+    ifi.ifi_flags = up ? IFF_UP : 0;
+    ifi.ifi_change = up ? IFF_UP : 0;
+
+    NetlinkRequest req(RTM_NEWLINK, NLM_F_CREATE | NLM_F_EXCL, &ifi, sizeof(ifi));
+    req.putStr(IFLA_IFNAME, name);
+    if (mtu)
+    {
+        req.putU32(IFLA_MTU, mtu);
+    }
+    size_t linkInfo = req.beginNest(IFLA_LINKINFO);
+    req.putStr(IFLA_INFO_KIND, kind);
+    req.endNest(linkInfo);
+
+    return queue(req.finish(), "link add " + name + " type " + kind);
+}
+
+bool NetlinkExec::addVlanLink(const string &name, const string &parent, uint16_t vlan_id,
+                              const MacAddress *mac, bool up)
+{
+    string desc = "link add link " + parent + " name " + name + " type vlan id " + to_string(vlan_id);
+
+    uint32_t parentIndex;
+    if (!ifIndex(parent, parentIndex))
+    {
+        return fail(desc);
+    }
+
+    struct ifinfomsg ifi;
+    memset(&ifi, 0, sizeof(ifi));
+    ifi.ifi_family = AF_UNSPEC;
+    ifi.ifi_flags = up ? IFF_UP : 0;
+    ifi.ifi_change = up ? IFF_UP : 0;
+
+    NetlinkRequest req(RTM_NEWLINK, NLM_F_CREATE | NLM_F_EXCL, &ifi, sizeof(ifi));
+    req.putStr(IFLA_IFNAME, name);
+    req.putU32(IFLA_LINK, parentIndex);
+    if (mac)
+    {
+        req.put(IFLA_ADDRESS, mac->getMac(), ETHER_ADDR_LEN);
+    }
+    size_t linkInfo = req.beginNest(IFLA_LINKINFO);
+    req.putStr(IFLA_INFO_KIND, "vlan");
+    size_t infoData = req.beginNest(IFLA_INFO_DATA);
+    req.putU16(IFLA_VLAN_ID, vlan_id);
+    req.endNest(infoData);
+    req.endNest(linkInfo);
+
+    return queue(req.finish(), desc);
+}
+
+bool NetlinkExec::addVrfLink(const string &name, uint32_t table)
+{
+    struct ifinfomsg ifi;
+    memset(&ifi, 0, sizeof(ifi));
+    ifi.ifi_family = AF_UNSPEC;
+
+    NetlinkRequest req(RTM_NEWLINK, NLM_F_CREATE | NLM_F_EXCL, &ifi, sizeof(ifi));
+    req.putStr(IFLA_IFNAME, name);
+    size_t linkInfo = req.beginNest(IFLA_LINKINFO);
+    req.putStr(IFLA_INFO_KIND, "vrf");
+    size_t infoData = req.beginNest(IFLA_INFO_DATA);
+    req.putU32(IFLA_VRF_TABLE, table);
+    req.endNest(infoData);
+    req.endNest(linkInfo);
+
+    return queue(req.finish(), "link add " + name + " type vrf table " + to_string(table));
+}
+
+bool NetlinkExec::delLink(const string &name)
+{
+    struct ifinfomsg ifi;
+    memset(&ifi, 0, sizeof(ifi));
+    ifi.ifi_family = AF_UNSPEC;
+
+    NetlinkRequest req(RTM_DELLINK, 0, &ifi, sizeof(ifi));
+    req.putStr(IFLA_IFNAME, name);
+
+    return queue(req.finish(), "link del " + name);
+}
+
+bool NetlinkExec::setLinkAdminState(const string &name, bool up)
+{
+    struct ifinfomsg ifi;
+    memset(&ifi, 0, sizeof(ifi));
+    ifi.ifi_family = AF_UNSPEC;
+    ifi.ifi_flags = up ? IFF_UP : 0;
+    ifi.ifi_change = IFF_UP;
+
+    NetlinkRequest req(RTM_SETLINK, 0, &ifi, sizeof(ifi));
+    req.putStr(IFLA_IFNAME, name);
+
+    return queue(req.finish(), "link set " + name + (up ? " up" : " down"));
+}
+
+bool NetlinkExec::setLinkMtu(const string &name, uint32_t mtu)
+{
+    struct ifinfomsg ifi;
+    memset(&ifi, 0, sizeof(ifi));
+    ifi.ifi_family = AF_UNSPEC;
+
+    NetlinkRequest req(RTM_SETLINK, 0, &ifi, sizeof(ifi));
+    req.putStr(IFLA_IFNAME, name);
+    req.putU32(IFLA_MTU, mtu);
+
+    return queue(req.finish(), "link set " + name + " mtu " + to_string(mtu));
+}
+
+bool NetlinkExec::setLinkAddress(const string &name, const MacAddress &mac)
+{
+    struct ifinfomsg ifi;
+    memset(&ifi, 0, sizeof(ifi));
+    ifi.ifi_family = AF_UNSPEC;
+
+    NetlinkRequest req(RTM_SETLINK, 0, &ifi, sizeof(ifi));
+    req.putStr(IFLA_IFNAME, name);
+    req.put(IFLA_ADDRESS, mac.getMac(), ETHER_ADDR_LEN);
+
+    return queue(req.finish(), "link set " + name + " address " + mac.to_string());
+}
+
+bool NetlinkExec::setLinkMaster(const string &name, const string &master)
+{
+    string desc = "link set " + name + (master.empty() ? " nomaster" : " master " + master);
+
+    uint32_t masterIndex = 0;
+    if (!master.empty() && !ifIndex(master, masterIndex))
+    {
+        return fail(desc);
+    }
+
+    struct ifinfomsg ifi;
+    memset(&ifi, 0, sizeof(ifi));
+    ifi.ifi_family = AF_UNSPEC;
+
+    NetlinkRequest req(RTM_SETLINK, 0, &ifi, sizeof(ifi));
+    req.putStr(IFLA_IFNAME, name);
+    req.putU32(IFLA_MASTER, masterIndex);
+
+    return queue(req.finish(), desc);
+}
+
+bool NetlinkExec::addAddress(const string &name, const IpPrefix &prefix, bool broadcast, uint32_t metric)
+{
+    return modifyAddress(RTM_NEWADDR, NLM_F_CREATE | NLM_F_EXCL, name, prefix, broadcast, metric);
+}
+
+bool NetlinkExec::delAddress(const string &name, const IpPrefix &prefix)
+{
+    return modifyAddress(RTM_DELADDR, 0, name, prefix, false, 0);
+}
+
+bool NetlinkExec::modifyAddress(uint16_t type, uint16_t flags, const string &name,
+                                const IpPrefix &prefix, bool broadcast, uint32_t metric)
+{
+    string desc = string("address ") + (type == RTM_NEWADDR ? "add " : "del ")
+                  + prefix.to_string() + " dev " + name;
+
+    uint32_t index;
+    if (!ifIndex(name, index))
+    {
+        return fail(desc);
+    }
+
+    ip_addr_t addr = prefix.getIp().getIp();
+    bool isV4 = prefix.isV4();
+    size_t addrLen = isV4 ? sizeof(addr.ip_addr.ipv4_addr) : sizeof(addr.ip_addr.ipv6_addr);
+
+    struct ifaddrmsg ifa;
+    memset(&ifa, 0, sizeof(ifa));
+    ifa.ifa_family = static_cast<unsigned char>(isV4 ? AF_INET : AF_INET6);
+    ifa.ifa_prefixlen = static_cast<unsigned char>(prefix.getMaskLength());
+    ifa.ifa_index = index;
+
+    NetlinkRequest req(type, flags, &ifa, sizeof(ifa));
+    req.put(IFA_LOCAL, &addr.ip_addr, addrLen);
+    req.put(IFA_ADDRESS, &addr.ip_addr, addrLen);
+    if (broadcast && isV4)
+    {
+        ip_addr_t bcast = prefix.getBroadcastIp().getIp();
+        req.put(IFA_BROADCAST, &bcast.ip_addr.ipv4_addr, sizeof(bcast.ip_addr.ipv4_addr));
+    }
+    if (metric)
+    {
+        req.putU32(IFA_RT_PRIORITY, metric);
+    }
+
+    return queue(req.finish(), desc);
+}
+
+bool NetlinkExec::addBridgeVlan(const string &name, uint16_t vlan_id, bool pvid_untagged, bool self)
+{
+    return modifyBridgeVlan(RTM_SETLINK, name, vlan_id, pvid_untagged, self);
+}
+
+bool NetlinkExec::delBridgeVlan(const string &name, uint16_t vlan_id, bool self)
+{
+    return modifyBridgeVlan(RTM_DELLINK, name, vlan_id, false, self);
+}
+
+bool NetlinkExec::modifyBridgeVlan(uint16_t type, const string &name, uint16_t vlan_id,
+                                   bool pvid_untagged, bool self)
+{
+    string desc = string("bridge vlan ") + (type == RTM_SETLINK ? "add" : "del")
+                  + " vid " + to_string(vlan_id) + " dev " + name
+                  + (pvid_untagged ? " pvid untagged" : "") + (self ? " self" : "");
+
+    uint32_t index;
+    if (!ifIndex(name, index))
+    {
+        return fail(desc);
+    }
+
+    struct ifinfomsg ifi;
+    memset(&ifi, 0, sizeof(ifi));
+    ifi.ifi_family = AF_BRIDGE;
+    ifi.ifi_index = static_cast<int>(index);
+
+    struct bridge_vlan_info vinfo;
+    memset(&vinfo, 0, sizeof(vinfo));
+    vinfo.vid = vlan_id;
+    if (pvid_untagged)
+    {
+        vinfo.flags = BRIDGE_VLAN_INFO_PVID | BRIDGE_VLAN_INFO_UNTAGGED;
+    }
+
+    NetlinkRequest req(type, 0, &ifi, sizeof(ifi));
+    size_t afSpec = req.beginNest(IFLA_AF_SPEC);
+    if (self)
+    {
+        req.putU16(IFLA_BRIDGE_FLAGS, BRIDGE_FLAGS_SELF);
+    }
+    req.put(IFLA_BRIDGE_VLAN_INFO, &vinfo, sizeof(vinfo));
+    req.endNest(afSpec);
+
+    return queue(req.finish(), desc);
+}
+
+bool NetlinkExec::getBridgeVlans(const string &name, vector<uint16_t> &vlans)
+{
+    SWSS_LOG_ENTER();
+
+    vlans.clear();
+
+    if (!isOpen() || m_batching)
+    {
+        m_lastError = !isOpen() ? ENOTCONN : EBUSY;
+        return false;
+    }
+
+    uint32_t index;
+    if (!ifIndex(name, index))
+    {
+        return false;
+    }
+
+    struct ifinfomsg ifi;
+    memset(&ifi, 0, sizeof(ifi));
+    ifi.ifi_family = AF_BRIDGE;
+
+    /* Bridge VLANs are only reported by dumps */
+    NetlinkRequest req(RTM_GETLINK, NLM_F_DUMP, &ifi, sizeof(ifi));
+    req.putU32(IFLA_EXT_MASK, RTEXT_FILTER_BRVLAN);
+
+    auto &msg = req.finish();
+    auto reqHdr = reinterpret_cast<struct nlmsghdr *>(msg.data());
+    reqHdr->nlmsg_seq = ++m_seq;
+
+    if (send(m_fd, msg.data(), msg.size(), 0) < 0)
+    {
+        m_lastError = errno;
+        SWSS_LOG_ERROR("Failed to request bridge vlans of %s: %s", name.c_str(), strerror(errno));
+        return false;
+    }
+
+    vector<uint8_t> buf(NETLINK_EXEC_MAX_BATCH_BYTES);
+    while (true)
+    {
+        ssize_t len = receive(m_fd, buf);
+        if (len < 0)
+        {
+            m_lastError = errno;
+            SWSS_LOG_ERROR("Failed to receive bridge vlans of %s: %s", name.c_str(), strerror(errno));
+            return false;
+        }
+
+        int remaining = static_cast<int>(len);
+        for (auto nlh = reinterpret_cast<struct nlmsghdr *>(buf.data());
+             NLMSG_OK(nlh, remaining); nlh = NLMSG_NEXT(nlh, remaining))
+        {
+            if (nlh->nlmsg_seq != m_seq)
+            {
+                continue;
+            }
+
+            if (nlh->nlmsg_type == NLMSG_DONE)
+            {
+                return true;
+            }
+
+            if (nlh->nlmsg_type == NLMSG_ERROR)
+            {
+                auto err = reinterpret_cast<struct nlmsgerr *>(NLMSG_DATA(nlh));
+                m_lastError = -err->error;
+                SWSS_LOG_ERROR("Failed to dump bridge vlans of %s: %s", name.c_str(), strerror(-err->error));
+                return false;
+            }
+
+            auto info = reinterpret_cast<struct ifinfomsg *>(NLMSG_DATA(nlh));
+            if (nlh->nlmsg_type != RTM_NEWLINK || static_cast<uint32_t>(info->ifi_index) != index)
+            {
+                continue;
+            }
+
+            int attrLen = static_cast<int>(IFLA_PAYLOAD(nlh));
+            for (auto rta = IFLA_RTA(info); RTA_OK(rta, attrLen); rta = RTA_NEXT(rta, attrLen))
+            {
+                if (rta->rta_type != IFLA_AF_SPEC)
+                {
+                    continue;
+                }
+
+                int specLen = static_cast<int>(RTA_PAYLOAD(rta));
+                for (auto spec = reinterpret_cast<struct rtattr *>(RTA_DATA(rta));
+                     RTA_OK(spec, specLen); spec = RTA_NEXT(spec, specLen))
+                {
+                    if (spec->rta_type == IFLA_BRIDGE_VLAN_INFO)
+                    {
+                        auto vinfo = reinterpret_cast<struct bridge_vlan_info *>(RTA_DATA(spec));
+                        vlans.push_back(vinfo->vid);
+                    }
+                }
+            }
+        }
+    }
+}
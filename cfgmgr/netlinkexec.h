@@ -0,0 +1,142 @@
+#ifndef __NETLINKEXEC__
+#define __NETLINKEXEC__
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "macaddress.h"
+#include "ipprefix.h"
+
+/* Maximum size and count of the requests sent by a single sendmsg, their acks must fit in the receive buffer */
+#define NETLINK_EXEC_MAX_BATCH_BYTES   (64 * 1024)
+#define NETLINK_EXEC_MAX_BATCH_MSGS    256
+/* Time to wait for the kernel to acknowledge a batch */
+#define NETLINK_EXEC_ACK_TIMEOUT_SEC   5
+
+namespace swss {
+
+/*
+ * NetlinkExec performs the link, address, bridge VLAN and VRF operations the
+ * cfgmgr daemons otherwise run through "ip" and "bridge" shell commands, by
+ * talking rtnetlink directly.
+ *
+ * Each operation is sent and acknowledged right away, unless a batch was
+ * started with beginBatch(): operations are then queued and commit() sends
+ * them with as few sendmsg calls as possible, waiting for all their acks.
+ * The kernel applies each request of a batch on its own, getResults() tells
+ * which operations of the last commit were applied.
+ *
+ * Interfaces are referred to by name. Operations which need the ifindex of an
+ * interface (addresses, bridge VLANs, master, parent link) resolve it when
+ * they are called, so the interface must exist by then: it cannot be created
+ * earlier in the same batch.
+ *
+ * The socket is only opened by open(). Until then every operation fails, so
+ * the callers keep using their shell commands.
+ */
+class NetlinkExec
+{
+public:
+    NetlinkExec() = default;
+    ~NetlinkExec();
+
+    NetlinkExec(const NetlinkExec&) = delete;
+    NetlinkExec& operator=(const NetlinkExec&) = delete;
+
+    bool open();
+    void close();
+
+    bool isOpen() const
+    {
+        return m_fd >= 0;
+    }
+
+    /* Queue the following operations until commit() */
+    void beginBatch();
+
+    /* Send the queued operations, return false if any of them failed */
+    bool commit();
+
+    /* Drop the queued operations */
+    void abortBatch();
+
+    /* ip link add {{name}} [mtu {{mtu}}] [up] type {{kind}} */
+    bool addLink(const std::string &name, const std::string &kind, uint32_t mtu = 0, bool up = false);
+    /* ip link add link {{parent}} name {{name}} [address {{mac}}] [up] type vlan id {{vlan_id}} */
+    bool addVlanLink(const std::string &name, const std::string &parent, uint16_t vlan_id,
+                     const MacAddress *mac = nullptr, bool up = false);
+    /* ip link add {{name}} type vrf table {{table}} */
+    bool addVrfLink(const std::string &name, uint32_t table);
+    /* ip link del {{name}} */
+    bool delLink(const std::string &name);
+
+    /* ip link set {{name}} up|down */
+    bool setLinkAdminState(const std::string &name, bool up);
+    /* ip link set {{name}} mtu {{mtu}} */
+    bool setLinkMtu(const std::string &name, uint32_t mtu);
+    /* ip link set {{name}} address {{mac}} */
+    bool setLinkAddress(const std::string &name, const MacAddress &mac);
+    /* ip link set {{name}} master {{master}}, nomaster if master is empty */
+    bool setLinkMaster(const std::string &name, const std::string &master);
+
+    /* ip address add|del {{prefix}} [broadcast {{bcast}}] dev {{name}} [metric {{metric}}] */
+    bool addAddress(const std::string &name, const IpPrefix &prefix, bool broadcast, uint32_t metric = 0);
+    bool delAddress(const std::string &name, const IpPrefix &prefix);
+
+    /* bridge vlan add vid {{vlan_id}} dev {{name}} [pvid untagged] [self] */
+    bool addBridgeVlan(const std::string &name, uint16_t vlan_id, bool pvid_untagged = false, bool self = false);
+    /* bridge vlan del vid {{vlan_id}} dev {{name}} [self] */
+    bool delBridgeVlan(const std::string &name, uint16_t vlan_id, bool self = false);
+
+    /* bridge vlan show dev {{name}}, not allowed while a batch is open */
+    bool getBridgeVlans(const std::string &name, std::vector<uint16_t> &vlans);
+
+    /*
+     * Whether each operation of the last commit(), or the last operation sent
+     * outside of a batch, was applied, in the order they were called
+     */
+    const std::vector<bool> &getResults() const
+    {
+        return m_results;
+    }
+
+    /* Errno of the last failed operation */
+    int getLastError() const
+    {
+        return m_lastError;
+    }
+
+private:
+    struct Pending
+    {
+        uint32_t seq;
+        std::string desc;
+        /* False when the operation failed before its request could be queued */
+        bool queued;
+    };
+
+    int m_fd = -1;
+    uint32_t m_seq = 0;
+    int m_lastError = 0;
+    bool m_batching = false;
+
+    /* Queued requests, laid out back to back as they are sent */
+    std::vector<uint8_t> m_batch;
+    std::vector<Pending> m_pending;
+    std::vector<bool> m_results;
+
+    bool queue(std::vector<uint8_t> &msg, const std::string &desc);
+    /* Record an operation which failed before its request could be queued */
+    bool fail(const std::string &desc);
+    bool sendChunk(size_t begin, size_t end, const std::vector<size_t> &members);
+    bool ifIndex(const std::string &name, uint32_t &index);
+    bool modifyAddress(uint16_t type, uint16_t flags, const std::string &name,
+                       const IpPrefix &prefix, bool broadcast, uint32_t metric);
+    bool modifyBridgeVlan(uint16_t type, const std::string &name, uint16_t vlan_id,
+                          bool pvid_untagged, bool self);
+};
+
+}
+
+#endif /* __NETLINKEXEC__ */
@@ -1,4 +1,6 @@
 #include <string.h>
+#include <fstream>
+#include <net/ethernet.h>
 #include "logger.h"
 #include "producerstatetable.h"
 #include "macaddress.h"
@@ -21,6 +23,28 @@ using namespace swss;
 
 extern MacAddress gMacAddress;
 
+/*
+ * Join the shell commands of the steps the last netlink batch did not apply,
+ * so the shell fallback does not run again the ones which succeeded.
+ */
+static std::string joinFailedSteps(const NetlinkExec &netlink, const std::vector<std::string> &steps)
+{
+    const auto &results = netlink.getResults();
+    std::string cmds;
+
+    for (size_t i = 0; i < steps.size(); i++)
+    {
+        if (netlink.isOpen() && results.size() == steps.size() && results[i])
+        {
+            continue;
+        }
+
+        cmds += (cmds.empty() ? "" : " && ") + steps[i];
+    }
+
+    return cmds;
+}
+
 VlanMgr::VlanMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, const vector<string> &tableNames,
         const vector<string> &stateTableNames) :
         Orch(cfgDb, stateDb, tableNames, stateTableNames),
@@ -109,6 +133,20 @@ VlanMgr::VlanMgr(DBConnector *cfgDb, DBConnector *appDb, DBConnector *stateDb, c
     EXEC_WITH_ERROR_THROW(no_ll_learn_cmd, res);
 }
 
+void VlanMgr::enableNetlinkExec()
+{
+    SWSS_LOG_ENTER();
+
+    if (m_netlink.open())
+    {
+        SWSS_LOG_NOTICE("Host VLANs programmed over rtnetlink");
+    }
+    else
+    {
+        SWSS_LOG_WARN("Failed to open rtnetlink socket, host VLANs programmed with shell commands");
+    }
+}
+
 bool VlanMgr::addHostVlan(int vlan_id)
 {
     SWSS_LOG_ENTER();
@@ -116,14 +154,33 @@ bool VlanMgr::addHostVlan(int vlan_id)
     // The command should be generated as:
     // /bin/bash -c "/sbin/bridge vlan add vid {{vlan_id}} dev Bridge self &&
     //               /sbin/ip link add link Bridge up name Vlan{{vlan_id}} address {{gMacAddress}} type vlan id {{vlan_id}}"
-    const std::string cmds = std::string("")
-      + BASH_CMD + " -c \""
-      + BRIDGE_CMD + " vlan add vid " + std::to_string(vlan_id) + " dev " + DOT1Q_BRIDGE_NAME + " self && "
-      + IP_CMD + " link add link " + DOT1Q_BRIDGE_NAME
+    const std::vector<std::string> steps = {
+        std::string("") + BRIDGE_CMD + " vlan add vid " + std::to_string(vlan_id) + " dev " + DOT1Q_BRIDGE_NAME + " self",
+        std::string("") + IP_CMD + " link add link " + DOT1Q_BRIDGE_NAME
                + " up"
                + " name " + VLAN_PREFIX + std::to_string(vlan_id)
                + " address " + gMacAddress.to_string()
-               + " type vlan id " + std::to_string(vlan_id) + "\"";
+               + " type vlan id " + std::to_string(vlan_id)
+    };
+
+    if (m_netlink.isOpen())
+    {
+        const std::string vlan_alias = VLAN_PREFIX + std::to_string(vlan_id);
+
+        m_netlink.beginBatch();
+        m_netlink.addBridgeVlan(DOT1Q_BRIDGE_NAME, static_cast<uint16_t>(vlan_id), false, true);
+        m_netlink.addVlanLink(vlan_alias, DOT1Q_BRIDGE_NAME, static_cast<uint16_t>(vlan_id), &gMacAddress, true);
+        if (m_netlink.commit())
+        {
+            std::ofstream arp_evict("/proc/sys/net/ipv4/conf/" + vlan_alias + "/arp_evict_nocarrier");
+            arp_evict << "0";
+            return true;
+        }
+
+        SWSS_LOG_NOTICE("Failed to create host vlan %d over netlink, retrying the failed steps with shell commands", vlan_id);
+    }
+
+    const std::string cmds = std::string("") + BASH_CMD + " -c " + shellquote(joinFailedSteps(m_netlink, steps));
 
     std::string res;
     EXEC_WITH_ERROR_THROW(cmds, res);
@@ -143,10 +200,25 @@ bool VlanMgr::removeHostVlan(int vlan_id)
     // The command should be generated as:
     // /bin/bash -c "/sbin/ip link del Vlan{{vlan_id}} &&
     //               /sbin/bridge vlan del vid {{vlan_id}} dev Bridge self"
-    const std::string cmds = std::string("")
-      + BASH_CMD + " -c \""
-      + IP_CMD + " link del " + VLAN_PREFIX + std::to_string(vlan_id) + " && "
-      + BRIDGE_CMD + " vlan del vid " + std::to_string(vlan_id) + " dev " + DOT1Q_BRIDGE_NAME + " self\"";
+    const std::vector<std::string> steps = {
+        std::string("") + IP_CMD + " link del " + VLAN_PREFIX + std::to_string(vlan_id),
+        std::string("") + BRIDGE_CMD + " vlan del vid " + std::to_string(vlan_id) + " dev " + DOT1Q_BRIDGE_NAME + " self"
+    };
+
+    if (m_netlink.isOpen())
+    {
+        m_netlink.beginBatch();
+        m_netlink.delLink(VLAN_PREFIX + std::to_string(vlan_id));
+        m_netlink.delBridgeVlan(DOT1Q_BRIDGE_NAME, static_cast<uint16_t>(vlan_id), true);
+        if (m_netlink.commit())
+        {
+            return true;
+        }
+
+        SWSS_LOG_NOTICE("Failed to remove host vlan %d over netlink, retrying the failed steps with shell commands", vlan_id);
+    }
+
+    const std::string cmds = std::string("") + BASH_CMD + " -c " + shellquote(joinFailedSteps(m_netlink, steps));
 
     std::string res;
     EXEC_WITH_ERROR_THROW(cmds, res);
@@ -158,6 +230,12 @@ bool VlanMgr::setHostVlanAdminState(int vlan_id, const string &admin_status)
 {
     SWSS_LOG_ENTER();
 
+    if (m_netlink.isOpen() && (admin_status == "up" || admin_status == "down") &&
+        m_netlink.setLinkAdminState(VLAN_PREFIX + std::to_string(vlan_id), admin_status == "up"))
+    {
+        return true;
+    }
+
     // The command should be generated as:
     // /sbin/ip link set Vlan{{vlan_id}} {{admin_status}}
     ostringstream cmds;
@@ -173,6 +251,12 @@ bool VlanMgr::setHostVlanMtu(int vlan_id, uint32_t mtu)
 {
     SWSS_LOG_ENTER();
 
+    if (m_netlink.isOpen())
+    {
+        /* VLAN mtu should not be larger than member mtu, which is not retried */
+        return m_netlink.setLinkMtu(VLAN_PREFIX + std::to_string(vlan_id), mtu);
+    }
+
     // The command should be generated as:
     // /sbin/ip link set Vlan{{vlan_id}} mtu {{mtu}}
     const std::string cmds = std::string("")
@@ -194,13 +278,30 @@ bool VlanMgr::setHostVlanMac(int vlan_id, const string &mac)
     SWSS_LOG_ENTER();
 
     // The command should be generated as:
-    // /sbin/ip link set Vlan{{vlan_id}} address {{mac}}
-    ostringstream cmds;
-    cmds << IP_CMD " link set " VLAN_PREFIX + std::to_string(vlan_id) + " address " << shellquote(mac) << " && "
-            IP_CMD " link set " DOT1Q_BRIDGE_NAME " address " << shellquote(mac);
+    // /sbin/ip link set Vlan{{vlan_id}} address {{mac}} &&
+    // /sbin/ip link set Bridge address {{mac}}
+    const std::vector<std::string> steps = {
+        IP_CMD " link set " VLAN_PREFIX + std::to_string(vlan_id) + " address " + shellquote(mac),
+        IP_CMD " link set " DOT1Q_BRIDGE_NAME " address " + shellquote(mac)
+    };
+
+    uint8_t mac_bin[ETHER_ADDR_LEN];
+    bool batched = m_netlink.isOpen() && MacAddress::parseMacString(mac, mac_bin);
+    if (batched)
+    {
+        m_netlink.beginBatch();
+        m_netlink.setLinkAddress(VLAN_PREFIX + std::to_string(vlan_id), MacAddress(mac_bin));
+        m_netlink.setLinkAddress(DOT1Q_BRIDGE_NAME, MacAddress(mac_bin));
+        if (m_netlink.commit())
+        {
+            return true;
+        }
+    }
+
+    const std::string cmds = batched ? joinFailedSteps(m_netlink, steps) : steps[0] + " && " + steps[1];
 
     std::string res;
-    EXEC_WITH_ERROR_THROW(cmds.str(), res);
+    EXEC_WITH_ERROR_THROW(cmds, res);
 
     return true;
 }
@@ -219,11 +320,29 @@ bool VlanMgr::addHostVlanMember(int vlan_id, const string &port_alias, const str
     // /bin/bash -c "/sbin/ip link set {{port_alias}} master Bridge &&
     //               /sbin/bridge vlan del vid 1 dev {{ port_alias }} &&
     //               /sbin/bridge vlan add vid {{vlan_id}} dev {{port_alias}} {{tagging_mode}}"
-    ostringstream cmds, inner;
-    inner << IP_CMD " link set " << shellquote(port_alias) << " master " DOT1Q_BRIDGE_NAME " && "
-      BRIDGE_CMD " vlan del vid " DEFAULT_VLAN_ID " dev " << shellquote(port_alias) << " && "
-      BRIDGE_CMD " vlan add vid " + std::to_string(vlan_id) + " dev " << shellquote(port_alias) << " " + tagging_cmd;
-    cmds << BASH_CMD " -c " << shellquote(inner.str());
+    const std::vector<std::string> steps = {
+        IP_CMD " link set " + shellquote(port_alias) + " master " DOT1Q_BRIDGE_NAME,
+        BRIDGE_CMD " vlan del vid " DEFAULT_VLAN_ID " dev " + shellquote(port_alias),
+        BRIDGE_CMD " vlan add vid " + std::to_string(vlan_id) + " dev " + shellquote(port_alias) + " " + tagging_cmd
+    };
+
+    if (m_netlink.isOpen())
+    {
+        m_netlink.beginBatch();
+        m_netlink.setLinkMaster(port_alias, DOT1Q_BRIDGE_NAME);
+        m_netlink.delBridgeVlan(port_alias, static_cast<uint16_t>(stoi(DEFAULT_VLAN_ID)));
+        m_netlink.addBridgeVlan(port_alias, static_cast<uint16_t>(vlan_id), !tagging_cmd.empty());
+        if (m_netlink.commit())
+        {
+            return true;
+        }
+
+        SWSS_LOG_NOTICE("Failed to add %s to host vlan %d over netlink, retrying the failed steps with shell commands",
+                        port_alias.c_str(), vlan_id);
+    }
+
+    ostringstream cmds;
+    cmds << BASH_CMD " -c " << shellquote(joinFailedSteps(m_netlink, steps));
 
     std::string res;
     try
@@ -245,6 +364,19 @@ bool VlanMgr::removeHostVlanMember(int vlan_id, const string &port_alias)
 {
     SWSS_LOG_ENTER();
 
+    // When port is not member of any VLAN, it shall be detached from Dot1Q bridge
+    bool vlanRemoved = false;
+    if (m_netlink.isOpen())
+    {
+        std::vector<uint16_t> port_vlans;
+        vlanRemoved = m_netlink.delBridgeVlan(port_alias, static_cast<uint16_t>(vlan_id));
+        if (vlanRemoved && m_netlink.getBridgeVlans(port_alias, port_vlans) &&
+            (!port_vlans.empty() || m_netlink.setLinkMaster(port_alias, "")))
+        {
+            return true;
+        }
+    }
+
     // The command should be generated as:
     // /bin/bash -c '/sbin/bridge vlan del vid {{vlan_id}} dev {{port_alias}} &&
     //               ( vlanShow=$(/sbin/bridge vlan show dev {{port_alias}});
@@ -258,8 +390,13 @@ bool VlanMgr::removeHostVlanMember(int vlan_id, const string &port_alias)
     //               else exit $ret; fi )'
 
     // When port is not member of any VLAN, it shall be detached from Dot1Q bridge!
+    // The vlan is not removed again when netlink did it
     ostringstream cmds, inner;
-    inner << BRIDGE_CMD " vlan del vid " + std::to_string(vlan_id) + " dev " << shellquote(port_alias) << " && ( "
+    if (!vlanRemoved)
+    {
+        inner << BRIDGE_CMD " vlan del vid " + std::to_string(vlan_id) + " dev " << shellquote(port_alias) << " && ";
+    }
+    inner << "( "
       "vlanShow=$(" BRIDGE_CMD " vlan show dev " << shellquote(port_alias) << "); "
       "ret=$?; "
       "if [ $ret -eq 0 ]; then "
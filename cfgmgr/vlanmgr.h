@@ -4,6 +4,7 @@
 #include "dbconnector.h"
 #include "producerstatetable.h"
 #include "orch.h"
+#include "netlinkexec.h"
 
 #include <set>
 #include <map>
@@ -18,6 +19,9 @@ public:
         const std::vector<std::string> &stateTableNames);
     using Orch::doTask;
 
+    /* Program the host VLANs over rtnetlink, shell commands remain the fallback */
+    void enableNetlinkExec();
+
 private:
     ProducerStateTable m_appVlanTableProducer, m_appVlanMemberTableProducer;
     ProducerStateTable m_appFdbTableProducer, m_appPortTableProducer;
@@ -29,6 +33,7 @@ private:
     std::set<std::string> m_vlanMemberReplay;
     bool replayDone;
     std::unordered_map<std::string, std::unordered_map<std::string, std::string>> m_PortVlanMember;
+    NetlinkExec m_netlink;
     
     void doTask(Consumer &consumer);
     void doVlanTask(Consumer &consumer);
@@ -63,6 +63,7 @@ int main(int argc, char **argv)
         gMacAddress = MacAddress(it->second);
 
         VlanMgr vlanmgr(&cfgDb, &appDb, &stateDb, cfg_vlan_tables, state_vlan_tables);
+        vlanmgr.enableNetlinkExec();
 
         std::vector<Orch *> cfgOrchList = {&vlanmgr};
 
@@ -263,10 +263,20 @@ void FpmLink::processFpmMessage(fpm_msg_hdr_t* hdr)
         /*
          * EVPN Type5 Add Routes need to be process in Raw mode as they contain
          * RMAC, VLAN and L3VNI information.
-         * Where as all other route will be using rtnl api to extract information
-         * from the netlink msg.
+         * Regular routes are decoded straight from the netlink msg as well,
+         * the rtnl api is only used for the routes the raw decoder leaves out.
          */
-        bool isRaw = isRawProcessing(nl_hdr);
+        if (isRawProcessing(nl_hdr))
+        {
+            /* EVPN Type5 Add route processing */
+            processRawMsg(nl_hdr);
+            continue;
+        }
+
+        if (m_routesync->isRawRouteDecodeEnabled() && m_routesync->onRouteMsgRaw(nl_hdr))
+        {
+            continue;
+        }
 
         nl_msg *msg = nlmsg_convert(nl_hdr);
         if (msg == NULL)
@@ -276,15 +286,7 @@ void FpmLink::processFpmMessage(fpm_msg_hdr_t* hdr)
 
         nlmsg_set_proto(msg, NETLINK_ROUTE);
 
-        if (isRaw)
-        {
-            /* EVPN Type5 Add route processing */
-            processRawMsg(nl_hdr);
-        }
-        else
-        {
-            NetDispatcher::getInstance().onNetlinkMessage(msg);
-        }
+        NetDispatcher::getInstance().onNetlinkMessage(msg);
         nlmsg_free(msg);
     }
 }
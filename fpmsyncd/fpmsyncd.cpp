@@ -1,3 +1,4 @@
+#include <getopt.h>
 #include <iostream>
 #include <inttypes.h>
 #include "logger.h"
@@ -69,10 +70,41 @@ static bool eoiuFlagsSet(Table &bgpStateTable)
     return true;
 }
 
+void usage()
+{
+    cout << "usage: fpmsyncd [-c coalesce_window_ms] [-m coalesce_max_routes] [-h]" << endl;
+    cout << "    -c coalesce_window_ms: coalesce ROUTE_TABLE updates of the same prefix within this window (default 0, disabled)" << endl;
+    cout << "    -m coalesce_max_routes: write the coalesced routes once this many are pending (default " << ROUTE_COALESCE_MAX_SIZE << ")" << endl;
+    cout << "    -h: display this message" << endl;
+}
+
 int main(int argc, char **argv)
 {
     swss::Logger::linkToDbNative("fpmsyncd");
 
+    int opt;
+    int coalesceWindow = 0;
+    size_t coalesceMaxRoutes = ROUTE_COALESCE_MAX_SIZE;
+
+    while ((opt = getopt(argc, argv, "c:m:h")) != -1 )
+    {
+        switch (opt)
+        {
+        case 'c':
+            coalesceWindow = atoi(optarg);
+            break;
+        case 'm':
+            coalesceMaxRoutes = (size_t)strtoul(optarg, NULL, 10);
+            break;
+        case 'h':
+            usage();
+            return 1;
+        default: /* '?' */
+            usage();
+            return EXIT_FAILURE;
+        }
+    }
+
     const auto routeResponseChannelName = std::string("APPL_DB_") + APP_ROUTE_TABLE_NAME + "_RESPONSE_CHANNEL";
 
     DBConnector db("APPL_DB", 0);
@@ -84,6 +116,7 @@ int main(int argc, char **argv)
 
     RedisPipeline pipeline(&db, ROUTE_SYNC_PPL_SIZE);
     RouteSync sync(&pipeline);
+    sync.setRouteCoalesceWindow(coalesceWindow, coalesceMaxRoutes);
 
     DBConnector stateDb("STATE_DB", 0);
     Table bgpStateTable(&stateDb, STATE_BGP_TABLE_NAME);
@@ -125,6 +158,7 @@ int main(int argc, char **argv)
              * Pipeline should be flushed right away to deal with state pending
              * from previous try/catch iterations.
              */
+            sync.flushRoutes();
             pipeline.flush();
 
             cout << "Waiting for fpm-client connection..." << endl;
@@ -308,14 +342,34 @@ int main(int argc, char **argv)
                         sync.onRouteResponse(key, fieldValues);
                     }
                 }
-                else if (!warmStartEnabled || sync.m_warmStartHelper.isReconciled())
+
+                /*
+                 * Whatever woke us up, write the coalesced routes whose window
+                 * expired, so steady traffic on the other selectables does not
+                 * hold them back.
+                 */
+                if (!warmStartEnabled || sync.m_warmStartHelper.isReconciled())
                 {
+                    int coalesceTimeout = sync.flushExpiredRoutes();
+
                     flushPipeline(pipeline);
+
+                    // wake up again when the coalescing window expires
+                    if (coalesceTimeout != INFINITE &&
+                        (gSelectTimeout == INFINITE || coalesceTimeout < gSelectTimeout))
+                    {
+                        gSelectTimeout = coalesceTimeout;
+                    }
                 }
             }
         }
         catch (FpmLink::FpmConnectionClosedException &e)
         {
+            const auto &counters = sync.getRouteCoalesceCounters();
+            SWSS_LOG_NOTICE("Route coalescing: received %" PRIu64 " written %" PRIu64
+                            " coalesced %" PRIu64 " cancelled %" PRIu64,
+                            counters.received, counters.written,
+                            counters.coalesced, counters.cancelled);
             cout << "Connection lost, reconnecting..." << endl;
         }
         catch (const exception& e)
@@ -0,0 +1,196 @@
+#include <inttypes.h>
+#include "logger.h"
+#include "fpmsyncd/routecoalescer.h"
+
+using namespace std;
+using namespace swss;
+
+RouteCoalescer::RouteCoalescer(ProducerStateTable &table) :
+    m_table(table)
+{
+}
+
+void RouteCoalescer::setWindow(int windowMsecs, size_t maxSize)
+{
+    SWSS_LOG_ENTER();
+
+    if (windowMsecs <= 0)
+    {
+        flush();
+        m_deleted.clear();
+    }
+
+    m_windowMsecs = windowMsecs > 0 ? windowMsecs : 0;
+    m_maxSize = maxSize ? maxSize : ROUTE_COALESCE_MAX_SIZE;
+
+    SWSS_LOG_NOTICE("Route coalescing window %d ms, up to %zu routes", m_windowMsecs, m_maxSize);
+}
+
+RouteCoalescer::Entry *RouteCoalescer::getPending(const string &key)
+{
+    auto it = m_pendingIndex.find(key);
+    return it == m_pendingIndex.end() ? nullptr : &*it->second;
+}
+
+void RouteCoalescer::set(const string &key, const vector<FieldValueTuple> &fvs)
+{
+    m_counters.received++;
+
+    if (!isEnabled())
+    {
+        write(Entry{key, false, fvs, false});
+        return;
+    }
+
+    Entry *entry = getPending(key);
+    if (entry)
+    {
+        m_counters.coalesced++;
+        entry->del = false;
+        entry->fvs = fvs;
+        return;
+    }
+
+    if (m_pending.empty())
+    {
+        m_windowStart = chrono::steady_clock::now();
+    }
+
+    m_pending.push_back(Entry{key, false, fvs, m_deleted.count(key) != 0});
+    m_pendingIndex.emplace(key, prev(m_pending.end()));
+
+    if (m_pending.size() >= m_maxSize)
+    {
+        flush();
+    }
+}
+
+void RouteCoalescer::del(const string &key)
+{
+    m_counters.received++;
+
+    if (!isEnabled())
+    {
+        write(Entry{key, true, {}, false});
+        return;
+    }
+
+    auto it = m_pendingIndex.find(key);
+    if (it != m_pendingIndex.end())
+    {
+        auto entry = it->second;
+
+        /* The route was added within the window and never reached APPL_DB */
+        if (entry->absent)
+        {
+            m_counters.cancelled++;
+            m_pending.erase(entry);
+            m_pendingIndex.erase(it);
+            return;
+        }
+
+        m_counters.coalesced++;
+        entry->del = true;
+        entry->fvs.clear();
+        return;
+    }
+
+    if (m_pending.empty())
+    {
+        m_windowStart = chrono::steady_clock::now();
+    }
+
+    m_pending.push_back(Entry{key, true, {}, m_deleted.count(key) != 0});
+    m_pendingIndex.emplace(key, prev(m_pending.end()));
+
+    if (m_pending.size() >= m_maxSize)
+    {
+        flush();
+    }
+}
+
+void RouteCoalescer::flush(const string &key)
+{
+    auto it = m_pendingIndex.find(key);
+    if (it == m_pendingIndex.end())
+    {
+        return;
+    }
+
+    write(*it->second);
+    m_pending.erase(it->second);
+    m_pendingIndex.erase(it);
+}
+
+void RouteCoalescer::flush()
+{
+    if (m_pending.empty())
+    {
+        return;
+    }
+
+    for (const auto &entry : m_pending)
+    {
+        write(entry);
+    }
+
+    m_pending.clear();
+    m_pendingIndex.clear();
+
+    SWSS_LOG_INFO("Route coalescing: received %" PRIu64 " written %" PRIu64
+                  " coalesced %" PRIu64 " cancelled %" PRIu64,
+                  m_counters.received, m_counters.written,
+                  m_counters.coalesced, m_counters.cancelled);
+}
+
+int RouteCoalescer::flushExpired()
+{
+    if (m_pending.empty())
+    {
+        return -1;
+    }
+
+    auto elapsed = chrono::duration_cast<chrono::milliseconds>(
+        chrono::steady_clock::now() - m_windowStart).count();
+
+    if (elapsed >= m_windowMsecs)
+    {
+        flush();
+        return -1;
+    }
+
+    return m_windowMsecs - (int)elapsed;
+}
+
+void RouteCoalescer::write(const Entry &entry)
+{
+    m_counters.written++;
+
+    if (entry.del)
+    {
+        m_table.del(entry.key);
+    }
+    else
+    {
+        m_table.set(entry.key, entry.fvs);
+    }
+
+    if (!isEnabled())
+    {
+        return;
+    }
+
+    if (entry.del)
+    {
+        if (m_deleted.size() >= m_maxSize)
+        {
+            /* Forgetting a deleted key only costs writing a later add/delete pair */
+            m_deleted.clear();
+        }
+        m_deleted.insert(entry.key);
+    }
+    else
+    {
+        m_deleted.erase(entry.key);
+    }
+}
@@ -0,0 +1,106 @@
+#ifndef __ROUTECOALESCER__
+#define __ROUTECOALESCER__
+
+#include <chrono>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "producerstatetable.h"
+
+/* Default bound on the number of routes held by the coalescing window */
+#define ROUTE_COALESCE_MAX_SIZE 10000
+
+namespace swss {
+
+/*
+ * RouteCoalescer buffers the updates written to ROUTE_TABLE for a short
+ * window, so that several updates zebra sends for the same VRF+prefix reach
+ * APPL_DB as a single one.
+ *
+ * Only the latest state of each key is written when the window expires or
+ * the number of pending keys reaches the size bound. A route added and
+ * deleted within the window is dropped altogether when its last state
+ * written to APPL_DB was a delete, as nothing downstream ever saw it.
+ *
+ * A window of 0 disables coalescing: updates are written right away.
+ */
+class RouteCoalescer
+{
+public:
+    struct Counters
+    {
+        uint64_t received = 0;   // updates handed to the coalescer
+        uint64_t written = 0;    // updates written to APPL_DB
+        uint64_t coalesced = 0;  // updates superseded by a later one of the same key
+        uint64_t cancelled = 0;  // add/delete pairs dropped
+    };
+
+    RouteCoalescer(ProducerStateTable &table);
+
+    void setWindow(int windowMsecs, size_t maxSize = ROUTE_COALESCE_MAX_SIZE);
+
+    bool isEnabled() const
+    {
+        return m_windowMsecs > 0;
+    }
+
+    void set(const std::string &key, const std::vector<FieldValueTuple> &fvs);
+
+    void del(const std::string &key);
+
+    /* Write the pending update of a key, before the key is written outside of the coalescer */
+    void flush(const std::string &key);
+
+    /* Write all pending updates */
+    void flush();
+
+    /*
+     * Write all pending updates if the window has expired.
+     * Return the time in ms until the window expires, or -1 if nothing is pending.
+     */
+    int flushExpired();
+
+    size_t getPendingCount() const
+    {
+        return m_pending.size();
+    }
+
+    const Counters &getCounters() const
+    {
+        return m_counters;
+    }
+
+private:
+    struct Entry
+    {
+        std::string key;
+        bool del;
+        std::vector<FieldValueTuple> fvs;
+        /* The key was absent from APPL_DB when the window opened */
+        bool absent;
+    };
+
+    ProducerStateTable &m_table;
+    int m_windowMsecs = 0;
+    size_t m_maxSize = ROUTE_COALESCE_MAX_SIZE;
+
+    /* Pending updates, in the order their key first showed up in the window */
+    std::list<Entry> m_pending;
+    std::unordered_map<std::string, std::list<Entry>::iterator> m_pendingIndex;
+    std::chrono::steady_clock::time_point m_windowStart;
+
+    /* Keys whose last update written was a delete, bounded by m_maxSize */
+    std::unordered_set<std::string> m_deleted;
+
+    Counters m_counters;
+
+    Entry *getPending(const std::string &key);
+    void write(const Entry &entry);
+};
+
+}
+
+#endif
@@ -127,6 +127,29 @@ static decltype(auto) makeUniqueWithDestructor(T* ptr, F func)
     return std::unique_ptr<T, F>(ptr, func);
 }
 
+/*
+ * Format a raw address attribute the way nl_addr2str() does:
+ * the prefix length is only appended if it does not cover the whole address.
+ */
+static bool rawAddr2Str(unsigned char family, struct rtattr *rta, unsigned char prefixlen,
+                        char *buf, size_t size)
+{
+    size_t addr_len = (family == AF_INET) ? IPV4_MAX_BYTE : IPV6_MAX_BYTE;
+
+    if (RTA_PAYLOAD(rta) != addr_len || !inet_ntop(family, RTA_DATA(rta), buf, (socklen_t)size))
+    {
+        return false;
+    }
+
+    if (prefixlen != addr_len * 8)
+    {
+        size_t len = strlen(buf);
+        snprintf(buf + len, size - len, "/%u", prefixlen);
+    }
+
+    return true;
+}
+
 template<typename T>
 static decltype(auto) makeNlAddr(const T& ip)
 {
@@ -772,7 +795,7 @@ void RouteSync::onEvpnRouteMsg(struct nlmsghdr *h, int len)
     {
         if (!warmRestartInProgress)
         {
-            m_routeTable.del(destipprefix);
+            m_routeCoalescer.del(destipprefix);
             return;
         }
         else
@@ -853,7 +876,7 @@ void RouteSync::onEvpnRouteMsg(struct nlmsghdr *h, int len)
 
     if (!warmRestartInProgress)
     {
-        m_routeTable.set(destipprefix, fvVector);
+        m_routeCoalescer.set(destipprefix, fvVector);
         SWSS_LOG_DEBUG("RouteTable set msg: %s vtep:%s vni:%s mac:%s intf:%s protocol:%s",
                        destipprefix, nexthops.c_str(), vni_list.c_str(), mac_list.c_str(), intf_list.c_str(),
                        proto_str.c_str());
@@ -1082,6 +1105,8 @@ void RouteSync::onSrv6SteerRouteMsg(struct nlmsghdr *h, int len)
 
         if (!warmRestartInProgress)
         {
+            /* Route and SID list are written together, outside of the coalescing window */
+            m_routeCoalescer.flush(routeTableKey);
             m_routeTable.del(routeTableKey);
             m_srv6SidListTable.del(srv6SidListTableKey);
             return;
@@ -1128,6 +1153,7 @@ void RouteSync::onSrv6SteerRouteMsg(struct nlmsghdr *h, int len)
         }
         if (!warmRestartInProgress)
         {
+            m_routeCoalescer.flush(routeTableKey);
             m_routeTable.set(routeTableKey, fvVectorRoute);
             SWSS_LOG_DEBUG("RouteTable set msg: %s vpn_sid: %s src_addr:%s",
                         routeTableKey, vpn_sid_str.c_str(),
@@ -1489,7 +1515,7 @@ void RouteSync::onMsg(int nlmsg_type, struct nl_object *obj)
 {
     if (nlmsg_type == RTM_NEWLINK || nlmsg_type == RTM_DELLINK)
     {
-        nl_cache_refill(m_nl_sock, m_link_cache);
+        refillLinkCache();
         return;
     }
 
@@ -1581,27 +1607,10 @@ void RouteSync::onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf)
      * Upon arrival of a delete msg we could either push the change right away,
      * or we could opt to defer it if we are going through a warm-reboot cycle.
      */
-    bool warmRestartInProgress = m_warmStartHelper.inProgress();
-
     if (nlmsg_type == RTM_DELROUTE)
     {
-        if (!warmRestartInProgress)
-        {
-            m_routeTable.del(destipprefix);
-            return;
-        }
-        else
-        {
-            SWSS_LOG_INFO("Warm-Restart mode: Receiving delete msg: %s",
-                          destipprefix);
-
-            vector<FieldValueTuple> fvVector;
-            const KeyOpFieldsValuesTuple kfv = std::make_tuple(destipprefix,
-                                                               DEL_COMMAND,
-                                                               fvVector);
-            m_warmStartHelper.insertRefreshMap(kfv);
-            return;
-        }
+        delRouteEntry(destipprefix);
+        return;
     }
     else if (nlmsg_type != RTM_NEWROUTE)
     {
@@ -1621,7 +1630,7 @@ void RouteSync::onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf)
             vector<FieldValueTuple> fvVector;
             FieldValueTuple fv("blackhole", "true");
             fvVector.push_back(fv);
-            m_routeTable.set(destipprefix, fvVector);
+            m_routeCoalescer.set(destipprefix, fvVector);
             return;
         }
         case RTN_UNICAST:
@@ -1651,6 +1660,183 @@ void RouteSync::onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf)
     getNextHopList(route_obj, gw_list, mpls_list, intf_list);
     string weights = getNextHopWt(route_obj);
 
+    setRouteEntry(destipprefix, rtnl_route_get_protocol(route_obj),
+                  gw_list, intf_list, mpls_list, weights);
+}
+
+/*
+ * Handle regular route (include VRF route) directly from the netlink message,
+ * without converting it to a libnl route object.
+ * @arg h               Netlink message header
+ *
+ * Return false if the message was not handled and has to go through libnl:
+ * routes without RTA_DST, MPLS or encapsulated nexthops and VNET routes.
+ */
+bool RouteSync::onRouteMsgRaw(struct nlmsghdr *h)
+{
+    struct rtmsg *rtm;
+    struct rtattr *tb[RTA_MAX + 1] = {0};
+    int len;
+
+    if (h->nlmsg_type != RTM_NEWROUTE && h->nlmsg_type != RTM_DELROUTE)
+    {
+        return false;
+    }
+
+    len = (int)(h->nlmsg_len - NLMSG_LENGTH(sizeof(struct rtmsg)));
+    if (len < 0)
+    {
+        return false;
+    }
+
+    rtm = (struct rtmsg *)NLMSG_DATA(h);
+    if (rtm->rtm_family != AF_INET && rtm->rtm_family != AF_INET6)
+    {
+        return false;
+    }
+
+    netlink_parse_rtattr(tb, RTA_MAX, RTM_RTA(rtm), len);
+
+    if (!tb[RTA_DST] || tb[RTA_ENCAP] || tb[RTA_ENCAP_TYPE] || tb[RTA_VIA] || tb[RTA_NEWDST])
+    {
+        return false;
+    }
+
+    /* libnl merges a single nexthop given next to RTA_MULTIPATH */
+    if (tb[RTA_MULTIPATH] && (tb[RTA_GATEWAY] || tb[RTA_OIF]))
+    {
+        return false;
+    }
+
+    char dst[MAX_ADDR_SIZE + 1] = {0};
+    if (!rawAddr2Str(rtm->rtm_family, tb[RTA_DST], rtm->rtm_dst_len, dst, sizeof(dst)))
+    {
+        return false;
+    }
+
+    /* Same table resolution as rtnl_route_get_table() */
+    uint32_t table = rtm->rtm_table;
+    if (tb[RTA_TABLE])
+    {
+        table = *(uint32_t *)RTA_DATA(tb[RTA_TABLE]);
+    }
+
+    char destipprefix[IFNAMSIZ + MAX_ADDR_SIZE + 2] = {0};
+
+    if (table)
+    {
+        string vrf;
+        getIfNameCached((int)table, vrf);
+
+        if (vrf.find(VNET_PREFIX) == 0)
+        {
+            return false;
+        }
+
+        if (vrf.compare(0, strlen(VRF_PREFIX), VRF_PREFIX))
+        {
+            if (vrf.compare(0, strlen(MGMT_VRF_PREFIX), MGMT_VRF_PREFIX))
+            {
+                SWSS_LOG_ERROR("Invalid VRF name %s (ifindex %u)", vrf.c_str(), table);
+            }
+            else
+            {
+                SWSS_LOG_INFO("Skip routes for Mgmt VRF name %s (ifindex %u) prefix: %s", vrf.c_str(),
+                        table, dst);
+            }
+            return true;
+        }
+        snprintf(destipprefix, sizeof(destipprefix), "%s:%s", vrf.c_str(), dst);
+    }
+    else
+    {
+        memcpy(destipprefix, dst, strlen(dst));
+    }
+
+    if (h->nlmsg_type == RTM_DELROUTE)
+    {
+        delRouteEntry(destipprefix);
+        return true;
+    }
+
+    string gw_list;
+    string intf_list;
+    string weights;
+    if (rtm->rtm_type == RTN_UNICAST &&
+        !getNextHopListRaw(rtm, tb, gw_list, intf_list, weights))
+    {
+        return false;
+    }
+
+    if (!isSuppressionEnabled())
+    {
+        sendOffloadReply(h);
+    }
+
+    switch (rtm->rtm_type)
+    {
+        case RTN_BLACKHOLE:
+        {
+            vector<FieldValueTuple> fvVector;
+            FieldValueTuple fv("blackhole", "true");
+            fvVector.push_back(fv);
+            m_routeCoalescer.set(destipprefix, fvVector);
+            return true;
+        }
+        case RTN_UNICAST:
+            break;
+
+        case RTN_MULTICAST:
+        case RTN_BROADCAST:
+        case RTN_LOCAL:
+            SWSS_LOG_INFO("BUM routes aren't supported yet (%s)", destipprefix);
+            return true;
+
+        default:
+            return true;
+    }
+
+    setRouteEntry(destipprefix, rtm->rtm_protocol, gw_list, intf_list, "", weights);
+    return true;
+}
+
+/*
+ * Remove a regular route, or defer the removal during warm-restart
+ * @arg destipprefix    Route key
+ */
+void RouteSync::delRouteEntry(const char *destipprefix)
+{
+    if (!m_warmStartHelper.inProgress())
+    {
+        m_routeCoalescer.del(destipprefix);
+        return;
+    }
+
+    SWSS_LOG_INFO("Warm-Restart mode: Receiving delete msg: %s",
+                  destipprefix);
+
+    vector<FieldValueTuple> fvVector;
+    const KeyOpFieldsValuesTuple kfv = std::make_tuple(destipprefix,
+                                                       DEL_COMMAND,
+                                                       fvVector);
+    m_warmStartHelper.insertRefreshMap(kfv);
+}
+
+/*
+ * Publish a regular unicast route, or hold it during warm-restart
+ * @arg destipprefix    Route key
+ * @arg proto_num       Route protocol
+ * @arg gw_list         comma-separated list of NH IP gateways
+ * @arg intf_list       comma-separated list of NH interfaces
+ * @arg mpls_list       comma-separated list of NH MPLS info
+ * @arg weights         comma-separated list of NH weights
+ */
+void RouteSync::setRouteEntry(const char *destipprefix, int proto_num,
+                              const string& gw_list, const string& intf_list,
+                              const string& mpls_list, const string& weights)
+{
+    bool warmRestartInProgress = m_warmStartHelper.inProgress();
+
     vector<string> alsv = tokenize(intf_list, NHG_DELIMITER);
     for (auto alias : alsv)
     {
@@ -1674,7 +1860,7 @@ void RouteSync::onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf)
                     SWSS_LOG_NOTICE("RouteTable del msg for route with only one nh on eth0/docker0: %s %s %s %s",
                             destipprefix, gw_list.c_str(), intf_list.c_str(), mpls_list.c_str());
 
-                    m_routeTable.del(destipprefix);
+                    m_routeCoalescer.del(destipprefix);
                 }
                 else
                 {
@@ -1692,7 +1878,6 @@ void RouteSync::onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf)
         }
     }
 
-    auto proto_num = rtnl_route_get_protocol(route_obj);
     auto proto_str = getProtocolString(proto_num);
 
     vector<FieldValueTuple> fvVector;
@@ -1716,7 +1901,7 @@ void RouteSync::onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf)
 
     if (!warmRestartInProgress)
     {
-        m_routeTable.set(destipprefix, fvVector);
+        m_routeCoalescer.set(destipprefix, fvVector);
         SWSS_LOG_DEBUG("RouteTable set msg: %s %s %s %s", destipprefix,
                        gw_list.c_str(), intf_list.c_str(), mpls_list.c_str());
     }
@@ -1963,7 +2148,7 @@ bool RouteSync::getIfName(int if_index, char *if_name, size_t name_len)
     if (!rtnl_link_i2name(m_link_cache, if_index, if_name, name_len))
     {
         /* Trying to refill cache */
-        nl_cache_refill(m_nl_sock, m_link_cache);
+        refillLinkCache();
         if (!rtnl_link_i2name(m_link_cache, if_index, if_name, name_len))
         {
             return false;
@@ -1973,13 +2158,46 @@ bool RouteSync::getIfName(int if_index, char *if_name, size_t name_len)
     return true;
 }
 
+/*
+ * Get interface name based on interface index, through m_ifNameCache
+ * @arg if_index      Interface index
+ * @arg if_name       String to store interface name
+ *
+ * Return true if we successfully gets the interface/VRF name.
+ */
+bool RouteSync::getIfNameCached(int if_index, string &if_name)
+{
+    auto it = m_ifNameCache.find(if_index);
+    if (it != m_ifNameCache.end())
+    {
+        if_name = it->second;
+        return true;
+    }
+
+    char name[IFNAMSIZ] = {0};
+    if (!getIfName(if_index, name, IFNAMSIZ))
+    {
+        return false;
+    }
+
+    if_name = name;
+    m_ifNameCache.emplace(if_index, if_name);
+    return true;
+}
+
+void RouteSync::refillLinkCache()
+{
+    nl_cache_refill(m_nl_sock, m_link_cache);
+    m_ifNameCache.clear();
+}
+
 rtnl_link* RouteSync::getLinkByName(const char *name)
 {
     auto link = rtnl_link_get_by_name(m_link_cache, name);
     if (link == nullptr)
     {
         /* Trying to refill cache */
-        nl_cache_refill(m_nl_sock ,m_link_cache);
+        refillLinkCache();
         link = rtnl_link_get_by_name(m_link_cache, name);
     }
     return link;
@@ -2199,6 +2417,118 @@ string RouteSync::getNextHopWt(struct rtnl_route *route_obj)
     return result;
 }
 
+/*
+ * getNextHopListRaw() - parses next hop list of a raw netlink route message,
+ *                       producing the same lists as getNextHopList()/getNextHopWt()
+ * @arg rtm           (input) Route message header
+ * @arg tb            (input) Parsed route attributes
+ * @arg gw_list       (output) comma-separated list of NH IP gateways
+ * @arg intf_list     (output) comma-separated list of NH interfaces
+ * @arg weights       (output) comma-separated list of NH weights
+ *
+ * Return false if a next hop needs libnl (MPLS or encapsulation)
+ */
+bool RouteSync::getNextHopListRaw(struct rtmsg *rtm, struct rtattr *tb[], string& gw_list,
+                                  string& intf_list, string& weights)
+{
+    if (!tb[RTA_MULTIPATH])
+    {
+        /* libnl only builds a next hop from RTA_GATEWAY and RTA_OIF, without weight */
+        if (!tb[RTA_GATEWAY] && !tb[RTA_OIF])
+        {
+            return true;
+        }
+
+        int if_index = tb[RTA_OIF] ? *(int *)RTA_DATA(tb[RTA_OIF]) : 0;
+        return appendNextHopRaw(rtm->rtm_family, tb[RTA_GATEWAY], if_index, gw_list, intf_list);
+    }
+
+    int len = (int)RTA_PAYLOAD(tb[RTA_MULTIPATH]);
+    struct rtnexthop *rtnh = (struct rtnexthop *)RTA_DATA(tb[RTA_MULTIPATH]);
+    struct rtattr *subtb[RTA_MAX + 1];
+    bool weighted = true;
+
+    while (RTNH_OK(rtnh, len))
+    {
+        memset(subtb, 0, sizeof(subtb));
+        if (rtnh->rtnh_len > sizeof(*rtnh))
+        {
+            netlink_parse_rtattr(subtb, RTA_MAX, RTNH_DATA(rtnh),
+                                 (int)(rtnh->rtnh_len - sizeof(*rtnh)));
+        }
+
+        if (subtb[RTA_VIA] || subtb[RTA_NEWDST] || subtb[RTA_ENCAP])
+        {
+            return false;
+        }
+
+        if (!gw_list.empty())
+        {
+            gw_list += NHG_DELIMITER;
+            intf_list += NHG_DELIMITER;
+            weights += NHG_DELIMITER;
+        }
+
+        if (!appendNextHopRaw(rtm->rtm_family, subtb[RTA_GATEWAY], rtnh->rtnh_ifindex,
+                              gw_list, intf_list))
+        {
+            return false;
+        }
+
+        /* libnl keeps rtnh_hops as the next hop weight */
+        if (rtnh->rtnh_hops)
+        {
+            weights += to_string(rtnh->rtnh_hops);
+        }
+        else
+        {
+            weighted = false;
+        }
+
+        len -= RTNH_ALIGN(rtnh->rtnh_len);
+        rtnh = RTNH_NEXT(rtnh);
+    }
+
+    if (!weighted)
+    {
+        weights.clear();
+    }
+
+    return true;
+}
+
+bool RouteSync::appendNextHopRaw(unsigned char family, struct rtattr *gateway, int if_index,
+                                 string& gw_list, string& intf_list)
+{
+    if (gateway)
+    {
+        char gw_ip[MAX_ADDR_SIZE + 1] = {0};
+        unsigned char prefixlen = (family == AF_INET) ? IPV4_MAX_BITLEN : IPV6_MAX_BITLEN;
+        if (!rawAddr2Str(family, gateway, prefixlen, gw_ip, sizeof(gw_ip)))
+        {
+            return false;
+        }
+        gw_list += gw_ip;
+    }
+    else
+    {
+        gw_list += (family == AF_INET6) ? "::" : "0.0.0.0";
+    }
+
+    string if_name;
+    if (getIfNameCached(if_index, if_name))
+    {
+        intf_list += if_name;
+    }
+    /* If we cannot get the interface name */
+    else
+    {
+        intf_list += "unknown";
+    }
+
+    return true;
+}
+
 bool RouteSync::sendOffloadReply(struct nlmsghdr* hdr)
 {
     SWSS_LOG_ENTER();
@@ -2386,6 +2716,9 @@ void RouteSync::markRoutesOffloaded(swss::DBConnector& db)
 {
     SWSS_LOG_ENTER();
 
+    /* Routes held by the coalescing window have not been offloaded either */
+    m_routeCoalescer.flush();
+
     sendOffloadReply(db, APP_ROUTE_TABLE_NAME);
 }
 
@@ -2400,6 +2733,7 @@ void RouteSync::onWarmStartEnd(DBConnector& applStateDb)
 
     if (m_warmStartHelper.inProgress())
     {
+        m_routeCoalescer.flush();
         m_warmStartHelper.reconcile();
         SWSS_LOG_NOTICE("Warm-Restart reconciliation processed.");
     }
@@ -6,6 +6,7 @@
 #include "netmsg.h"
 #include "linkcache.h"
 #include "fpminterface.h"
+#include "routecoalescer.h"
 #include "warmRestartHelper.h"
 #include <string.h>
 #include <bits/stdc++.h>
@@ -40,6 +41,19 @@ public:
 
     virtual void onMsgRaw(struct nlmsghdr *obj);
 
+    /* Handle regular route without libnl, returns false if libnl is needed */
+    bool onRouteMsgRaw(struct nlmsghdr *h);
+
+    void setRawRouteDecodeEnabled(bool enabled)
+    {
+        m_isRawRouteDecodeEnabled = enabled;
+    }
+
+    bool isRawRouteDecodeEnabled() const
+    {
+        return m_isRawRouteDecodeEnabled;
+    }
+
     void setSuppressionEnabled(bool enabled);
 
     bool isSuppressionEnabled() const
@@ -47,6 +61,29 @@ public:
         return m_isSuppressionEnabled;
     }
 
+    /* Coalesce ROUTE_TABLE updates for windowMsecs, 0 disables coalescing */
+    void setRouteCoalesceWindow(int windowMsecs, size_t maxSize = ROUTE_COALESCE_MAX_SIZE)
+    {
+        m_routeCoalescer.setWindow(windowMsecs, maxSize);
+    }
+
+    /* Write the coalesced routes if the window expired, returns the ms left or -1 */
+    int flushExpiredRoutes()
+    {
+        return m_routeCoalescer.flushExpired();
+    }
+
+    /* Write all coalesced routes */
+    void flushRoutes()
+    {
+        m_routeCoalescer.flush();
+    }
+
+    const RouteCoalescer::Counters& getRouteCoalesceCounters() const
+    {
+        return m_routeCoalescer.getCounters();
+    }
+
     void onRouteResponse(const std::string& key, const std::vector<FieldValueTuple>& fieldValues);
 
     void onWarmStartEnd(swss::DBConnector& applStateDb);
@@ -69,6 +106,8 @@ public:
 private:
     /* regular route table */
     ProducerStateTable  m_routeTable;
+    /* ROUTE_TABLE updates of regular and EVPN routes go through the coalescer */
+    RouteCoalescer      m_routeCoalescer{m_routeTable};
     /* label route table */
     ProducerStateTable  m_label_routeTable;
     /* vnet route table */
@@ -83,11 +122,22 @@ private:
     struct nl_sock     *m_nl_sock;
 
     bool                m_isSuppressionEnabled{false};
+    bool                m_isRawRouteDecodeEnabled{true};
+    /* Interface names by index, flushed whenever m_link_cache is refilled */
+    std::unordered_map<int, std::string> m_ifNameCache;
     FpmInterface*       m_fpmInterface {nullptr};
 
     /* Handle regular route (include VRF route) */
     void onRouteMsg(int nlmsg_type, struct nl_object *obj, char *vrf);
 
+    /* Remove regular route, deferred during warm-restart */
+    void delRouteEntry(const char *destipprefix);
+
+    /* Publish regular route, deferred during warm-restart */
+    void setRouteEntry(const char *destipprefix, int proto_num,
+                       const string& gw_list, const string& intf_list,
+                       const string& mpls_list, const string& weights);
+
     /* Handle label route */
     void onLabelRouteMsg(int nlmsg_type, struct nl_object *obj);
 
@@ -125,6 +175,12 @@ private:
     /* Get interface name based on interface index */
     bool getIfName(int if_index, char *if_name, size_t name_len);
 
+    /* Get interface name based on interface index, through m_ifNameCache */
+    bool getIfNameCached(int if_index, string &if_name);
+
+    /* Refill m_link_cache and flush m_ifNameCache */
+    void refillLinkCache();
+
     /* Get interface if_index based on interface name */
     rtnl_link* getLinkByName(const char *name);
 
@@ -147,6 +203,13 @@ private:
     void getNextHopList(struct rtnl_route *route_obj, string& gw_list,
                         string& mpls_list, string& intf_list);
 
+    /* Get next hop lists from a raw route message */
+    bool getNextHopListRaw(struct rtmsg *rtm, struct rtattr *tb[], string& gw_list,
+                           string& intf_list, string& weights);
+
+    bool appendNextHopRaw(unsigned char family, struct rtattr *gateway, int if_index,
+                          string& gw_list, string& intf_list);
+
     /* Get next hop gateway IP addresses */
     string getNextHopGw(struct rtnl_route *route_obj);
 
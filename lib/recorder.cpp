@@ -2,6 +2,8 @@
 #include "timestamp.h"
 #include "logger.h"
 #include <cstring>
+#include <chrono>
+#include <time.h>
 
 using namespace swss;
 
@@ -19,6 +21,13 @@ Recorder& Recorder::Instance()
 }
 
 
+void Recorder::flush()
+{
+    swss.flush();
+    respub.flush();
+}
+
+
 SwSSRec::SwSSRec() 
 {
     /* Set Default values */
@@ -71,15 +80,23 @@ void RecWriter::startRec(bool exit_if_failure)
         else
         {
             setRecord(false);
+            return ;
         }
     }
     record_ofs << swss::getTimestamp() << Recorder::REC_START << std::endl;
+
+    if (!m_thread)
+    {
+        m_thread = std::unique_ptr<std::thread>(new std::thread(&RecWriter::writerThread, this));
+    }
     SWSS_LOG_NOTICE("%s Recorder: Recording started at %s", getName().c_str(), fname.c_str());
 }
 
 
 RecWriter::~RecWriter()
 {
+    stopRec();
+
     if (record_ofs.is_open())
     {
         record_ofs.close();      
@@ -87,18 +104,134 @@ RecWriter::~RecWriter()
 }
 
 
+void RecWriter::stopRec()
+{
+    if (!m_thread)
+    {
+        return ;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_wakeup.notify_one();
+    m_thread->join();
+    m_thread.reset();
+}
+
+
 void RecWriter::record(const std::string& val)
 {
     if (!isRecord())
     {
         return ;
     }
-    if (isRotate())
+
+    if (!m_thread)
+    {
+        if (!m_notStartedLogged)
+        {
+            SWSS_LOG_ERROR("%s Recorder: Recording is enabled but not started, records are dropped", getName().c_str());
+            m_notStartedLogged = true;
+        }
+        return ;
+    }
+
+    Entry entry;
+    gettimeofday(&entry.tv, NULL);
+    entry.val = val;
+
+    bool wakeup;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_queue.push_back(std::move(entry));
+        m_queuedCount++;
+        wakeup = m_queue.size() >= RECORD_BATCH_SIZE;
+    }
+
+    /* Otherwise the writer picks the records up on its flush interval */
+    if (wakeup)
     {
-        setRotate(false);
-        logfileReopen();
+        m_wakeup.notify_one();
+    }
+}
+
+
+void RecWriter::flush()
+{
+    if (!m_thread)
+    {
+        return ;
+    }
+
+    std::unique_lock<std::mutex> lock(m_mutex);
+    uint64_t target = m_queuedCount;
+    m_flushRequested = true;
+    m_wakeup.notify_one();
+    m_written.wait(lock, [&]() { return m_writtenCount >= target; });
+}
+
+
+void RecWriter::writerThread()
+{
+    std::vector<Entry> batch;
+    std::unique_lock<std::mutex> lock(m_mutex);
+
+    while (true)
+    {
+        m_wakeup.wait_for(lock, std::chrono::milliseconds(RECORD_FLUSH_INTERVAL_MSECS), [&]()
+        {
+            return m_stop || m_flushRequested || m_queue.size() >= RECORD_BATCH_SIZE;
+        });
+
+        /* Swap the buffers so the callers keep queueing while the batch is written */
+        batch.swap(m_queue);
+        m_flushRequested = false;
+        bool stop = m_stop;
+        lock.unlock();
+
+        if (isRotate())
+        {
+            setRotate(false);
+            logfileReopen();
+        }
+
+        writeEntries(batch);
+        uint64_t count = batch.size();
+        batch.clear();
+
+        lock.lock();
+        m_writtenCount += count;
+        m_written.notify_all();
+
+        if (stop && m_queue.empty())
+        {
+            break;
+        }
+    }
+}
+
+
+void RecWriter::writeEntries(const std::vector<Entry>& entries)
+{
+    if (entries.empty())
+    {
+        return ;
+    }
+
+    char timestamp[64];
+    for (const auto& entry : entries)
+    {
+        /* Same format as swss::getTimestamp() */
+        struct tm tm;
+        localtime_r(&entry.tv.tv_sec, &tm);
+        size_t size = strftime(timestamp, 32, "%Y-%m-%d.%T.", &tm);
+        snprintf(&timestamp[size], 32, "%06ld", (long)entry.tv.tv_usec);
+
+        record_ofs << timestamp << "|" << entry.val << "\n";
     }
-    record_ofs << swss::getTimestamp() << "|" << val << std::endl;
+    record_ofs.flush();
 }
 
 
@@ -5,6 +5,18 @@
 #include <iostream>
 #include <sstream>
 #include <memory>
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include <sys/time.h>
+
+/* Number of queued records which wakes up the writer thread */
+#define RECORD_BATCH_SIZE 1024
+/* Maximum delay before queued records are written to the file */
+#define RECORD_FLUSH_INTERVAL_MSECS 100
 
 namespace swss {
 
@@ -27,12 +39,18 @@ public:
 
 private:
     bool m_recording;
-    bool m_rotate;
+    /* Set from the SIGHUP handler, handled by the writer thread */
+    std::atomic<bool> m_rotate;
     std::string m_location;
     std::string m_filename;
     std::string m_name;
 };
 
+/*
+ * RecWriter queues the records and writes them from a dedicated thread,
+ * in batches followed by a single flush, so that recording does not cost
+ * the caller a write syscall per record.
+ */
 class RecWriter : public RecBase {
 public:
     RecWriter() = default;
@@ -40,12 +58,50 @@ public:
     void startRec(bool exit_if_failure);
     void record(const std::string& val);
 
+    /*
+     * Record the string returned by format(), which is only called when
+     * recording is enabled, e.g. record([&]() { return dump(entry); })
+     */
+    template <typename Formatter, typename = decltype(std::declval<Formatter>()())>
+    void record(Formatter&& format)
+    {
+        if (!isRecord())
+        {
+            return ;
+        }
+        record(format());
+    }
+
+    /* Block until all queued records are written to the file */
+    void flush();
+
 protected:
     void logfileReopen();
 
 private:
+    struct Entry
+    {
+        struct timeval tv;
+        std::string val;
+    };
+
+    void writerThread();
+    void writeEntries(const std::vector<Entry>& entries);
+    void stopRec();
+
     std::ofstream record_ofs;
     std::string fname;
+
+    std::mutex m_mutex;
+    std::condition_variable m_wakeup;
+    std::condition_variable m_written;
+    std::vector<Entry> m_queue;
+    uint64_t m_queuedCount = 0;
+    uint64_t m_writtenCount = 0;
+    bool m_flushRequested = false;
+    bool m_stop = false;
+    bool m_notStartedLogged = false;
+    std::unique_ptr<std::thread> m_thread;
 };
 
 class SwSSRec : public RecWriter {
@@ -75,6 +131,10 @@ public:
     static const std::string RESPPUB_FNAME;
 
     Recorder() = default;
+
+    /* Write out the queued records, e.g. before aborting */
+    void flush();
+
     /* Individual Handlers */
     SwSSRec swss;
     SaiRedisRec sairedis;
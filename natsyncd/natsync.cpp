@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <deque>
 #include <string>
 #include <netinet/in.h>
 #include <netlink/netfilter/ct.h>
@@ -38,15 +39,15 @@ using namespace swss;
 #define CT_UDP_EXPIRY_TIMEOUT   600 /* Max conntrack timeout in the user configurable range */
 
 NatSync::NatSync(RedisPipeline *pipelineAppDB, DBConnector *appDb, DBConnector *stateDb, NfNetlink *nfnl) :
-    m_natTable(appDb, APP_NAT_TABLE_NAME),
-    m_naptTable(appDb, APP_NAPT_TABLE_NAME),
-    m_natTwiceTable(appDb, APP_NAT_TWICE_TABLE_NAME),
-    m_naptTwiceTable(appDb, APP_NAPT_TWICE_TABLE_NAME),
-    m_natCheckTable(appDb, APP_NAT_TABLE_NAME),
-    m_naptCheckTable(appDb, APP_NAPT_TABLE_NAME),
-    m_twiceNatCheckTable(appDb, APP_NAT_TWICE_TABLE_NAME),
-    m_twiceNaptCheckTable(appDb, APP_NAPT_TWICE_TABLE_NAME),
-    m_naptPoolCheckTable(appDb, APP_NAPT_POOL_IP_TABLE_NAME),
+    m_natTable(pipelineAppDB, APP_NAT_TABLE_NAME, true),
+    m_naptTable(pipelineAppDB, APP_NAPT_TABLE_NAME, true),
+    m_natTwiceTable(pipelineAppDB, APP_NAT_TWICE_TABLE_NAME, true),
+    m_naptTwiceTable(pipelineAppDB, APP_NAPT_TWICE_TABLE_NAME, true),
+    m_natCache(appDb, APP_NAT_TABLE_NAME),
+    m_naptCache(appDb, APP_NAPT_TABLE_NAME),
+    m_naptPoolCache(appDb, APP_NAPT_POOL_IP_TABLE_NAME),
+    m_twiceNatCache(appDb, APP_NAT_TWICE_TABLE_NAME),
+    m_twiceNaptCache(appDb, APP_NAPT_TWICE_TABLE_NAME),
     m_stateNatRestoreTable(stateDb, STATE_NAT_RESTORE_TABLE_NAME)
 {
     nfsock = nfnl;
@@ -61,6 +62,12 @@ NatSync::NatSync(RedisPipeline *pipelineAppDB, DBConnector *appDb, DBConnector *
     }
 
     setTimeoutNotifier = std::make_shared<swss::NotificationProducer>(appDb, "SETTIMEOUTNAT");
+
+    /* Subscriber tables start with the current table content */
+    for (auto cache : { &m_natCache, &m_naptCache, &m_naptPoolCache, &m_twiceNatCache, &m_twiceNaptCache })
+    {
+        cache->process();
+    }
 }
 
 NatSync::~NatSync()
@@ -71,6 +78,74 @@ NatSync::~NatSync()
     }
 }
 
+NatTableCache::NatTableCache(DBConnector *db, const std::string &tableName) :
+    m_subscriber(db, tableName)
+{
+}
+
+void NatTableCache::process()
+{
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    m_subscriber.pops(entries);
+
+    for (const auto &entry : entries)
+    {
+        const auto &key = kfvKey(entry);
+
+        auto written = m_written.find(key);
+        if (written != m_written.end())
+        {
+            if (written->second != (kfvOp(entry) == SET_COMMAND))
+            {
+                /* Echo of an update preceding the last write of natsyncd */
+                continue;
+            }
+            m_written.erase(written);
+        }
+
+        if (kfvOp(entry) != SET_COMMAND)
+        {
+            m_entries.erase(key);
+            continue;
+        }
+
+        bool isStatic = false;
+        for (const auto &fv : kfvFieldsValues(entry))
+        {
+            if ((fvField(fv) == "entry_type") && (fvValue(fv) == "static"))
+            {
+                isStatic = true;
+            }
+        }
+        m_entries[key] = isStatic;
+    }
+}
+
+bool NatTableCache::isStatic(const std::string &key) const
+{
+    auto it = m_entries.find(key);
+    return (it != m_entries.end()) && it->second;
+}
+
+std::vector<Selectable *> NatSync::getNatTableSubscribers()
+{
+    return { m_natCache.getSubscriber(), m_naptCache.getSubscriber(), m_naptPoolCache.getSubscriber(),
+             m_twiceNatCache.getSubscriber(), m_twiceNaptCache.getSubscriber() };
+}
+
+bool NatSync::processNatTable(Selectable *subscriber)
+{
+    for (auto cache : { &m_natCache, &m_naptCache, &m_naptPoolCache, &m_twiceNatCache, &m_twiceNaptCache })
+    {
+        if (subscriber == cache->getSubscriber())
+        {
+            cache->process();
+            return true;
+        }
+    }
+    return false;
+}
+
 /* To check the port init is done or not */
 bool NatSync::isPortInitDone(DBConnector *app_db)
 {
@@ -302,9 +377,8 @@ void NatSync::onMsg(int nlmsg_type, struct nl_object *obj)
 bool NatSync::matchingSnaptPoolExists(const IpAddress &natIp)
 {
     string key             = natIp.to_string();
-    std::vector<FieldValueTuple> values;
 
-    if (m_naptPoolCheckTable.get(key, values))
+    if (m_naptPoolCache.exists(key))
     {
         SWSS_LOG_INFO("Matching pool IP exists for NAT IP %s", key.c_str());
         return true;
@@ -317,9 +391,8 @@ bool NatSync::matchingSnaptEntryExists(const naptEntry &entry)
 {
     string key             = entry.orig_src_ip.to_string() + ":" + to_string(entry.orig_src_l4_port);
     string reverseEntryKey = entry.nat_src_ip.to_string() + ":" + to_string(entry.nat_src_l4_port);
-    std::vector<FieldValueTuple> values;
 
-    if (m_naptCheckTable.get(key, values) || m_naptCheckTable.get(reverseEntryKey, values))
+    if (m_naptCache.exists(key) || m_naptCache.exists(reverseEntryKey))
     {
         SWSS_LOG_INFO("Matching SNAPT entry exists for key %s or reverse key %s",
                        key.c_str(), reverseEntryKey.c_str());
@@ -332,9 +405,8 @@ bool NatSync::matchingDnaptEntryExists(const naptEntry &entry)
 {
     string key             = entry.orig_dest_ip.to_string() + ":" + to_string(entry.orig_dst_l4_port);
     string reverseEntryKey = entry.nat_dest_ip.to_string() + ":" + to_string(entry.nat_dst_l4_port);
-    std::vector<FieldValueTuple> values;
 
-    if (m_naptCheckTable.get(key, values) || m_naptCheckTable.get(reverseEntryKey, values))
+    if (m_naptCache.exists(key) || m_naptCache.exists(reverseEntryKey))
     {
         SWSS_LOG_INFO("Matching DNAPT entry exists for key %s or reverse key %s",
                        key.c_str(), reverseEntryKey.c_str());
@@ -400,25 +472,21 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
         string tmpKey             = key + entry.orig_src_ip.to_string() + ":" + entry.orig_dest_ip.to_string();
         string tmpReverseEntryKey = reverseEntryKey + entry.nat_dest_ip.to_string() + ":" + entry.nat_src_ip.to_string();
 
-        std::vector<FieldValueTuple> values;
-        if (m_twiceNatCheckTable.get(tmpKey, values))
+        if (m_twiceNatCache.exists(tmpKey))
         {
             src_port_natted = dst_port_natted = false;
 
-            for (auto iter : values)
+            /* If a matching Static Twice NAT entry exists in the APP_DB,
+             * it has higher priority than the dynamic twice nat entry. */
+            if (m_twiceNatCache.isStatic(tmpKey))
             {
-                /* If a matching Static Twice NAT entry exists in the APP_DB,
-                 * it has higher priority than the dynamic twice nat entry. */
-                if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
+                SWSS_LOG_INFO("Static Twice NAT %s: entry exists, not processing twice NAT entry notification", opStr.c_str());
+                if (m_AppRestartAssist->isWarmStartInProgress())
                 {
-                    SWSS_LOG_INFO("Static Twice NAT %s: entry exists, not processing twice NAT entry notification", opStr.c_str());
-                    if (m_AppRestartAssist->isWarmStartInProgress())
-                    {
-                       m_AppRestartAssist->insertToMap(APP_NAT_TWICE_TABLE_NAME, tmpKey, fvVector, (!addFlag));
-                       m_AppRestartAssist->insertToMap(APP_NAT_TWICE_TABLE_NAME, tmpReverseEntryKey, reverseFvVector, (!addFlag));
-                    }
-                    return 1;
+                   m_AppRestartAssist->insertToMap(APP_NAT_TWICE_TABLE_NAME, tmpKey, fvVector, (!addFlag));
+                   m_AppRestartAssist->insertToMap(APP_NAT_TWICE_TABLE_NAME, tmpReverseEntryKey, reverseFvVector, (!addFlag));
                 }
+                return 1;
             }
             if (addFlag)
             {
@@ -446,23 +514,19 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
             reverseEntryKey += ":" + nat_dst_l4_port + ":" + entry.nat_src_ip.to_string()
                           + ":" + nat_src_l4_port;
 
-            std::vector<FieldValueTuple> values;
             /* If a matching Static Twice NAPT entry exists in the APP_DB,
              * it has higher priority than the dynamic twice napt entry. */
-            if (m_twiceNaptCheckTable.get(key, values))
+            if (m_twiceNaptCache.exists(key))
             {
-                for (auto iter : values)
+                if (m_twiceNaptCache.isStatic(key))
                 {
-                    if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
+                    SWSS_LOG_INFO("Static Twice NAPT %s: entry exists, not processing dynamic twice NAPT entry", opStr.c_str());
+                    if (m_AppRestartAssist->isWarmStartInProgress())
                     {
-                        SWSS_LOG_INFO("Static Twice NAPT %s: entry exists, not processing dynamic twice NAPT entry", opStr.c_str());
-                        if (m_AppRestartAssist->isWarmStartInProgress())
-                        {
-                            m_AppRestartAssist->insertToMap(APP_NAPT_TWICE_TABLE_NAME, key, fvVector, (!addFlag));
-                            m_AppRestartAssist->insertToMap(APP_NAPT_TWICE_TABLE_NAME, reverseEntryKey, reverseFvVector, (!addFlag));
-                        }
-                        return 1;
+                        m_AppRestartAssist->insertToMap(APP_NAPT_TWICE_TABLE_NAME, key, fvVector, (!addFlag));
+                        m_AppRestartAssist->insertToMap(APP_NAPT_TWICE_TABLE_NAME, reverseEntryKey, reverseFvVector, (!addFlag));
                     }
+                    return 1;
                 }
                 if (addFlag)
                 {
@@ -491,9 +555,11 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                 else
                 {
                     m_naptTwiceTable.set(key, fvVector);
+                    m_twiceNaptCache.setDynamic(key);
                     SWSS_LOG_NOTICE("Twice NAPT entry with key %s added to APP_DB", key.c_str());
                     setTimeoutNotifier->send("SET-TWICE-NAPT", key, fvVector);
                     m_naptTwiceTable.set(reverseEntryKey, reverseFvVector);
+                    m_twiceNaptCache.setDynamic(reverseEntryKey);
                     SWSS_LOG_NOTICE("Twice NAPT entry with reverse key %s added to APP_DB", reverseEntryKey.c_str());
                 }
             }
@@ -507,8 +573,10 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                 else
                 {
                     m_naptTwiceTable.del(key);
+                    m_twiceNaptCache.remove(key);
                     SWSS_LOG_NOTICE("Twice NAPT entry with key %s deleted from APP_DB", key.c_str());
                     m_naptTwiceTable.del(reverseEntryKey);
+                    m_twiceNaptCache.remove(reverseEntryKey);
                     SWSS_LOG_NOTICE("Twice NAPT entry with reverse key %s deleted from APP_DB", reverseEntryKey.c_str());
                 }
             }
@@ -532,9 +600,11 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                 else
                 {
                     m_natTwiceTable.set(key, fvVector);
+                    m_twiceNatCache.setDynamic(key);
                     SWSS_LOG_NOTICE("Twice NAT entry with key %s added to APP_DB", key.c_str());
                     setTimeoutNotifier->send("SET-TWICE-NAT", key, fvVector);
                     m_natTwiceTable.set(reverseEntryKey, reverseFvVector);
+                    m_twiceNatCache.setDynamic(reverseEntryKey);
                     SWSS_LOG_NOTICE("Twice NAT entry with reverse key %s added to APP_DB", reverseEntryKey.c_str());
                 }
             }
@@ -548,8 +618,10 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                 else
                 {
                     m_natTwiceTable.del(key);
+                    m_twiceNatCache.remove(key);
                     SWSS_LOG_NOTICE("Twice NAT entry with key %s deleted from APP_DB", key.c_str());
                     m_natTwiceTable.del(reverseEntryKey);
+                    m_twiceNatCache.remove(reverseEntryKey);
                     SWSS_LOG_NOTICE("Twice NAT entry with reverse key %s deleted from APP_DB", reverseEntryKey.c_str());
                 }
             }
@@ -587,23 +659,19 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                 key             += ":" + src_l4_port;
                 reverseEntryKey += ":" + nat_src_l4_port;
 
-                std::vector<FieldValueTuple> values;
                 /* We check for existence of reverse nat entry in the app-db because the same dnat static entry
                  * would be reported as snat entry from the kernel if a packet that is forwarded in the kernel
                  * is matched by the iptables rules corresponding to the dnat static entry */
                 if (! m_AppRestartAssist->isWarmStartInProgress())
                 {
-                    if ((entryExists = m_naptCheckTable.get(key, values)))
+                    if ((entryExists = m_naptCache.exists(key)))
                     {
-                        for (auto iter : values)
+                        if (m_naptCache.isStatic(key))
                         {
-                            if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
-                            {
-                                /* If a matching Static NAPT entry exists in the APP_DB,
-                                 * it has higher priority than the dynamic napt entry. */
-                                SWSS_LOG_INFO("SNAPT %s: static entry exists, not processing the NAPT notification", opStr.c_str());
-                                return 1;
-                            }
+                            /* If a matching Static NAPT entry exists in the APP_DB,
+                             * it has higher priority than the dynamic napt entry. */
+                            SWSS_LOG_INFO("SNAPT %s: static entry exists, not processing the NAPT notification", opStr.c_str());
+                            return 1;
                         }
                         if (addFlag)
                         {
@@ -622,21 +690,19 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                             else
                             {
                                 m_naptTable.del(key);
+                                m_naptCache.remove(key);
                                 SWSS_LOG_NOTICE("SNAPT entry with key %s deleted from APP_DB", key.c_str());
                             }
                         }
                     }
-                    if ((reverseEntryExists = m_naptCheckTable.get(reverseEntryKey, values)))
+                    if ((reverseEntryExists = m_naptCache.exists(reverseEntryKey)))
                     {
-                        for (auto iter : values)
+                        if (m_naptCache.isStatic(reverseEntryKey))
                         {
-                            if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
-                            {
-                                /* If a matching Static NAPT entry exists in the APP_DB,
-                                 * it has higher priority than the dynamic napt entry. */
-                                SWSS_LOG_INFO("SNAPT %s: static reverse entry exists, not processing dynamic NAPT entry", opStr.c_str());
-                                return 1;
-                            }
+                            /* If a matching Static NAPT entry exists in the APP_DB,
+                             * it has higher priority than the dynamic napt entry. */
+                            SWSS_LOG_INFO("SNAPT %s: static reverse entry exists, not processing dynamic NAPT entry", opStr.c_str());
+                            return 1;
                         }
                         if (addFlag)
                         {
@@ -655,6 +721,7 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                             else
                             {
                                 m_naptTable.del(reverseEntryKey);
+                                m_naptCache.remove(reverseEntryKey);
                                 SWSS_LOG_NOTICE("Implicit DNAPT entry with key %s deleted from APP_DB", reverseEntryKey.c_str());
                             }
                         }
@@ -685,9 +752,11 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                         else
                         {
                             m_naptTable.set(key, fvVector);
+                            m_naptCache.setDynamic(key);
                             SWSS_LOG_NOTICE("SNAPT entry with key %s added to APP_DB", key.c_str());
                             setTimeoutNotifier->send("SET-SINGLE-NAPT", key, fvVector);
                             m_naptTable.set(reverseEntryKey, reverseFvVector);
+                            m_naptCache.setDynamic(reverseEntryKey);
                             SWSS_LOG_NOTICE("Implicit DNAPT entry with key %s added to APP_DB", reverseEntryKey.c_str());
                         }
                     }
@@ -701,20 +770,16 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                 key             += entry.orig_src_ip.to_string();
                 reverseEntryKey += entry.nat_src_ip.to_string();
 
-                std::vector<FieldValueTuple> values;
                 if (! m_AppRestartAssist->isWarmStartInProgress())
                 {
-                    if ((entryExists = m_natCheckTable.get(key, values)))
+                    if ((entryExists = m_natCache.exists(key)))
                     {
-                        for (auto iter : values)
+                        if (m_natCache.isStatic(key))
                         {
-                            if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
-                            {
-                                /* If a matching Static NAT entry exists in the APP_DB,
-                                 * it has higher priority than the dynamic napt entry. */
-                                SWSS_LOG_INFO("SNAT %s: static entry exists, not processing the NAT notification", opStr.c_str());
-                                return 1;
-                            }
+                            /* If a matching Static NAT entry exists in the APP_DB,
+                             * it has higher priority than the dynamic napt entry. */
+                            SWSS_LOG_INFO("SNAT %s: static entry exists, not processing the NAT notification", opStr.c_str());
+                            return 1;
                         }
                         if (addFlag)
                         {
@@ -733,21 +798,19 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                             else
                             {
                                 m_natTable.del(key);
+                                m_natCache.remove(key);
                                 SWSS_LOG_NOTICE("SNAT entry with key %s deleted from APP_DB", key.c_str());
                             }
                         }
                     }
-                    if ((reverseEntryExists = m_natCheckTable.get(reverseEntryKey, values)))
+                    if ((reverseEntryExists = m_natCache.exists(reverseEntryKey)))
                     {
-                        for (auto iter : values)
+                        if (m_natCache.isStatic(reverseEntryKey))
                         {
-                            if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
-                            {
-                                /* If a matching Static NAT entry exists in the APP_DB,
-                                 * it has higher priority than the dynamic napt entry. */
-                                SWSS_LOG_INFO("SNAT %s: static reverse entry exists, not adding dynamic NAT entry", opStr.c_str());
-                                return 1;
-                            }
+                            /* If a matching Static NAT entry exists in the APP_DB,
+                             * it has higher priority than the dynamic napt entry. */
+                            SWSS_LOG_INFO("SNAT %s: static reverse entry exists, not adding dynamic NAT entry", opStr.c_str());
+                            return 1;
                         }
                         if (addFlag)
                         {
@@ -766,6 +829,7 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                             else
                             {
                                 m_natTable.del(reverseEntryKey);
+                                m_natCache.remove(reverseEntryKey);
                                 SWSS_LOG_NOTICE("Implicit DNAT entry with key %s deleted from APP_DB", reverseEntryKey.c_str());
                             }
                         }
@@ -790,9 +854,11 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                         else
                         {
                             m_natTable.set(key, fvVector);
+                            m_natCache.setDynamic(key);
                             SWSS_LOG_NOTICE("SNAT entry with key %s added to APP_DB", key.c_str());
                             setTimeoutNotifier->send("SET-SINGLE-NAT", key, fvVector);
                             m_natTable.set(reverseEntryKey, reverseFvVector);
+                            m_natCache.setDynamic(reverseEntryKey);
                             SWSS_LOG_NOTICE("Implicit DNAT entry with key %s added to APP_DB", reverseEntryKey.c_str());
                         }
                     }
@@ -829,20 +895,16 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                 key             += ":" + dst_l4_port;
                 reverseEntryKey += ":" + nat_dst_l4_port;
 
-                std::vector<FieldValueTuple> values;
                 if (! m_AppRestartAssist->isWarmStartInProgress())
                 {
-                    if ((entryExists = m_naptCheckTable.get(key, values)))
+                    if ((entryExists = m_naptCache.exists(key)))
                     {
-                        for (auto iter : values)
+                        if (m_naptCache.isStatic(key))
                         {
-                            if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
-                            {
-                                /* If a matching Static NAPT entry exists in the APP_DB,
-                                 * it has higher priority than the dynamic napt entry. */
-                                SWSS_LOG_INFO("DNAPT %s: static entry exists, not processing the NAPT notification", opStr.c_str());
-                                return 1;
-                            }
+                            /* If a matching Static NAPT entry exists in the APP_DB,
+                             * it has higher priority than the dynamic napt entry. */
+                            SWSS_LOG_INFO("DNAPT %s: static entry exists, not processing the NAPT notification", opStr.c_str());
+                            return 1;
                         }
                         if (addFlag)
                         {
@@ -852,20 +914,18 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                         else
                         {
                             m_naptTable.del(key);
+                            m_naptCache.remove(key);
                             SWSS_LOG_NOTICE("DNAPT entry with key %s deleted from APP_DB", key.c_str());
                         }
                      }
-                     if ((reverseEntryExists = m_naptCheckTable.get(reverseEntryKey, values)))
+                     if ((reverseEntryExists = m_naptCache.exists(reverseEntryKey)))
                      {
-                        for (auto iter : values)
+                        if (m_naptCache.isStatic(reverseEntryKey))
                         {
-                            if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
-                            {
-                                /* If a matching Static NAPT entry exists in the APP_DB,
-                                 * it has higher priority than the dynamic napt entry. */
-                                SWSS_LOG_INFO("DNAPT %s: static reverse entry exists, not adding dynamic NAPT entry", opStr.c_str());
-                                return 1;
-                            }
+                            /* If a matching Static NAPT entry exists in the APP_DB,
+                             * it has higher priority than the dynamic napt entry. */
+                            SWSS_LOG_INFO("DNAPT %s: static reverse entry exists, not adding dynamic NAPT entry", opStr.c_str());
+                            return 1;
                         }
                         if (addFlag)
                         {
@@ -875,6 +935,7 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                         else
                         {
                             m_naptTable.del(reverseEntryKey);
+                            m_naptCache.remove(reverseEntryKey);
                             SWSS_LOG_NOTICE("Implicit SNAPT entry with key %s deleted from APP_DB", reverseEntryKey.c_str());
                         }
                     }
@@ -895,9 +956,11 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                     else
                     {
                         m_naptTable.set(key, fvVector);
+                        m_naptCache.setDynamic(key);
                         SWSS_LOG_NOTICE("DNAPT entry with key %s added to APP_DB", key.c_str());
                         setTimeoutNotifier->send("SET-SINGLE-NAPT", key, fvVector);
                         m_naptTable.set(reverseEntryKey, reverseFvVector);
+                        m_naptCache.setDynamic(reverseEntryKey);
                         SWSS_LOG_NOTICE("Implicit SNAPT entry with key %s added to APP_DB", reverseEntryKey.c_str());
                     }
                 }
@@ -909,20 +972,16 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                 key             += entry.orig_dest_ip.to_string();
                 reverseEntryKey += entry.nat_dest_ip.to_string();
 
-                std::vector<FieldValueTuple> values;
                 if (! m_AppRestartAssist->isWarmStartInProgress())
                 {
-                    if ((entryExists = m_natCheckTable.get(key, values)))
+                    if ((entryExists = m_natCache.exists(key)))
                     {
-                        for (auto iter : values)
+                        if (m_natCache.isStatic(key))
                         {
-                            if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
-                            {
-                                /* If a matching Static NAT entry exists in the APP_DB,
-                                 * it has higher priority than the dynamic napt entry. */
-                                SWSS_LOG_INFO("DNAT %s: static entry exists, not processing the NAT notification", opStr.c_str());
-                                return 1;
-                            }
+                            /* If a matching Static NAT entry exists in the APP_DB,
+                             * it has higher priority than the dynamic napt entry. */
+                            SWSS_LOG_INFO("DNAT %s: static entry exists, not processing the NAT notification", opStr.c_str());
+                            return 1;
                         }
                         if (addFlag)
                         {
@@ -932,20 +991,18 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                         else
                         { 
                             m_natTable.del(key);
+                            m_natCache.remove(key);
                             SWSS_LOG_NOTICE("DNAT entry with key %s deleted from APP_DB", key.c_str());
                         }
                     }
-                    if ((reverseEntryExists = m_natCheckTable.get(reverseEntryKey, values)))
+                    if ((reverseEntryExists = m_natCache.exists(reverseEntryKey)))
                     {
-                        for (auto iter : values)
+                        if (m_natCache.isStatic(reverseEntryKey))
                         {
-                            if ((fvField(iter) == "entry_type") && (fvValue(iter) == "static"))
-                            {
-                                /* If a matching Static NAT entry exists in the APP_DB,
-                                 * it has higher priority than the dynamic napt entry. */
-                                SWSS_LOG_INFO("DNAT %s: static reverse entry exists, not adding dynamic NAT entry", opStr.c_str());
-                                return 1;
-                            }
+                            /* If a matching Static NAT entry exists in the APP_DB,
+                             * it has higher priority than the dynamic napt entry. */
+                            SWSS_LOG_INFO("DNAT %s: static reverse entry exists, not adding dynamic NAT entry", opStr.c_str());
+                            return 1;
                         }
                         if (addFlag)
                         {
@@ -955,6 +1012,7 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                         else
                         { 
                             m_natTable.del(reverseEntryKey);
+                            m_natCache.remove(reverseEntryKey);
                             SWSS_LOG_NOTICE("Implicit SNAT entry with key %s deleted from APP_DB", reverseEntryKey.c_str());
                         }
                     }
@@ -969,9 +1027,11 @@ int NatSync::addNatEntry(struct nfnl_ct *ct, struct naptEntry &entry, bool addFl
                     else
                     {
                         m_natTable.set(key, fvVector);
+                        m_natCache.setDynamic(key);
                         SWSS_LOG_NOTICE("DNAT entry with key %s added to APP_DB", key.c_str());
                         setTimeoutNotifier->send("SET-SINGLE-NAT", key, fvVector);
                         m_natTable.set(reverseEntryKey, reverseFvVector);
+                        m_natCache.setDynamic(reverseEntryKey);
                         SWSS_LOG_NOTICE("Implicit SNAT entry with key %s added to APP_DB", reverseEntryKey.c_str());
                     }
                 }
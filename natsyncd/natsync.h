@@ -19,6 +19,7 @@
 
 #include "dbconnector.h"
 #include "producerstatetable.h"
+#include "subscriberstatetable.h"
 #include "notificationproducer.h"
 #include "netmsg.h"
 #include "warmRestartAssist.h"
@@ -27,6 +28,8 @@
 #include <linux/netfilter/nfnetlink_conntrack.h>
 #include <linux/netfilter/nf_conntrack_common.h>
 #include <unistd.h>
+#include <unordered_map>
+#include <vector>
 
 // The timeout value (in seconds) for natsyncd reconcilation logic
 #define DEFAULT_NATSYNC_WARMSTART_TIMER 30
@@ -40,6 +43,59 @@ namespace swss {
 
 struct naptEntry;
 
+/*
+ * Keys of an APPL_DB NAT table, kept from a subscription on the table so that
+ * the conntrack notifications are checked without reading the database.
+ */
+class NatTableCache
+{
+public:
+    NatTableCache(DBConnector *db, const std::string &tableName);
+
+    SubscriberStateTable *getSubscriber()
+    {
+        return &m_subscriber;
+    }
+
+    /* Apply the updates of the table */
+    void process();
+
+    bool exists(const std::string &key) const
+    {
+        return m_entries.find(key) != m_entries.end();
+    }
+    bool isStatic(const std::string &key) const;
+
+    /* Dynamic entries written by natsyncd, known ahead of their update in the table */
+    void setDynamic(const std::string &key)
+    {
+        m_entries[key] = false;
+        m_written[key] = true;
+    }
+    void remove(const std::string &key)
+    {
+        if (m_entries.erase(key))
+        {
+            m_written[key] = false;
+        }
+    }
+
+    size_t size() const
+    {
+        return m_entries.size();
+    }
+
+private:
+    SubscriberStateTable m_subscriber;
+    /* Key of each entry, true for the static entries */
+    std::unordered_map<std::string, bool> m_entries;
+    /*
+     * Whether the last write of natsyncd to each key added or removed it, until
+     * the table shows it. Updates of the table older than the write are ignored.
+     */
+    std::unordered_map<std::string, bool> m_written;
+};
+
 class NatSync : public NetMsg
 {
 public:
@@ -56,6 +112,11 @@ public:
         return m_AppRestartAssist;
     }
 
+    /* Subscriptions on the APPL_DB NAT tables */
+    std::vector<Selectable *> getNatTableSubscribers();
+    /* Update the cache of the table of the subscriber, false when it is not one of them */
+    bool processNatTable(Selectable *subscriber);
+
 private:
     static int  parseConnTrackMsg(const struct nfnl_ct *ct, struct naptEntry &entry);
     void        updateConnTrackEntry(struct nfnl_ct *ct);
@@ -73,11 +134,11 @@ private:
     ProducerStateTable m_natTwiceTable;
     ProducerStateTable m_naptTwiceTable;
 
-    Table              m_natCheckTable;
-    Table              m_naptCheckTable;
-    Table              m_naptPoolCheckTable;
-    Table              m_twiceNatCheckTable;
-    Table              m_twiceNaptCheckTable;
+    NatTableCache      m_natCache;
+    NatTableCache      m_naptCache;
+    NatTableCache      m_naptPoolCache;
+    NatTableCache      m_twiceNatCache;
+    NatTableCache      m_twiceNaptCache;
 
     Table              m_stateNatRestoreTable;
     AppRestartAssist  *m_AppRestartAssist;
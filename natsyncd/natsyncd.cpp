@@ -71,10 +71,17 @@ int main(int argc, char **argv)
             nfnl.dumpRequest(IPCTNL_MSG_CT_GET);
 
             s.addSelectable(&nfnl);
+            for (auto subscriber : sync.getNatTableSubscribers())
+            {
+                s.addSelectable(subscriber);
+            }
             while (true)
             {
                 Selectable *temps;
                 s.select(&temps);
+
+                sync.processNatTable(temps);
+
                 /*
                  * If warmstart is in progress, we check the reconcile timer,
                  * if timer expired, we stop the timer and start the reconcile process
@@ -87,6 +94,9 @@ int main(int argc, char **argv)
                         sync.getRestartAssist()->reconcile();
                     }
                 }
+
+                /* The APPL_DB updates of the conntrack notifications are written together */
+                pipelineAppDB.flush();
             }
         }
         catch (const std::exception& e)
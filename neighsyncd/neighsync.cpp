@@ -19,7 +19,7 @@ using namespace std;
 using namespace swss;
 
 NeighSync::NeighSync(RedisPipeline *pipelineAppDB, DBConnector *stateDb, DBConnector *cfgDb) :
-    m_neighTable(pipelineAppDB, APP_NEIGH_TABLE_NAME),
+    m_neighTable(pipelineAppDB, APP_NEIGH_TABLE_NAME, true),
     m_stateNeighRestoreTable(stateDb, STATE_NEIGH_RESTORE_TABLE_NAME),
     m_cfgInterfaceTable(cfgDb, CFG_INTF_TABLE_NAME),
     m_cfgLagInterfaceTable(cfgDb, CFG_LAG_INTF_TABLE_NAME),
@@ -31,6 +31,12 @@ NeighSync::NeighSync(RedisPipeline *pipelineAppDB, DBConnector *stateDb, DBConne
     {
         m_AppRestartAssist->registerAppTable(APP_NEIGH_TABLE_NAME, &m_neighTable);
     }
+
+    /* Subscriber tables start with the current table content */
+    processCfgPeerSwitch();
+    processCfgInterface(m_cfgVlanInterfaceTable);
+    processCfgInterface(m_cfgLagInterfaceTable);
+    processCfgInterface(m_cfgInterfaceTable);
 }
 
 NeighSync::~NeighSync()
@@ -55,6 +61,61 @@ bool NeighSync::isNeighRestoreDone()
     return false;
 }
 
+void NeighSync::processCfgPeerSwitch()
+{
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    m_cfgPeerSwitchTable.pops(entries);
+
+    for (const auto &entry: entries)
+    {
+        const auto &key = kfvKey(entry);
+
+        if (kfvOp(entry) == SET_COMMAND)
+        {
+            m_peerSwitches.insert(key);
+        }
+        else
+        {
+            m_peerSwitches.erase(key);
+        }
+        SWSS_LOG_INFO("Peer switch %s %s, dualtor %d", key.c_str(),
+                      kfvOp(entry).c_str(), !m_peerSwitches.empty());
+    }
+}
+
+void NeighSync::processCfgInterface(SubscriberStateTable &table)
+{
+    std::deque<KeyOpFieldsValuesTuple> entries;
+    table.pops(entries);
+
+    for (const auto &entry: entries)
+    {
+        const auto &key = kfvKey(entry);
+
+        /* Only the interface entry holds its attributes, skip the IP address entries */
+        if (key.find(table.getTableNameSeparator()) != string::npos)
+        {
+            continue;
+        }
+
+        if (kfvOp(entry) != SET_COMMAND)
+        {
+            m_intfLinkLocalOnly.erase(key);
+            continue;
+        }
+
+        bool enabled = false;
+        for (const auto &fv: kfvFieldsValues(entry))
+        {
+            if (fvField(fv) == "ipv6_use_link_local_only")
+            {
+                enabled = (fvValue(fv) == "enable");
+            }
+        }
+        m_intfLinkLocalOnly[key] = enabled;
+    }
+}
+
 void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
 {
     char ipStr[MAX_ADDR_SIZE + 1] = {0};
@@ -63,9 +124,7 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
     string key;
     string family;
     string intfName;
-    std::vector<std::string> peerSwitchKeys;
-    m_cfgPeerSwitchTable.getKeys(peerSwitchKeys);
-    bool is_dualtor = peerSwitchKeys.size() > 0;
+    bool is_dualtor = !m_peerSwitches.empty();
 
     if ((nlmsg_type != RTM_NEWNEIGH) && (nlmsg_type != RTM_GETNEIGH) &&
         (nlmsg_type != RTM_DELNEIGH))
@@ -181,46 +240,19 @@ void NeighSync::onMsg(int nlmsg_type, struct nl_object *obj)
 /* To check the ipv6 link local is enabled on a given port */
 bool NeighSync::isLinkLocalEnabled(const string &port)
 {
-    vector<FieldValueTuple> values;
-
-    if (!port.compare(0, strlen("Vlan"), "Vlan"))
-    {
-        if (!m_cfgVlanInterfaceTable.get(port, values))
-        {
-            SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
-            return false;
-        }
-    }
-    else if (!port.compare(0, strlen("PortChannel"), "PortChannel"))
-    {
-        if (!m_cfgLagInterfaceTable.get(port, values))
-        {
-            SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
-            return false;
-        }
-    }
-    else if (!port.compare(0, strlen("Ethernet"), "Ethernet"))
-    {
-        if (!m_cfgInterfaceTable.get(port, values))
-        {
-            SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
-            return false;
-        }
-    }
-    else
+    if (port.compare(0, strlen("Vlan"), "Vlan") &&
+        port.compare(0, strlen("PortChannel"), "PortChannel") &&
+        port.compare(0, strlen("Ethernet"), "Ethernet"))
     {
         SWSS_LOG_INFO("IPv6 Link local is not supported for %s ", port.c_str());
         return false;
     }
 
-    auto it = std::find_if(values.begin(), values.end(), [](const FieldValueTuple& t){ return t.first == "ipv6_use_link_local_only";});
-    if (it != values.end())
+    auto it = m_intfLinkLocalOnly.find(port);
+    if (it != m_intfLinkLocalOnly.end() && it->second)
     {
-        if (it->second == "enable")
-        {
-            SWSS_LOG_INFO("IPv6 Link local is enabled on %s", port.c_str());
-            return true;
-        }
+        SWSS_LOG_INFO("IPv6 Link local is enabled on %s", port.c_str());
+        return true;
     }
 
     SWSS_LOG_INFO("IPv6 Link local is not enabled on %s", port.c_str());
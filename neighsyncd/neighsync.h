@@ -3,9 +3,13 @@
 
 #include "dbconnector.h"
 #include "producerstatetable.h"
+#include "subscriberstatetable.h"
 #include "netmsg.h"
 #include "warmRestartAssist.h"
 
+#include <set>
+#include <unordered_map>
+
 // The timeout value (in seconds) for neighsyncd reconcilation logic
 #define DEFAULT_NEIGHSYNC_WARMSTART_TIMER 5
 
@@ -35,11 +39,42 @@ public:
         return m_AppRestartAssist;
     }
 
+    SubscriberStateTable *getCfgPeerSwitchTable()
+    {
+        return &m_cfgPeerSwitchTable;
+    }
+
+    SubscriberStateTable *getCfgVlanInterfaceTable()
+    {
+        return &m_cfgVlanInterfaceTable;
+    }
+
+    SubscriberStateTable *getCfgLagInterfaceTable()
+    {
+        return &m_cfgLagInterfaceTable;
+    }
+
+    SubscriberStateTable *getCfgInterfaceTable()
+    {
+        return &m_cfgInterfaceTable;
+    }
+
+    void processCfgPeerSwitch();
+
+    void processCfgInterface(SubscriberStateTable &table);
+
 private:
-    Table m_stateNeighRestoreTable, m_cfgPeerSwitchTable;
+    Table m_stateNeighRestoreTable;
     ProducerStateTable m_neighTable;
     AppRestartAssist  *m_AppRestartAssist;
-    Table m_cfgVlanInterfaceTable, m_cfgLagInterfaceTable, m_cfgInterfaceTable;
+
+    /* CONFIG_DB tables cached locally, so that netlink events do no Redis reads */
+    SubscriberStateTable m_cfgPeerSwitchTable;
+    SubscriberStateTable m_cfgVlanInterfaceTable, m_cfgLagInterfaceTable, m_cfgInterfaceTable;
+
+    std::set<std::string> m_peerSwitches;
+    /* Configured router interfaces, with their ipv6_use_link_local_only mode */
+    std::unordered_map<std::string, bool> m_intfLinkLocalOnly;
 
     bool isLinkLocalEnabled(const std::string &port);
 };
@@ -67,10 +67,32 @@ int main(int argc, char **argv)
             netlink.dumpRequest(RTM_GETNEIGH);
 
             s.addSelectable(&netlink);
+            s.addSelectable(sync.getCfgPeerSwitchTable());
+            s.addSelectable(sync.getCfgVlanInterfaceTable());
+            s.addSelectable(sync.getCfgLagInterfaceTable());
+            s.addSelectable(sync.getCfgInterfaceTable());
             while (true)
             {
                 Selectable *temps;
                 s.select(&temps);
+
+                if (temps == (Selectable *)sync.getCfgPeerSwitchTable())
+                {
+                    sync.processCfgPeerSwitch();
+                }
+                else if (temps == (Selectable *)sync.getCfgVlanInterfaceTable())
+                {
+                    sync.processCfgInterface(*sync.getCfgVlanInterfaceTable());
+                }
+                else if (temps == (Selectable *)sync.getCfgLagInterfaceTable())
+                {
+                    sync.processCfgInterface(*sync.getCfgLagInterfaceTable());
+                }
+                else if (temps == (Selectable *)sync.getCfgInterfaceTable())
+                {
+                    sync.processCfgInterface(*sync.getCfgInterfaceTable());
+                }
+
                 /*
                  * If warmstart is in progress, we check the reconcile timer,
                  * if timer expired, we stop the timer and start the reconcile process
@@ -83,6 +105,9 @@ int main(int argc, char **argv)
                         sync.getRestartAssist()->reconcile();
                     }
                 }
+
+                /* Neighbor updates of this iteration are written in a single round trip */
+                pipelineAppDB.flush();
             }
         }
         catch (const std::exception& e)
@@ -30,6 +30,7 @@ extern PortsOrch*        gPortsOrch;
 extern CrmOrch *gCrmOrch;
 extern SwitchOrch *gSwitchOrch;
 extern string gMySwitchType;
+extern size_t gMaxBulkSize;
 
 #define MIN_VLAN_ID 1    // 0 is a reserved VLAN ID
 #define MAX_VLAN_ID 4095 // 4096 is a reserved VLAN ID
@@ -886,22 +887,22 @@ bool AclRule::validateAddMatch(string attr_name, string attr_value)
                 return false;
             }
 
-            for (auto alias : ports)
+            for (const auto &alias : ports)
             {
-                Port port;
-                if (!gPortsOrch->getPort(alias, port))
+                Port *port = gPortsOrch->findPort(alias);
+                if (!port)
                 {
                     SWSS_LOG_ERROR("Failed to locate port %s", alias.c_str());
                     return false;
                 }
 
-                if (port.m_type != Port::PHY)
+                if (port->m_type != Port::PHY)
                 {
                     SWSS_LOG_ERROR("Cannot bind rule to %s: IN_PORTS can only match physical interfaces", alias.c_str());
                     return false;
                 }
 
-                inPorts.push_back(port.m_port_id);
+                inPorts.push_back(port->m_port_id);
             }
 
             matchData.data.objlist.count = static_cast<uint32_t>(inPorts.size());
@@ -916,22 +917,22 @@ bool AclRule::validateAddMatch(string attr_name, string attr_value)
                 return false;
             }
 
-            for (auto alias : ports)
+            for (const auto &alias : ports)
             {
-                Port port;
-                if (!gPortsOrch->getPort(alias, port))
+                Port *port = gPortsOrch->findPort(alias);
+                if (!port)
                 {
                     SWSS_LOG_ERROR("Failed to locate port %s", alias.c_str());
                     return false;
                 }
 
-                if (port.m_type != Port::PHY)
+                if (port->m_type != Port::PHY)
                 {
                     SWSS_LOG_ERROR("Cannot bind rule to %s: OUT_PORTS can only match physical interfaces", alias.c_str());
                     return false;
                 }
 
-                outPorts.push_back(port.m_port_id);
+                outPorts.push_back(port->m_port_id);
             }
 
             matchData.data.objlist.count = static_cast<uint32_t>(outPorts.size());
@@ -1196,9 +1197,23 @@ bool AclRule::createRule()
     vector<sai_attribute_t> rule_attrs;
     sai_object_id_t range_objects[2];
     sai_object_list_t range_object_list = {0, range_objects};
+    sai_object_id_t rule_oid = SAI_NULL_OBJECT_ID;
+
+    if (!getRuleAttrs(rule_attrs, range_object_list))
+    {
+        return false;
+    }
+
+    sai_status_t status = sai_acl_api->create_acl_entry(&rule_oid, gSwitchId, (uint32_t)rule_attrs.size(), rule_attrs.data());
+
+    return onRuleCreated(rule_oid, status, range_object_list);
+}
+
+bool AclRule::getRuleAttrs(vector<sai_attribute_t> &rule_attrs, sai_object_list_t &range_object_list)
+{
+    SWSS_LOG_ENTER();
 
     sai_attribute_t attr;
-    sai_status_t status;
 
     // store table oid this rule belongs to
     attr.id = SAI_ACL_ENTRY_ATTR_TABLE_ID;
@@ -1232,12 +1247,13 @@ bool AclRule::createRule()
             if (!range)
             {
                 // release already created range if any
-                AclRange::remove(range_objects, range_object_list.count);
+                AclRange::remove(range_object_list.list, range_object_list.count);
+                range_object_list.count = 0;
                 return false;
             }
 
             m_ranges.push_back(range);
-            range_objects[range_object_list.count++] = range->getOid();
+            range_object_list.list[range_object_list.count++] = range->getOid();
         }
 
         attr.id = SAI_ACL_ENTRY_ATTR_FIELD_ACL_RANGE_TYPE;
@@ -1260,26 +1276,32 @@ bool AclRule::createRule()
         rule_attrs.push_back(attr);
     }
 
-    status = sai_acl_api->create_acl_entry(&m_ruleOid, gSwitchId, (uint32_t)rule_attrs.size(), rule_attrs.data());
+    return true;
+}
+
+bool AclRule::onRuleCreated(sai_object_id_t rule_oid, sai_status_t status, const sai_object_list_t &range_object_list)
+{
+    SWSS_LOG_ENTER();
+
+    if (status == SAI_STATUS_ITEM_ALREADY_EXISTS)
+    {
+        SWSS_LOG_NOTICE("ACL rule %s already exists", m_id.c_str());
+        return true;
+    }
+
     if (status != SAI_STATUS_SUCCESS)
     {
-        if (status == SAI_STATUS_ITEM_ALREADY_EXISTS)
-        {
-            SWSS_LOG_NOTICE("ACL rule %s already exists", m_id.c_str());
-            return true;
-        }
         SWSS_LOG_ERROR("Failed to create ACL rule %s, rv:%d",
                 m_id.c_str(), status);
-        AclRange::remove(range_objects, range_object_list.count);
+        AclRange::remove(range_object_list.list, range_object_list.count);
         decreaseNextHopRefCount();
+        return false;
     }
 
-    if (status == SAI_STATUS_SUCCESS)
-    {
-        gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, m_pTable->getOid());
-    }
+    m_ruleOid = rule_oid;
+    gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, m_pTable->getOid());
 
-    return (status == SAI_STATUS_SUCCESS);
+    return true;
 }
 
 void AclRule::decreaseNextHopRefCount()
@@ -1326,7 +1348,13 @@ bool AclRule::removeRule()
         return true;
     }
 
-    auto status = sai_acl_api->remove_acl_entry(m_ruleOid);
+    return onRuleRemoved(sai_acl_api->remove_acl_entry(m_ruleOid));
+}
+
+bool AclRule::onRuleRemoved(sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
     if (status != SAI_STATUS_SUCCESS)
     {
         if (status == SAI_STATUS_ITEM_NOT_FOUND)
@@ -1700,6 +1728,11 @@ bool AclRule::getCreateCounter() const
     return m_createCounter;
 }
 
+bool AclRule::isBulkSupported() const
+{
+    return true;
+}
+
 shared_ptr<AclRule> AclRule::makeShared(AclOrch *acl, MirrorOrch *mirror, DTelOrch *dtel, const string& rule, const string& table, const KeyOpFieldsValuesTuple& data, MetaDataMgr * m_metadataMgr)
 {
     shared_ptr<AclRule> aclRule;
@@ -1816,14 +1849,24 @@ bool AclRule::createCounter()
 {
     SWSS_LOG_ENTER();
 
-    sai_attribute_t attr;
-    vector<sai_attribute_t> counter_attrs;
-
     if (m_counterOid != SAI_NULL_OBJECT_ID)
     {
         return true;
     }
 
+    vector<sai_attribute_t> counter_attrs = getCounterAttrs();
+    sai_object_id_t counter_oid = SAI_NULL_OBJECT_ID;
+
+    sai_status_t status = sai_acl_api->create_acl_counter(&counter_oid, gSwitchId, (uint32_t)counter_attrs.size(), counter_attrs.data());
+
+    return onCounterCreated(counter_oid, status);
+}
+
+vector<sai_attribute_t> AclRule::getCounterAttrs() const
+{
+    sai_attribute_t attr;
+    vector<sai_attribute_t> counter_attrs;
+
     attr.id = SAI_ACL_COUNTER_ATTR_TABLE_ID;
     attr.value.oid = m_pTable->getOid();
     counter_attrs.push_back(attr);
@@ -1835,12 +1878,20 @@ bool AclRule::createCounter()
         counter_attrs.push_back(attr);
     }
 
-    if (sai_acl_api->create_acl_counter(&m_counterOid, gSwitchId, (uint32_t)counter_attrs.size(), counter_attrs.data()) != SAI_STATUS_SUCCESS)
+    return counter_attrs;
+}
+
+bool AclRule::onCounterCreated(sai_object_id_t counter_oid, sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to create counter for the rule %s in table %s", m_id.c_str(), m_pTable->getId().c_str());
         return false;
     }
 
+    m_counterOid = counter_oid;
     gCrmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_COUNTER, m_pTable->getOid());
 
     SWSS_LOG_INFO("Created counter for the rule %s in table %s", m_id.c_str(), m_pTable->getId().c_str());
@@ -1877,7 +1928,14 @@ bool AclRule::removeCounter()
         return true;
     }
 
-    if (sai_acl_api->remove_acl_counter(m_counterOid) != SAI_STATUS_SUCCESS)
+    return onCounterRemoved(sai_acl_api->remove_acl_counter(m_counterOid));
+}
+
+bool AclRule::onCounterRemoved(sai_status_t status)
+{
+    SWSS_LOG_ENTER();
+
+    if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to remove ACL counter for rule %s in table %s", m_id.c_str(), m_pTable->getId().c_str());
         return false;
@@ -2138,6 +2196,12 @@ bool AclRuleMirror::removeRule()
     return deactivate();
 }
 
+bool AclRuleMirror::isBulkSupported() const
+{
+    // The rule is only programmed while it is active
+    return false;
+}
+
 bool AclRuleMirror::activate()
 {
     SWSS_LOG_ENTER();
@@ -3041,6 +3105,12 @@ bool AclRuleDTelWatchListEntry::removeRule()
     return deactivate();
 }
 
+bool AclRuleDTelWatchListEntry::isBulkSupported() const
+{
+    // The rule is only programmed while it is active
+    return false;
+}
+
 bool AclRuleDTelWatchListEntry::activate()
 {
     SWSS_LOG_ENTER();
@@ -4008,6 +4078,98 @@ void AclOrch::queryAclActionAttrEnumValues(const string &action_name,
     m_switchOrch->set_switch_capability(fvVector);
 }
 
+// The ACL API has no bulk functions, ACL entries and counters go through the
+// generic object bulk API, one object at a time if it is not implemented
+static sai_status_t bulkCreateAclObjects(sai_object_type_t object_type, sai_object_id_t switch_id,
+        uint32_t object_count, const uint32_t *attr_count, const sai_attribute_t **attr_list,
+        sai_bulk_op_error_mode_t mode, sai_object_id_t *object_id, sai_status_t *object_statuses)
+{
+    sai_status_t status = sai_bulk_object_create(switch_id, object_type, object_count, attr_count,
+            attr_list, mode, object_id, object_statuses);
+    if (status != SAI_STATUS_NOT_IMPLEMENTED && status != SAI_STATUS_NOT_SUPPORTED)
+    {
+        return status;
+    }
+
+    status = SAI_STATUS_SUCCESS;
+    for (uint32_t i = 0; i < object_count; i++)
+    {
+        if (status != SAI_STATUS_SUCCESS && mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR)
+        {
+            object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+
+        object_statuses[i] = object_type == SAI_OBJECT_TYPE_ACL_ENTRY ?
+            sai_acl_api->create_acl_entry(&object_id[i], switch_id, attr_count[i], attr_list[i]) :
+            sai_acl_api->create_acl_counter(&object_id[i], switch_id, attr_count[i], attr_list[i]);
+        if (object_statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            status = SAI_STATUS_FAILURE;
+        }
+    }
+
+    return status;
+}
+
+static sai_status_t bulkRemoveAclObjects(sai_object_type_t object_type, uint32_t object_count,
+        const sai_object_id_t *object_id, sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+{
+    sai_status_t status = sai_bulk_object_remove(object_type, object_count, object_id, mode, object_statuses);
+    if (status != SAI_STATUS_NOT_IMPLEMENTED && status != SAI_STATUS_NOT_SUPPORTED)
+    {
+        return status;
+    }
+
+    status = SAI_STATUS_SUCCESS;
+    for (uint32_t i = 0; i < object_count; i++)
+    {
+        if (status != SAI_STATUS_SUCCESS && mode == SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR)
+        {
+            object_statuses[i] = SAI_STATUS_NOT_EXECUTED;
+            continue;
+        }
+
+        object_statuses[i] = object_type == SAI_OBJECT_TYPE_ACL_ENTRY ?
+            sai_acl_api->remove_acl_entry(object_id[i]) :
+            sai_acl_api->remove_acl_counter(object_id[i]);
+        if (object_statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            status = SAI_STATUS_FAILURE;
+        }
+    }
+
+    return status;
+}
+
+static sai_status_t bulkCreateAclEntries(sai_object_id_t switch_id, uint32_t object_count,
+        const uint32_t *attr_count, const sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode,
+        sai_object_id_t *object_id, sai_status_t *object_statuses)
+{
+    return bulkCreateAclObjects(SAI_OBJECT_TYPE_ACL_ENTRY, switch_id, object_count, attr_count,
+            attr_list, mode, object_id, object_statuses);
+}
+
+static sai_status_t bulkRemoveAclEntries(uint32_t object_count, const sai_object_id_t *object_id,
+        sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+{
+    return bulkRemoveAclObjects(SAI_OBJECT_TYPE_ACL_ENTRY, object_count, object_id, mode, object_statuses);
+}
+
+static sai_status_t bulkCreateAclCounters(sai_object_id_t switch_id, uint32_t object_count,
+        const uint32_t *attr_count, const sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode,
+        sai_object_id_t *object_id, sai_status_t *object_statuses)
+{
+    return bulkCreateAclObjects(SAI_OBJECT_TYPE_ACL_COUNTER, switch_id, object_count, attr_count,
+            attr_list, mode, object_id, object_statuses);
+}
+
+static sai_status_t bulkRemoveAclCounters(uint32_t object_count, const sai_object_id_t *object_id,
+        sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+{
+    return bulkRemoveAclObjects(SAI_OBJECT_TYPE_ACL_COUNTER, object_count, object_id, mode, object_statuses);
+}
+
 AclOrch::AclOrch(vector<TableConnector>& connectors, DBConnector* stateDb, SwitchOrch *switchOrch,
         PortsOrch *portOrch, MirrorOrch *mirrorOrch, NeighOrch *neighOrch, RouteOrch *routeOrch, DTelOrch *dtelOrch) :
         Orch(connectors),
@@ -4024,7 +4186,9 @@ AclOrch::AclOrch(vector<TableConnector>& connectors, DBConnector* stateDb, Switc
             StatsMode::READ,
             ACL_COUNTER_DEFAULT_POLLING_INTERVAL_MS,
             ACL_COUNTER_DEFAULT_ENABLED_STATE
-        )
+        ),
+        m_aclCounterBulker(bulkCreateAclCounters, bulkRemoveAclCounters, gSwitchId, gMaxBulkSize, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR),
+        m_aclEntryBulker(bulkCreateAclEntries, bulkRemoveAclEntries, gSwitchId, gMaxBulkSize, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR)
 {
     SWSS_LOG_ENTER();
 
@@ -5349,6 +5513,12 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
             continue;
         }
 
+        // Tasks of the same rule are applied in order
+        if (m_bulkRuleKeys.find(table_id + ":" + rule_id) != m_bulkRuleKeys.end())
+        {
+            flushAclRules(consumer);
+        }
+
         if (op == SET_COMMAND)
         {
             bool bAllAttributesOk = true;
@@ -5390,6 +5560,7 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
             {
                 SWSS_LOG_ERROR("Error while creating ACL rule %s: %s", rule_id.c_str(), e.what());
                 it = consumer.m_toSync.erase(it);
+                flushAclRules(consumer);
                 return;
             }
             bool bHasTCPFlag = false;
@@ -5474,7 +5645,17 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
             // validate and create ACL rule
             if (bAllAttributesOk && newRule->validate())
             {
-                if (addAclRule(newRule, table_id))
+                if (canBulkAddAclRule(newRule, table_id, table_oid))
+                {
+                    AclRuleBulkContext ctx;
+                    ctx.task = it++;
+                    ctx.table_id = table_id;
+                    ctx.table_oid = table_oid;
+                    ctx.rule = newRule;
+                    m_bulkRuleCreates.push_back(ctx);
+                    m_bulkRuleKeys.insert(table_id + ":" + rule_id);
+                }
+                else if (addAclRule(newRule, table_id))
                 {
                     setAclRuleStatus(table_id, rule_id, AclObjectStatus::ACTIVE);
                     it = consumer.m_toSync.erase(it);
@@ -5495,7 +5676,24 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
         }
         else if (op == DEL_COMMAND)
         {
-            if (removeAclRule(table_id, rule_id))
+            if (canBulkRemoveAclRule(table_id, rule_id))
+            {
+                sai_object_id_t table_oid = getTableById(table_id);
+                auto rule = m_AclTables[table_oid].rules[rule_id];
+                if (rule->hasCounter())
+                {
+                    deregisterFlexCounter(*rule);
+                }
+
+                AclRuleBulkContext ctx;
+                ctx.task = it++;
+                ctx.table_id = table_id;
+                ctx.table_oid = table_oid;
+                ctx.rule = rule;
+                m_bulkRuleRemoves.push_back(ctx);
+                m_bulkRuleKeys.insert(table_id + ":" + rule_id);
+            }
+            else if (removeAclRule(table_id, rule_id))
             {
                 removeAclRuleStatus(table_id, rule_id);
                 it = consumer.m_toSync.erase(it);
@@ -5513,6 +5711,227 @@ void AclOrch::doAclRuleTask(Consumer &consumer)
             SWSS_LOG_ERROR("Unknown operation type %s", op.c_str());
         }
     }
+
+    flushAclRules(consumer);
+}
+
+bool AclOrch::canBulkAddAclRule(const shared_ptr<AclRule> &rule, const string &table_id, sai_object_id_t table_oid)
+{
+    // Replacing an existing rule and the egress set DSCP rules go through addAclRule()
+    return rule->isBulkSupported() && !isUsingEgrSetDscp(table_id) &&
+           m_AclTables[table_oid].rules.find(rule->getId()) == m_AclTables[table_oid].rules.end();
+}
+
+bool AclOrch::canBulkRemoveAclRule(const string &table_id, const string &rule_id)
+{
+    if (m_egrDscpRuleMetadata.find(table_id + ":" + rule_id) != m_egrDscpRuleMetadata.end())
+    {
+        return false;
+    }
+
+    auto rule = getAclRule(table_id, rule_id);
+    return rule && rule->isBulkSupported();
+}
+
+void AclOrch::flushAclRules(Consumer &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    // Removes first, to free the resources the creates may need
+    flushAclRuleRemoves(consumer);
+    flushAclRuleCreates(consumer);
+
+    m_bulkRuleKeys.clear();
+}
+
+void AclOrch::flushAclBulker(ObjectBulker<sai_acl_api_t> &bulker, vector<AclRuleBulkContext *> ctxs,
+        sai_status_t AclRuleBulkContext::*status, const function<void(AclRuleBulkContext &)> &stage)
+{
+    SWSS_LOG_ENTER();
+
+    // Stage the entries the previous flush did not execute again, as long as
+    // each flush makes progress. Failed entries are left to the caller.
+    while (!ctxs.empty())
+    {
+        for (auto ctx : ctxs)
+        {
+            stage(*ctx);
+        }
+        bulker.flush();
+
+        vector<AclRuleBulkContext *> not_executed;
+        for (auto ctx : ctxs)
+        {
+            if (ctx->*status == SAI_STATUS_NOT_EXECUTED)
+            {
+                not_executed.push_back(ctx);
+            }
+        }
+
+        if (not_executed.size() == ctxs.size())
+        {
+            break;
+        }
+        ctxs.swap(not_executed);
+    }
+}
+
+void AclOrch::flushAclRuleRemoves(Consumer &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_bulkRuleRemoves.empty())
+    {
+        return;
+    }
+
+    // Entries reference their counters, remove the entries first
+    vector<AclRuleBulkContext *> ctxs;
+    for (auto &ctx : m_bulkRuleRemoves)
+    {
+        if (ctx.rule->m_ruleOid != SAI_NULL_OBJECT_ID)
+        {
+            ctxs.push_back(&ctx);
+        }
+    }
+    flushAclBulker(m_aclEntryBulker, ctxs, &AclRuleBulkContext::rule_status, [this](AclRuleBulkContext &ctx) {
+        m_aclEntryBulker.remove_entry(&ctx.rule_status, ctx.rule->m_ruleOid);
+    });
+
+    ctxs.clear();
+    for (auto &ctx : m_bulkRuleRemoves)
+    {
+        if (ctx.rule->m_ruleOid != SAI_NULL_OBJECT_ID)
+        {
+            ctx.ok = ctx.rule->onRuleRemoved(ctx.rule_status);
+        }
+
+        ctx.ok = ctx.ok && ctx.rule->removeRanges();
+
+        if (ctx.ok && ctx.rule->m_counterOid != SAI_NULL_OBJECT_ID)
+        {
+            ctxs.push_back(&ctx);
+        }
+    }
+    flushAclBulker(m_aclCounterBulker, ctxs, &AclRuleBulkContext::counter_status, [this](AclRuleBulkContext &ctx) {
+        m_aclCounterBulker.remove_entry(&ctx.counter_status, ctx.rule->m_counterOid);
+    });
+
+    for (auto &ctx : m_bulkRuleRemoves)
+    {
+        string rule_id = ctx.rule->getId();
+
+        if (ctx.ok && ctx.rule->m_counterOid != SAI_NULL_OBJECT_ID)
+        {
+            ctx.ok = ctx.rule->onCounterRemoved(ctx.counter_status);
+        }
+
+        if (ctx.ok)
+        {
+            m_AclTables[ctx.table_oid].rules.erase(rule_id);
+            SWSS_LOG_NOTICE("Successfully deleted ACL rule %s in table %s",
+                    rule_id.c_str(), ctx.table_id.c_str());
+            removeAclRuleStatus(ctx.table_id, rule_id);
+            consumer.m_toSync.erase(ctx.task);
+        }
+        else
+        {
+            SWSS_LOG_ERROR("Failed to delete ACL rule %s in table %s",
+                    rule_id.c_str(), ctx.table_id.c_str());
+            // Mark pending removal status if removeAclRule returns error
+            setAclRuleStatus(ctx.table_id, rule_id, AclObjectStatus::PENDING_REMOVAL);
+        }
+    }
+
+    m_bulkRuleRemoves.clear();
+}
+
+void AclOrch::flushAclRuleCreates(Consumer &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_bulkRuleCreates.empty())
+    {
+        return;
+    }
+
+    // Entries reference their counters, create the counters first
+    vector<AclRuleBulkContext *> ctxs;
+    for (auto &ctx : m_bulkRuleCreates)
+    {
+        if (ctx.rule->m_createCounter)
+        {
+            ctxs.push_back(&ctx);
+        }
+    }
+    flushAclBulker(m_aclCounterBulker, ctxs, &AclRuleBulkContext::counter_status, [this](AclRuleBulkContext &ctx) {
+        auto counter_attrs = ctx.rule->getCounterAttrs();
+        m_aclCounterBulker.create_entry(&ctx.counter_oid, &ctx.counter_status,
+                (uint32_t)counter_attrs.size(), counter_attrs.data());
+    });
+
+    ctxs.clear();
+    for (auto &ctx : m_bulkRuleCreates)
+    {
+        if (ctx.rule->m_createCounter)
+        {
+            ctx.ok = ctx.rule->onCounterCreated(ctx.counter_oid, ctx.counter_status);
+        }
+
+        if (!ctx.ok)
+        {
+            continue;
+        }
+
+        ctx.range_object_list = {0, ctx.range_objects};
+        if (!ctx.rule->getRuleAttrs(ctx.rule_attrs, ctx.range_object_list))
+        {
+            ctx.rule->removeCounter();
+            ctx.ok = false;
+            continue;
+        }
+
+        ctxs.push_back(&ctx);
+    }
+    flushAclBulker(m_aclEntryBulker, ctxs, &AclRuleBulkContext::rule_status, [this](AclRuleBulkContext &ctx) {
+        m_aclEntryBulker.create_entry(&ctx.rule_oid, &ctx.rule_status,
+                (uint32_t)ctx.rule_attrs.size(), ctx.rule_attrs.data());
+    });
+
+    for (auto &ctx : m_bulkRuleCreates)
+    {
+        string rule_id = ctx.rule->getId();
+
+        if (ctx.ok)
+        {
+            ctx.ok = ctx.rule->onRuleCreated(ctx.rule_oid, ctx.rule_status, ctx.range_object_list);
+            if (!ctx.ok)
+            {
+                ctx.rule->removeCounter();
+            }
+        }
+
+        if (ctx.ok)
+        {
+            m_AclTables[ctx.table_oid].rules[rule_id] = ctx.rule;
+            SWSS_LOG_NOTICE("Successfully created ACL rule %s in table %s",
+                    rule_id.c_str(), ctx.table_id.c_str());
+            if (ctx.rule->hasCounter())
+            {
+                registerFlexCounter(*ctx.rule);
+            }
+            setAclRuleStatus(ctx.table_id, rule_id, AclObjectStatus::ACTIVE);
+            consumer.m_toSync.erase(ctx.task);
+        }
+        else
+        {
+            SWSS_LOG_ERROR("Failed to create ACL rule %s in table %s",
+                    rule_id.c_str(), ctx.table_id.c_str());
+            setAclRuleStatus(ctx.table_id, rule_id, AclObjectStatus::PENDING_CREATION);
+        }
+    }
+
+    m_bulkRuleCreates.clear();
 }
 
 void AclOrch::doAclTableTypeTask(Consumer &consumer)
@@ -7,6 +7,8 @@
 #include <mutex>
 #include <tuple>
 #include <map>
+#include <deque>
+#include <functional>
 #include <condition_variable>
 
 #include "orch.h"
@@ -16,6 +18,7 @@
 #include "dtelorch.h"
 #include "observer.h"
 #include "flex_counter_manager.h"
+#include "bulker.h"
 
 #include "acltable.h"
 
@@ -326,12 +329,25 @@ public:
     virtual ~AclRule() {}
 
 protected:
+    // AclOrch creates and removes the rules of a drain in bulk
+    friend class AclOrch;
+
     virtual bool createCounter();
     virtual bool createRule();
     virtual bool removeCounter();
     virtual bool removeRanges();
     virtual bool removeRule();
 
+    // The steps of createCounter(), createRule(), removeRule() and removeCounter()
+    // around their SAI call, for the rules which support bulk programming
+    virtual bool isBulkSupported() const;
+    vector<sai_attribute_t> getCounterAttrs() const;
+    bool onCounterCreated(sai_object_id_t counter_oid, sai_status_t status);
+    bool getRuleAttrs(vector<sai_attribute_t> &rule_attrs, sai_object_list_t &range_object_list);
+    bool onRuleCreated(sai_object_id_t rule_oid, sai_status_t status, const sai_object_list_t &range_object_list);
+    bool onRuleRemoved(sai_status_t status);
+    bool onCounterRemoved(sai_status_t status);
+
     virtual bool updatePriority(const AclRule& updatedRule);
     virtual bool updateMatches(const AclRule& updatedRule);
     virtual bool updateActions(const AclRule& updatedRule);
@@ -389,6 +405,7 @@ public:
     bool createCounter();
     bool createRule();
     bool removeRule();
+    bool isBulkSupported() const override;
     void onUpdate(SubjectType, void *) override;
 
     bool activate();
@@ -409,6 +426,7 @@ public:
     bool validate();
     bool createRule();
     bool removeRule();
+    bool isBulkSupported() const override;
     void onUpdate(SubjectType, void *) override;
 
     bool activate();
@@ -657,6 +675,32 @@ private:
     void removeAllAclTableStatus();
     void removeAllAclRuleStatus();
 
+    // A rule task of doAclRuleTask, staged until flushAclRules()
+    struct AclRuleBulkContext
+    {
+        SyncMap::iterator task;
+        string table_id;
+        sai_object_id_t table_oid;
+        shared_ptr<AclRule> rule;
+        bool ok = true;
+        sai_object_id_t counter_oid = SAI_NULL_OBJECT_ID;
+        sai_object_id_t rule_oid = SAI_NULL_OBJECT_ID;
+        sai_status_t counter_status = SAI_STATUS_NOT_EXECUTED;
+        sai_status_t rule_status = SAI_STATUS_NOT_EXECUTED;
+        vector<sai_attribute_t> rule_attrs;
+        // Referenced by the staged entry attributes
+        sai_object_id_t range_objects[2];
+        sai_object_list_t range_object_list = {0, nullptr};
+    };
+
+    bool canBulkAddAclRule(const shared_ptr<AclRule> &rule, const string &table_id, sai_object_id_t table_oid);
+    bool canBulkRemoveAclRule(const string &table_id, const string &rule_id);
+    void flushAclRules(Consumer &consumer);
+    void flushAclRuleRemoves(Consumer &consumer);
+    void flushAclRuleCreates(Consumer &consumer);
+    void flushAclBulker(ObjectBulker<sai_acl_api_t> &bulker, vector<AclRuleBulkContext *> ctxs,
+            sai_status_t AclRuleBulkContext::*status, const function<void(AclRuleBulkContext &)> &stage);
+
     map<sai_object_id_t, AclTable> m_AclTables;
     // TODO: Move all ACL tables into one map: name -> instance
     map<string, AclTable> m_ctrlAclTables;
@@ -680,6 +724,14 @@ private:
     acl_capabilities_t m_aclCapabilities;
     acl_action_enum_values_capabilities_t m_aclEnumActionCapabilities;
     FlexCounterManager m_flex_counter_manager;
+
+    // Counters are created before their entries and removed after them
+    ObjectBulker<sai_acl_api_t> m_aclCounterBulker;
+    ObjectBulker<sai_acl_api_t> m_aclEntryBulker;
+    deque<AclRuleBulkContext> m_bulkRuleCreates;
+    deque<AclRuleBulkContext> m_bulkRuleRemoves;
+    // Keys of the staged tasks, a later task of the same key flushes them first
+    set<string> m_bulkRuleKeys;
 };
 
 #endif /* SWSS_ACLORCH_H */
@@ -0,0 +1,69 @@
+#include <hiredis/hiredis.h>
+
+#include "batchtablereader.h"
+#include "logger.h"
+#include "redisreply.h"
+
+using namespace std;
+using namespace swss;
+
+BatchTableReader::BatchTableReader(DBConnector *db, const string &tableName) :
+    m_pipe(db),
+    m_table(tableName, SonicDBConfig::getSeparator(db)),
+    m_sha(m_pipe.loadRedisScript(luaScript))
+{
+}
+
+void BatchTableReader::get(const vector<string> &keys, vector<vector<FieldValueTuple>> &values)
+{
+    SWSS_LOG_ENTER();
+
+    values.resize(keys.size());
+    if (keys.empty())
+    {
+        return;
+    }
+
+    vector<string> args = { "EVALSHA", m_sha, to_string(keys.size()) };
+    for (const auto &key : keys)
+    {
+        args.push_back(m_table.getKeyName(key));
+    }
+
+    RedisCommand command;
+    command.format(args);
+    RedisReply r(m_pipe.push(command, REDIS_REPLY_ARRAY));
+    redisReply *reply = r.getContext();
+
+    if (reply->type != REDIS_REPLY_ARRAY || reply->elements != keys.size())
+    {
+        SWSS_LOG_THROW("Unexpected reply type %d with %zu elements to HGETALL of %zu keys of %s",
+                       reply->type, reply->elements, keys.size(), m_table.getTableName().c_str());
+    }
+
+    for (size_t i = 0; i < keys.size(); i++)
+    {
+        const redisReply *fvReply = reply->element[i];
+
+        auto &fvs = values[i];
+        fvs.clear();
+
+        if (fvReply->type == REDIS_REPLY_ERROR)
+        {
+            SWSS_LOG_ERROR("Failed to HGETALL %s: %s", m_table.getKeyName(keys[i]).c_str(), fvReply->str);
+            continue;
+        }
+
+        if (fvReply->type != REDIS_REPLY_ARRAY)
+        {
+            SWSS_LOG_ERROR("Unexpected reply type %d to HGETALL %s", fvReply->type, m_table.getKeyName(keys[i]).c_str());
+            continue;
+        }
+
+        for (size_t e = 0; e + 1 < fvReply->elements; e += 2)
+        {
+            fvs.emplace_back(string(fvReply->element[e]->str, fvReply->element[e]->len),
+                             string(fvReply->element[e + 1]->str, fvReply->element[e + 1]->len));
+        }
+    }
+}
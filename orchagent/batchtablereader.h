@@ -0,0 +1,41 @@
+#ifndef SWSS_BATCHTABLEREADER_H
+#define SWSS_BATCHTABLEREADER_H
+
+#include <string>
+#include <vector>
+
+#include "dbconnector.h"
+#include "redispipeline.h"
+#include "table.h"
+
+/*
+ * BatchTableReader reads many keys of a table in one round trip to redis:
+ * a Lua script runs the HGETALL of every key and returns all the replies.
+ * It has its own connection, through a RedisPipeline.
+ */
+class BatchTableReader
+{
+public:
+    BatchTableReader(swss::DBConnector *db, const std::string &tableName);
+
+    /* The fields of each key, in the order of the keys, empty when the key does not exist */
+    void get(const std::vector<std::string> &keys, std::vector<std::vector<swss::FieldValueTuple>> &values);
+
+    /*
+     * KEYS are the keys to read, returns the HGETALL reply of each of them.
+     * A key that can't be read, e.g. not a hash, gets an error reply instead of failing the script.
+     */
+    static constexpr const char *luaScript =
+        "local values = {}\n"
+        "for i = 1, #KEYS do\n"
+        "    values[i] = redis.pcall('HGETALL', KEYS[i])\n"
+        "end\n"
+        "return values\n";
+
+private:
+    swss::RedisPipeline m_pipe;
+    swss::TableBase m_table;
+    std::string m_sha;
+};
+
+#endif /* SWSS_BATCHTABLEREADER_H */
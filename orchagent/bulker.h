@@ -2,6 +2,7 @@
 
 #include <assert.h>
 #include <vector>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
 #include <stdexcept>
@@ -356,6 +357,18 @@ struct SaiBulkerTraits<sai_next_hop_api_t>
     //using bulk_set_entry_attribute_fn = sai_bulk_object_set_attribute_fn;
 };
 
+template<>
+struct SaiBulkerTraits<sai_acl_api_t>
+{
+    using entry_t = sai_object_id_t;
+    using api_t = sai_acl_api_t;
+    using create_entry_fn = sai_create_acl_entry_fn;
+    using remove_entry_fn = sai_remove_acl_entry_fn;
+    using set_entry_attribute_fn = sai_set_acl_entry_attribute_fn;
+    using bulk_create_entry_fn = sai_bulk_object_create_fn;
+    using bulk_remove_entry_fn = sai_bulk_object_remove_fn;
+};
+
 template<>
 struct SaiBulkerTraits<sai_mpls_api_t>
 {
@@ -906,14 +919,39 @@ class ObjectBulker
 public:
     using Ts = SaiBulkerTraits<T>;
 
-    ObjectBulker(typename Ts::api_t* next_hop_group_api, sai_object_id_t switch_id, size_t max_bulk_size) :
-        max_bulk_size(max_bulk_size)
+    ObjectBulker(typename Ts::api_t* next_hop_group_api, sai_object_id_t switch_id, size_t max_bulk_size,
+                 sai_bulk_op_error_mode_t error_mode = SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR) :
+        max_bulk_size(max_bulk_size),
+        error_mode(error_mode)
     {
         throw std::logic_error("Not implemented");
     }
 
+    // For APIs without bulk functions of their own, e.g. the ACL API which has
+    // several object types: the caller binds the bulk functions to use
+    ObjectBulker(typename Ts::bulk_create_entry_fn create_fn, typename Ts::bulk_remove_entry_fn remove_fn,
+                 sai_object_id_t switch_id, size_t max_bulk_size,
+                 sai_bulk_op_error_mode_t error_mode = SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR) :
+        switch_id(switch_id),
+        max_bulk_size(max_bulk_size),
+        error_mode(error_mode),
+        create_entries(create_fn),
+        remove_entries(remove_fn)
+    {
+    }
+
+    sai_status_t create_entry(
+        _Out_ sai_object_id_t *object_id,
+        _In_ uint32_t attr_count,
+        _In_ const sai_attribute_t *attr_list)
+    {
+        return create_entry(object_id, nullptr, attr_count, attr_list);
+    }
+
+    // object_status, if not null, receives the status of this entry on flush
     sai_status_t create_entry(
         _Out_ sai_object_id_t *object_id,
+        _Out_ sai_status_t *object_status,
         _In_ uint32_t attr_count,
         _In_ const sai_attribute_t *attr_list)
     {
@@ -922,12 +960,16 @@ public:
         assert(attr_list);
         if (!attr_list) throw std::invalid_argument("attr_list is null");
 
-        creating_entries.emplace_back(std::piecewise_construct, std::forward_as_tuple(object_id), std::forward_as_tuple(attr_list, attr_list + attr_count));
+        creating_entries.emplace_back(object_id, std::vector<sai_attribute_t>(attr_list, attr_list + attr_count), object_status);
 
         auto& last_attrs = std::get<1>(creating_entries.back());
         SWSS_LOG_INFO("ObjectBulker.create_entry %zu, %zu, %u\n", creating_entries.size(), last_attrs.size(), last_attrs[0].id);
 
         *object_id = SAI_NULL_OBJECT_ID; // not created immediately, postponed until flush
+        if (object_status)
+        {
+            *object_status = SAI_STATUS_NOT_EXECUTED;
+        }
         return SAI_STATUS_NOT_EXECUTED;
     }
 
@@ -1007,6 +1049,7 @@ public:
             std::vector<sai_object_id_t *> rs;
             std::vector<sai_attribute_t const*> tss;
             std::vector<uint32_t> cs;
+            std::vector<sai_status_t *> ss;
 
             for (auto const& i: creating_entries)
             {
@@ -1017,14 +1060,15 @@ public:
                     rs.push_back(pid);
                     tss.push_back(attrs.data());
                     cs.push_back((uint32_t)attrs.size());
+                    ss.push_back(std::get<2>(i));
 
                     if (rs.size() >= max_bulk_size)
                     {
-                        flush_creating_entries(rs, tss, cs);
+                        flush_creating_entries(rs, tss, cs, ss);
                     }
                 }
             }
-            flush_creating_entries(rs, tss, cs);
+            flush_creating_entries(rs, tss, cs, ss);
 
             creating_entries.clear();
         }
@@ -1102,9 +1146,12 @@ private:
 
     size_t max_bulk_size;
 
-    std::vector<std::pair<                                  // A vector of pair of
+    sai_bulk_op_error_mode_t                                error_mode;
+
+    std::vector<std::tuple<                                 // A vector of tuple of
             sai_object_id_t *,                              // - object_id
-            std::vector<sai_attribute_t>                    // - attrs
+            std::vector<sai_attribute_t>,                   // - attrs
+            sai_status_t *                                  // - OUT object_status, may be null
     >>                                                      creating_entries;
 
     std::unordered_map<                                     // A map of
@@ -1134,8 +1181,8 @@ private:
             return SAI_STATUS_SUCCESS;
         }
         size_t count = rs.size();
-        std::vector<sai_status_t> statuses(count);
-        sai_status_t status = (*remove_entries)((uint32_t)count, rs.data(), SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, statuses.data());
+        std::vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+        sai_status_t status = (*remove_entries)((uint32_t)count, rs.data(), error_mode, statuses.data());
         if (status == SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_INFO("ObjectBulker.flush removing_entries %zu rc=%d statuses[0]=%d\n", removing_entries.size(), status, statuses[0]);
@@ -1161,7 +1208,8 @@ private:
     sai_status_t flush_creating_entries(
         _Inout_ std::vector<sai_object_id_t *> &rs,
         _Inout_ std::vector<sai_attribute_t const*> &tss,
-        _Inout_ std::vector<uint32_t> &cs)
+        _Inout_ std::vector<uint32_t> &cs,
+        _Inout_ std::vector<sai_status_t *> &ss)
     {
         if (rs.empty())
         {
@@ -1169,9 +1217,9 @@ private:
         }
         size_t count = rs.size();
         std::vector<sai_object_id_t> object_ids(count);
-        std::vector<sai_status_t> statuses(count);
+        std::vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
         sai_status_t status = (*create_entries)(switch_id, (uint32_t)count, cs.data(), tss.data()
-            , SAI_BULK_OP_ERROR_MODE_STOP_ON_ERROR, object_ids.data(), statuses.data());
+            , error_mode, object_ids.data(), statuses.data());
         if (status == SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_INFO("ObjectBulker.flush creating_entries %zu\n", count);
@@ -1187,11 +1235,16 @@ private:
             create_statuses.emplace(object_ids[i], statuses[i]);
             sai_object_id_t *pid = rs[i];
             *pid = (statuses[i] == SAI_STATUS_SUCCESS) ? object_ids[i] : SAI_NULL_OBJECT_ID;
+            if (ss[i])
+            {
+                *ss[i] = statuses[i];
+            }
         }
 
         rs.clear();
         tss.clear();
         cs.clear();
+        ss.clear();
 
         return status;
     }
@@ -1229,9 +1282,10 @@ private:
 };
 
 template <>
-inline ObjectBulker<sai_next_hop_group_api_t>::ObjectBulker(SaiBulkerTraits<sai_next_hop_group_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) : 
+inline ObjectBulker<sai_next_hop_group_api_t>::ObjectBulker(SaiBulkerTraits<sai_next_hop_group_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size, sai_bulk_op_error_mode_t error_mode) :
     switch_id(switch_id),
-    max_bulk_size(max_bulk_size)
+    max_bulk_size(max_bulk_size),
+    error_mode(error_mode)
 {
     create_entries = api->create_next_hop_group_members;
     remove_entries = api->remove_next_hop_group_members;
@@ -1240,9 +1294,10 @@ inline ObjectBulker<sai_next_hop_group_api_t>::ObjectBulker(SaiBulkerTraits<sai_
 }
 
 template <>
-inline ObjectBulker<sai_next_hop_api_t>::ObjectBulker(SaiBulkerTraits<sai_next_hop_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+inline ObjectBulker<sai_next_hop_api_t>::ObjectBulker(SaiBulkerTraits<sai_next_hop_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size, sai_bulk_op_error_mode_t error_mode) :
     switch_id(switch_id),
-    max_bulk_size(max_bulk_size)
+    max_bulk_size(max_bulk_size),
+    error_mode(error_mode)
 {
     create_entries = api->create_next_hops;
     remove_entries = api->remove_next_hops;
@@ -1251,9 +1306,10 @@ inline ObjectBulker<sai_next_hop_api_t>::ObjectBulker(SaiBulkerTraits<sai_next_h
 }
 
 template <>
-inline ObjectBulker<sai_dash_vnet_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_vnet_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size) :
+inline ObjectBulker<sai_dash_vnet_api_t>::ObjectBulker(SaiBulkerTraits<sai_dash_vnet_api_t>::api_t *api, sai_object_id_t switch_id, size_t max_bulk_size, sai_bulk_op_error_mode_t error_mode) :
     switch_id(switch_id),
-    max_bulk_size(max_bulk_size)
+    max_bulk_size(max_bulk_size),
+    error_mode(error_mode)
 {
     create_entries = api->create_vnets;
     remove_entries = api->remove_vnets;
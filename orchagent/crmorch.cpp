@@ -1,4 +1,5 @@
 #include <sstream>
+#include <algorithm>
 #include <inttypes.h>
 
 #include "crmorch.h"
@@ -7,6 +8,7 @@
 #include "saihelper.h"
 
 #define CRM_POLLING_INTERVAL "polling_interval"
+#define CRM_POLLING_INTERVAL_NEAR_THRESHOLD "polling_interval_near_threshold"
 #define CRM_COUNTERS_TABLE_KEY "STATS"
 
 #define CRM_POLLING_INTERVAL_DEFAULT (5 * 60)
@@ -24,6 +26,7 @@ extern sai_switch_api_t *sai_switch_api;
 extern sai_acl_api_t *sai_acl_api;
 extern event_handle_t g_events_handle;
 extern string gMySwitchType;
+extern size_t gMaxBulkSize;
 
 const map<CrmResourceType, string> crmResTypeNameMap =
 {
@@ -370,12 +373,15 @@ const map<string, CrmResourceType> crmUsedCntsTableMap =
 CrmOrch::CrmOrch(DBConnector *db, string tableName):
     Orch(db, tableName),
     m_countersDb(new DBConnector("COUNTERS_DB", 0)),
-    m_countersCrmTable(new Table(m_countersDb.get(), COUNTERS_CRM_TABLE)),
+    m_countersPipeline(new RedisPipeline(m_countersDb.get())),
+    m_countersCrmTable(new Table(m_countersPipeline.get(), COUNTERS_CRM_TABLE, true)),
     m_timer(new SelectableTimer(timespec { .tv_sec = CRM_POLLING_INTERVAL_DEFAULT, .tv_nsec = 0 }))
 {
     SWSS_LOG_ENTER();
 
     m_pollingInterval = chrono::seconds(CRM_POLLING_INTERVAL_DEFAULT);
+    m_nearThresholdPollingInterval = chrono::seconds(0);
+    m_timerInterval = m_pollingInterval;
 
     for (const auto &res : crmResTypeNameMap)
     {
@@ -384,6 +390,7 @@ CrmOrch::CrmOrch(DBConnector *db, string tableName):
 
     // The CRM stats needs to be populated again
     m_countersCrmTable->del(CRM_COUNTERS_TABLE_KEY);
+    m_countersCrmTable->flush();
 
     // Note: ExecutableTimer will hold m_timer pointer and release the object later
     auto executor = new ExecutableTimer(m_timer, this, "CRM_COUNTERS_POLL");
@@ -459,9 +466,12 @@ void CrmOrch::handleSetCommand(const string& key, const vector<FieldValueTuple>&
             if (field == CRM_POLLING_INTERVAL)
             {
                 m_pollingInterval = chrono::seconds(to_uint<uint32_t>(value));
-                auto interv = timespec { .tv_sec = (time_t)m_pollingInterval.count(), .tv_nsec = 0 };
-                m_timer->setInterval(interv);
-                m_timer->reset();
+                setTimerInterval(m_pollingInterval);
+            }
+            else if (field == CRM_POLLING_INTERVAL_NEAR_THRESHOLD)
+            {
+                // Taken into account from the next poll
+                m_nearThresholdPollingInterval = chrono::seconds(to_uint<uint32_t>(value));
             }
             else if (crmThreshTypeResMap.find(field) != crmThreshTypeResMap.end())
             {
@@ -567,25 +577,12 @@ void CrmOrch::decCrmAclUsedCounter(CrmResourceType resource, sai_acl_stage_t sta
         // remove acl_entry and acl_counter in this acl table
         if (resource == CrmResourceType::CRM_ACL_TABLE)
         {
-            for (auto &resourcesMap : m_resourcesMap)
-            {
-                if ((resourcesMap.first == (CrmResourceType::CRM_ACL_ENTRY))
-                    || (resourcesMap.first == (CrmResourceType::CRM_ACL_COUNTER)))
-                {
-                    auto &cntMap = resourcesMap.second.countersMap;
-                    for (auto it = cntMap.begin(); it != cntMap.end(); ++it)
-                    {
-                        if (it->second.id == oid)
-                        {
-                            cntMap.erase(it);
-                            break;
-                        }
-                    }
-                }
-            }
+            removeCrmObjectCounter(m_resourcesMap.at(CrmResourceType::CRM_ACL_ENTRY), oid, &CrmOrch::getCrmAclTableKey);
+            removeCrmObjectCounter(m_resourcesMap.at(CrmResourceType::CRM_ACL_COUNTER), oid, &CrmOrch::getCrmAclTableKey);
 
             // remove ACL_TABLE_STATS in crm database
             m_countersCrmTable->del(getCrmAclTableKey(oid));
+            m_countersCrmTable->flush();
         }
     }
     catch (...)
@@ -601,8 +598,7 @@ void CrmOrch::incCrmAclTableUsedCounter(CrmResourceType resource, sai_object_id_
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].usedCounter++;
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].id = tableId;
+        getCrmObjectCounter(m_resourcesMap.at(resource), tableId, &CrmOrch::getCrmAclTableKey).usedCounter++;
     }
     catch (...)
     {
@@ -617,7 +613,7 @@ void CrmOrch::decCrmAclTableUsedCounter(CrmResourceType resource, sai_object_id_
 
     try
     {
-        m_resourcesMap.at(resource).countersMap[getCrmAclTableKey(tableId)].usedCounter--;
+        getCrmObjectCounter(m_resourcesMap.at(resource), tableId, &CrmOrch::getCrmAclTableKey).usedCounter--;
     }
     catch (...)
     {
@@ -665,20 +661,20 @@ void CrmOrch::incCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
         if (resource == CrmResourceType::CRM_DASH_IPV4_ACL_GROUP)
         {
             incCrmResUsedCounter(resource);
-            auto &rule_cnt = m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV4_ACL_RULE).countersMap[getCrmDashAclGroupKey(tableId)];
+            auto &rule_cnt = getCrmObjectCounter(m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV4_ACL_RULE), tableId,
+                                                 &CrmOrch::getCrmDashAclGroupKey);
             rule_cnt.usedCounter = 0;
-            rule_cnt.id = tableId;
         }
         else if (resource == CrmResourceType::CRM_DASH_IPV6_ACL_GROUP)
         {
             incCrmResUsedCounter(resource);
-            auto &rule_cnt = m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV6_ACL_RULE).countersMap[getCrmDashAclGroupKey(tableId)];
+            auto &rule_cnt = getCrmObjectCounter(m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV6_ACL_RULE), tableId,
+                                                 &CrmOrch::getCrmDashAclGroupKey);
             rule_cnt.usedCounter = 0;
-            rule_cnt.id = tableId;
         }
         else 
         {
-            auto &rule_cnt = m_resourcesMap.at(resource).countersMap[getCrmDashAclGroupKey(tableId)];
+            auto &rule_cnt = getCrmObjectCounter(m_resourcesMap.at(resource), tableId, &CrmOrch::getCrmDashAclGroupKey);
             ++rule_cnt.usedCounter;
         }
     }
@@ -698,18 +694,22 @@ void CrmOrch::decCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
         if (resource == CrmResourceType::CRM_DASH_IPV4_ACL_GROUP)
         {
             decCrmResUsedCounter(resource);
-            m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV4_ACL_RULE).countersMap.erase(getCrmDashAclGroupKey(tableId));
+            removeCrmObjectCounter(m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV4_ACL_RULE), tableId,
+                                   &CrmOrch::getCrmDashAclGroupKey);
             m_countersCrmTable->del(getCrmDashAclGroupKey(tableId));
+            m_countersCrmTable->flush();
         }
         else if (resource == CrmResourceType::CRM_DASH_IPV6_ACL_GROUP)
         {
             decCrmResUsedCounter(resource);
-            m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV6_ACL_RULE).countersMap.erase(getCrmDashAclGroupKey(tableId));
+            removeCrmObjectCounter(m_resourcesMap.at(CrmResourceType::CRM_DASH_IPV6_ACL_RULE), tableId,
+                                   &CrmOrch::getCrmDashAclGroupKey);
             m_countersCrmTable->del(getCrmDashAclGroupKey(tableId));
+            m_countersCrmTable->flush();
         }
         else 
         {
-            auto &rule_cnt = m_resourcesMap.at(resource).countersMap[getCrmDashAclGroupKey(tableId)];
+            auto &rule_cnt = getCrmObjectCounter(m_resourcesMap.at(resource), tableId, &CrmOrch::getCrmDashAclGroupKey);
             --rule_cnt.usedCounter;
         }
     }
@@ -720,13 +720,61 @@ void CrmOrch::decCrmDashAclUsedCounter(CrmResourceType resource, sai_object_id_t
     }
 }
 
+CrmOrch::CrmResourceCounter &CrmOrch::getCrmObjectCounter(CrmResourceEntry &res, sai_object_id_t id,
+                                                          string (CrmOrch::*getKey)(sai_object_id_t))
+{
+    auto it = res.countersById.find(id);
+    if (it != res.countersById.end())
+    {
+        return *it->second;
+    }
+
+    auto &cnt = res.countersMap[(this->*getKey)(id)];
+    cnt.id = id;
+    res.countersById[id] = &cnt;
+    return cnt;
+}
+
+void CrmOrch::removeCrmObjectCounter(CrmResourceEntry &res, sai_object_id_t id,
+                                     string (CrmOrch::*getKey)(sai_object_id_t))
+{
+    res.countersById.erase(id);
+    res.countersMap.erase((this->*getKey)(id));
+}
+
 void CrmOrch::doTask(SelectableTimer &timer)
 {
     SWSS_LOG_ENTER();
 
     getResAvailableCounters();
     updateCrmCountersTable();
-    checkCrmThresholds();
+    updatePollingInterval(checkCrmThresholds());
+}
+
+void CrmOrch::setTimerInterval(chrono::seconds interval)
+{
+    m_timerInterval = interval;
+    auto interv = timespec { .tv_sec = (time_t)interval.count(), .tv_nsec = 0 };
+    m_timer->setInterval(interv);
+    m_timer->reset();
+}
+
+void CrmOrch::updatePollingInterval(bool nearThreshold)
+{
+    SWSS_LOG_ENTER();
+
+    auto interval = m_pollingInterval;
+    if (nearThreshold && (m_nearThresholdPollingInterval.count() > 0) && (m_nearThresholdPollingInterval < interval))
+    {
+        interval = m_nearThresholdPollingInterval;
+    }
+
+    if (interval != m_timerInterval)
+    {
+        SWSS_LOG_NOTICE("CRM polling interval set to %" PRId64 " seconds, %s low thresholds",
+                        static_cast<int64_t>(interval.count()), nearThreshold ? "resources above" : "all resources below");
+        setTimerInterval(interval);
+    }
 }
 
 bool CrmOrch::getResAvailability(CrmResourceType type, CrmResourceEntry &res)
@@ -847,10 +895,162 @@ bool CrmOrch::getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEn
     return true;
 }
 
+static bool isResNotSupportedStatus(sai_status_t status)
+{
+    return (status == SAI_STATUS_NOT_SUPPORTED) ||
+           (status == SAI_STATUS_NOT_IMPLEMENTED) ||
+           SAI_STATUS_IS_ATTR_NOT_SUPPORTED(status) ||
+           SAI_STATUS_IS_ATTR_NOT_IMPLEMENTED(status);
+}
+
+void CrmOrch::getAclTableResAvailability(sai_object_id_t tableId, const vector<CrmResourceType> &types,
+                                         const vector<sai_attribute_t> &attrs)
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t j = 0; j < types.size(); j++)
+    {
+        auto &res = m_resourcesMap.at(types[j]);
+        if (res.resStatus != CrmResourceStatus::CRM_RES_SUPPORTED)
+        {
+            continue;
+        }
+
+        sai_attribute_t attr = attrs[j];
+        sai_status_t status = sai_acl_api->get_acl_table_attribute(tableId, 1, &attr);
+        if (isResNotSupportedStatus(status))
+        {
+            // mark unsupported resources
+            res.resStatus = CrmResourceStatus::CRM_RES_NOT_SUPPORTED;
+            SWSS_LOG_NOTICE("CRM resource %s not supported", crmResTypeNameMap.at(types[j]).c_str());
+            continue;
+        }
+        if (status != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to get ACL table 0x%" PRIx64 " attribute %u, rv:%d", tableId, attr.id, status);
+            continue;
+        }
+
+        auto it = res.countersById.find(tableId);
+        if (it != res.countersById.end())
+        {
+            it->second->availableCounter = attr.value.u32;
+        }
+    }
+}
+
+void CrmOrch::getAclTableResAvailability()
+{
+    SWSS_LOG_ENTER();
+
+    // The ACL entries and counters available in each ACL table are both queried with one get of the ACL table
+    vector<CrmResourceType> types;
+    vector<sai_attribute_t> attrs;
+    for (auto type : { CrmResourceType::CRM_ACL_ENTRY, CrmResourceType::CRM_ACL_COUNTER })
+    {
+        if (m_resourcesMap.at(type).resStatus == CrmResourceStatus::CRM_RES_SUPPORTED)
+        {
+            sai_attribute_t attr;
+            attr.id = crmResSaiAvailAttrMap.at(type);
+            types.push_back(type);
+            attrs.push_back(attr);
+        }
+    }
+
+    vector<sai_object_id_t> tableIds;
+    for (auto type : types)
+    {
+        for (const auto &cnt : m_resourcesMap.at(type).countersById)
+        {
+            tableIds.push_back(cnt.first);
+        }
+    }
+    sort(tableIds.begin(), tableIds.end());
+    tableIds.erase(unique(tableIds.begin(), tableIds.end()), tableIds.end());
+
+    uint32_t attr_count = (uint32_t)attrs.size();
+    size_t bulk_size = gMaxBulkSize ? gMaxBulkSize : tableIds.size();
+    vector<sai_attribute_t> attr_values;
+    vector<uint32_t> attr_counts;
+    vector<sai_attribute_t *> attr_lists;
+    vector<sai_status_t> statuses;
+
+    for (size_t begin = 0; begin < tableIds.size(); begin += bulk_size)
+    {
+        size_t count = min(bulk_size, tableIds.size() - begin);
+        bool queried = false;
+
+        attr_values.clear();
+        for (size_t i = 0; i < count; i++)
+        {
+            attr_values.insert(attr_values.end(), attrs.begin(), attrs.end());
+        }
+        attr_counts.assign(count, attr_count);
+        attr_lists.resize(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            attr_lists[i] = &attr_values[i * attr_count];
+        }
+        statuses.assign(count, SAI_STATUS_NOT_EXECUTED);
+
+        if (m_aclTableBulkGetSupported)
+        {
+            sai_status_t status = sai_bulk_object_get_attribute(gSwitchId, SAI_OBJECT_TYPE_ACL_TABLE, (uint32_t)count,
+                                                                &tableIds[begin], attr_counts.data(), attr_lists.data(),
+                                                                SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, statuses.data());
+            if ((status == SAI_STATUS_NOT_IMPLEMENTED) || (status == SAI_STATUS_NOT_SUPPORTED))
+            {
+                SWSS_LOG_NOTICE("Bulk get of ACL table attributes is not supported, querying them one table at a time");
+                m_aclTableBulkGetSupported = false;
+            }
+            else
+            {
+                queried = true;
+            }
+        }
+
+        if (!queried)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                statuses[i] = sai_acl_api->get_acl_table_attribute(tableIds[begin + i], attr_count, attr_lists[i]);
+            }
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            sai_status_t status = statuses[i];
+            if (isResNotSupportedStatus(status))
+            {
+                // Query the attributes one by one, only the resources that are not supported are marked so
+                getAclTableResAvailability(tableIds[begin + i], types, attrs);
+                continue;
+            }
+            if (status != SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_ERROR("Failed to get ACL table 0x%" PRIx64 " available resources, rv:%d", tableIds[begin + i], status);
+                continue;
+            }
+
+            for (size_t j = 0; j < types.size(); j++)
+            {
+                auto &res = m_resourcesMap.at(types[j]);
+                auto it = res.countersById.find(tableIds[begin + i]);
+                if (it != res.countersById.end())
+                {
+                    it->second->availableCounter = attr_lists[i][j].value.u32;
+                }
+            }
+        }
+    }
+}
+
 void CrmOrch::getResAvailableCounters()
 {
     SWSS_LOG_ENTER();
 
+    getAclTableResAvailability();
+
     for (auto &res : m_resourcesMap)
     {
         // ignore unsupported resources
@@ -959,31 +1159,7 @@ void CrmOrch::getResAvailableCounters()
             case CrmResourceType::CRM_ACL_ENTRY:
             case CrmResourceType::CRM_ACL_COUNTER:
             {
-                sai_attribute_t attr;
-                attr.id = crmResSaiAvailAttrMap.at(res.first);
-
-                for (auto &cnt : res.second.countersMap)
-                {
-                    sai_status_t status = sai_acl_api->get_acl_table_attribute(cnt.second.id, 1, &attr);
-                    if ((status == SAI_STATUS_NOT_SUPPORTED) ||
-                        (status == SAI_STATUS_NOT_IMPLEMENTED) ||
-                        SAI_STATUS_IS_ATTR_NOT_SUPPORTED(status) ||
-                        SAI_STATUS_IS_ATTR_NOT_IMPLEMENTED(status))
-                    {
-                        // mark unsupported resources
-                        res.second.resStatus = CrmResourceStatus::CRM_RES_NOT_SUPPORTED;
-                        SWSS_LOG_NOTICE("CRM resource %s not supported", crmResTypeNameMap.at(res.first).c_str());
-                        break;
-                    }
-                    if (status != SAI_STATUS_SUCCESS)
-                    {
-                        SWSS_LOG_ERROR("Failed to get ACL table attribute %u , rv:%d", attr.id, status);
-                        break;
-                    }
-
-                    cnt.second.availableCounter = attr.value.u32;
-                }
-
+                // Queried together for the ACL tables above
                 break;
             }
 
@@ -1032,22 +1208,32 @@ void CrmOrch::updateCrmCountersTable()
 {
     SWSS_LOG_ENTER();
 
+    // Only the counters that changed since they were last written are updated, a single write per key.
+    // All of them are rewritten periodically, a counter removed from COUNTERS_DB does not stay missing.
+    map<string, vector<FieldValueTuple>> updates;
+    bool republish = (m_pollsSinceRepublish == 0);
+    m_pollsSinceRepublish = (m_pollsSinceRepublish + 1) % CRM_COUNTERS_REPUBLISH_POLLS;
+
     // Update CRM used counters in COUNTERS_DB
     for (const auto &i : crmUsedCntsTableMap)
     {
         try
         {
-            const auto &res = m_resourcesMap.at(i.second);
+            auto &res = m_resourcesMap.at(i.second);
             if (res.resStatus == CrmResourceStatus::CRM_RES_NOT_SUPPORTED)
             {
                 continue;
             }
 
-            for (const auto &cnt : res.countersMap)
+            for (auto &cnt : res.countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.usedCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
+                if (!republish && cnt.second.usedPublished && (cnt.second.publishedUsedCounter == cnt.second.usedCounter))
+                {
+                    continue;
+                }
+                updates[cnt.first].emplace_back(i.first, to_string(cnt.second.usedCounter));
+                cnt.second.publishedUsedCounter = cnt.second.usedCounter;
+                cnt.second.usedPublished = true;
             }
         }
         catch(const out_of_range &e)
@@ -1061,17 +1247,21 @@ void CrmOrch::updateCrmCountersTable()
     {
         try
         {
-            const auto &res = m_resourcesMap.at(i.second);
+            auto &res = m_resourcesMap.at(i.second);
             if (res.resStatus == CrmResourceStatus::CRM_RES_NOT_SUPPORTED)
             {
                 continue;
             }
 
-            for (const auto &cnt : res.countersMap)
+            for (auto &cnt : res.countersMap)
             {
-                FieldValueTuple attr(i.first, to_string(cnt.second.availableCounter));
-                vector<FieldValueTuple> attrs = { attr };
-                m_countersCrmTable->set(cnt.first, attrs);
+                if (!republish && cnt.second.availablePublished && (cnt.second.publishedAvailableCounter == cnt.second.availableCounter))
+                {
+                    continue;
+                }
+                updates[cnt.first].emplace_back(i.first, to_string(cnt.second.availableCounter));
+                cnt.second.publishedAvailableCounter = cnt.second.availableCounter;
+                cnt.second.availablePublished = true;
             }
         }
         catch(const out_of_range &e)
@@ -1079,12 +1269,26 @@ void CrmOrch::updateCrmCountersTable()
             // expected when a resource is unavailable
         }
     }
+
+    if (updates.empty())
+    {
+        return;
+    }
+
+    for (const auto &update : updates)
+    {
+        m_countersCrmTable->set(update.first, update.second);
+    }
+    m_countersCrmTable->flush();
 }
 
-void CrmOrch::checkCrmThresholds()
+bool CrmOrch::checkCrmThresholds()
 {
     SWSS_LOG_ENTER();
 
+    // A resource is above its low threshold
+    bool nearThreshold = false;
+
     for (auto &i : m_resourcesMap)
     {
         auto &res = i.second;
@@ -1133,6 +1337,11 @@ void CrmOrch::checkCrmThresholds()
                     throw runtime_error("Unknown threshold type for CRM resource");
             }
 
+            if (utilization > res.lowThreshold)
+            {
+                nearThreshold = true;
+            }
+
             if ((utilization >= res.highThreshold) && (cnt.exceededLogCounter < CRM_EXCEEDED_MSG_MAX))
             {
                 event_params_t params = {
@@ -1155,6 +1364,8 @@ void CrmOrch::checkCrmThresholds()
             }
         } // end of counters loop
     } // end of resources loop
+
+    return nearThreshold;
 }
 
 
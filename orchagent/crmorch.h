@@ -3,6 +3,7 @@
 #include <thread>
 #include <chrono>
 #include <map>
+#include <unordered_map>
 #include "orch.h"
 #include "port.h"
 #include "events.h"
@@ -11,6 +12,9 @@ extern "C" {
 #include "sai.h"
 }
 
+// All the counters are rewritten to COUNTERS_DB every that many polls, in case they were removed from it
+#define CRM_COUNTERS_REPUBLISH_POLLS 6
+
 enum class CrmResourceType
 {
     CRM_IPV4_ROUTE,
@@ -91,6 +95,7 @@ public:
 
 private:
     std::shared_ptr<swss::DBConnector> m_countersDb = nullptr;
+    std::shared_ptr<swss::RedisPipeline> m_countersPipeline = nullptr;
     std::shared_ptr<swss::Table> m_countersCrmTable = nullptr;
     swss::SelectableTimer *m_timer = nullptr;
 
@@ -100,6 +105,12 @@ private:
         uint32_t availableCounter = 0;
         uint32_t usedCounter = 0;
         uint32_t exceededLogCounter = 0;
+
+        // Values last written to COUNTERS_DB
+        uint32_t publishedAvailableCounter = 0;
+        uint32_t publishedUsedCounter = 0;
+        bool availablePublished = false;
+        bool usedPublished = false;
     };
 
     struct CrmResourceEntry
@@ -113,11 +124,21 @@ private:
         uint32_t highThreshold = 85;
 
         std::map<std::string, CrmResourceCounter> countersMap;
+        // Counters of countersMap that are kept per object (ACL table, DASH ACL group), by object id
+        std::unordered_map<sai_object_id_t, CrmResourceCounter *> countersById;
 
         CrmResourceStatus resStatus = CrmResourceStatus::CRM_RES_SUPPORTED;
     };
 
     std::chrono::seconds m_pollingInterval;
+    // Polling interval while a resource is above its low threshold, 0 when disabled
+    std::chrono::seconds m_nearThresholdPollingInterval;
+    // Interval the timer is currently set to
+    std::chrono::seconds m_timerInterval;
+
+    bool m_aclTableBulkGetSupported = true;
+    // Polls since all the counters were last written to COUNTERS_DB
+    uint32_t m_pollsSinceRepublish = 0;
 
     std::map<CrmResourceType, CrmResourceEntry> m_resourcesMap;
 
@@ -126,9 +147,18 @@ private:
     void doTask(swss::SelectableTimer &timer);
     bool getResAvailability(CrmResourceType type, CrmResourceEntry &res);
     bool getDashAclGroupResAvailability(CrmResourceType type, CrmResourceEntry &res);
+    void getAclTableResAvailability();
+    void getAclTableResAvailability(sai_object_id_t tableId, const std::vector<CrmResourceType> &types,
+                                    const std::vector<sai_attribute_t> &attrs);
     void getResAvailableCounters();
     void updateCrmCountersTable();
-    void checkCrmThresholds();
+    bool checkCrmThresholds();
+    void updatePollingInterval(bool nearThreshold);
+    void setTimerInterval(std::chrono::seconds interval);
+    CrmResourceCounter &getCrmObjectCounter(CrmResourceEntry &res, sai_object_id_t id,
+                                            std::string (CrmOrch::*getKey)(sai_object_id_t));
+    void removeCrmObjectCounter(CrmResourceEntry &res, sai_object_id_t id,
+                                std::string (CrmOrch::*getKey)(sai_object_id_t));
     std::string getCrmAclKey(sai_acl_stage_t stage, sai_acl_bind_point_type_t bindPoint);
     std::string getCrmAclTableKey(sai_object_id_t id);
     std::string getCrmP4rtTableKey(std::string table_name);
@@ -21,6 +21,7 @@
 #include "saihelper.h"
 
 #include "taskworker.h"
+#include "taskworkerpool.h"
 #include "pbutils.h"
 #include "dash_api/route_type.pb.h"
 
@@ -257,6 +258,10 @@ void DashRouteOrch::doTaskRouteTable(ConsumerBase& consumer)
 {
     SWSS_LOG_ENTER();
 
+    // Protobuf messages are decoded on the worker pool, in the order of m_toSync
+    auto decoded = decodePbMessages<dash::route::Route>(consumer.m_toSync);
+    size_t task_index = 0;
+
     auto it = consumer.m_toSync.begin();
 
     while (it != consumer.m_toSync.end())
@@ -267,6 +272,7 @@ void DashRouteOrch::doTaskRouteTable(ConsumerBase& consumer)
         while (it != consumer.m_toSync.end())
         {
             KeyOpFieldsValuesTuple tuple = it->second;
+            auto& decoded_task = decoded[task_index++];
             const string& key = kfvKey(tuple);
             auto op = kfvOp(tuple);
             auto rc = toBulk.emplace(std::piecewise_construct,
@@ -292,12 +298,13 @@ void DashRouteOrch::doTaskRouteTable(ConsumerBase& consumer)
 
             if (op == SET_COMMAND)
             {
-                if (!parsePbMessage(kfvFieldsValues(tuple), ctxt.metadata))
+                if (!decoded_task.parsed)
                 {
                     SWSS_LOG_WARN("Requires protobuff at OutboundRouting :%s", key.c_str());
                     it = consumer.m_toSync.erase(it);
                     continue;
                 }
+                ctxt.metadata.Swap(&decoded_task.msg);
                 if (ctxt.metadata.routing_type() == dash::route_type::RoutingType::ROUTING_TYPE_UNSPECIFIED)
                 {
                     // Route::action_type is deprecated in favor of Route::routing_type. For messages still using the old action_type field,
@@ -538,6 +545,10 @@ void DashRouteOrch::doTaskRouteRuleTable(ConsumerBase& consumer)
 {
     SWSS_LOG_ENTER();
 
+    // Protobuf messages are decoded on the worker pool, in the order of m_toSync
+    auto decoded = decodePbMessages<dash::route_rule::RouteRule>(consumer.m_toSync);
+    size_t task_index = 0;
+
     auto it = consumer.m_toSync.begin();
 
     while (it != consumer.m_toSync.end())
@@ -548,6 +559,7 @@ void DashRouteOrch::doTaskRouteRuleTable(ConsumerBase& consumer)
         while (it != consumer.m_toSync.end())
         {
             KeyOpFieldsValuesTuple tuple = it->second;
+            auto& decoded_task = decoded[task_index++];
             const string& key = kfvKey(tuple);
             auto op = kfvOp(tuple);
             auto rc = toBulk.emplace(std::piecewise_construct,
@@ -580,12 +592,13 @@ void DashRouteOrch::doTaskRouteRuleTable(ConsumerBase& consumer)
 
             if (op == SET_COMMAND)
             {
-                if (!parsePbMessage(kfvFieldsValues(tuple), ctxt.metadata))
+                if (!decoded_task.parsed)
                 {
                     SWSS_LOG_WARN("Requires protobuff at InboundRouting :%s", key.c_str());
                     it = consumer.m_toSync.erase(it);
                     continue;
                 }
+                ctxt.metadata.Swap(&decoded_task.msg);
                 if (addInboundRouting(key, ctxt))
                 {
                     it = consumer.m_toSync.erase(it);
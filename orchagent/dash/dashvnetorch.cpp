@@ -23,6 +23,7 @@
 #include "directory.h"
 
 #include "taskworker.h"
+#include "taskworkerpool.h"
 #include "pbutils.h"
 
 using namespace std;
@@ -690,6 +691,10 @@ void DashVnetOrch::doTaskVnetMapTable(ConsumerBase& consumer)
 {
     SWSS_LOG_ENTER();
 
+    // Protobuf messages are decoded on the worker pool, in the order of m_toSync
+    auto decoded = decodePbMessages<dash::vnet_mapping::VnetMapping>(consumer.m_toSync);
+    size_t task_index = 0;
+
     auto it = consumer.m_toSync.begin();
 
     while (it != consumer.m_toSync.end())
@@ -700,6 +705,7 @@ void DashVnetOrch::doTaskVnetMapTable(ConsumerBase& consumer)
         while (it != consumer.m_toSync.end())
         {
             KeyOpFieldsValuesTuple tuple = it->second;
+            auto& decoded_task = decoded[task_index++];
             const string& key = kfvKey(tuple);
             auto op = kfvOp(tuple);
             auto rc = toBulk.emplace(std::piecewise_construct,
@@ -724,12 +730,13 @@ void DashVnetOrch::doTaskVnetMapTable(ConsumerBase& consumer)
 
             if (op == SET_COMMAND)
             {
-                if (!parsePbMessage(kfvFieldsValues(tuple), ctxt.metadata))
+                if (!decoded_task.parsed)
                 {
                     SWSS_LOG_WARN("Requires protobuff at VnetMap :%s", key.c_str());
                     it = consumer.m_toSync.erase(it);
                     continue;
                 }
+                ctxt.metadata.Swap(&decoded_task.msg);
                 if (ctxt.metadata.routing_type() == dash::route_type::RoutingType::ROUTING_TYPE_UNSPECIFIED)
                 {
                     // VnetMapping::action_type is deprecated in favor of VnetMapping::routing_type. For messages still using the old action_type field,
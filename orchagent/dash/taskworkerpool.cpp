@@ -0,0 +1,140 @@
+#include <algorithm>
+
+#include "taskworkerpool.h"
+
+using namespace std;
+
+// Tasks taken by a thread at a time
+#define TASK_WORKER_POOL_CHUNK_SIZE 64
+// Fewer tasks are run on the calling thread only
+#define TASK_WORKER_POOL_MIN_TASKS 256
+#define TASK_WORKER_POOL_MAX_THREADS 4
+
+TaskWorkerPool::TaskWorkerPool(size_t threads)
+{
+    SWSS_LOG_ENTER();
+
+    for (size_t i = 0; i < threads; i++)
+    {
+        m_threads.emplace_back(&TaskWorkerPool::workerThread, this);
+    }
+}
+
+TaskWorkerPool::~TaskWorkerPool()
+{
+    SWSS_LOG_ENTER();
+
+    {
+        lock_guard<mutex> lock(m_lock);
+        m_shutdown = true;
+    }
+    m_signal.notify_all();
+
+    for (auto &thread : m_threads)
+    {
+        thread.join();
+    }
+}
+
+TaskWorkerPool &TaskWorkerPool::getInstance()
+{
+    // The main thread keeps running tasks too
+    static TaskWorkerPool pool(min<size_t>(TASK_WORKER_POOL_MAX_THREADS,
+                                           max<size_t>(thread::hardware_concurrency(), 1) - 1));
+    return pool;
+}
+
+void TaskWorkerPool::run(size_t count, const function<void(size_t)> &func)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_threads.empty() || count < TASK_WORKER_POOL_MIN_TASKS)
+    {
+        for (size_t i = 0; i < count; i++)
+        {
+            func(i);
+        }
+        return;
+    }
+
+    {
+        lock_guard<mutex> lock(m_lock);
+        m_func = &func;
+        m_count = count;
+        m_next = 0;
+        m_error = nullptr;
+        m_busyThreads = m_threads.size();
+        m_generation++;
+    }
+    m_signal.notify_all();
+
+    runTasks();
+
+    exception_ptr error;
+    {
+        unique_lock<mutex> lock(m_lock);
+        m_doneSignal.wait(lock, [&]() { return m_busyThreads == 0; });
+        m_func = nullptr;
+        error = m_error;
+    }
+
+    if (error)
+    {
+        rethrow_exception(error);
+    }
+}
+
+void TaskWorkerPool::runTasks()
+{
+    while (true)
+    {
+        size_t begin = m_next.fetch_add(TASK_WORKER_POOL_CHUNK_SIZE);
+        if (begin >= m_count)
+        {
+            break;
+        }
+
+        size_t end = min<size_t>(begin + TASK_WORKER_POOL_CHUNK_SIZE, m_count);
+        try
+        {
+            for (size_t i = begin; i < end; i++)
+            {
+                (*m_func)(i);
+            }
+        }
+        catch (...)
+        {
+            lock_guard<mutex> lock(m_lock);
+            if (!m_error)
+            {
+                m_error = current_exception();
+            }
+        }
+    }
+}
+
+void TaskWorkerPool::workerThread()
+{
+    uint64_t generation = 0;
+
+    while (true)
+    {
+        {
+            unique_lock<mutex> lock(m_lock);
+            m_signal.wait(lock, [&]() { return m_shutdown || m_generation != generation; });
+            if (m_shutdown)
+            {
+                return;
+            }
+            generation = m_generation;
+        }
+
+        runTasks();
+
+        {
+            lock_guard<mutex> lock(m_lock);
+            m_busyThreads--;
+        }
+        m_doneSignal.notify_one();
+    }
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <orch.h>
+
+#include "taskworker.h"
+
+// Decoding the protobuf payloads of millions of DASH entries takes most of the
+// time the DASH orchs spend on the main thread. TaskWorkerPool runs that part
+// on a fixed set of threads. The caller waits for the results, and then programs
+// the bulkers on the main thread in the order of m_toSync, as before.
+class TaskWorkerPool
+{
+public:
+    explicit TaskWorkerPool(size_t threads);
+    ~TaskWorkerPool();
+
+    // Pool shared by the DASH orchs
+    static TaskWorkerPool &getInstance();
+
+    // Calls func(i) for each i in [0, count) on the pool threads and the calling thread,
+    // returns once all the calls are done. The first exception thrown by func is rethrown.
+    // Only one thread may run tasks at a time.
+    void run(size_t count, const std::function<void(size_t)> &func);
+
+    size_t getThreadCount() const
+    {
+        return m_threads.size();
+    }
+
+private:
+    void runTasks();
+    void workerThread();
+
+    std::vector<std::thread> m_threads;
+
+    // Tasks of the current run
+    const std::function<void(size_t)> *m_func = nullptr;
+    size_t m_count = 0;
+    std::atomic<size_t> m_next{0};
+    std::exception_ptr m_error;
+
+    uint64_t m_generation = 0;
+    size_t m_busyThreads = 0;
+    bool m_shutdown = false;
+    std::mutex m_lock;
+    std::condition_variable m_signal;
+    std::condition_variable m_doneSignal;
+};
+
+template<typename MessageType>
+struct PbDecodeResult
+{
+    bool parsed = false;
+    MessageType msg;
+};
+
+// Parses the protobuf messages of the SET tasks of m_toSync on the pool,
+// the results are in the order of m_toSync.
+template<typename MessageType>
+std::vector<PbDecodeResult<MessageType>> decodePbMessages(const SyncMap &toSync)
+{
+    SWSS_LOG_ENTER();
+
+    std::vector<const swss::KeyOpFieldsValuesTuple *> tasks;
+    tasks.reserve(toSync.size());
+    for (const auto &it : toSync)
+    {
+        tasks.push_back(&it.second);
+    }
+
+    std::vector<PbDecodeResult<MessageType>> results(tasks.size());
+    TaskWorkerPool::getInstance().run(tasks.size(), [&](size_t i) {
+        if (kfvOp(*tasks[i]) == SET_COMMAND)
+        {
+            results[i].parsed = parsePbMessage(kfvFieldsValues(*tasks[i]), results[i].msg);
+        }
+    });
+
+    return results;
+}
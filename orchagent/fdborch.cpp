@@ -24,6 +24,140 @@ extern Directory<Orch*> gDirectory;
 
 const int FdbOrch::fdborch_pri = 20;
 
+void FdbEntryMap::set(const FdbEntry &entry, const FdbData &data)
+{
+    auto it = m_entries.find(entry);
+    if (it == m_entries.end())
+    {
+        it = m_entries.emplace(entry, data).first;
+    }
+    else
+    {
+        removeFromIndex(it->first, it->second.bridge_port_id);
+        it->second = data;
+    }
+
+    addToIndex(it->first, data.bridge_port_id);
+}
+
+size_t FdbEntryMap::erase(const FdbEntry &entry)
+{
+    auto it = m_entries.find(entry);
+    if (it == m_entries.end())
+    {
+        return 0;
+    }
+
+    removeFromIndex(it->first, it->second.bridge_port_id);
+    m_entries.erase(it);
+    return 1;
+}
+
+void FdbEntryMap::clear()
+{
+    m_entries.clear();
+    m_portIndex.clear();
+    m_vlanIndex.clear();
+}
+
+void FdbEntryMap::addToIndex(const FdbEntry &entry, sai_object_id_t bridge_port_id)
+{
+    m_portIndex[bridge_port_id][entry.bv_id].insert(entry.mac);
+    m_vlanIndex[entry.bv_id].insert(entry.mac);
+}
+
+void FdbEntryMap::removeFromIndex(const FdbEntry &entry, sai_object_id_t bridge_port_id)
+{
+    auto port = m_portIndex.find(bridge_port_id);
+    if (port != m_portIndex.end())
+    {
+        auto vlan = port->second.find(entry.bv_id);
+        if (vlan != port->second.end())
+        {
+            vlan->second.erase(entry.mac);
+            if (vlan->second.empty())
+            {
+                port->second.erase(vlan);
+            }
+        }
+        if (port->second.empty())
+        {
+            m_portIndex.erase(port);
+        }
+    }
+
+    auto vlan = m_vlanIndex.find(entry.bv_id);
+    if (vlan != m_vlanIndex.end())
+    {
+        vlan->second.erase(entry.mac);
+        if (vlan->second.empty())
+        {
+            m_vlanIndex.erase(vlan);
+        }
+    }
+}
+
+void FdbEntryMap::addEntries(sai_object_id_t bv_id, const std::set<MacAddress> &macs, vector<iterator> &entries)
+{
+    FdbEntry entry;
+    entry.bv_id = bv_id;
+
+    for (const auto &mac : macs)
+    {
+        entry.mac = mac;
+        auto it = m_entries.find(entry);
+        if (it != m_entries.end())
+        {
+            entries.push_back(it);
+        }
+    }
+}
+
+void FdbEntryMap::getEntries(sai_object_id_t bridge_port_id, sai_object_id_t bv_id, vector<iterator> &entries)
+{
+    if (bridge_port_id == SAI_NULL_OBJECT_ID && bv_id == SAI_NULL_OBJECT_ID)
+    {
+        entries.reserve(entries.size() + m_entries.size());
+        for (auto it = m_entries.begin(); it != m_entries.end(); it++)
+        {
+            entries.push_back(it);
+        }
+        return;
+    }
+
+    if (bridge_port_id == SAI_NULL_OBJECT_ID)
+    {
+        auto vlan = m_vlanIndex.find(bv_id);
+        if (vlan != m_vlanIndex.end())
+        {
+            addEntries(bv_id, vlan->second, entries);
+        }
+        return;
+    }
+
+    auto port = m_portIndex.find(bridge_port_id);
+    if (port == m_portIndex.end())
+    {
+        return;
+    }
+
+    if (bv_id == SAI_NULL_OBJECT_ID)
+    {
+        for (const auto &vlan : port->second)
+        {
+            addEntries(vlan.first, vlan.second, entries);
+        }
+        return;
+    }
+
+    auto vlan = port->second.find(bv_id);
+    if (vlan != port->second.end())
+    {
+        addEntries(bv_id, vlan->second, entries);
+    }
+}
+
+
 FdbOrch::FdbOrch(DBConnector* applDbConnector, vector<table_name_with_pri_t> appFdbTables,
     TableConnector stateDbFdbConnector, TableConnector stateDbMclagFdbConnector, PortsOrch *port) :
     Orch(applDbConnector, appFdbTables),
@@ -115,11 +249,11 @@ bool FdbOrch::storeFdbEntryState(const FdbUpdate& update)
         fdbdata.esi = "";
         fdbdata.vni = 0;
 
-        m_entries[entry] = fdbdata;
+        m_entries.set(entry, fdbdata);
         SWSS_LOG_INFO("FdbOrch notification: mac %s was inserted in port %s into bv_id 0x%" PRIx64,
                         entry.mac.to_string().c_str(), portName.c_str(), entry.bv_id);
         SWSS_LOG_INFO("m_entries size=%zu mac=%s port=0x%" PRIx64,
-            m_entries.size(), entry.mac.to_string().c_str(),  m_entries[entry].bridge_port_id);
+            m_entries.size(), entry.mac.to_string().c_str(), fdbdata.bridge_port_id);
 
         if (mac_move && (oldFdbData.origin == FDB_ORIGIN_MCLAG_ADVERTIZED))
         {
@@ -213,64 +347,16 @@ void FdbOrch::handleSyncdFlushNotif(const sai_object_id_t& bv_id,
     // Consolidated flush will have a zero mac
     MacAddress flush_mac("00:00:00:00:00:00");
 
-    if (bridge_port_id == SAI_NULL_OBJECT_ID && bv_id == SAI_NULL_OBJECT_ID)
-    {
-        for (auto itr = m_entries.begin(); itr != m_entries.end();)
-        {
-            auto curr = itr++;
-            if (curr->second.sai_fdb_type == sai_fdb_type &&
-                (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
-            {
-                clearFdbEntry(curr->first);
-            }
-        }
-    }
-    else if (bv_id == SAI_NULL_OBJECT_ID)
-    {
-        /* FLUSH based on PORT */
-        for (auto itr = m_entries.begin(); itr != m_entries.end();)
-        {
-            auto curr = itr++;
-            if (curr->second.bridge_port_id == bridge_port_id)
-            {
-                if (curr->second.sai_fdb_type == sai_fdb_type &&
-                    (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
-                {
-                    clearFdbEntry(curr->first);
-                }
-            }
-        }
-    }
-    else if (bridge_port_id == SAI_NULL_OBJECT_ID)
-    {
-        /* FLUSH based on BV_ID */
-        for (auto itr = m_entries.begin(); itr != m_entries.end();)
-        {
-            auto curr = itr++;
-            if (curr->first.bv_id == bv_id)
-            {
-                if (curr->second.sai_fdb_type == sai_fdb_type &&
-                    (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
-                {
-                    clearFdbEntry(curr->first);
-                }
-            }
-        }
-    }
-    else
+    /* FLUSH based on PORT and/or BV_ID, all entries if neither is set */
+    vector<FdbEntryMap::iterator> entries;
+    m_entries.getEntries(bridge_port_id, bv_id, entries);
+
+    for (auto curr : entries)
     {
-        /* FLUSH based on port and VLAN */
-        for (auto itr = m_entries.begin(); itr != m_entries.end();)
+        if (curr->second.sai_fdb_type == sai_fdb_type &&
+            (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
         {
-            auto curr = itr++;
-            if (curr->first.bv_id == bv_id && curr->second.bridge_port_id == bridge_port_id)
-            {
-                if (curr->second.sai_fdb_type == sai_fdb_type &&
-                    (curr->first.mac == mac || mac == flush_mac) && curr->second.is_flush_pending)
-                {
-                    clearFdbEntry(curr->first);
-                }
-            }
+            clearFdbEntry(curr->first);
         }
     }
 }
@@ -1131,16 +1217,19 @@ void FdbOrch::flushFDBEntries(sai_object_id_t bridge_port_oid,
     }
 
     if (SAI_STATUS_SUCCESS == rv) {
-        for (map<FdbEntry, FdbData>::iterator it = m_entries.begin();
-                it != m_entries.end(); it++)
+        vector<FdbEntryMap::iterator> entries;
+        if (bridge_port_oid != SAI_NULL_OBJECT_ID)
         {
-            if ((bridge_port_oid != SAI_NULL_OBJECT_ID &&
-                    it->second.bridge_port_id == bridge_port_oid) ||
-                    (vlan_oid != SAI_NULL_OBJECT_ID &&
-                    it->first.bv_id == vlan_oid))
-            {
-                it->second.is_flush_pending = true;
-            }
+            m_entries.getEntries(bridge_port_oid, SAI_NULL_OBJECT_ID, entries);
+        }
+        if (vlan_oid != SAI_NULL_OBJECT_ID)
+        {
+            m_entries.getEntries(SAI_NULL_OBJECT_ID, vlan_oid, entries);
+        }
+
+        for (auto it : entries)
+        {
+            it->second.is_flush_pending = true;
         }
     }
 }
@@ -1179,18 +1268,21 @@ void FdbOrch::notifyObserversFDBFlush(Port &port, sai_object_id_t& bvid)
     FdbFlushUpdate flushUpdate;
     flushUpdate.port = port;
 
-    for (auto itr = m_entries.begin(); itr != m_entries.end(); ++itr)
+    /* Entries learnt on the port are found by its bridge port */
+    vector<FdbEntryMap::iterator> entries;
+    if (port.m_bridge_port_id != SAI_NULL_OBJECT_ID && bvid != SAI_NULL_OBJECT_ID)
     {
-        if ((itr->first.port_name == port.m_alias) &&
-            (itr->first.bv_id == bvid))
-        {
-            SWSS_LOG_INFO("Adding MAC learnt on [ port:%s , bvid:0x%" PRIx64 "]\
-                           to ARP flush", port.m_alias.c_str(), bvid);
-            FdbEntry entry;
-            entry.mac = itr->first.mac;
-            entry.bv_id = itr->first.bv_id;
-            flushUpdate.entries.push_back(entry);
-        }
+        m_entries.getEntries(port.m_bridge_port_id, bvid, entries);
+    }
+
+    for (auto itr : entries)
+    {
+        SWSS_LOG_INFO("Adding MAC learnt on [ port:%s , bvid:0x%" PRIx64 "]\
+                       to ARP flush", port.m_alias.c_str(), bvid);
+        FdbEntry entry;
+        entry.mac = itr->first.mac;
+        entry.bv_id = itr->first.bv_id;
+        flushUpdate.entries.push_back(entry);
     }
 
     if (!flushUpdate.entries.empty())
@@ -1270,8 +1362,8 @@ void FdbOrch::updateVlanMember(const VlanMemberUpdate& update)
 bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
         FdbData fdbData)
 {
-    Port vlan;
-    Port port;
+    Port *vlan;
+    Port *port;
     string end_point_ip = "";
 
     VxlanTunnelOrch* tunnel_orch = gDirectory.get<VxlanTunnelOrch*>();
@@ -1281,18 +1373,20 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
             entry.mac.to_string().c_str(), entry.bv_id, port_name.c_str(),
             fdbData.type.c_str(), fdbData.origin, fdbData.remote_ip.c_str());
 
-    if (!m_portsOrch->getPort(entry.bv_id, vlan))
+    vlan = m_portsOrch->findPort(entry.bv_id);
+    if (!vlan)
     {
         SWSS_LOG_NOTICE("addFdbEntry: Failed to locate vlan port from bv_id 0x%" PRIx64, entry.bv_id);
         return false;
     }
 
     /* Retry until port is created */
-    if (!m_portsOrch->getPort(port_name, port) || (port.m_bridge_port_id == SAI_NULL_OBJECT_ID))
+    port = m_portsOrch->findPort(port_name);
+    if (!port || (port->m_bridge_port_id == SAI_NULL_OBJECT_ID))
     {
         SWSS_LOG_INFO("Saving a fdb entry until port %s becomes active", port_name.c_str());
         saved_fdb_entries[port_name].push_back({entry.mac,
-                vlan.m_vlan_info.vlan_id, fdbData});
+                vlan->m_vlan_info.vlan_id, fdbData});
         return true;
     }
 
@@ -1303,11 +1397,11 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
         end_point_ip = fdbData.remote_ip;
     }
     /* Retry until port is member of vlan*/
-    if (!m_portsOrch->isVlanMember(vlan, port, end_point_ip))
+    if (!m_portsOrch->isVlanMember(*vlan, *port, end_point_ip))
     {
-        SWSS_LOG_INFO("Saving a fdb entry until port %s becomes vlan %s member", port_name.c_str(), vlan.m_alias.c_str());
+        SWSS_LOG_INFO("Saving a fdb entry until port %s becomes vlan %s member", port_name.c_str(), vlan->m_alias.c_str());
         saved_fdb_entries[port_name].push_back({entry.mac,
-                vlan.m_vlan_info.vlan_id, fdbData});
+                vlan->m_vlan_info.vlan_id, fdbData});
         return true;
     }
 
@@ -1337,12 +1431,12 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
             return false;
         }
 
-        if ((oldOrigin == fdbData.origin) && (oldType == fdbData.type) && (port.m_bridge_port_id == it->second.bridge_port_id)
+        if ((oldOrigin == fdbData.origin) && (oldType == fdbData.type) && (port->m_bridge_port_id == it->second.bridge_port_id)
             && (oldRemoteIp == fdbData.remote_ip))
         {
             /* Duplicate Mac */
             SWSS_LOG_INFO("FdbOrch: mac=%s %s port=%s type=%s origin=%d  remote_ip=%s is duplicate", entry.mac.to_string().c_str(),
-                    vlan.m_alias.c_str(), port_name.c_str(),
+                    vlan->m_alias.c_str(), port_name.c_str(),
                     fdbData.type.c_str(), fdbData.origin, fdbData.remote_ip.c_str());
             return true;
         }
@@ -1355,7 +1449,7 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
                 SWSS_LOG_NOTICE("Already existing static MAC:%s in Vlan:%d. "
                         "Received same MAC from peer:%s; "
                         "Peer mac ignored",
-                        entry.mac.to_string().c_str(), vlan.m_vlan_info.vlan_id,
+                        entry.mac.to_string().c_str(), vlan->m_vlan_info.vlan_id,
                         fdbData.remote_ip.c_str());
 
                 return true;
@@ -1367,7 +1461,7 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
                 SWSS_LOG_INFO("Already existing static MAC:%s in Vlan:%d "
                         "from Peer:%s. Now same is provisioned as dynamic; "
                         "Provisioned dynamic mac is ignored",
-                        entry.mac.to_string().c_str(), vlan.m_vlan_info.vlan_id,
+                        entry.mac.to_string().c_str(), vlan->m_vlan_info.vlan_id,
                         it->second.remote_ip.c_str());
                 return true;
             }
@@ -1379,18 +1473,18 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
                             "in Vlan:%d from Peer:%s, "
                             "If it is a mistake, it will result in inconsistent Traffic Forwarding",
                             entry.mac.to_string().c_str(),
-                            vlan.m_vlan_info.vlan_id,
+                            vlan->m_vlan_info.vlan_id,
                             it->second.remote_ip.c_str());
                 }
             }
             else if ((oldOrigin == FDB_ORIGIN_LEARN) && (fdbData.origin == FDB_ORIGIN_MCLAG_ADVERTIZED))
             {
-                if ((port.m_bridge_port_id == it->second.bridge_port_id) && (oldType == "dynamic") && (fdbData.type == "dynamic_local"))
+                if ((port->m_bridge_port_id == it->second.bridge_port_id) && (oldType == "dynamic") && (fdbData.type == "dynamic_local"))
                 {
                     SWSS_LOG_INFO("FdbOrch: mac=%s %s port=%s type=%s origin=%d old_origin=%d"
                         " old_type=%s local mac exists,"
                         " received dynamic_local from iccpd, ignore update",
-                        entry.mac.to_string().c_str(), vlan.m_alias.c_str(), port_name.c_str(),
+                        entry.mac.to_string().c_str(), vlan->m_alias.c_str(), port_name.c_str(),
                         fdbData.type.c_str(), fdbData.origin, oldOrigin, oldType.c_str());
 
                     return true;
@@ -1440,7 +1534,7 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
     }
 
     attr.id = SAI_FDB_ENTRY_ATTR_BRIDGE_PORT_ID;
-    attr.value.oid = port.m_bridge_port_id;
+    attr.value.oid = port->m_bridge_port_id;
     attrs.push_back(attr);
 
     if (fdbData.origin == FDB_ORIGIN_VXLAN_ADVERTIZED)
@@ -1492,7 +1586,7 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
     if (macUpdate)
     {
         SWSS_LOG_INFO("MAC-Update FDB %s in %s on from-%s:to-%s from-%s:to-%s origin-%d-to-%d",
-                entry.mac.to_string().c_str(), vlan.m_alias.c_str(), oldPort.m_alias.c_str(),
+                entry.mac.to_string().c_str(), vlan->m_alias.c_str(), oldPort.m_alias.c_str(),
                 port_name.c_str(), oldType.c_str(), fdbData.type.c_str(),
                 oldOrigin, fdbData.origin);
         for (auto itr : attrs)
@@ -1501,7 +1595,7 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
             if (status != SAI_STATUS_SUCCESS)
             {
                 SWSS_LOG_ERROR("macUpdate-Failed for attr.id=0x%x for FDB %s in %s on %s, rv:%d",
-                            itr.id, entry.mac.to_string().c_str(), vlan.m_alias.c_str(), port_name.c_str(), status);
+                            itr.id, entry.mac.to_string().c_str(), vlan->m_alias.c_str(), port_name.c_str(), status);
                 task_process_status handle_status = handleSaiSetStatus(SAI_API_FDB, status);
                 if (handle_status != task_success)
                 {
@@ -1509,45 +1603,42 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
                 }
             }
         }
-        if (oldPort.m_bridge_port_id != port.m_bridge_port_id)
+        if (oldPort.m_bridge_port_id != port->m_bridge_port_id)
         {
             oldPort.m_fdb_count--;
             m_portsOrch->setPort(oldPort.m_alias, oldPort);
-            port.m_fdb_count++;
-            m_portsOrch->setPort(port.m_alias, port);
+            m_portsOrch->increasePortFdbCount(port->m_alias);
         }
     }
     else
     {
-        SWSS_LOG_INFO("MAC-Create %s FDB %s in %s on %s", fdbData.type.c_str(), entry.mac.to_string().c_str(), vlan.m_alias.c_str(), port_name.c_str());
+        SWSS_LOG_INFO("MAC-Create %s FDB %s in %s on %s", fdbData.type.c_str(), entry.mac.to_string().c_str(), vlan->m_alias.c_str(), port_name.c_str());
 
         status = sai_fdb_api->create_fdb_entry(&fdb_entry, (uint32_t)attrs.size(), attrs.data());
         if (status != SAI_STATUS_SUCCESS)
         {
             SWSS_LOG_ERROR("Failed to create %s FDB %s in %s on %s, rv:%d",
                     fdbData.type.c_str(), entry.mac.to_string().c_str(),
-                    vlan.m_alias.c_str(), port_name.c_str(), status);
+                    vlan->m_alias.c_str(), port_name.c_str(), status);
             task_process_status handle_status = handleSaiCreateStatus(SAI_API_FDB, status); //FIXME: it should be based on status. Some could be retried, some not
             if (handle_status != task_success)
             {
                 return parseHandleSaiStatusFailure(handle_status);
             }
         }
-        port.m_fdb_count++;
-        m_portsOrch->setPort(port.m_alias, port);
-        vlan.m_fdb_count++;
-        m_portsOrch->setPort(vlan.m_alias, vlan);
+        m_portsOrch->increasePortFdbCount(port->m_alias);
+        m_portsOrch->increasePortFdbCount(vlan->m_alias);
     }
 
     FdbData storeFdbData = fdbData;
-    storeFdbData.bridge_port_id = port.m_bridge_port_id;
+    storeFdbData.bridge_port_id = port->m_bridge_port_id;
     // overwrite the type and origin
     if ((fdbData.origin == FDB_ORIGIN_MCLAG_ADVERTIZED) && (fdbData.type == "dynamic_local"))
     {
         //If the MAC is dynamic_local change the origin accordingly
         //MAC is added/updated as dynamic to allow aging.
         SWSS_LOG_INFO("MAC-Update Modify to dynamic FDB %s in %s on from-%s:to-%s from-%s:to-%s origin-%d-to-%d",
-                entry.mac.to_string().c_str(), vlan.m_alias.c_str(), oldPort.m_alias.c_str(),
+                entry.mac.to_string().c_str(), vlan->m_alias.c_str(), oldPort.m_alias.c_str(),
                 port_name.c_str(), oldType.c_str(), fdbData.type.c_str(), 
                 oldOrigin, fdbData.origin);
 
@@ -1555,9 +1646,9 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
         storeFdbData.type = "dynamic";
     }
 
-    m_entries[entry] = storeFdbData;
+    m_entries.set(entry, storeFdbData);
 
-    string key = "Vlan" + to_string(vlan.m_vlan_info.vlan_id) + ":" + entry.mac.to_string();
+    string key = "Vlan" + to_string(vlan->m_vlan_info.vlan_id) + ":" + entry.mac.to_string();
 
     if (((fdbData.origin != FDB_ORIGIN_MCLAG_ADVERTIZED) &&
          (fdbData.origin != FDB_ORIGIN_VXLAN_ADVERTIZED)) ||
@@ -1594,14 +1685,14 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
 
         SWSS_LOG_NOTICE("fdbEvent: AddFdbEntry: Add MCLAG MAC with state mclag remote fdb table "
               "Mac: %s Vlan: %d port:%s type:%s", entry.mac.to_string().c_str(),
-              vlan.m_vlan_info.vlan_id, port_name.c_str(), fdbData.type.c_str());
+              vlan->m_vlan_info.vlan_id, port_name.c_str(), fdbData.type.c_str());
     }
     else if (macUpdate && (oldOrigin == FDB_ORIGIN_MCLAG_ADVERTIZED) &&
             (fdbData.origin != FDB_ORIGIN_MCLAG_ADVERTIZED))
     {
         SWSS_LOG_NOTICE("fdbEvent: AddFdbEntry: del MCLAG MAC from state MCLAG remote fdb table "
                     "Mac: %s Vlan: %d port:%s type:%s", entry.mac.to_string().c_str(),
-                    vlan.m_vlan_info.vlan_id, port_name.c_str(), fdbData.type.c_str());
+                    vlan->m_vlan_info.vlan_id, port_name.c_str(), fdbData.type.c_str());
         m_mclagFdbStateTable.del(key);
     }
 
@@ -1612,7 +1703,7 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
 
     FdbUpdate update;
     update.entry = entry;
-    update.port = port;
+    update.port = *port;
     update.type = fdbData.type;
     update.add = true;
 
@@ -1623,14 +1714,15 @@ bool FdbOrch::addFdbEntry(const FdbEntry& entry, const string& port_name,
 
 bool FdbOrch::removeFdbEntry(const FdbEntry& entry, FdbOrigin origin)
 {
-    Port vlan;
+    Port *vlan;
     Port port;
 
     SWSS_LOG_ENTER();
 
     SWSS_LOG_INFO("FdbOrch RemoveFDBEntry: mac=%s bv_id=0x%" PRIx64 "origin %d", entry.mac.to_string().c_str(), entry.bv_id, origin);
 
-    if (!m_portsOrch->getPort(entry.bv_id, vlan))
+    vlan = m_portsOrch->findPort(entry.bv_id);
+    if (!vlan)
     {
         SWSS_LOG_NOTICE("FdbOrch notification: Failed to locate vlan port from bv_id 0x%" PRIx64, entry.bv_id);
         return false;
@@ -1642,7 +1734,7 @@ bool FdbOrch::removeFdbEntry(const FdbEntry& entry, FdbOrigin origin)
         SWSS_LOG_INFO("FdbOrch RemoveFDBEntry: FDB entry isn't found. mac=%s bv_id=0x%" PRIx64, entry.mac.to_string().c_str(), entry.bv_id);
 
         /* check whether the entry is in the saved fdb, if so delete it from there. */
-        deleteFdbEntryFromSavedFDB(entry.mac, vlan.m_vlan_info.vlan_id, origin);
+        deleteFdbEntryFromSavedFDB(entry.mac, vlan->m_vlan_info.vlan_id, origin);
         return true;
     }
 
@@ -1677,13 +1769,13 @@ bool FdbOrch::removeFdbEntry(const FdbEntry& entry, FdbOrigin origin)
             /* We may still have the mac in saved-fdb probably due to unavailability
              * of bridge-port. check whether the entry is in the saved fdb,
              * if so delete it from there. */
-            deleteFdbEntryFromSavedFDB(entry.mac, vlan.m_vlan_info.vlan_id, origin);
+            deleteFdbEntryFromSavedFDB(entry.mac, vlan->m_vlan_info.vlan_id, origin);
 
             return true;
         }
     }
 
-    string key = "Vlan" + to_string(vlan.m_vlan_info.vlan_id) + ":" + entry.mac.to_string();
+    string key = "Vlan" + to_string(vlan->m_vlan_info.vlan_id) + ":" + entry.mac.to_string();
 
     sai_status_t status;
     sai_fdb_entry_t fdb_entry;
@@ -1708,8 +1800,7 @@ bool FdbOrch::removeFdbEntry(const FdbEntry& entry, FdbOrigin origin)
 
     port.m_fdb_count--;
     m_portsOrch->setPort(port.m_alias, port);
-    vlan.m_fdb_count--;
-    m_portsOrch->setPort(vlan.m_alias, vlan);
+    m_portsOrch->decreasePortFdbCount(vlan->m_alias);
     (void)m_entries.erase(entry);
 
     // Remove in StateDb
@@ -1,6 +1,9 @@
 #ifndef SWSS_FDBORCH_H
 #define SWSS_FDBORCH_H
 
+#include <set>
+#include <unordered_map>
+
 #include "orch.h"
 #include "observer.h"
 #include "portsorch.h"
@@ -81,6 +84,47 @@ struct SavedFdbEntry
 
 typedef unordered_map<string, vector<SavedFdbEntry>> fdb_entries_by_port_t;
 
+/*
+ * FDB entries, indexed by bridge port and by bv_id so that flushes only visit
+ * the entries they match. Entries are added and removed with set() and erase();
+ * the bridge port of an entry must not be changed through an iterator.
+ */
+class FdbEntryMap
+{
+public:
+    typedef map<FdbEntry, FdbData>::iterator iterator;
+    typedef map<FdbEntry, FdbData>::const_iterator const_iterator;
+
+    iterator begin() { return m_entries.begin(); }
+    iterator end() { return m_entries.end(); }
+    const_iterator begin() const { return m_entries.begin(); }
+    const_iterator end() const { return m_entries.end(); }
+    iterator find(const FdbEntry &entry) { return m_entries.find(entry); }
+    size_t size() const { return m_entries.size(); }
+    bool empty() const { return m_entries.empty(); }
+
+    void set(const FdbEntry &entry, const FdbData &data);
+    size_t erase(const FdbEntry &entry);
+    void clear();
+
+    /*
+     * Entries learnt on bridge_port_id and in bv_id. Either may be
+     * SAI_NULL_OBJECT_ID to match any, both to get all the entries.
+     */
+    void getEntries(sai_object_id_t bridge_port_id, sai_object_id_t bv_id, vector<iterator> &entries);
+
+private:
+    map<FdbEntry, FdbData> m_entries;
+    /* bridge port -> bv_id -> MACs */
+    unordered_map<sai_object_id_t, unordered_map<sai_object_id_t, std::set<MacAddress>>> m_portIndex;
+    /* bv_id -> MACs */
+    unordered_map<sai_object_id_t, std::set<MacAddress>> m_vlanIndex;
+
+    void addToIndex(const FdbEntry &entry, sai_object_id_t bridge_port_id);
+    void removeFromIndex(const FdbEntry &entry, sai_object_id_t bridge_port_id);
+    void addEntries(sai_object_id_t bv_id, const std::set<MacAddress> &macs, vector<iterator> &entries);
+};
+
 class FdbOrch: public Orch, public Subject, public Observer
 {
 public:
@@ -108,7 +152,7 @@ public:
 
 private:
     PortsOrch *m_portsOrch;
-    map<FdbEntry, FdbData> m_entries;
+    FdbEntryMap m_entries;
     fdb_entries_by_port_t saved_fdb_entries;
     vector<Table*> m_appTables;
     Table m_fdbStateTable;
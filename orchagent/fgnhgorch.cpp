@@ -7,6 +7,7 @@
 #include "crmorch.h"
 #include <array>
 #include <algorithm>
+#include <chrono>
 
 #define LINK_DOWN    0
 #define LINK_UP      1
@@ -20,6 +21,15 @@ extern sai_route_api_t*             sai_route_api;
 extern RouteOrch *gRouteOrch;
 extern CrmOrch *gCrmOrch;
 extern PortsOrch *gPortsOrch;
+extern size_t gMaxBulkSize;
+
+// The next hop group API has no bulk set, the members go through the generic object bulk API
+static sai_status_t bulkSetNextHopGroupMembers(uint32_t object_count, const sai_object_id_t *object_id,
+        const sai_attribute_t *attr_list, sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+{
+    return sai_bulk_object_set_attribute(SAI_OBJECT_TYPE_NEXT_HOP_GROUP_MEMBER, object_count, object_id,
+            attr_list, mode, object_statuses);
+}
 
 FgNhgOrch::FgNhgOrch(DBConnector *db, DBConnector *appDb, DBConnector *stateDb, vector<table_name_with_pri_t> &tableNames, NeighOrch *neighOrch, IntfsOrch *intfsOrch, VRFOrch *vrfOrch) :
         Orch(db, tableNames),
@@ -27,7 +37,8 @@ FgNhgOrch::FgNhgOrch(DBConnector *db, DBConnector *appDb, DBConnector *stateDb,
         m_intfsOrch(intfsOrch),
         m_vrfOrch(vrfOrch),
         m_stateWarmRestartRouteTable(stateDb, STATE_FG_ROUTE_TABLE_NAME),
-        m_routeTable(appDb, APP_ROUTE_TABLE_NAME)
+        m_routeTable(appDb, APP_ROUTE_TABLE_NAME),
+        m_bulkSetNextHopGroupMembers(bulkSetNextHopGroupMembers)
 {
     SWSS_LOG_ENTER();
     isFineGrainedConfigured = false;
@@ -196,10 +207,15 @@ void FgNhgOrch::calculateBankHashBucketStartIndices(FgNhgEntry *fgNhgEntry)
 }
 
 
-void FgNhgOrch::setStateDbRouteEntry(const IpPrefix &ipPrefix, uint32_t index, NextHopKey nextHop)
+void FgNhgOrch::setStateDbRouteEntries(const IpPrefix &ipPrefix, const map<uint32_t, NextHopKey> &buckets)
 {
     SWSS_LOG_ENTER();
 
+    if (buckets.empty())
+    {
+        return;
+    }
+
     string key = ipPrefix.to_string();
     // Write to StateDb
     std::vector<FieldValueTuple> fvs;
@@ -207,49 +223,140 @@ void FgNhgOrch::setStateDbRouteEntry(const IpPrefix &ipPrefix, uint32_t index, N
     // check if profile already exists - if yes - skip creation
     m_stateWarmRestartRouteTable.get(key, fvs);
 
-    //bucket rewrite
-    if (fvs.size() > index)
+    for (const auto &bucket : buckets)
     {
-        FieldValueTuple fv(std::to_string(index), nextHop.to_string());
-        fvs[index] = fv;
-        SWSS_LOG_INFO("Set state db entry for ip prefix %s next hop %s with index %d",
-                        ipPrefix.to_string().c_str(), nextHop.to_string().c_str(), index);
-        m_stateWarmRestartRouteTable.set(key, fvs);
-    }
-    else
-    {
-        fvs.push_back(FieldValueTuple(std::to_string(index), nextHop.to_string()));
-        SWSS_LOG_INFO("Add new next hop entry %s with index %d for ip prefix %s",
-                nextHop.to_string().c_str(), index, ipPrefix.to_string().c_str());
-        m_stateWarmRestartRouteTable.set(key, fvs);
+        uint32_t index = bucket.first;
+        const NextHopKey &nextHop = bucket.second;
+
+        //bucket rewrite
+        if (fvs.size() > index)
+        {
+            fvs[index] = FieldValueTuple(std::to_string(index), nextHop.to_string());
+            SWSS_LOG_INFO("Set state db entry for ip prefix %s next hop %s with index %d",
+                            key.c_str(), nextHop.to_string().c_str(), index);
+        }
+        else
+        {
+            fvs.push_back(FieldValueTuple(std::to_string(index), nextHop.to_string()));
+            SWSS_LOG_INFO("Add new next hop entry %s with index %d for ip prefix %s",
+                    nextHop.to_string().c_str(), index, key.c_str());
+        }
     }
 
+    m_stateWarmRestartRouteTable.set(key, fvs);
 }
 
-bool FgNhgOrch::writeHashBucketChange(FGNextHopGroupEntry *syncd_fg_route_entry, uint32_t index, sai_object_id_t nh_oid,
+/* writeHashBucketChange: Queues the rewrite of a hash bucket, the rewrites of a prefix
+ * are sent to SAI and STATE_DB together by flushHashBucketChanges.
+ * A bucket rewritten twice is only sent with its last next-hop.
+ */
+void FgNhgOrch::writeHashBucketChange(FGNextHopGroupEntry *syncd_fg_route_entry, uint32_t index, sai_object_id_t nh_oid,
         const IpPrefix &ipPrefix, NextHopKey nextHop)
 {
     SWSS_LOG_ENTER();
 
-    sai_attribute_t nhgm_attr;
-    nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
-    nhgm_attr.value.oid = nh_oid;
-    sai_status_t status = sai_next_hop_group_api->set_next_hop_group_member_attribute(
-                                                              syncd_fg_route_entry->nhopgroup_members[index],
-                                                              &nhgm_attr);
-    if (status != SAI_STATUS_SUCCESS)
+    m_hashBucketChanges[index] = { syncd_fg_route_entry->nhopgroup_members[index], nh_oid, nextHop };
+}
+
+
+bool FgNhgOrch::flushHashBucketChanges(const IpPrefix &ipPrefix)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_hashBucketChanges.empty())
+    {
+        return true;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    size_t count = m_hashBucketChanges.size();
+    vector<uint32_t> indices;
+    vector<sai_object_id_t> nhgm_ids;
+    vector<sai_attribute_t> nhgm_attrs;
+    vector<sai_status_t> statuses(count, SAI_STATUS_NOT_EXECUTED);
+
+    indices.reserve(count);
+    nhgm_ids.reserve(count);
+    nhgm_attrs.reserve(count);
+    for (const auto &change : m_hashBucketChanges)
+    {
+        sai_attribute_t nhgm_attr;
+        nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
+        nhgm_attr.value.oid = change.second.nh_oid;
+
+        indices.push_back(change.first);
+        nhgm_ids.push_back(change.second.nhgm_id);
+        nhgm_attrs.push_back(nhgm_attr);
+    }
+
+    /* A bucket that fails does not keep the others from being rewritten */
+    size_t bulk_size = gMaxBulkSize ? gMaxBulkSize : 1;
+    for (size_t begin = 0; begin < count; begin += bulk_size)
+    {
+        uint32_t bulk_count = (uint32_t)min(bulk_size, count - begin);
+        bool done = false;
+
+        if (m_bulkSetSupported)
+        {
+            sai_status_t status = (*m_bulkSetNextHopGroupMembers)(bulk_count, &nhgm_ids[begin], &nhgm_attrs[begin],
+                                                                  SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, &statuses[begin]);
+            if ((status == SAI_STATUS_NOT_IMPLEMENTED) || (status == SAI_STATUS_NOT_SUPPORTED))
+            {
+                SWSS_LOG_NOTICE("Bulk set of next hop group members is not supported, setting them one at a time");
+                m_bulkSetSupported = false;
+            }
+            else
+            {
+                done = true;
+            }
+        }
+
+        if (!done)
+        {
+            for (size_t i = begin; i < begin + bulk_count; i++)
+            {
+                statuses[i] = sai_next_hop_group_api->set_next_hop_group_member_attribute(nhgm_ids[i], &nhgm_attrs[i]);
+            }
+        }
+    }
+
+    /* Only the buckets that were set are written to STATE_DB */
+    map<uint32_t, NextHopKey> buckets;
+    bool ret = true;
+    for (size_t i = 0; i < count; i++)
     {
-        SWSS_LOG_ERROR("Failed to set next hop oid %" PRIx64 " member %" PRIx64 ": %d",
-            syncd_fg_route_entry->nhopgroup_members[index], nh_oid, status);
-        task_process_status handle_status = handleSaiSetStatus(SAI_API_NEXT_HOP_GROUP, status);
-        if (handle_status != task_success)
+        if (statuses[i] == SAI_STATUS_NOT_EXECUTED)
         {
-            return parseHandleSaiStatusFailure(handle_status);
+            SWSS_LOG_ERROR("Next hop oid %" PRIx64 " member %" PRIx64 " was not set",
+                nhgm_attrs[i].value.oid, nhgm_ids[i]);
+            ret = false;
+            continue;
+        }
+
+        if (statuses[i] != SAI_STATUS_SUCCESS)
+        {
+            SWSS_LOG_ERROR("Failed to set next hop oid %" PRIx64 " member %" PRIx64 ": %d",
+                nhgm_attrs[i].value.oid, nhgm_ids[i], statuses[i]);
+            task_process_status handle_status = handleSaiSetStatus(SAI_API_NEXT_HOP_GROUP, statuses[i]);
+            if (handle_status != task_success)
+            {
+                ret = parseHandleSaiStatusFailure(handle_status) && ret;
+                continue;
+            }
         }
+
+        buckets[indices[i]] = m_hashBucketChanges[indices[i]].next_hop;
     }
 
-    setStateDbRouteEntry(ipPrefix, index, nextHop);
-    return true;
+    setStateDbRouteEntries(ipPrefix, buckets);
+    m_hashBucketChanges.clear();
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+    SWSS_LOG_INFO("Rewrote %zu of %zu hash buckets for prefix %s in %" PRId64 " ms",
+            buckets.size(), count, ipPrefix.to_string().c_str(), (int64_t)elapsed.count());
+
+    return ret;
 }
 
 
@@ -581,12 +688,9 @@ bool FgNhgOrch::setActiveBankHashBucketChanges(FGNextHopGroupEntry *syncd_fg_rou
         HashBuckets *hash_buckets = &(bank_fgnhg_map->at(bank_member_change.nhs_to_del[del_idx]));
         for (uint32_t i = 0; i < hash_buckets->size(); i++)
         {
-            if (!writeHashBucketChange(syncd_fg_route_entry, hash_buckets->at(i), 
-                        nhopgroup_members_set[bank_member_change.nhs_to_add[add_idx]],
-                        ipPrefix, bank_member_change.nhs_to_add[add_idx]))
-            {
-                return false;
-            }
+            writeHashBucketChange(syncd_fg_route_entry, hash_buckets->at(i),
+                    nhopgroup_members_set[bank_member_change.nhs_to_add[add_idx]],
+                    ipPrefix, bank_member_change.nhs_to_add[add_idx]);
         }
 
         (*bank_fgnhg_map)[bank_member_change.nhs_to_add[add_idx]] =*hash_buckets;
@@ -620,11 +724,8 @@ bool FgNhgOrch::setActiveBankHashBucketChanges(FGNextHopGroupEntry *syncd_fg_rou
                 NextHopKey round_robin_nh = bank_member_change.active_nhs[i %
                     bank_member_change.active_nhs.size()];
 
-                if (!writeHashBucketChange(syncd_fg_route_entry, hash_buckets->at(i), 
-                        nhopgroup_members_set[round_robin_nh], ipPrefix, round_robin_nh))
-                {
-                    return false;
-                }
+                writeHashBucketChange(syncd_fg_route_entry, hash_buckets->at(i),
+                        nhopgroup_members_set[round_robin_nh], ipPrefix, round_robin_nh);
                 bank_fgnhg_map->at(round_robin_nh).push_back(hash_buckets->at(i));
 
                 /* Logic below ensure that # hash buckets assigned to a nh is equalized,
@@ -720,12 +821,9 @@ bool FgNhgOrch::setActiveBankHashBucketChanges(FGNextHopGroupEntry *syncd_fg_rou
                 {
                     uint32_t last_elem = map_entry->at((*map_entry).size() - 1);
 
-                    if (!writeHashBucketChange(syncd_fg_route_entry, last_elem, 
+                    writeHashBucketChange(syncd_fg_route_entry, last_elem,
                         nhopgroup_members_set[bank_member_change.nhs_to_add[add_idx]],
-                        ipPrefix, bank_member_change.nhs_to_add[add_idx]))
-                    {
-                        return false;
-                    }
+                        ipPrefix, bank_member_change.nhs_to_add[add_idx]);
 
                     (*bank_fgnhg_map)[bank_member_change.nhs_to_add[add_idx]].push_back(last_elem);
                     (*map_entry).erase((*map_entry).end() - 1);
@@ -809,11 +907,8 @@ bool FgNhgOrch::setInactiveBankToNextAvailableActiveBank(FGNextHopGroupEntry *sy
                 NextHopKey bank_nh_memb = bank_member_changes[new_bank_idx].
                          active_nhs[i % bank_member_changes[new_bank_idx].active_nhs.size()];
 
-                if (!writeHashBucketChange(syncd_fg_route_entry, i,
-                    nhopgroup_members_set[bank_nh_memb],ipPrefix, bank_nh_memb ))
-                {
-                    return false;
-                }
+                writeHashBucketChange(syncd_fg_route_entry, i,
+                    nhopgroup_members_set[bank_nh_memb], ipPrefix, bank_nh_memb);
 
                 syncd_fg_route_entry->syncd_fgnhg_map[bank][bank_nh_memb].push_back(i);
             }
@@ -855,8 +950,9 @@ bool FgNhgOrch::setInactiveBankToNextAvailableActiveBank(FGNextHopGroupEntry *sy
             syncd_fg_route_entry->points_to_rif = true;
             syncd_fg_route_entry->next_hop_group_id = rif_next_hop_id;
 
-            // remove state_db entry
+            // remove state_db entry, and drop the bucket rewrites of the removed members
             m_stateWarmRestartRouteTable.del(ipPrefix.to_string());
+            m_hashBucketChanges.clear();
             // Clear data structures
             syncd_fg_route_entry->syncd_fgnhg_map.clear();
             syncd_fg_route_entry->active_nexthops.clear();
@@ -896,11 +992,8 @@ bool FgNhgOrch::setInactiveBankHashBucketChanges(FGNextHopGroupEntry *syncd_fg_r
             NextHopKey bank_nh_memb = bank_member_changes[bank].
                 nhs_to_add[i % bank_member_changes[bank].nhs_to_add.size()];
 
-            if (!writeHashBucketChange(syncd_fg_route_entry, i, 
-                  nhopgroup_members_set[bank_nh_memb], ipPrefix, bank_nh_memb))
-            {
-                return false;
-            }
+            writeHashBucketChange(syncd_fg_route_entry, i,
+                  nhopgroup_members_set[bank_nh_memb], ipPrefix, bank_nh_memb);
 
             syncd_fg_route_entry->syncd_fgnhg_map[bank][bank_nh_memb].push_back(i);
             syncd_fg_route_entry->active_nexthops.insert(bank_nh_memb);
@@ -976,6 +1069,7 @@ bool FgNhgOrch::computeAndSetHashBucketChanges(FGNextHopGroupEntry *syncd_fg_rou
             if (!setActiveBankHashBucketChanges(syncd_fg_route_entry, fgNhgEntry, 
                         bank_idx, bank_idx, bank_member_changes, nhopgroup_members_set, ipPrefix))
             {
+                flushHashBucketChanges(ipPrefix);
                 return false;
             }
         }
@@ -984,12 +1078,14 @@ bool FgNhgOrch::computeAndSetHashBucketChanges(FGNextHopGroupEntry *syncd_fg_rou
             if (!setInactiveBankHashBucketChanges(syncd_fg_route_entry, fgNhgEntry, 
                         bank_idx, bank_member_changes, nhopgroup_members_set, ipPrefix))
             {
+                flushHashBucketChanges(ipPrefix);
                 return false;
             }
         }
     }
 
-    return true;
+    /* Send the hash bucket rewrites of all the banks at once */
+    return flushHashBucketChanges(ipPrefix);
 }
 
 
@@ -1001,6 +1097,7 @@ bool FgNhgOrch::setNewNhgMembers(FGNextHopGroupEntry &syncd_fg_route_entry, FgNh
 
     sai_status_t status;
     bool isWarmReboot = false;
+    map<uint32_t, NextHopKey> state_db_buckets;
     auto nexthopsMap = m_recoveryMap.find(ipPrefix.to_string());
     for (uint32_t i = 0; i < fgNhgEntry->hash_bucket_indices.size(); i++) 
     {
@@ -1100,7 +1197,7 @@ bool FgNhgOrch::setNewNhgMembers(FGNextHopGroupEntry &syncd_fg_route_entry, FgNh
                 }
             }
 
-            setStateDbRouteEntry(ipPrefix, j, bank_nh_memb);
+            state_db_buckets[j] = bank_nh_memb;
             syncd_fg_route_entry.syncd_fgnhg_map[i][bank_nh_memb].push_back(j);
             syncd_fg_route_entry.active_nexthops.insert(bank_nh_memb);
             syncd_fg_route_entry.nhopgroup_members.push_back(next_hop_group_member_id);
@@ -1108,6 +1205,8 @@ bool FgNhgOrch::setNewNhgMembers(FGNextHopGroupEntry &syncd_fg_route_entry, FgNh
         }
     }
 
+    setStateDbRouteEntries(ipPrefix, state_db_buckets);
+
     if (isWarmReboot)
     {
         m_recoveryMap.erase(nexthopsMap);
@@ -92,6 +92,16 @@ typedef struct
     std::vector<NextHopKey> active_nhs;
 } BankMemberChanges;
 
+/* Hash bucket rewrite queued while the next-hop changes of a prefix are computed */
+typedef struct
+{
+    sai_object_id_t nhgm_id;                        // Next hop group member of the hash bucket
+    sai_object_id_t nh_oid;                         // Next hop the member is set to
+    NextHopKey next_hop;                            // Next hop written to STATE_DB
+} HashBucketChange;
+/* Map from hash bucket index to its pending rewrite */
+typedef std::map<uint32_t, HashBucketChange> HashBucketChanges;
+
 typedef std::vector<string> NextHopIndexMap;
 typedef map<string, NextHopIndexMap> WarmBootRecoveryMap;
 
@@ -132,6 +142,11 @@ private:
     // < ip_prefix, < HashBuckets, nh_ip>>
     WarmBootRecoveryMap m_recoveryMap;
 
+    // hash bucket rewrites of the prefix being updated, sent by flushHashBucketChanges
+    HashBucketChanges m_hashBucketChanges;
+    sai_bulk_object_set_attribute_fn m_bulkSetNextHopGroupMembers;
+    bool m_bulkSetSupported = true;
+
     bool setNewNhgMembers(FGNextHopGroupEntry &syncd_fg_route_entry, FgNhgEntry *fgNhgEntry,
                     std::vector<BankMemberChanges> &bank_member_changes, 
                     std::map<NextHopKey,sai_object_id_t> &nhopgroup_members_set, const IpPrefix&);
@@ -148,9 +163,10 @@ private:
                     uint32_t bank, std::vector<BankMemberChanges> bank_member_changes,
                     std::map<NextHopKey,sai_object_id_t> &nhopgroup_members_set, const IpPrefix&);
     void calculateBankHashBucketStartIndices(FgNhgEntry *fgNhgEntry);
-    void setStateDbRouteEntry(const IpPrefix&, uint32_t index, NextHopKey nextHop);
-    bool writeHashBucketChange(FGNextHopGroupEntry *syncd_fg_route_entry, uint32_t index, sai_object_id_t nh_oid,
+    void setStateDbRouteEntries(const IpPrefix&, const std::map<uint32_t, NextHopKey> &buckets);
+    void writeHashBucketChange(FGNextHopGroupEntry *syncd_fg_route_entry, uint32_t index, sai_object_id_t nh_oid,
                     const IpPrefix &ipPrefix, NextHopKey nextHop);
+    bool flushHashBucketChanges(const IpPrefix&);
     bool modifyRoutesNextHopId(sai_object_id_t vrf_id, const IpPrefix &ipPrefix, sai_object_id_t next_hop_id);
     bool createFineGrainedNextHopGroup(FGNextHopGroupEntry &syncd_fg_route_entry, FgNhgEntry *fgNhgEntry,
                     const NextHopGroupKey &nextHops);
@@ -188,6 +188,10 @@ void FlexCounterOrch::doTask(Consumer &consumer)
                             gPortsOrch->addPriorityGroupWatermarkFlexCounters(getPgConfigurations());
                         }
                     }
+                    if (key == PORT_KEY)
+                    {
+                        m_port_counter_polling = (value == "enable");
+                    }
                     if(gIntfsOrch && (key == RIF_KEY) && (value == "enable"))
                     {
                         gIntfsOrch->generateInterfaceMap();
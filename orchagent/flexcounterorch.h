@@ -43,6 +43,8 @@ public:
     FlexCounterOrch(swss::DBConnector *db, std::vector<std::string> &tableNames);
     virtual ~FlexCounterOrch(void);
     bool getPortCountersState() const;
+    /* Unlike getPortCountersState, false again once the port counters are disabled */
+    bool getPortCountersPollingState() const {return m_port_counter_polling;}
     bool getPortBufferDropCountersState() const;
     bool getQueueCountersState() const;
     bool getQueueWatermarkCountersState() const;
@@ -56,6 +58,7 @@ public:
 
 private:
     bool m_port_counter_enabled = false;
+    bool m_port_counter_polling = false;
     bool m_port_buffer_drop_counter_enabled = false;
     bool m_queue_enabled = false;
     bool m_queue_watermark_enabled = false;
@@ -110,9 +110,8 @@ IntfsOrch::IntfsOrch(DBConnector *db, string tableName, VRFOrch *vrf_orch, DBCon
 
 sai_object_id_t IntfsOrch::getRouterIntfsId(const string &alias)
 {
-    Port port;
-    gPortsOrch->getPort(alias, port);
-    return port.m_rif_id;
+    Port *port = gPortsOrch->findPort(alias);
+    return port ? port->m_rif_id : SAI_NULL_OBJECT_ID;
 }
 
 bool IntfsOrch::isPrefixSubnet(const IpPrefix &ip_prefix, const string &alias)
@@ -1612,15 +1611,15 @@ void IntfsOrch::doTask(SelectableTimer &timer)
 
 bool IntfsOrch::isRemoteSystemPortIntf(string alias)
 {
-    Port port;
-    if(gPortsOrch->getPort(alias, port))
+    Port *port = gPortsOrch->findPort(alias);
+    if(port)
     {
-        if (port.m_type == Port::LAG)
+        if (port->m_type == Port::LAG)
         {
-            return(port.m_system_lag_info.switch_id != gVoqMySwitchId);
+            return(port->m_system_lag_info.switch_id != gVoqMySwitchId);
         }
 
-        return(port.m_system_port_info.type == SAI_SYSTEM_PORT_TYPE_REMOTE);
+        return(port->m_system_port_info.type == SAI_SYSTEM_PORT_TYPE_REMOTE);
     }
     //Given alias is system port alias of the local port/LAG
     return false;
@@ -1628,15 +1627,15 @@ bool IntfsOrch::isRemoteSystemPortIntf(string alias)
 
 bool IntfsOrch::isLocalSystemPortIntf(string alias)
 {
-    Port port;
-    if(gPortsOrch->getPort(alias, port))
+    Port *port = gPortsOrch->findPort(alias);
+    if(port)
     {
-        if (port.m_type == Port::LAG)
+        if (port->m_type == Port::LAG)
         {
-            return(port.m_system_lag_info.switch_id == gVoqMySwitchId);
+            return(port->m_system_lag_info.switch_id == gVoqMySwitchId);
         }
 
-        return(port.m_system_port_info.type != SAI_SYSTEM_PORT_TYPE_REMOTE);
+        return(port->m_system_port_info.type != SAI_SYSTEM_PORT_TYPE_REMOTE);
     }
     //Given alias is system port alias of the local port/LAG
     return false;
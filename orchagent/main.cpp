@@ -69,11 +69,13 @@ uint32_t gCfgSystemPorts = 0;
 string gMyHostName = "";
 string gMyAsicName = "";
 bool gTraditionalFlexCounter = false;
+bool gNativeCounterRates = false;
+bool gNativePfcWdDetection = false;
 uint32_t create_switch_timeout = 0;
 
 void usage()
 {
-    cout << "usage: orchagent [-h] [-r record_type] [-d record_location] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size] [-q zmq_server_address] [-c mode] [-t create_switch_timeout] [-v VRF]" << endl;
+    cout << "usage: orchagent [-h] [-r record_type] [-d record_location] [-f swss_rec_filename] [-j sairedis_rec_filename] [-b batch_size] [-m MAC] [-i INST_ID] [-s] [-z mode] [-k bulk_size] [-q zmq_server_address] [-c mode] [-R mode] [-W mode] [-t create_switch_timeout] [-v VRF]" << endl;
     cout << "    -h: display this message" << endl;
     cout << "    -r record_type: record orchagent logs with type (default 3)" << endl;
     cout << "                    Bit 0: sairedis.rec, Bit 1: swss.rec, Bit 2: responsepublisher.rec. For example:" << endl;
@@ -93,6 +95,8 @@ void usage()
     cout << "    -k max bulk size in bulk mode (default 1000)" << endl;
     cout << "    -q zmq_server_address: ZMQ server address (default disable ZMQ)" << endl;
     cout << "    -c counter mode (traditional|asic_db), default: asic_db" << endl;
+    cout << "    -R port rates computation (lua|native), default: lua" << endl;
+    cout << "    -W PFC watchdog storm detection (lua|native), default: lua" << endl;
     cout << "    -t Override create switch timeout, in sec" << endl;
     cout << "    -v vrf: VRF name (default empty)" << endl;
 }
@@ -350,7 +354,7 @@ int main(int argc, char **argv)
     string responsepublisher_rec_filename = Recorder::RESPPUB_FNAME;
     int record_type = 3; // Only swss and sairedis recordings enabled by default.
 
-    while ((opt = getopt(argc, argv, "b:m:r:f:j:d:i:hsz:k:q:c:t:v:")) != -1)
+    while ((opt = getopt(argc, argv, "b:m:r:f:j:d:i:hsz:k:q:c:R:W:t:v:")) != -1)
     {
         switch (opt)
         {
@@ -407,6 +411,20 @@ int main(int argc, char **argv)
                 gTraditionalFlexCounter = true;
             }
             break;
+        case 'R':
+            if (optarg == string("native"))
+            {
+                gNativeCounterRates = true;
+                SWSS_LOG_NOTICE("Computing port rates in orchagent");
+            }
+            break;
+        case 'W':
+            if (optarg == string("native"))
+            {
+                gNativePfcWdDetection = true;
+                SWSS_LOG_NOTICE("Detecting PFC storms in orchagent");
+            }
+            break;
         case 'f':
 
             if (optarg)
@@ -36,6 +36,7 @@ extern sai_object_id_t     gVirtualRouterId;
 extern sai_nat_api_t      *sai_nat_api;
 extern sai_hostif_api_t   *sai_hostif_api;
 extern bool               gIsNatSupported;
+extern size_t             gMaxBulkSize;
 #ifdef DEBUG_FRAMEWORK
 extern DebugDumpOrch      *gDebugDumpOrch;
 #endif
@@ -3114,53 +3115,273 @@ void NatOrch::doTask(SelectableTimer &timer)
     }
 }
 
+void NatOrch::getNatEntriesAttribute(const vector<sai_nat_entry_t> &entries, const vector<sai_attribute_t> &attrs,
+                                     const function<void(size_t, sai_status_t, const sai_attribute_t *)> &process)
+{
+    uint32_t                  attr_count = (uint32_t)attrs.size();
+    size_t                    bulk_size  = gMaxBulkSize ? gMaxBulkSize : 1;
+    vector<sai_attribute_t>   attr_values;
+    vector<uint32_t>          attr_counts;
+    vector<sai_attribute_t *> attr_lists;
+    vector<sai_status_t>      statuses;
+
+    /* Query the entries a bulk at a time, and hand over the results of each bulk before querying the next one */
+    for (size_t begin = 0; begin < entries.size(); begin += bulk_size)
+    {
+        size_t count = min(bulk_size, entries.size() - begin);
+        bool   queried = false;
+
+        attr_values.clear();
+        for (size_t i = 0; i < count; i++)
+        {
+            attr_values.insert(attr_values.end(), attrs.begin(), attrs.end());
+        }
+        attr_counts.assign(count, attr_count);
+        attr_lists.resize(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            attr_lists[i] = &attr_values[i * attr_count];
+        }
+        statuses.assign(count, SAI_STATUS_NOT_EXECUTED);
+
+        if (m_natBulkGetSupported && sai_nat_api->get_nat_entries_attribute)
+        {
+            sai_status_t status = sai_nat_api->get_nat_entries_attribute((uint32_t)count, &entries[begin], attr_counts.data(),
+                                                                         attr_lists.data(), SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR,
+                                                                         statuses.data());
+            if ((status == SAI_STATUS_NOT_IMPLEMENTED) || (status == SAI_STATUS_NOT_SUPPORTED))
+            {
+                SWSS_LOG_NOTICE("Bulk get of NAT entries is not supported, querying them one at a time");
+                m_natBulkGetSupported = false;
+            }
+            else
+            {
+                queried = true;
+            }
+        }
+
+        if (!queried)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                statuses[i] = sai_nat_api->get_nat_entry_attribute(&entries[begin + i], attr_count, attr_lists[i]);
+            }
+        }
+
+        for (size_t i = 0; i < count; i++)
+        {
+            process(begin + i, statuses[i], attr_lists[i]);
+        }
+    }
+}
+
+void NatOrch::getSaiNatEntry(const NatEntry::iterator &iter, sai_nat_entry_t &nat_entry)
+{
+    const IpAddress   &ipAddr = iter->first;
+    NatEntryValue     &entry  = iter->second;
+
+    memset(&nat_entry, 0, sizeof(nat_entry));
+
+    nat_entry.vr_id       = gVirtualRouterId;
+    nat_entry.switch_id   = gSwitchId;
+
+    if (entry.nat_type == "dnat")
+    {
+        nat_entry.nat_type = SAI_NAT_TYPE_DESTINATION_NAT;
+        nat_entry.data.key.dst_ip = ipAddr.getV4Addr();
+        nat_entry.data.mask.dst_ip = 0xffffffff;
+    }
+    else
+    {
+        nat_entry.nat_type = SAI_NAT_TYPE_SOURCE_NAT;
+        nat_entry.data.key.src_ip = ipAddr.getV4Addr();
+        nat_entry.data.mask.src_ip = 0xffffffff;
+    }
+}
+
+void NatOrch::getSaiNatEntry(const NaptEntry::iterator &iter, sai_nat_entry_t &nat_entry)
+{
+    const NaptEntryKey &naptKey    = iter->first;
+    NaptEntryValue     &entry      = iter->second;
+    uint8_t            protoType   = ((naptKey.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
+
+    memset(&nat_entry, 0, sizeof(nat_entry));
+
+    nat_entry.vr_id       = gVirtualRouterId;
+    nat_entry.switch_id   = gSwitchId;
+
+    if (entry.nat_type == "dnat")
+    {
+        nat_entry.nat_type = SAI_NAT_TYPE_DESTINATION_NAT;
+        nat_entry.data.key.dst_ip      = naptKey.ip_address.getV4Addr();
+        nat_entry.data.key.l4_dst_port = (uint16_t)(naptKey.l4_port);
+        nat_entry.data.mask.dst_ip      = 0xffffffff;
+        nat_entry.data.mask.l4_dst_port = 0xffff;
+    }
+    else
+    {
+        nat_entry.nat_type = SAI_NAT_TYPE_SOURCE_NAT;
+        nat_entry.data.key.src_ip      = naptKey.ip_address.getV4Addr();
+        nat_entry.data.key.l4_src_port = (uint16_t)(naptKey.l4_port);
+        nat_entry.data.mask.src_ip      = 0xffffffff;
+        nat_entry.data.mask.l4_src_port = 0xffff;
+    }
+
+    nat_entry.data.key.proto        = protoType;
+    nat_entry.data.mask.proto       = 0xff;
+}
+
+void NatOrch::getSaiNatEntry(const TwiceNatEntry::iterator &iter, sai_nat_entry_t &nat_entry)
+{
+    const TwiceNatEntryKey   &key = iter->first;
+
+    memset(&nat_entry, 0, sizeof(nat_entry));
+
+    nat_entry.vr_id = gVirtualRouterId;
+    nat_entry.switch_id = gSwitchId;
+    nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
+    nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
+    nat_entry.data.mask.src_ip = 0xffffffff;
+    nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
+    nat_entry.data.mask.dst_ip = 0xffffffff;
+}
+
+void NatOrch::getSaiNatEntry(const TwiceNaptEntry::iterator &iter, sai_nat_entry_t &nat_entry)
+{
+    const TwiceNaptEntryKey &key    = iter->first;
+    uint8_t            protoType   = ((key.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
+
+    memset(&nat_entry, 0, sizeof(nat_entry));
+
+    nat_entry.vr_id = gVirtualRouterId;
+    nat_entry.switch_id = gSwitchId;
+    nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
+    nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
+    nat_entry.data.mask.src_ip = 0xffffffff;
+    nat_entry.data.key.l4_src_port = (uint16_t)(key.src_l4_port);
+    nat_entry.data.mask.l4_src_port = 0xffff;
+    nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
+    nat_entry.data.mask.dst_ip = 0xffffffff;
+    nat_entry.data.key.l4_dst_port = (uint16_t)(key.dst_l4_port);
+    nat_entry.data.mask.l4_dst_port = 0xffff;
+    nat_entry.data.key.proto = protoType;
+    nat_entry.data.mask.proto = 0xff;
+}
+
 void NatOrch::queryCounters(void)
 {
     SWSS_LOG_ENTER();
 
     uint32_t         queried_entries = 0;
     struct timespec  time_now, time_end, time_spent;
+    vector<sai_attribute_t> nat_entry_attr(2);
 
     if (clock_gettime (CLOCK_MONOTONIC, &time_now) < 0)
     {
         return;
     }
 
-    NatEntry::iterator natIter = m_natEntries.begin();
-    while (natIter != m_natEntries.end())
-    {
-        getNatCounters(natIter);
+    nat_entry_attr[0].id   = SAI_NAT_ENTRY_ATTR_BYTE_COUNT;
+    nat_entry_attr[1].id   = SAI_NAT_ENTRY_ATTR_PACKET_COUNT;
 
+    vector<NatEntry::iterator> natIters;
+    vector<sai_nat_entry_t>    natSaiEntries;
+    for (auto natIter = m_natEntries.begin(); natIter != m_natEntries.end(); natIter++)
+    {
         queried_entries++;
-        natIter++;
+
+        if (natIter->second.addedToHw == false)
+        {
+            SWSS_LOG_DEBUG("Skip get Counters for %s NAT entry [ip %s], as not yet added to HW",
+                           natIter->second.nat_type.c_str(), natIter->first.to_string().c_str());
+            continue;
+        }
+
+        natIters.push_back(natIter);
+        natSaiEntries.emplace_back();
+        getSaiNatEntry(natIter, natSaiEntries.back());
     }
 
-    NaptEntry::iterator naptIter = m_naptEntries.begin();
-    while (naptIter != m_naptEntries.end())
-    {
-        getNaptCounters(naptIter);
+    getNatEntriesAttribute(natSaiEntries, nat_entry_attr,
+        [&](size_t index, sai_status_t status, const sai_attribute_t *attr_list)
+        {
+            getNatCounters(natIters[index], status, attr_list);
+        });
 
+    vector<NaptEntry::iterator> naptIters;
+    vector<sai_nat_entry_t>     naptSaiEntries;
+    for (auto naptIter = m_naptEntries.begin(); naptIter != m_naptEntries.end(); naptIter++)
+    {
         queried_entries++;
-        naptIter++;
+
+        if (naptIter->second.addedToHw == false)
+        {
+            SWSS_LOG_DEBUG("Skip get Counters for %s NAPT entry for [proto %s, ip %s, port %d], as not yet added to HW",
+                           naptIter->second.nat_type.c_str(), naptIter->first.prototype.c_str(),
+                           naptIter->first.ip_address.to_string().c_str(), naptIter->first.l4_port);
+            continue;
+        }
+
+        naptIters.push_back(naptIter);
+        naptSaiEntries.emplace_back();
+        getSaiNatEntry(naptIter, naptSaiEntries.back());
     }
-    TwiceNatEntry::iterator tnatIter = m_twiceNatEntries.begin();
-    while (tnatIter != m_twiceNatEntries.end())
-    {
-        getTwiceNatCounters(tnatIter);
 
+    getNatEntriesAttribute(naptSaiEntries, nat_entry_attr,
+        [&](size_t index, sai_status_t status, const sai_attribute_t *attr_list)
+        {
+            getNaptCounters(naptIters[index], status, attr_list);
+        });
+
+    vector<TwiceNatEntry::iterator> tnatIters;
+    vector<sai_nat_entry_t>         tnatSaiEntries;
+    for (auto tnatIter = m_twiceNatEntries.begin(); tnatIter != m_twiceNatEntries.end(); tnatIter++)
+    {
         queried_entries++;
-        tnatIter++;
+
+        if (tnatIter->second.addedToHw == false)
+        {
+            SWSS_LOG_DEBUG("Skip get Counters for Twice NAT entry [src ip %s, dst ip %s], as not yet added to HW",
+                           tnatIter->first.src_ip.to_string().c_str(), tnatIter->first.dst_ip.to_string().c_str());
+            continue;
+        }
+
+        tnatIters.push_back(tnatIter);
+        tnatSaiEntries.emplace_back();
+        getSaiNatEntry(tnatIter, tnatSaiEntries.back());
     }
 
-    TwiceNaptEntry::iterator tnaptIter = m_twiceNaptEntries.begin();
-    while (tnaptIter != m_twiceNaptEntries.end())
-    {
-        getTwiceNaptCounters(tnaptIter);
+    getNatEntriesAttribute(tnatSaiEntries, nat_entry_attr,
+        [&](size_t index, sai_status_t status, const sai_attribute_t *attr_list)
+        {
+            getTwiceNatCounters(tnatIters[index], status, attr_list);
+        });
 
+    vector<TwiceNaptEntry::iterator> tnaptIters;
+    vector<sai_nat_entry_t>          tnaptSaiEntries;
+    for (auto tnaptIter = m_twiceNaptEntries.begin(); tnaptIter != m_twiceNaptEntries.end(); tnaptIter++)
+    {
         queried_entries++;
-        tnaptIter++;
+
+        if (tnaptIter->second.addedToHw == false)
+        {
+            SWSS_LOG_DEBUG("Skip get Counters for Twice NAPT entry for [proto %s, src ip %s, src port %d, dst ip %s, dst port %d], as not yet added to HW",
+                           tnaptIter->first.prototype.c_str(), tnaptIter->first.src_ip.to_string().c_str(), tnaptIter->first.src_l4_port,
+                           tnaptIter->first.dst_ip.to_string().c_str(), tnaptIter->first.dst_l4_port);
+            continue;
+        }
+
+        tnaptIters.push_back(tnaptIter);
+        tnaptSaiEntries.emplace_back();
+        getSaiNatEntry(tnaptIter, tnaptSaiEntries.back());
     }
 
+    getNatEntriesAttribute(tnaptSaiEntries, nat_entry_attr,
+        [&](size_t index, sai_status_t status, const sai_attribute_t *attr_list)
+        {
+            getTwiceNaptCounters(tnaptIters[index], status, attr_list);
+        });
+
     if (clock_gettime (CLOCK_MONOTONIC, &time_end) < 0)
     {
         return;
@@ -3306,126 +3527,289 @@ void NatOrch::queryHitBits(void)
 
     uint32_t         queried_entries = 0;
     struct timespec  time_now, time_end, time_spent;
+    vector<sai_attribute_t> nat_entry_attr(2);
 
     if (clock_gettime (CLOCK_MONOTONIC, &time_now) < 0)
     {
         return;
     }
 
+    time_t now = time_now.tv_sec;
+
+    nat_entry_attr[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
+    nat_entry_attr[0].value.booldata = 0;
+    nat_entry_attr[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
+    nat_entry_attr[1].value.booldata = 1;
+
     /* Remove the NAT entries that are aged out.
-     * Query the NAT entries for their activity in the hardware
-     * and update the active timeout. */
-    NatEntry::iterator natIter = m_natEntries.begin();
-    while (natIter != m_natEntries.end())
+     * Query the SNAT entries for their activity in the hardware
+     * and update the active timeout. The hit bits of the DNAT entries
+     * are only queried, in a second pass, for the SNAT entries not hit. */
+    vector<NatEntry::iterator> natIters, dnatIters;
+    vector<sai_nat_entry_t>    natSaiEntries, dnatSaiEntries;
+    for (auto natIter = m_natEntries.begin(); natIter != m_natEntries.end(); natIter++)
     {
-        if (checkIfNatEntryIsActive(natIter, time_now.tv_sec))
+        queried_entries++;
+
+        /* Hitbits are queried for both directions when SNAT entry is checked */
+        if ((natIter->second.nat_type == "dnat") or (natIter->second.addedToHw == false))
+        {
+            continue;
+        }
+
+        if (natIter->second.entry_type == "static")
         {
-            /* Since the entry is active in the hardware, reset the active time */
-            natIter->second.activeTime = time_now.tv_sec;
+            /* Static NAT entries are always treated active */
+            natIter->second.activeTime = now;
+            continue;
         }
-        else
+
+        natIters.push_back(natIter);
+        natSaiEntries.emplace_back();
+        getSaiNatEntry(natIter, natSaiEntries.back());
+    }
+
+    getNatEntriesAttribute(natSaiEntries, nat_entry_attr,
+        [&](size_t index, sai_status_t status, const sai_attribute_t *attr_list)
         {
-            if ((natIter->second.nat_type == "snat") and (natIter->second.addedToHw == true) and
-                (natIter->second.entry_type != "static"))
+            auto natIter = natIters[index];
+
+            if (status == SAI_STATUS_SUCCESS)
             {
-                if (time_now.tv_sec - natIter->second.activeTime >= timeout)
+                SWSS_LOG_DEBUG("SNAT HIT BIT for src-ip %s = %d", natIter->first.to_string().c_str(),
+                               attr_list[0].value.booldata);
+
+                if (attr_list[0].value.booldata)
                 {
-                    std::vector<FieldValueTuple> fvVector;
-                    std::string key = natIter->first.to_string();
-                    setTimeoutNotifier->send("AGEOUT-SINGLE-NAT", key, fvVector);
+                    /* Since the entry is active in the hardware, reset the active time */
+                    natIter->second.ageOutTime = now + timeout;
+                    natIter->second.activeTime = now;
+                    return;
                 }
-            } 
-        }
-        queried_entries++;
-        natIter++;
-    }
+
+                auto dnatIter = m_natEntries.find(natIter->second.translated_ip);
+                if ((dnatIter != m_natEntries.end()) and (dnatIter->second.addedToHw == true))
+                {
+                    dnatIters.push_back(natIter);
+                    dnatSaiEntries.emplace_back();
+                    getSaiNatEntry(dnatIter, dnatSaiEntries.back());
+                    return;
+                }
+            }
+
+            checkNatEntryAgeOut(natIter, now);
+        });
+
+    /* If SNAT HitBit is not set, check for the HitBit in the reverse direction */
+    getNatEntriesAttribute(dnatSaiEntries, nat_entry_attr,
+        [&](size_t index, sai_status_t status, const sai_attribute_t *attr_list)
+        {
+            auto natIter = dnatIters[index];
+
+            if (status == SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_DEBUG("DNAT HIT BIT for dst-ip %s = %d", natIter->second.translated_ip.to_string().c_str(),
+                               attr_list[0].value.booldata);
+
+                if (attr_list[0].value.booldata)
+                {
+                    natIter->second.ageOutTime = now + timeout;
+                    natIter->second.activeTime = now;
+                    return;
+                }
+            }
+
+            checkNatEntryAgeOut(natIter, now);
+        });
 
     /* Remove the NAPT entries that are aged out.
-     * Query the NAPT entries for their activity in the hardware
-     * and update the active timeout. */
-    NaptEntry::iterator naptIter = m_naptEntries.begin();
-    while (naptIter != m_naptEntries.end())
+     * Query the SNAPT entries for their activity in the hardware
+     * and update the active timeout, then the DNAPT entries in
+     * the reverse direction of the SNAPT entries not hit. */
+    vector<NaptEntry::iterator> naptIters, dnaptIters;
+    vector<sai_nat_entry_t>     naptSaiEntries, dnaptSaiEntries;
+    for (auto naptIter = m_naptEntries.begin(); naptIter != m_naptEntries.end(); naptIter++)
     {
-        if (checkIfNaptEntryIsActive(naptIter, time_now.tv_sec))
+        queried_entries++;
+
+        /* Hitbits are queried for both directions when SNAPT entry is checked */
+        if ((naptIter->second.nat_type == "dnat") or (naptIter->second.addedToHw == false))
         {
-            /* Since the entry is active in the hardware, reset the active time */
-            naptIter->second.activeTime = time_now.tv_sec;
+            continue;
         }
-        else
+
+        if (naptIter->second.entry_type == "static")
         {
-            if ((naptIter->second.nat_type == "snat") and (naptIter->second.addedToHw == true) and
-                (naptIter->second.entry_type != "static"))
+            /* Static NAPT entries are always treated active */
+            naptIter->second.activeTime = now;
+            continue;
+        }
+
+        naptIters.push_back(naptIter);
+        naptSaiEntries.emplace_back();
+        getSaiNatEntry(naptIter, naptSaiEntries.back());
+    }
+
+    getNatEntriesAttribute(naptSaiEntries, nat_entry_attr,
+        [&](size_t index, sai_status_t status, const sai_attribute_t *attr_list)
+        {
+            auto naptIter = naptIters[index];
+            const NaptEntryKey &naptKey = naptIter->first;
+
+            if (status == SAI_STATUS_SUCCESS)
             {
-                int timeout = naptIter->first.prototype == string("TCP") ? tcp_timeout : udp_timeout;
-                if (time_now.tv_sec - naptIter->second.activeTime >= timeout)
+                SWSS_LOG_DEBUG("SNAPT HIT BIT for proto %s, src-ip %s, src-port %d = %d", naptKey.prototype.c_str(),
+                               naptKey.ip_address.to_string().c_str(), naptKey.l4_port, attr_list[0].value.booldata);
+
+                if (attr_list[0].value.booldata)
                 {
-                    std::vector<FieldValueTuple> fvVector;
-                    std::string key = (naptIter->first.prototype + ":" + naptIter->first.ip_address.to_string() + ":" + to_string(naptIter->first.l4_port));
-                    setTimeoutNotifier->send("AGEOUT-SINGLE-NAPT", key, fvVector);
+                    /* Since the entry is active in the hardware, reset the active time */
+                    naptIter->second.ageOutTime = now + ((naptKey.prototype == "TCP") ? tcp_timeout : udp_timeout);
+                    naptIter->second.activeTime = now;
+                    return;
+                }
+
+                NaptEntryKey dnaptKey;
+                dnaptKey.ip_address = naptIter->second.translated_ip;
+                dnaptKey.l4_port    = naptIter->second.translated_l4_port;
+                dnaptKey.prototype  = naptKey.prototype;
+
+                auto dnaptIter = m_naptEntries.find(dnaptKey);
+                if ((dnaptIter != m_naptEntries.end()) and (dnaptIter->second.addedToHw == true))
+                {
+                    dnaptIters.push_back(naptIter);
+                    dnaptSaiEntries.emplace_back();
+                    getSaiNatEntry(dnaptIter, dnaptSaiEntries.back());
+                    return;
+                }
+            }
+
+            checkNaptEntryAgeOut(naptIter, now);
+        });
+
+    /* If SNAPT HitBit is not set, check for the HitBit in the reverse direction */
+    getNatEntriesAttribute(dnaptSaiEntries, nat_entry_attr,
+        [&](size_t index, sai_status_t status, const sai_attribute_t *attr_list)
+        {
+            auto naptIter = dnaptIters[index];
+            const NaptEntryKey &naptKey = naptIter->first;
+
+            if (status == SAI_STATUS_SUCCESS)
+            {
+                SWSS_LOG_DEBUG("DNAPT HIT BIT for proto %s, dst-ip %s, dst-port %d = %d", naptKey.prototype.c_str(),
+                               naptIter->second.translated_ip.to_string().c_str(), naptIter->second.translated_l4_port,
+                               attr_list[0].value.booldata);
+
+                if (attr_list[0].value.booldata)
+                {
+                    naptIter->second.ageOutTime = now + ((naptKey.prototype == "TCP") ? tcp_timeout : udp_timeout);
+                    naptIter->second.activeTime = now;
+                    return;
                 }
             }
-        }
-        queried_entries++;
-        naptIter++;
-    }
+
+            checkNaptEntryAgeOut(naptIter, now);
+        });
 
     /* Remove the Twice NAT entries that are aged out.
      * Query the Twice NAT entries for their activity in the hardware
      * and update the active timeout. */
-    TwiceNatEntry::iterator twiceNatIter = m_twiceNatEntries.begin();
-    while (twiceNatIter != m_twiceNatEntries.end())
+    vector<TwiceNatEntry::iterator> twiceNatIters;
+    vector<sai_nat_entry_t>         twiceNatSaiEntries;
+    for (auto twiceNatIter = m_twiceNatEntries.begin(); twiceNatIter != m_twiceNatEntries.end(); twiceNatIter++)
     {
-        if (checkIfTwiceNatEntryIsActive(twiceNatIter, time_now.tv_sec))
+        queried_entries++;
+
+        if (twiceNatIter->second.entry_type == "static")
+        {
+            /* Static Twice NAT entries are always treated active */
+            twiceNatIter->second.activeTime = now;
+            continue;
+        }
+
+        if (twiceNatIter->second.addedToHw == false)
         {
-            /* Since the entry is active in the hardware, reset the active time */
-            twiceNatIter->second.activeTime = time_now.tv_sec;
+            continue;
         }
-        else
+
+        twiceNatIters.push_back(twiceNatIter);
+        twiceNatSaiEntries.emplace_back();
+        getSaiNatEntry(twiceNatIter, twiceNatSaiEntries.back());
+    }
+
+    getNatEntriesAttribute(twiceNatSaiEntries, nat_entry_attr,
+        [&](size_t index, sai_status_t status, const sai_attribute_t *attr_list)
         {
-            if ((twiceNatIter->second.addedToHw == true) and
-                (twiceNatIter->second.entry_type != "static"))
+            auto twiceNatIter = twiceNatIters[index];
+            const TwiceNatEntryKey &key = twiceNatIter->first;
+
+            if (status == SAI_STATUS_SUCCESS)
             {
-                if (time_now.tv_sec - twiceNatIter->second.activeTime >= timeout)
+                SWSS_LOG_DEBUG("Twice NAT HIT BIT for src-ip %s, dst-ip %s = %d",
+                               key.src_ip.to_string().c_str(), key.dst_ip.to_string().c_str(), attr_list[0].value.booldata);
+
+                if (attr_list[0].value.booldata)
                 {
-                    std::vector<FieldValueTuple> fvVector;
-                    std::string key = (twiceNatIter->first.src_ip.to_string() + ":" + twiceNatIter->first.dst_ip.to_string());
-                    setTimeoutNotifier->send("AGEOUT-TWICE-NAT", key, fvVector);
+                    /* Since the entry is active in the hardware, reset the active time */
+                    twiceNatIter->second.ageOutTime = now + timeout;
+                    twiceNatIter->second.activeTime = now;
+                    return;
                 }
             }
-        }
-        queried_entries++;
-        twiceNatIter++;
-    }
+
+            checkTwiceNatEntryAgeOut(twiceNatIter, now);
+        });
 
     /* Remove the Twice NAPT entries that are aged out.
      * Query the Twice NAPT entries for their activity in the hardware
      * and update the active timeout. */
-    TwiceNaptEntry::iterator twiceNaptIter = m_twiceNaptEntries.begin();
-    while (twiceNaptIter != m_twiceNaptEntries.end())
+    vector<TwiceNaptEntry::iterator> twiceNaptIters;
+    vector<sai_nat_entry_t>          twiceNaptSaiEntries;
+    for (auto twiceNaptIter = m_twiceNaptEntries.begin(); twiceNaptIter != m_twiceNaptEntries.end(); twiceNaptIter++)
     {
-        if (checkIfTwiceNaptEntryIsActive(twiceNaptIter, time_now.tv_sec))
+        queried_entries++;
+
+        if (twiceNaptIter->second.addedToHw == false)
         {
-            /* Since the entry is active in the hardware, reset the active time */
-            twiceNaptIter->second.activeTime = time_now.tv_sec;
+            continue;
         }
-        else
+
+        if (twiceNaptIter->second.entry_type == "static")
+        {
+            /* Static Twice NAPT entries are always treated active */
+            twiceNaptIter->second.activeTime = now;
+            continue;
+        }
+
+        twiceNaptIters.push_back(twiceNaptIter);
+        twiceNaptSaiEntries.emplace_back();
+        getSaiNatEntry(twiceNaptIter, twiceNaptSaiEntries.back());
+    }
+
+    getNatEntriesAttribute(twiceNaptSaiEntries, nat_entry_attr,
+        [&](size_t index, sai_status_t status, const sai_attribute_t *attr_list)
         {
-            if ((twiceNaptIter->second.addedToHw == true) and
-                (twiceNaptIter->second.entry_type != "static"))
+            auto twiceNaptIter = twiceNaptIters[index];
+            const TwiceNaptEntryKey &key = twiceNaptIter->first;
+
+            if (status == SAI_STATUS_SUCCESS)
             {
-                int timeout = twiceNaptIter->first.prototype == string("TCP") ? tcp_timeout : udp_timeout;
-                if (time_now.tv_sec - twiceNaptIter->second.activeTime >= timeout)
+                SWSS_LOG_DEBUG("Twice NAPT HIT BIT for [proto %s, src ip %s, src port %d, dst ip %s, dst port %d] = %d",
+                               key.prototype.c_str(), key.src_ip.to_string().c_str(), key.src_l4_port, key.dst_ip.to_string().c_str(),
+                               key.dst_l4_port, attr_list[0].value.booldata);
+
+                if (attr_list[0].value.booldata)
                 {
-                    std::vector<FieldValueTuple> fvVector;
-                    std::string key = (twiceNaptIter->first.prototype + ":" + twiceNaptIter->first.src_ip.to_string() + ":" + to_string(twiceNaptIter->first.src_l4_port) + 
-                                       ":" + twiceNaptIter->first.dst_ip.to_string() + ":" + to_string(twiceNaptIter->first.dst_l4_port));
-                    setTimeoutNotifier->send("AGEOUT-TWICE-NAPT", key, fvVector);
+                    /* Since the entry is active in the hardware, reset the active time */
+                    twiceNaptIter->second.ageOutTime = now + ((key.prototype == "TCP") ? tcp_timeout : udp_timeout);
+                    twiceNaptIter->second.activeTime = now;
+                    return;
                 }
             }
-        }
-        queried_entries++;
-        twiceNaptIter++;
-    }
+
+            checkTwiceNaptEntryAgeOut(twiceNaptIter, now);
+        });
+
     if (clock_gettime (CLOCK_MONOTONIC, &time_end) < 0)
     {
         return;
@@ -3498,50 +3882,17 @@ void NatOrch::updateAllConntrackEntries(void)
             std::string key = (twiceNaptIter->first.prototype + ":" + twiceNaptIter->first.src_ip.to_string() + ":" + to_string(twiceNaptIter->first.src_l4_port) +
                                ":" + twiceNaptIter->first.dst_ip.to_string() + ":" + to_string(twiceNaptIter->first.dst_l4_port));
             setTimeoutNotifier->send("SET-TWICE-NAPT", key, fvVector);
-        }
-        twiceNaptIter++;
-    }
-}
-
-bool NatOrch::getNatCounters(const NatEntry::iterator &iter)
-{
-    const IpAddress   &ipAddr = iter->first;
-    NatEntryValue     &entry  = iter->second;
-    uint32_t          attr_count;
-    sai_attribute_t   nat_entry_attr[4] = {};
-    sai_nat_entry_t   nat_entry = {};
-    sai_status_t      status;
-    uint64_t          nat_translations_pkts = 0, nat_translations_bytes = 0;
-
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get Counters for %s NAT entry [ip %s], as not yet added to HW", entry.nat_type.c_str(), ipAddr.to_string().c_str());
-        return 0;
-    }
-
-    nat_entry_attr[0].id   = SAI_NAT_ENTRY_ATTR_BYTE_COUNT;
-    nat_entry_attr[1].id   = SAI_NAT_ENTRY_ATTR_PACKET_COUNT;
-
-    attr_count = 2;
-
-
-    nat_entry.vr_id       = gVirtualRouterId;
-    nat_entry.switch_id   = gSwitchId;
-
-    if (entry.nat_type == "dnat")
-    {
-        nat_entry.nat_type = SAI_NAT_TYPE_DESTINATION_NAT;
-        nat_entry.data.key.dst_ip = ipAddr.getV4Addr();   
-        nat_entry.data.mask.dst_ip = 0xffffffff;
-    }
-    else
-    {
-        nat_entry.nat_type = SAI_NAT_TYPE_SOURCE_NAT;
-        nat_entry.data.key.src_ip = ipAddr.getV4Addr();
-        nat_entry.data.mask.src_ip = 0xffffffff;
+        }
+        twiceNaptIter++;
     }
+}
+
+bool NatOrch::getNatCounters(const NatEntry::iterator &iter, sai_status_t status, const sai_attribute_t *nat_entry_attr)
+{
+    const IpAddress   &ipAddr = iter->first;
+    NatEntryValue     &entry  = iter->second;
+    uint64_t          nat_translations_pkts = 0, nat_translations_bytes = 0;
 
-    status = sai_nat_api->get_nat_entry_attribute(&nat_entry, attr_count, nat_entry_attr);
     if (entry.nat_type == "snat")
     {
         if (status != SAI_STATUS_SUCCESS)
@@ -3575,37 +3926,11 @@ bool NatOrch::getNatCounters(const NatEntry::iterator &iter)
     return 0;
 }
 
-bool NatOrch::getTwiceNatCounters(const TwiceNatEntry::iterator &iter)
+bool NatOrch::getTwiceNatCounters(const TwiceNatEntry::iterator &iter, sai_status_t status, const sai_attribute_t *nat_entry_attr)
 {
     const TwiceNatEntryKey   &key = iter->first;
-    TwiceNatEntryValue       &entry  = iter->second;
-    uint32_t          attr_count;
-    sai_attribute_t   nat_entry_attr[4] = {};
-    sai_nat_entry_t   dbl_nat_entry = {};
-    sai_status_t      status;
     uint64_t          nat_translations_pkts = 0, nat_translations_bytes = 0;
 
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get Counters for Twice NAT entry [src ip %s, dst ip %s], as not yet added to HW",
-                        key.src_ip.to_string().c_str(), key.dst_ip.to_string().c_str());
-        return 0;
-    }
-
-    nat_entry_attr[0].id   = SAI_NAT_ENTRY_ATTR_BYTE_COUNT;
-    nat_entry_attr[1].id   = SAI_NAT_ENTRY_ATTR_PACKET_COUNT;
-
-    attr_count = 2;
-
-    dbl_nat_entry.vr_id = gVirtualRouterId;
-    dbl_nat_entry.switch_id = gSwitchId;
-    dbl_nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
-    dbl_nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
-    dbl_nat_entry.data.mask.src_ip = 0xffffffff;
-    dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
-    dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&dbl_nat_entry, attr_count, nat_entry_attr);
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_ERROR("Failed to get Counters for Twice NAT entry [src-ip %s, dst-ip %s], bytes = %" PRIu64 ", pkts = %" PRIu64 "",
@@ -3702,54 +4027,12 @@ bool NatOrch::setNatCounters(const NatEntry::iterator &iter)
     return 0;
 }
 
-bool NatOrch::getNaptCounters(const NaptEntry::iterator &iter)
+bool NatOrch::getNaptCounters(const NaptEntry::iterator &iter, sai_status_t status, const sai_attribute_t *nat_entry_attr)
 {
     const NaptEntryKey &naptKey    = iter->first;
     NaptEntryValue     &entry      = iter->second;
-    uint8_t            protoType   = ((naptKey.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    uint32_t           attr_count;
-    sai_attribute_t    nat_entry_attr[4] = {};
-    sai_nat_entry_t    nat_entry = {};
-    sai_status_t       status;
     uint64_t           nat_translations_pkts = 0, nat_translations_bytes = 0;
 
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get Counters for %s NAPT entry for [proto %s, ip %s, port %d], as not yet added to HW",
-                       entry.nat_type.c_str(), naptKey.prototype.c_str(), naptKey.ip_address.to_string().c_str(), naptKey.l4_port);
-        return 0;
-    }
-
-    nat_entry_attr[0].id   = SAI_NAT_ENTRY_ATTR_BYTE_COUNT;
-    nat_entry_attr[1].id   = SAI_NAT_ENTRY_ATTR_PACKET_COUNT;
-
-    attr_count = 2;
-
-    nat_entry.vr_id       = gVirtualRouterId;
-    nat_entry.switch_id   = gSwitchId;
-
-    if (entry.nat_type == "dnat")
-    {
-        nat_entry.nat_type = SAI_NAT_TYPE_DESTINATION_NAT;
-        nat_entry.data.key.dst_ip      = naptKey.ip_address.getV4Addr();
-        nat_entry.data.key.l4_dst_port = (uint16_t)(naptKey.l4_port);
-        nat_entry.data.mask.dst_ip      = 0xffffffff;
-        nat_entry.data.mask.l4_dst_port = 0xffff;
-    }
-    else if (entry.nat_type == "snat")
-    {
-        nat_entry.nat_type = SAI_NAT_TYPE_SOURCE_NAT;
-        nat_entry.data.key.src_ip      = naptKey.ip_address.getV4Addr();
-        nat_entry.data.key.l4_src_port = (uint16_t)(naptKey.l4_port);
-        nat_entry.data.mask.src_ip      = 0xffffffff;
-        nat_entry.data.mask.l4_src_port = 0xffff;
-    }
-
-    nat_entry.data.key.proto        = protoType;
-    nat_entry.data.mask.proto       = 0xff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&nat_entry, attr_count, nat_entry_attr);
-
     if (entry.nat_type == "snat")
     { 
         if (status != SAI_STATUS_SUCCESS)
@@ -3785,46 +4068,11 @@ bool NatOrch::getNaptCounters(const NaptEntry::iterator &iter)
     return 0;
 }
 
-bool NatOrch::getTwiceNaptCounters(const TwiceNaptEntry::iterator &iter)
+bool NatOrch::getTwiceNaptCounters(const TwiceNaptEntry::iterator &iter, sai_status_t status, const sai_attribute_t *nat_entry_attr)
 {
     const TwiceNaptEntryKey &key    = iter->first;
-    TwiceNaptEntryValue     &entry      = iter->second;
-    uint8_t            protoType   = ((key.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    uint32_t           attr_count;
-    sai_attribute_t    nat_entry_attr[4] = {};
-    sai_nat_entry_t    dbl_nat_entry = {};
-    sai_status_t       status;
     uint64_t           nat_translations_pkts = 0, nat_translations_bytes = 0;
 
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get Counters for Twice NAPT entry for [proto %s, src ip %s, src port %d, dst ip %s, dst port %d], as not yet added to HW",
-                       key.prototype.c_str(), key.src_ip.to_string().c_str(), key.src_l4_port, key.dst_ip.to_string().c_str(),
-                       key.dst_l4_port);
-        return 0;
-    }
-
-    nat_entry_attr[0].id   = SAI_NAT_ENTRY_ATTR_BYTE_COUNT;
-    nat_entry_attr[1].id   = SAI_NAT_ENTRY_ATTR_PACKET_COUNT;
-
-    attr_count = 2;
-
-    dbl_nat_entry.vr_id = gVirtualRouterId;
-    dbl_nat_entry.switch_id = gSwitchId;
-    dbl_nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
-    dbl_nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
-    dbl_nat_entry.data.mask.src_ip = 0xffffffff;
-    dbl_nat_entry.data.key.l4_src_port = (uint16_t)(key.src_l4_port);
-    dbl_nat_entry.data.mask.l4_src_port = 0xffff;
-    dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
-    dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
-    dbl_nat_entry.data.key.l4_dst_port = (uint16_t)(key.dst_l4_port);
-    dbl_nat_entry.data.mask.l4_dst_port = 0xffff;
-    dbl_nat_entry.data.key.proto = protoType;
-    dbl_nat_entry.data.mask.proto = 0xff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&dbl_nat_entry, attr_count, nat_entry_attr);
-
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_DEBUG("Failed to get Counters for Twice NAPT entry for [proto %s, src ip %s, src port %d, dst ip %s, dst port %d], as not yet added to HW",
@@ -4133,317 +4381,63 @@ void NatOrch::updateTwiceNaptCounters(const TwiceNaptEntryKey &key,
     m_countersTwiceNaptTable.set(naptKey, values);
 }
 
-bool NatOrch::checkIfNatEntryIsActive(const NatEntry::iterator &iter, time_t now)
+void NatOrch::checkNatEntryAgeOut(const NatEntry::iterator &iter, time_t now)
 {
-    const IpAddress   &ipAddr = iter->first;
-    NatEntryValue     &entry  = iter->second;
-    uint32_t          attr_count;
-    IpAddress         srcIp;
-    sai_attribute_t   nat_entry_attr[4] = {};
-    sai_nat_entry_t   snat_entry = {};
-    sai_nat_entry_t   dnat_entry;
-    sai_status_t      status;
-
-    if (entry.nat_type == "dnat")
-    {
-        /* Hitbits are queried for both directions when SNAT entry is checked */
-        return 0;
-    }
-
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get hitbits for %s NAT entry [ip %s], as not yet added to HW", entry.nat_type.c_str(), ipAddr.to_string().c_str());
-        return 0;
-    }
-
-    if (entry.entry_type == "static")
-    {
-        /* Static NAT entries are always treated active */ 
-        return 1;
-    }
-
-    nat_entry_attr[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
-    nat_entry_attr[0].value.booldata = 0;
-    nat_entry_attr[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
-    nat_entry_attr[1].value.booldata = 1;
-
-    attr_count = 2;
-
-    snat_entry.vr_id                 = gVirtualRouterId;
-    snat_entry.switch_id             = gSwitchId;
-    snat_entry.nat_type              = SAI_NAT_TYPE_SOURCE_NAT;
-    srcIp     = ipAddr;
-    snat_entry.data.key.src_ip   = srcIp.getV4Addr();
-    snat_entry.data.mask.src_ip  = 0xffffffff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&snat_entry, attr_count, nat_entry_attr);
-    if (status == SAI_STATUS_SUCCESS)
+    if ((iter->second.nat_type == "snat") and (iter->second.addedToHw == true) and
+        (iter->second.entry_type != "static"))
     {
-        SWSS_LOG_DEBUG("SNAT HIT BIT for src-ip %s = %d", srcIp.to_string().c_str(),
-                      nat_entry_attr[0].value.booldata);
-
-        if (nat_entry_attr[0].value.booldata)
+        if (now - iter->second.activeTime >= timeout)
         {
-            entry.ageOutTime = now + timeout;
-            return 1;
-        }
-        else
-        {
-            auto dnatIter = m_natEntries.find(entry.translated_ip);
-            if (dnatIter == m_natEntries.end())
-            {
-                return 0;
-            }
-            if ((dnatIter->second).addedToHw == false)
-            {
-                return 0;
-            }
-
-            /* If SNAT HitBit is not set, check for the HitBit in the reverse direction */
-            memset(&dnat_entry, 0, sizeof(dnat_entry));
-
-            dnat_entry.vr_id             = gVirtualRouterId;
-            dnat_entry.switch_id         = gSwitchId;
-            dnat_entry.nat_type          = SAI_NAT_TYPE_DESTINATION_NAT;
-            dnat_entry.data.key.dst_ip   = entry.translated_ip.getV4Addr();
-            dnat_entry.data.mask.dst_ip  = 0xffffffff;
-
-            status = sai_nat_api->get_nat_entry_attribute(&dnat_entry, attr_count, nat_entry_attr);
-            if (status == SAI_STATUS_SUCCESS)
-            {
-                SWSS_LOG_DEBUG("DNAT HIT BIT for dst-ip %s = %d", entry.translated_ip.to_string().c_str(),
-                                nat_entry_attr[0].value.booldata);
-                if (nat_entry_attr[0].value.booldata)
-                {
-                    entry.ageOutTime = now + timeout;
-                    return 1;
-                }
-            }
+            std::vector<FieldValueTuple> fvVector;
+            std::string key = iter->first.to_string();
+            setTimeoutNotifier->send("AGEOUT-SINGLE-NAT", key, fvVector);
         }
     }
-    return 0;
 }
 
-bool NatOrch::checkIfNaptEntryIsActive(const NaptEntry::iterator &iter, time_t now)
+void NatOrch::checkNaptEntryAgeOut(const NaptEntry::iterator &iter, time_t now)
 {
-    const NaptEntryKey &naptKey    = iter->first;
-    NaptEntryValue     &entry      = iter->second;
-    int                protoType   = ((naptKey.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    uint32_t           attr_count;
-    IpAddress          srcIp;
-    uint16_t           srcPort;
-    sai_attribute_t    nat_entry_attr[4] = {};
-    sai_nat_entry_t    snat_entry = {};
-    sai_nat_entry_t    dnat_entry;
-    sai_status_t       status;
-
-    if (entry.nat_type == "dnat")
-    {
-        /* Hitbits are queried for both directions when SNAT entry is checked */
-        return 0;
-    }
-
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get hitbits for %s NAPT entry for [proto %s, ip %s, port %d], as not yet added to HW",
-                       entry.nat_type.c_str(), naptKey.prototype.c_str(), naptKey.ip_address.to_string().c_str(), naptKey.l4_port);
-        return 0;
-    }
-
-    if (entry.entry_type == "static")
-    {
-        /* Static NAPT entries are always treated active */
-        return 1;
-    }
-
-    nat_entry_attr[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
-    nat_entry_attr[0].value.booldata = 0;
-    nat_entry_attr[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
-    nat_entry_attr[1].value.booldata = 1;
-
-    attr_count = 2;
-
-    snat_entry.vr_id                 = gVirtualRouterId;
-    snat_entry.switch_id             = gSwitchId;
-    snat_entry.nat_type              = SAI_NAT_TYPE_SOURCE_NAT;
-
-    srcIp     = naptKey.ip_address;
-    srcPort   = (uint16_t)(naptKey.l4_port);
-    snat_entry.data.key.src_ip       = srcIp.getV4Addr();
-    snat_entry.data.key.l4_src_port  = srcPort;
-
-    snat_entry.data.mask.src_ip      = 0xffffffff;
-    snat_entry.data.mask.l4_src_port = 0xffff;
-    snat_entry.data.key.proto        = (uint8_t)protoType;
-    snat_entry.data.mask.proto       = 0xff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&snat_entry, attr_count, nat_entry_attr);
-    if (status == SAI_STATUS_SUCCESS)
+    if ((iter->second.nat_type == "snat") and (iter->second.addedToHw == true) and
+        (iter->second.entry_type != "static"))
     {
-        SWSS_LOG_DEBUG("SNAPT HIT BIT for proto %s, src-ip %s, src-port %d = %d", naptKey.prototype.c_str(),
-                      srcIp.to_string().c_str(), srcPort, nat_entry_attr[0].value.booldata);
-        if (nat_entry_attr[0].value.booldata)
-        {
-            entry.ageOutTime = now + ((protoType == IPPROTO_TCP) ? tcp_timeout : udp_timeout);
-            return 1;
-        }
-        else
+        int timeout = iter->first.prototype == string("TCP") ? tcp_timeout : udp_timeout;
+        if (now - iter->second.activeTime >= timeout)
         {
-            NaptEntryKey dnaptKey;
-            dnaptKey.ip_address = entry.translated_ip;
-            dnaptKey.l4_port    = entry.translated_l4_port;
-            dnaptKey.prototype  = naptKey.prototype;
-
-            auto dnaptIter = m_naptEntries.find(dnaptKey);
-            if (dnaptIter == m_naptEntries.end())
-            {
-                return 0;
-            }
-            if ((dnaptIter->second).addedToHw == false)
-            {
-                return 0;
-            }
-
-
-            /* If SNAPT HitBit is not set, check for the HitBit in the reverse direction */
-            memset(&dnat_entry, 0, sizeof(dnat_entry));
-
-            dnat_entry.vr_id                 = gVirtualRouterId;
-            dnat_entry.switch_id             = gSwitchId;
-            dnat_entry.nat_type              = SAI_NAT_TYPE_DESTINATION_NAT;
-
-            dnat_entry.data.key.dst_ip       = entry.translated_ip.getV4Addr();
-            dnat_entry.data.key.l4_dst_port  = (uint16_t)(entry.translated_l4_port);
-
-            dnat_entry.data.mask.dst_ip      = 0xffffffff;
-            dnat_entry.data.mask.l4_dst_port = 0xffff;
-            dnat_entry.data.key.proto        = (uint8_t)protoType;
-            dnat_entry.data.mask.proto       = 0xff;
-
-            status = sai_nat_api->get_nat_entry_attribute(&dnat_entry, attr_count, nat_entry_attr);
-            if (status == SAI_STATUS_SUCCESS)
-            {
-                SWSS_LOG_DEBUG("DNAPT HIT BIT for proto %s, dst-ip %s, dst-port %d = %d", naptKey.prototype.c_str(),
-                              entry.translated_ip.to_string().c_str(), entry.translated_l4_port, nat_entry_attr[0].value.booldata);
-                if (nat_entry_attr[0].value.booldata)
-                {
-                    entry.ageOutTime = now + ((protoType == IPPROTO_TCP) ? tcp_timeout : udp_timeout);
-                    return 1;
-                }
-            }
+            std::vector<FieldValueTuple> fvVector;
+            std::string key = (iter->first.prototype + ":" + iter->first.ip_address.to_string() + ":" + to_string(iter->first.l4_port));
+            setTimeoutNotifier->send("AGEOUT-SINGLE-NAPT", key, fvVector);
         }
     }
-    return 0;
 }
 
-bool NatOrch::checkIfTwiceNatEntryIsActive(const TwiceNatEntry::iterator &iter, time_t now)
+void NatOrch::checkTwiceNatEntryAgeOut(const TwiceNatEntry::iterator &iter, time_t now)
 {
-    const TwiceNatEntryKey &key    = iter->first;
-    TwiceNatEntryValue     &entry  = iter->second;
-    uint32_t           attr_count;
-    sai_attribute_t    nat_entry_attr[4] = {};
-    sai_nat_entry_t    dbl_nat_entry = {};
-    sai_status_t       status;
-
-    if (entry.entry_type == "static")
-    {
-        /* Static NAPT entries are always treated active */
-        return 1;
-    }
-
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get hitbits for Twice NAPT entry for [src ip %s, dst-ip %s], as not yet added to HW",
-                       key.src_ip.to_string().c_str(), key.dst_ip.to_string().c_str());
-        return 0;
-    }
-
-    nat_entry_attr[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
-    nat_entry_attr[0].value.booldata = 0;
-    nat_entry_attr[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
-    nat_entry_attr[1].value.booldata = 1;
-
-    attr_count = 2;
-
-    dbl_nat_entry.vr_id = gVirtualRouterId;
-    dbl_nat_entry.switch_id = gSwitchId;
-    dbl_nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
-    dbl_nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
-    dbl_nat_entry.data.mask.src_ip = 0xffffffff;
-    dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
-    dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&dbl_nat_entry, attr_count, nat_entry_attr);
-    if (status == SAI_STATUS_SUCCESS)
+    if ((iter->second.addedToHw == true) and
+        (iter->second.entry_type != "static"))
     {
-        SWSS_LOG_DEBUG("Twice NAT HIT BIT for src-ip %s, dst-ip %s = %d",
-                       key.src_ip.to_string().c_str(), key.dst_ip.to_string().c_str(), nat_entry_attr[0].value.booldata);
-        if (nat_entry_attr[0].value.booldata)
+        if (now - iter->second.activeTime >= timeout)
         {
-            entry.ageOutTime = now + timeout;
-            return 1;
+            std::vector<FieldValueTuple> fvVector;
+            std::string key = (iter->first.src_ip.to_string() + ":" + iter->first.dst_ip.to_string());
+            setTimeoutNotifier->send("AGEOUT-TWICE-NAT", key, fvVector);
         }
     }
-    return 0;
 }
 
-bool NatOrch::checkIfTwiceNaptEntryIsActive(const TwiceNaptEntry::iterator &iter, time_t now)
+void NatOrch::checkTwiceNaptEntryAgeOut(const TwiceNaptEntry::iterator &iter, time_t now)
 {
-    const TwiceNaptEntryKey &key   = iter->first;
-    TwiceNaptEntryValue     &entry = iter->second;
-    uint8_t            protoType   = ((key.prototype == "TCP") ? IPPROTO_TCP : IPPROTO_UDP);
-    uint32_t           attr_count;
-    sai_attribute_t    nat_entry_attr[4] = {};
-    sai_nat_entry_t    dbl_nat_entry = {};
-    sai_status_t       status;
-
-    if (entry.addedToHw == false)
-    {
-        SWSS_LOG_DEBUG("Skip get hitbits for Twice NAPT entry for [proto %s, src ip %s, src port %d, dst ip %s, dst port %d], as not yet added to HW",
-                        key.prototype.c_str(), key.src_ip.to_string().c_str(), key.src_l4_port, key.dst_ip.to_string().c_str(), key.dst_l4_port);
-        return 0;
-    }
-
-    if (entry.entry_type == "static")
-    {
-        /* Static NAPT entries are always treated active */
-        return 1;
-    }
-
-    nat_entry_attr[0].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT;  /* Get the Hit bit */
-    nat_entry_attr[0].value.booldata = 0;
-    nat_entry_attr[1].id             = SAI_NAT_ENTRY_ATTR_HIT_BIT_COR; /* clear the hit bit after returning the value */
-    nat_entry_attr[1].value.booldata = 1;
-
-    attr_count = 2;
-
-    dbl_nat_entry.vr_id = gVirtualRouterId;
-    dbl_nat_entry.switch_id = gSwitchId;
-    dbl_nat_entry.nat_type = SAI_NAT_TYPE_DOUBLE_NAT;
-    dbl_nat_entry.data.key.src_ip = key.src_ip.getV4Addr();
-    dbl_nat_entry.data.mask.src_ip = 0xffffffff;
-    dbl_nat_entry.data.key.l4_src_port = (uint16_t)(key.src_l4_port);
-    dbl_nat_entry.data.mask.l4_src_port = 0xffff;
-    dbl_nat_entry.data.key.dst_ip = key.dst_ip.getV4Addr();
-    dbl_nat_entry.data.mask.dst_ip = 0xffffffff;
-    dbl_nat_entry.data.key.l4_dst_port = (uint16_t)(key.dst_l4_port);
-    dbl_nat_entry.data.mask.l4_dst_port = 0xffff;
-    dbl_nat_entry.data.key.proto = protoType;
-    dbl_nat_entry.data.mask.proto = 0xff;
-
-    status = sai_nat_api->get_nat_entry_attribute(&dbl_nat_entry, attr_count, nat_entry_attr);
-    if (status == SAI_STATUS_SUCCESS)
+    if ((iter->second.addedToHw == true) and
+        (iter->second.entry_type != "static"))
     {
-        SWSS_LOG_DEBUG("Twice NAPT HIT BIT for [proto %s, src ip %s, src port %d, dst ip %s, dst port %d] = %d",
-                        key.prototype.c_str(), key.src_ip.to_string().c_str(), key.src_l4_port, key.dst_ip.to_string().c_str(), key.dst_l4_port,
-                        nat_entry_attr[0].value.booldata);
-        if (nat_entry_attr[0].value.booldata)
+        int timeout = iter->first.prototype == string("TCP") ? tcp_timeout : udp_timeout;
+        if (now - iter->second.activeTime >= timeout)
         {
-            entry.ageOutTime = now + ((protoType == IPPROTO_TCP) ? tcp_timeout : udp_timeout);
-            return 1;
+            std::vector<FieldValueTuple> fvVector;
+            std::string key = (iter->first.prototype + ":" + iter->first.src_ip.to_string() + ":" + to_string(iter->first.src_l4_port) +
+                               ":" + iter->first.dst_ip.to_string() + ":" + to_string(iter->first.dst_l4_port));
+            setTimeoutNotifier->send("AGEOUT-TWICE-NAPT", key, fvVector);
         }
     }
-    return 0;
 }
 
 void NatOrch::doTask(NotificationConsumer& consumer)
@@ -17,6 +17,8 @@
 #ifndef SWSS_NATORCH_H
 #define SWSS_NATORCH_H
 
+#include <functional>
+
 #include "orch.h"
 #include "observer.h"
 #include "portsorch.h"
@@ -241,6 +243,7 @@ private:
     int              totalDnatEntries;
     int              maxAllowedSNatEntries;
     string           admin_mode;
+    bool             m_natBulkGetSupported = true;
 
     void doTask(Consumer& consumer);
     void doTask(SelectableTimer &timer);
@@ -289,10 +292,18 @@ private:
     bool addHwDnatPoolEntry(const IpAddress &dstIp);
     bool removeHwDnatPoolEntry(const IpAddress &dstIp);
 
-    bool checkIfNatEntryIsActive(const NatEntry::iterator &iter, time_t now);
-    bool checkIfNaptEntryIsActive(const NaptEntry::iterator &iter, time_t now);
-    bool checkIfTwiceNatEntryIsActive(const TwiceNatEntry::iterator &iter, time_t now);
-    bool checkIfTwiceNaptEntryIsActive(const TwiceNaptEntry::iterator &iter, time_t now);
+    void checkNatEntryAgeOut(const NatEntry::iterator &iter, time_t now);
+    void checkNaptEntryAgeOut(const NaptEntry::iterator &iter, time_t now);
+    void checkTwiceNatEntryAgeOut(const TwiceNatEntry::iterator &iter, time_t now);
+    void checkTwiceNaptEntryAgeOut(const TwiceNaptEntry::iterator &iter, time_t now);
+
+    void getSaiNatEntry(const NatEntry::iterator &iter, sai_nat_entry_t &nat_entry);
+    void getSaiNatEntry(const NaptEntry::iterator &iter, sai_nat_entry_t &nat_entry);
+    void getSaiNatEntry(const TwiceNatEntry::iterator &iter, sai_nat_entry_t &nat_entry);
+    void getSaiNatEntry(const TwiceNaptEntry::iterator &iter, sai_nat_entry_t &nat_entry);
+    /* Get the attrs of each NAT entry with SAI bulk calls, process() is called with the result of each entry */
+    void getNatEntriesAttribute(const vector<sai_nat_entry_t> &entries, const vector<sai_attribute_t> &attrs,
+                                const function<void(size_t, sai_status_t, const sai_attribute_t *)> &process);
 
     void enableNatFeature(void);
     void disableNatFeature(void);
@@ -304,10 +315,10 @@ private:
     void queryCounters(void);
     void queryHitBits(void);
     bool isNatEnabled(void);
-    bool getNatCounters(const NatEntry::iterator &iter);
-    bool getTwiceNatCounters(const TwiceNatEntry::iterator &iter);
-    bool getNaptCounters(const NaptEntry::iterator &iter);
-    bool getTwiceNaptCounters(const TwiceNaptEntry::iterator &iter);
+    bool getNatCounters(const NatEntry::iterator &iter, sai_status_t status, const sai_attribute_t *nat_entry_attr);
+    bool getTwiceNatCounters(const TwiceNatEntry::iterator &iter, sai_status_t status, const sai_attribute_t *nat_entry_attr);
+    bool getNaptCounters(const NaptEntry::iterator &iter, sai_status_t status, const sai_attribute_t *nat_entry_attr);
+    bool getTwiceNaptCounters(const TwiceNaptEntry::iterator &iter, sai_status_t status, const sai_attribute_t *nat_entry_attr);
     bool setNatCounters(const NatEntry::iterator &iter);
     bool setTwiceNatCounters(const TwiceNatEntry::iterator &iter);
     bool setNaptCounters(const NaptEntry::iterator &iter);
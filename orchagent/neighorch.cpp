@@ -123,22 +123,22 @@ void NeighOrch::processFDBFlushUpdate(const FdbFlushUpdate& update)
     for (auto entry : update.entries)
     {
         // Get Vlan object
-        Port vlan;
-        if (!m_portsOrch->getPort(entry.bv_id, vlan))
+        Port *vlan = m_portsOrch->findPort(entry.bv_id);
+        if (!vlan)
         {
             SWSS_LOG_NOTICE("FdbOrch notification: Failed to locate vlan port \
                              from bv_id 0x%" PRIx64 ".", entry.bv_id);
             continue;
         }
         SWSS_LOG_INFO("Flushing ARP for port: %s, VLAN: %s",
-                      vlan.m_alias.c_str(), update.port.m_alias.c_str());
+                      vlan->m_alias.c_str(), update.port.m_alias.c_str());
 
         // If the FDB entry MAC matches with neighbor/ARP entry MAC,
         // and ARP entry incoming interface matches with VLAN name,
         // flush neighbor/arp entry.
         for (const auto &neighborEntry : m_syncdNeighbors)
         {
-            if (neighborEntry.first.alias == vlan.m_alias &&
+            if (neighborEntry.first.alias == vlan->m_alias &&
                 neighborEntry.second.mac == entry.mac)
             {
                 resolveNeighborEntry(neighborEntry.first, neighborEntry.second.mac);
@@ -202,16 +202,17 @@ bool NeighOrch::addNextHop(NeighborContext& ctx)
     SWSS_LOG_ENTER();
     const NextHopKey nh = ctx.neighborEntry;
 
-    Port p;
-    if (!gPortsOrch->getPort(nh.alias, p))
+    Port *p = gPortsOrch->findPort(nh.alias);
+    if (!p)
     {
         SWSS_LOG_ERROR("Neighbor %s seen on port %s which doesn't exist",
                         nh.ip_address.to_string().c_str(), nh.alias.c_str());
         return false;
     }
-    if (p.m_type == Port::SUBPORT)
+    if (p->m_type == Port::SUBPORT)
     {
-        if (!gPortsOrch->getPort(p.m_parent_port_id, p))
+        p = gPortsOrch->findPort(p->m_parent_port_id);
+        if (!p)
         {
             SWSS_LOG_ERROR("Neighbor %s seen on sub interface %s whose parent port doesn't exist",
                             nh.ip_address.to_string().c_str(), nh.alias.c_str());
@@ -272,7 +273,7 @@ bool NeighOrch::addNextHop(NeighborContext& ctx)
 
     if (ctx.bulk_op)
     {
-        gNextHopBulker.create_entry(&ctx.next_hop_id , (uint32_t)next_hop_attrs.size(), next_hop_attrs.data());
+        gNextHopBulker.create_entry(&ctx.next_hop_id, &ctx.nexthop_status, (uint32_t)next_hop_attrs.size(), next_hop_attrs.data());
         return true;
     }
 
@@ -303,11 +304,7 @@ bool NeighOrch::addNextHop(NeighborContext& ctx)
         SWSS_LOG_INFO("Resolved neighbor for %s", nexthop.to_string().c_str());
     }
 
-    NextHopEntry next_hop_entry;
-    next_hop_entry.next_hop_id = next_hop_id;
-    next_hop_entry.ref_count = 0;
-    next_hop_entry.nh_flags = 0;
-    m_syncdNextHops[nexthop] = next_hop_entry;
+    addNextHopEntry(nexthop, next_hop_id);
 
     m_intfsOrch->increaseRouterIntfsRefCount(nh.alias);
 
@@ -333,7 +330,7 @@ bool NeighOrch::addNextHop(NeighborContext& ctx)
     // flag should be set on it.
     // This scenario may happen under race condition where buffered neighbor event
     // is processed after incoming port is down.
-    if (p.m_oper_status == SAI_PORT_OPER_STATUS_DOWN)
+    if (p->m_oper_status == SAI_PORT_OPER_STATUS_DOWN)
     {
         if (setNextHopFlag(nexthop, NHFLAGS_IFDOWN) == false)
         {
@@ -350,16 +347,17 @@ bool NeighOrch::processBulkAddNextHop(NeighborContext& ctx)
 
     const NextHopKey nh = ctx.neighborEntry;
 
-    Port p;
-    if (!gPortsOrch->getPort(nh.alias, p))
+    Port *p = gPortsOrch->findPort(nh.alias);
+    if (!p)
     {
         SWSS_LOG_ERROR("Neighbor %s seen on port %s which doesn't exist",
                         nh.ip_address.to_string().c_str(), nh.alias.c_str());
         return false;
     }
-    if (p.m_type == Port::SUBPORT)
+    if (p->m_type == Port::SUBPORT)
     {
-        if (!gPortsOrch->getPort(p.m_parent_port_id, p))
+        p = gPortsOrch->findPort(p->m_parent_port_id);
+        if (!p)
         {
             SWSS_LOG_ERROR("Neighbor %s seen on sub interface %s whose parent port doesn't exist",
                             nh.ip_address.to_string().c_str(), nh.alias.c_str());
@@ -368,18 +366,24 @@ bool NeighOrch::processBulkAddNextHop(NeighborContext& ctx)
     }
 
     NextHopKey nexthop(nh);
-    if (ctx.next_hop_id == SAI_NULL_OBJECT_ID)
+    if (ctx.nexthop_status != SAI_STATUS_SUCCESS)
     {
-        sai_status_t bulker_status = gNextHopBulker.create_status(ctx.next_hop_id);
-        if (bulker_status == SAI_STATUS_ITEM_ALREADY_EXISTS)
+        if (ctx.nexthop_status == SAI_STATUS_ITEM_ALREADY_EXISTS)
         {
             SWSS_LOG_NOTICE("Next hop %s on %s already exists",
                         nexthop.ip_address.to_string().c_str(), nexthop.alias.c_str());
             return true;
         }
+        if (ctx.nexthop_status == SAI_STATUS_NOT_EXECUTED)
+        {
+            /* The bulk call did not reach this entry, the neighbor is added again */
+            SWSS_LOG_INFO("Next hop %s on %s not created yet, will retry",
+                          nexthop.ip_address.to_string().c_str(), nexthop.alias.c_str());
+            return false;
+        }
         SWSS_LOG_ERROR("Failed to create next hop %s on %s, rv:%d",
-                       nexthop.ip_address.to_string().c_str(), nexthop.alias.c_str(), bulker_status);
-        task_process_status handle_status = handleSaiCreateStatus(SAI_API_NEXT_HOP, bulker_status);
+                       nexthop.ip_address.to_string().c_str(), nexthop.alias.c_str(), ctx.nexthop_status);
+        task_process_status handle_status = handleSaiCreateStatus(SAI_API_NEXT_HOP, ctx.nexthop_status);
         if (handle_status != task_success)
         {
             return parseHandleSaiStatusFailure(handle_status);
@@ -395,11 +399,7 @@ bool NeighOrch::processBulkAddNextHop(NeighborContext& ctx)
         SWSS_LOG_INFO("Resolved neighbor for %s", nexthop.to_string().c_str());
     }
 
-    NextHopEntry next_hop_entry;
-    next_hop_entry.next_hop_id = ctx.next_hop_id;
-    next_hop_entry.ref_count = 0;
-    next_hop_entry.nh_flags = 0;
-    m_syncdNextHops[nexthop] = next_hop_entry;
+    addNextHopEntry(nexthop, ctx.next_hop_id);
 
     m_intfsOrch->increaseRouterIntfsRefCount(nh.alias);
 
@@ -425,7 +425,7 @@ bool NeighOrch::processBulkAddNextHop(NeighborContext& ctx)
     // flag should be set on it.
     // This scenario may happen under race condition where buffered neighbor event
     // is processed after incoming port is down.
-    if (p.m_oper_status == SAI_PORT_OPER_STATUS_DOWN)
+    if (p->m_oper_status == SAI_PORT_OPER_STATUS_DOWN)
     {
         if (setNextHopFlag(nexthop, NHFLAGS_IFDOWN) == false)
         {
@@ -524,20 +524,21 @@ bool NeighOrch::ifChangeInformNextHop(const string &alias, bool if_up)
     SWSS_LOG_ENTER();
     bool rc = true;
 
-    for (auto nhop = m_syncdNextHops.begin(); nhop != m_syncdNextHops.end(); ++nhop)
+    auto nhops = m_syncdNextHopsByAlias.find(alias);
+    if (nhops == m_syncdNextHopsByAlias.end())
     {
-        if (nhop->first.alias != alias)
-        {
-            continue;
-        }
+        return rc;
+    }
 
+    for (const auto &nhop : nhops->second)
+    {
         if (if_up)
         {
-            rc = clearNextHopFlag(nhop->first, NHFLAGS_IFDOWN);
+            rc = clearNextHopFlag(nhop, NHFLAGS_IFDOWN);
         }
         else
         {
-            rc = setNextHopFlag(nhop->first, NHFLAGS_IFDOWN);
+            rc = setNextHopFlag(nhop, NHFLAGS_IFDOWN);
         }
 
         if (rc == true)
@@ -553,6 +554,32 @@ bool NeighOrch::ifChangeInformNextHop(const string &alias, bool if_up)
     return rc;
 }
 
+void NeighOrch::addNextHopEntry(const NextHopKey &nexthop, sai_object_id_t next_hop_id)
+{
+    NextHopEntry next_hop_entry;
+    next_hop_entry.next_hop_id = next_hop_id;
+    next_hop_entry.ref_count = 0;
+    next_hop_entry.nh_flags = 0;
+    m_syncdNextHops[nexthop] = next_hop_entry;
+
+    m_syncdNextHopsByAlias[nexthop.alias].insert(nexthop);
+}
+
+void NeighOrch::removeNextHopEntry(const NextHopKey &nexthop)
+{
+    m_syncdNextHops.erase(nexthop);
+
+    auto nhops = m_syncdNextHopsByAlias.find(nexthop.alias);
+    if (nhops != m_syncdNextHopsByAlias.end())
+    {
+        nhops->second.erase(nexthop);
+        if (nhops->second.empty())
+        {
+            m_syncdNextHopsByAlias.erase(nhops);
+        }
+    }
+}
+
 void NeighOrch::updateNextHop(const BfdUpdate& update)
 {
     SWSS_LOG_ENTER();
@@ -635,7 +662,7 @@ bool NeighOrch::removeNextHop(const IpAddress &ipAddress, const string &alias)
         return false;
     }
 
-    m_syncdNextHops.erase(nexthop);
+    removeNextHopEntry(nexthop);
     m_intfsOrch->decreaseRouterIntfsRefCount(alias);
     return true;
 }
@@ -703,7 +730,7 @@ bool NeighOrch::removeMplsNextHop(const NextHopKey& nh)
         }
     }
 
-    m_syncdNextHops.erase(nexthop);
+    removeNextHopEntry(nexthop);
     m_intfsOrch->decreaseRouterIntfsRefCount(nexthop.alias);
     return true;
 }
@@ -721,7 +748,7 @@ bool NeighOrch::removeOverlayNextHop(const NextHopKey &nexthop)
         return false;
     }
 
-    m_syncdNextHops.erase(nexthop);
+    removeNextHopEntry(nexthop);
     return true;
 }
 
@@ -852,6 +879,16 @@ void NeighOrch::doTask(Consumer &consumer)
         return;
     }
 
+    /*
+     * With several tasks to process, neighbors and their next hops are added and
+     * removed with the bulkers. A task waits in bulk_tasks until they are flushed,
+     * and is retried if its neighbor could not be programmed.
+     */
+    bool bulk_op = consumer.m_toSync.size() > 1;
+    std::list<NeighborBulkTask> bulk_tasks;
+    std::set<IpAddress> bulk_ips;
+    bool bulk_add = true;
+
     auto it = consumer.m_toSync.begin();
     while (it != consumer.m_toSync.end())
     {
@@ -894,21 +931,32 @@ void NeighOrch::doTask(Consumer &consumer)
 
         IpAddress ip_address(key.substr(found+1));
 
+        /*
+         * Flush the bulkers before a neighbor of an IP address already in them,
+         * which depends on their result, and between additions and removals
+         */
+        if (!bulk_tasks.empty() && (bulk_ips.count(ip_address) || bulk_add != (op == SET_COMMAND)))
+        {
+            flushBulkNeighborTasks(consumer, bulk_tasks, bulk_add);
+            bulk_ips.clear();
+        }
+
         NeighborEntry neighbor_entry = { ip_address, alias };
 
-        NeighborContext ctx = NeighborContext(neighbor_entry);
+        NeighborContext ctx = NeighborContext(neighbor_entry, bulk_op);
+        bool bulk_pending = false;
 
         if (op == SET_COMMAND)
         {
-            Port p;
-            if (!gPortsOrch->getPort(alias, p))
+            Port *p = gPortsOrch->findPort(alias);
+            if (!p)
             {
                 SWSS_LOG_INFO("Port %s doesn't exist", alias.c_str());
                 it++;
                 continue;
             }
 
-            if (!p.m_rif_id)
+            if (!p->m_rif_id)
             {
                 SWSS_LOG_INFO("Router interface doesn't exist on %s", alias.c_str());
                 it++;
@@ -953,9 +1001,10 @@ void NeighOrch::doTask(Consumer &consumer)
                         it = consumer.m_toSync.erase(it);
                     }
                 }
-                else if (addNeighbor(ctx))
+                else if (bulk_op ? addBulkNeighborTask(it, ctx, bulk_tasks) : addNeighbor(ctx))
                 {
-                    it = consumer.m_toSync.erase(it);
+                    bulk_pending = !bulk_tasks.empty() && bulk_tasks.back().task == it;
+                    it = bulk_pending ? next(it) : consumer.m_toSync.erase(it);
                 }
                 else
                 {
@@ -973,7 +1022,7 @@ void NeighOrch::doTask(Consumer &consumer)
              * Since DEL operation is supposed to be executed before SET for the same neighbor
              * A remaining DEL after the SET operation means the DEL operation failed previously and should not be executed anymore
              */
-            auto rit = make_reverse_iterator(it);
+            auto rit = make_reverse_iterator(bulk_pending ? prev(it) : it);
             while (rit != consumer.m_toSync.rend() && rit->first == key && kfvOp(rit->second) == DEL_COMMAND)
             {
                 consumer.m_toSync.erase(next(rit).base());
@@ -984,9 +1033,10 @@ void NeighOrch::doTask(Consumer &consumer)
         {
             if (m_syncdNeighbors.find(neighbor_entry) != m_syncdNeighbors.end())
             {
-                if (removeNeighbor(ctx))
+                if (bulk_op ? addBulkNeighborTask(it, ctx, bulk_tasks) : removeNeighbor(ctx))
                 {
-                    it = consumer.m_toSync.erase(it);
+                    bulk_pending = !bulk_tasks.empty() && bulk_tasks.back().task == it;
+                    it = bulk_pending ? next(it) : consumer.m_toSync.erase(it);
                 }
                 else
                 {
@@ -1002,7 +1052,95 @@ void NeighOrch::doTask(Consumer &consumer)
             SWSS_LOG_ERROR("Unknown operation type %s", op.c_str());
             it = consumer.m_toSync.erase(it);
         }
+
+        if (bulk_pending)
+        {
+            bulk_add = (op == SET_COMMAND);
+            bulk_ips.insert(ip_address);
+        }
+    }
+
+    if (!bulk_tasks.empty())
+    {
+        flushBulkNeighborTasks(consumer, bulk_tasks, bulk_add);
+    }
+}
+
+/*
+ * Add or remove the neighbor of a NEIGH_TABLE task with the bulkers. Returns false if the task
+ * is to be retried, otherwise the task is either done or waits in bulk_tasks for the flush
+ */
+bool NeighOrch::addBulkNeighborTask(SyncMap::iterator task, NeighborContext& ctx, std::list<NeighborBulkTask>& bulk_tasks)
+{
+    SWSS_LOG_ENTER();
+
+    bool add = (kfvOp(task->second) == SET_COMMAND);
+
+    /* The bulkers keep pointers to the statuses and next hop id of the context */
+    bulk_tasks.push_back({ task, ctx });
+    NeighborContext& bulk_ctx = bulk_tasks.back().ctx;
+
+    if (!(add ? addNeighbor(bulk_ctx) : removeNeighbor(bulk_ctx)))
+    {
+        bulk_tasks.pop_back();
+        return false;
+    }
+
+    /* Nothing was left for the bulkers, e.g. a neighbor kept out of HW by its mux */
+    if (bulk_ctx.object_statuses.empty())
+    {
+        bulk_tasks.pop_back();
+    }
+
+    return true;
+}
+
+/* Flush the bulkers, then finish the tasks whose neighbor was programmed */
+void NeighOrch::flushBulkNeighborTasks(Consumer &consumer, std::list<NeighborBulkTask>& bulk_tasks, bool add)
+{
+    SWSS_LOG_ENTER();
+
+    SWSS_LOG_INFO("Bulk %s %zu neighbors", add ? "adding" : "removing", bulk_tasks.size());
+
+    /* Same order as for the neighbors of a mux port */
+    if (add)
+    {
+        gNeighBulker.flush();
+        gNextHopBulker.flush();
+    }
+    else
+    {
+        gNextHopBulker.flush();
+
+        /* A neighbor whose next hop was not removed is kept, the bulker only flushes the pending entries */
+        for (auto& bulk_task : bulk_tasks)
+        {
+            NeighborContext& ctx = bulk_task.ctx;
+            if (ctx.nexthop_status == SAI_STATUS_NOT_EXECUTED && !ctx.object_statuses.empty())
+            {
+                ctx.object_statuses.back() = SAI_STATUS_FAILURE;
+            }
+        }
+
+        gNeighBulker.flush();
+    }
+
+    for (auto& bulk_task : bulk_tasks)
+    {
+        NeighborContext& ctx = bulk_task.ctx;
+        if (add ? processBulkAddNeighbor(ctx) : processBulkRemoveNeighbor(ctx))
+        {
+            consumer.m_toSync.erase(bulk_task.task);
+        }
+        else
+        {
+            SWSS_LOG_INFO("Failed to %s neighbor %s on %s, will retry", add ? "add" : "remove",
+                          ctx.neighborEntry.ip_address.to_string().c_str(), ctx.neighborEntry.alias.c_str());
+        }
     }
+
+    bulk_tasks.clear();
+    gNeighBulker.clear();
 }
 
 bool NeighOrch::addNeighbor(NeighborContext& ctx)
@@ -1258,17 +1396,28 @@ bool NeighOrch::removeNeighbor(NeighborContext& ctx, bool disable)
         neighbor_entry.switch_id = gSwitchId;
         copy(neighbor_entry.ip_address, ip_address);
 
-        sai_object_id_t next_hop_id = m_syncdNextHops[nexthop].next_hop_id;
-
         if (bulk_op)
         {
             object_statuses.emplace_back();
-            gNextHopBulker.remove_entry(&ctx.nexthop_status, next_hop_id);
+            /* The next hop is already removed when only the neighbor is retried */
+            if (m_syncdNextHops.find(nexthop) != m_syncdNextHops.end())
+            {
+                gNextHopBulker.remove_entry(&ctx.nexthop_status, m_syncdNextHops[nexthop].next_hop_id);
+            }
+            else
+            {
+                ctx.nexthop_status = SAI_STATUS_ITEM_NOT_FOUND;
+            }
             gNeighBulker.remove_entry(&object_statuses.back(), &neighbor_entry);
             return true;
         }
 
-        status = sai_next_hop_api->remove_next_hop(next_hop_id);
+        /* The next hop is already removed when a bulk removal only retries the neighbor */
+        status = SAI_STATUS_ITEM_NOT_FOUND;
+        if (m_syncdNextHops.find(nexthop) != m_syncdNextHops.end())
+        {
+            status = sai_next_hop_api->remove_next_hop(m_syncdNextHops[nexthop].next_hop_id);
+        }
         if (status != SAI_STATUS_SUCCESS)
         {
             /* When next hop is not found, we continue to remove neighbor entry. */
@@ -1334,7 +1483,10 @@ bool NeighOrch::removeNeighbor(NeighborContext& ctx, bool disable)
                 gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEIGHBOR);
             }
 
-            removeNextHop(ip_address, alias);
+            if (m_syncdNextHops.find(nexthop) != m_syncdNextHops.end())
+            {
+                removeNextHop(ip_address, alias);
+            }
             m_intfsOrch->decreaseRouterIntfsRefCount(alias);
             SWSS_LOG_NOTICE("Removed neighbor %s on %s",
                     m_syncdNeighbors[neighborEntry].mac.to_string().c_str(), alias.c_str());
@@ -1363,8 +1515,8 @@ bool NeighOrch::removeNeighbor(NeighborContext& ctx, bool disable)
     return true;
 }
 
-/* Process bulk ctx entry and enable the neigbor */
-bool NeighOrch::processBulkEnableNeighbor(NeighborContext& ctx)
+/* Process bulk ctx entry and add the neigbor */
+bool NeighOrch::processBulkAddNeighbor(NeighborContext& ctx)
 {
     SWSS_LOG_ENTER();
 
@@ -1403,12 +1555,29 @@ bool NeighOrch::processBulkEnableNeighbor(NeighborContext& ctx)
         status = *it_status++;
         if (status != SAI_STATUS_SUCCESS)
         {
+            /* The next hop created along with the neighbor is not kept without it */
+            if (ctx.next_hop_id != SAI_NULL_OBJECT_ID)
+            {
+                if (sai_next_hop_api->remove_next_hop(ctx.next_hop_id) != SAI_STATUS_SUCCESS)
+                {
+                    SWSS_LOG_ERROR("Failed to remove next hop %s on %s",
+                                   ip_address.to_string().c_str(), alias.c_str());
+                }
+                ctx.next_hop_id = SAI_NULL_OBJECT_ID;
+            }
+
             if (status == SAI_STATUS_ITEM_ALREADY_EXISTS)
             {
                 SWSS_LOG_INFO("Neighbor exists: neighbor %s on %s, skipping: status:%s",
                            macAddress.to_string().c_str(), alias.c_str(), sai_serialize_status(status).c_str());
                 return true;
             }
+            else if (status == SAI_STATUS_NOT_EXECUTED)
+            {
+                SWSS_LOG_INFO("Neighbor %s on %s not created yet, will retry",
+                              macAddress.to_string().c_str(), alias.c_str());
+                return false;
+            }
             else
             {
                 SWSS_LOG_ERROR("Failed to create neighbor %s on %s, status:%s",
@@ -1468,11 +1637,17 @@ bool NeighOrch::processBulkEnableNeighbor(NeighborContext& ctx)
     NeighborUpdate update = { neighborEntry, macAddress, true };
     notify(SUBJECT_TYPE_NEIGH_CHANGE, static_cast<void *>(&update));
 
+    if(gMySwitchType == "voq")
+    {
+        //Sync the neighbor to add to the CHASSIS_APP_DB
+        voqSyncAddNeigh(alias, ip_address, macAddress, neighbor_entry);
+    }
+
     return true;
 }
 
-/* Process bulk ctx entry and disable the neigbor */
-bool NeighOrch::processBulkDisableNeighbor(NeighborContext& ctx)
+/* Process bulk ctx entry and remove or disable the neigbor */
+bool NeighOrch::processBulkRemoveNeighbor(NeighborContext& ctx, bool disable)
 {
     SWSS_LOG_ENTER();
 
@@ -1484,6 +1659,17 @@ bool NeighOrch::processBulkDisableNeighbor(NeighborContext& ctx)
     string alias = neighborEntry.alias;
     IpAddress ip_address = neighborEntry.ip_address;
 
+    NextHopKey nexthop = { ip_address, alias };
+    if(m_intfsOrch->isRemoteSystemPortIntf(alias))
+    {
+        //For remote system ports kernel nexthops are always on inband. Change the key
+        Port inbp;
+        gPortsOrch->getInbandPort(inbp);
+        assert(inbp.m_alias.length());
+
+        nexthop.alias = inbp.m_alias;
+    }
+
     if (m_syncdNeighbors.find(neighborEntry) == m_syncdNeighbors.end())
     {
         return true;
@@ -1500,6 +1686,14 @@ bool NeighOrch::processBulkDisableNeighbor(NeighborContext& ctx)
         neighbor_entry.switch_id = gSwitchId;
         copy(neighbor_entry.ip_address, ip_address);
 
+        /* The neighbor removal was held back as well, see flushBulkNeighborTasks */
+        if (ctx.nexthop_status == SAI_STATUS_NOT_EXECUTED)
+        {
+            SWSS_LOG_INFO("Next hop %s on %s not removed yet, will retry",
+                          ip_address.to_string().c_str(), alias.c_str());
+            return false;
+        }
+
         if (ctx.nexthop_status != SAI_STATUS_SUCCESS)
         {
             /* When next hop is not found, we continue to remove neighbor entry. */
@@ -1535,7 +1729,18 @@ bool NeighOrch::processBulkDisableNeighbor(NeighborContext& ctx)
         SWSS_LOG_NOTICE("Bulk removed next hop %s on %s", ip_address.to_string().c_str(), alias.c_str());
 
         status = *it_status++;
-        if (status != SAI_STATUS_SUCCESS)
+        if (status == SAI_STATUS_NOT_EXECUTED)
+        {
+            /* Only the neighbor is removed again, the next hop is gone */
+            if (m_syncdNextHops.find(nexthop) != m_syncdNextHops.end())
+            {
+                removeNextHop(ip_address, alias);
+            }
+            SWSS_LOG_INFO("Neighbor %s on %s not removed yet, will retry",
+                          ip_address.to_string().c_str(), alias.c_str());
+            return false;
+        }
+        else if (status != SAI_STATUS_SUCCESS)
         {
             if (status == SAI_STATUS_ITEM_NOT_FOUND)
             {
@@ -1564,7 +1769,10 @@ bool NeighOrch::processBulkDisableNeighbor(NeighborContext& ctx)
                 gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV6_NEIGHBOR);
             }
 
-            removeNextHop(ip_address, alias);
+            if (m_syncdNextHops.find(nexthop) != m_syncdNextHops.end())
+            {
+                removeNextHop(ip_address, alias);
+            }
             m_intfsOrch->decreaseRouterIntfsRefCount(alias);
             SWSS_LOG_NOTICE("Removed neighbor %s on %s",
                     m_syncdNeighbors[neighborEntry].mac.to_string().c_str(), alias.c_str());
@@ -1572,7 +1780,23 @@ bool NeighOrch::processBulkDisableNeighbor(NeighborContext& ctx)
     }
 
     /* Do not delete entry from cache for disable request */
-    m_syncdNeighbors[neighborEntry].hw_configured = false;
+    if (disable)
+    {
+        m_syncdNeighbors[neighborEntry].hw_configured = false;
+        return true;
+    }
+
+    m_syncdNeighbors.erase(neighborEntry);
+
+    NeighborUpdate update = { neighborEntry, MacAddress(), false };
+    notify(SUBJECT_TYPE_NEIGH_CHANGE, static_cast<void *>(&update));
+
+    if(gMySwitchType == "voq")
+    {
+        //Sync the neighbor to delete from the CHASSIS_APP_DB
+        voqSyncDelNeigh(alias, ip_address);
+    }
+
     return true;
 }
 
@@ -1672,7 +1896,7 @@ bool NeighOrch::enableNeighbors(std::list<NeighborContext>& bulk_ctx_list)
         }
 
         const NeighborEntry& neighborEntry = ctx->neighborEntry;
-        if (!processBulkEnableNeighbor(*ctx))
+        if (!processBulkAddNeighbor(*ctx))
         {
             SWSS_LOG_INFO("Enable neighbor failed for %s", neighborEntry.ip_address.to_string().c_str());
             /* finish processing bulk entries */
@@ -1719,7 +1943,7 @@ bool NeighOrch::disableNeighbors(std::list<NeighborContext>& bulk_ctx_list)
         }
 
         const NeighborEntry& neighborEntry = ctx->neighborEntry;
-        if (!processBulkDisableNeighbor(*ctx))
+        if (!processBulkRemoveNeighbor(*ctx, true))
         {
             SWSS_LOG_INFO("Disable neighbor failed for %s", neighborEntry.ip_address.to_string().c_str());
             /* finish processing bulk entries but return false */
@@ -1761,11 +1985,7 @@ sai_object_id_t NeighOrch::addTunnelNextHop(const NextHopKey& nh)
     SWSS_LOG_NOTICE("Created Tunnel next hop %s, %s@%d@%s", tun_name.c_str(), nh.ip_address.to_string().c_str(),
             nh.vni, nh.mac_address.to_string().c_str());
 
-    NextHopEntry next_hop_entry;
-    next_hop_entry.next_hop_id = nh_id;
-    next_hop_entry.ref_count = 0;
-    next_hop_entry.nh_flags = 0;
-    m_syncdNextHops[nh] = next_hop_entry;
+    addNextHopEntry(nh, nh_id);
 
     return nh_id;
 }
@@ -1854,15 +2074,15 @@ void NeighOrch::doVoqSystemNeighTask(Consumer &consumer)
 
         if (op == SET_COMMAND)
         {
-            Port p;
-            if (!gPortsOrch->getPort(alias, p))
+            Port *p = gPortsOrch->findPort(alias);
+            if (!p)
             {
                 SWSS_LOG_INFO("Port %s doesn't exist", alias.c_str());
                 it++;
                 continue;
             }
 
-            if (!p.m_rif_id)
+            if (!p->m_rif_id)
             {
                 SWSS_LOG_INFO("Router interface doesn't exist on %s", alias.c_str());
                 it++;
@@ -2345,18 +2565,14 @@ void NeighOrch::updateSrv6Nexthop(const NextHopKey &nh, const sai_object_id_t &n
 {
     if (nh_id != SAI_NULL_OBJECT_ID)
     {
-        NextHopEntry next_hop_entry;
-        next_hop_entry.next_hop_id = nh_id;
-        next_hop_entry.ref_count = 0;
-        next_hop_entry.nh_flags = 0;
-        m_syncdNextHops[nh] = next_hop_entry;
+        addNextHopEntry(nh, nh_id);
         gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_SRV6_NEXTHOP);
     }
     else
     {
         assert(m_syncdNextHops[nh].ref_count == 0);
         gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_SRV6_NEXTHOP);
-        m_syncdNextHops.erase(nh);
+        removeNextHopEntry(nh);
     }
 }
 
@@ -36,6 +36,8 @@ struct NeighborData
 typedef map<NeighborEntry, NeighborData> NeighborTable;
 /* NextHopTable: NextHopKey, NextHopEntry */
 typedef map<NextHopKey, NextHopEntry> NextHopTable;
+/* NextHopAliasTable: interface alias, next hops of NextHopTable on it */
+typedef map<string, set<NextHopKey>> NextHopAliasTable;
 
 struct NeighborUpdate
 {
@@ -52,9 +54,9 @@ struct NeighborContext
     NeighborEntry                       neighborEntry;              // neighbor entry to process
     std::deque<sai_status_t>            object_statuses;            // entity bulk statuses for neighbors
     MacAddress                          mac;                        // neighbor mac
-    bool                                bulk_op = false;            // use bulker (only for mux use for now)
-    sai_object_id_t                     next_hop_id;                // next hop id
-    sai_status_t                        nexthop_status;             // next hop status
+    bool                                bulk_op = false;            // use bulker
+    sai_object_id_t                     next_hop_id = SAI_NULL_OBJECT_ID;           // next hop id
+    sai_status_t                        nexthop_status = SAI_STATUS_NOT_EXECUTED;   // next hop status
 
     NeighborContext(NeighborEntry neighborEntry)
         : neighborEntry(neighborEntry)
@@ -67,6 +69,15 @@ struct NeighborContext
     }
 };
 
+/*
+ * A NEIGH_TABLE task whose neighbor waits in the bulkers to be added or removed
+ */
+struct NeighborBulkTask
+{
+    SyncMap::iterator                   task;                       // task in m_toSync, erased once done
+    NeighborContext                     ctx;                        // neighbor in the bulkers
+};
+
 class NeighOrch : public Orch, public Subject, public Observer
 {
 public:
@@ -118,6 +129,7 @@ private:
 
     NeighborTable m_syncdNeighbors;
     NextHopTable m_syncdNextHops;
+    NextHopAliasTable m_syncdNextHopsByAlias;
 
     std::set<NextHopKey> m_neighborToResolve;
 
@@ -125,12 +137,16 @@ private:
     ObjectBulker<sai_next_hop_api_t> gNextHopBulker;
 
     bool removeNextHop(const IpAddress&, const string&);
+    void addNextHopEntry(const NextHopKey&, sai_object_id_t);
+    void removeNextHopEntry(const NextHopKey&);
     bool processBulkAddNextHop(NeighborContext&);
 
     bool addNeighbor(NeighborContext& ctx);
     bool removeNeighbor(NeighborContext& ctx, bool disable = false);
-    bool processBulkEnableNeighbor(NeighborContext& ctx);
-    bool processBulkDisableNeighbor(NeighborContext& ctx);
+    bool processBulkAddNeighbor(NeighborContext& ctx);
+    bool processBulkRemoveNeighbor(NeighborContext& ctx, bool disable = false);
+    bool addBulkNeighborTask(SyncMap::iterator task, NeighborContext& ctx, std::list<NeighborBulkTask>& bulk_tasks);
+    void flushBulkNeighborTasks(Consumer &consumer, std::list<NeighborBulkTask>& bulk_tasks, bool add);
 
     bool setNextHopFlag(const NextHopKey &, const uint32_t);
     bool clearNextHopFlag(const NextHopKey &, const uint32_t);
@@ -3,21 +3,37 @@
 
 #include "nexthopkey.h"
 
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+/*
+ * NextHopGroupKey is a handle on an interned set of next hops: the keys with
+ * the same next hops and weights share one immutable set with a precomputed
+ * id and hash, so copies don't copy the next hops and comparisons don't walk
+ * them. The APPL_DB strings are parsed once per set while a key to it exists.
+ */
 class NextHopGroupKey
 {
 public:
-    NextHopGroupKey() = default;
+    NextHopGroupKey() : m_nexthops(emptySet())
+    {
+    }
 
     /* ip_string@if_alias separated by ',' */
     NextHopGroupKey(const std::string &nexthops)
     {
-        m_overlay_nexthops = false;
-        m_srv6_nexthops = false;
-        auto nhv = tokenize(nexthops, NHG_DELIMITER);
-        for (const auto &nh : nhv)
-        {
-            m_nexthops.insert(nh);
-        }
+        m_nexthops = parse("n" + nexthops, [&](std::set<NextHopKey> &nhs) {
+            bool cacheable = true;
+            auto nhv = tokenize(nexthops, NHG_DELIMITER);
+            for (const auto &nh : nhv)
+            {
+                nhs.insert(nh);
+                cacheable &= !dependsOnRouterIntfs(nh);
+            }
+            return cacheable;
+        });
     }
 
     /* ip_string|if_alias|vni|router_mac separated by ',' */
@@ -27,92 +43,72 @@ public:
         {
             m_overlay_nexthops = true;
             m_srv6_nexthops = false;
-            auto nhv = tokenize(nexthops, NHG_DELIMITER);
-            for (const auto &nh_str : nhv)
-            {
-                auto nh = NextHopKey(nh_str, overlay_nh, srv6_nh);
-                m_nexthops.insert(nh);
-            }
         }
         else if (srv6_nh)
         {
             m_overlay_nexthops = false;
             m_srv6_nexthops = true;
+        }
+        else
+        {
+            m_nexthops = emptySet();
+            return;
+        }
+
+        m_nexthops = parse((overlay_nh ? "o" : "s") + nexthops, [&](std::set<NextHopKey> &nhs) {
             auto nhv = tokenize(nexthops, NHG_DELIMITER);
             for (const auto &nh_str : nhv)
             {
                 auto nh = NextHopKey(nh_str, overlay_nh, srv6_nh);
-                m_nexthops.insert(nh);
+                nhs.insert(nh);
             }
-        }
+            return true;
+        });
     }
 
     NextHopGroupKey(const std::string &nexthops, const std::string &weights)
     {
-        m_overlay_nexthops = false;
-        m_srv6_nexthops = false;
-        std::vector<std::string> nhv = tokenize(nexthops, NHG_DELIMITER);
-        std::vector<std::string> wtv = tokenize(weights, NHG_DELIMITER);
-        bool set_weight = wtv.size() == nhv.size();
-        for (uint32_t i = 0; i < nhv.size(); i++)
-        {
-            NextHopKey nh(nhv[i]);
-            nh.weight = set_weight? (uint32_t)std::stoi(wtv[i]) : 0;
-            m_nexthops.insert(nh);
-        }
+        m_nexthops = parse("w" + nexthops + NH_DELIMITER + weights, [&](std::set<NextHopKey> &nhs) {
+            bool cacheable = true;
+            std::vector<std::string> nhv = tokenize(nexthops, NHG_DELIMITER);
+            std::vector<std::string> wtv = tokenize(weights, NHG_DELIMITER);
+            bool set_weight = wtv.size() == nhv.size();
+            for (uint32_t i = 0; i < nhv.size(); i++)
+            {
+                NextHopKey nh(nhv[i]);
+                nh.weight = set_weight? (uint32_t)std::stoi(wtv[i]) : 0;
+                nhs.insert(nh);
+                cacheable &= !dependsOnRouterIntfs(nhv[i]);
+            }
+            return cacheable;
+        });
     }
 
     inline const std::set<NextHopKey> &getNextHops() const
     {
-        return m_nexthops;
+        return m_nexthops->nexthops;
     }
 
     inline size_t getSize() const
     {
-        return m_nexthops.size();
+        return m_nexthops->nexthops.size();
     }
 
+    /* Same for the keys with the same next hops and weights */
+    inline size_t hash() const
+    {
+        return m_nexthops->hash;
+    }
+
+    /* Ordered by interning, not by next hops */
     inline bool operator<(const NextHopGroupKey &o) const
     {
-        if (m_nexthops < o.m_nexthops)
-        {
-            return true;
-        }
-        else if (m_nexthops == o.m_nexthops)
-        {
-            auto it1 = m_nexthops.begin();
-            for (auto& it2 : o.m_nexthops)
-            {
-                if (it1->weight < it2.weight)
-                {
-                    return true;
-                }
-                else if(it1->weight > it2.weight)
-                {
-                    return false;
-                }
-                it1++;
-            }
-        }
-        return false;
+        return m_nexthops->id < o.m_nexthops->id;
     }
 
     inline bool operator==(const NextHopGroupKey &o) const
     {
-        if (m_nexthops != o.m_nexthops)
-        {
-            return false;
-        }
-        auto it1 = m_nexthops.begin();
-        for (auto& it2 : o.m_nexthops)
-        {
-            if (it2.weight != it1->weight)
-            {
-                return false;
-            }
-            it1++;
-        }
-        return true;
+        return m_nexthops == o.m_nexthops;
     }
 
     inline bool operator!=(const NextHopGroupKey &o) const
@@ -122,33 +118,39 @@ public:
 
     void add(const std::string &ip, const std::string &alias)
     {
-        m_nexthops.emplace(ip, alias);
+        auto nhs = getNextHops();
+        nhs.emplace(ip, alias);
+        m_nexthops = intern(std::move(nhs));
     }
 
     void add(const std::string &nh)
     {
-        m_nexthops.insert(nh);
+        auto nhs = getNextHops();
+        nhs.insert(nh);
+        m_nexthops = intern(std::move(nhs));
     }
 
     void add(const NextHopKey &nh)
     {
-        m_nexthops.insert(nh);
+        auto nhs = getNextHops();
+        nhs.insert(nh);
+        m_nexthops = intern(std::move(nhs));
     }
 
     bool contains(const std::string &ip, const std::string &alias) const
     {
         NextHopKey nh(ip, alias);
-        return m_nexthops.find(nh) != m_nexthops.end();
+        return getNextHops().find(nh) != getNextHops().end();
     }
 
     bool contains(const std::string &nh) const
     {
-        return m_nexthops.find(nh) != m_nexthops.end();
+        return getNextHops().find(nh) != getNextHops().end();
     }
 
     bool contains(const NextHopKey &nh) const
     {
-        return m_nexthops.find(nh) != m_nexthops.end();
+        return getNextHops().find(nh) != getNextHops().end();
     }
 
     bool contains(const NextHopGroupKey &nhs) const
@@ -165,7 +167,7 @@ public:
 
     bool hasIntfNextHop() const
     {
-        for (const auto &nh : m_nexthops)
+        for (const auto &nh : getNextHops())
         {
             if (nh.isIntfNextHop())
             {
@@ -177,27 +179,34 @@ public:
 
     void remove(const std::string &ip, const std::string &alias)
     {
+        auto nhs = getNextHops();
         NextHopKey nh(ip, alias);
-        m_nexthops.erase(nh);
+        nhs.erase(nh);
+        m_nexthops = intern(std::move(nhs));
     }
 
     void remove(const std::string &nh)
     {
-        m_nexthops.erase(nh);
+        auto nhs = getNextHops();
+        nhs.erase(nh);
+        m_nexthops = intern(std::move(nhs));
     }
 
     void remove(const NextHopKey &nh)
     {
-        m_nexthops.erase(nh);
+        auto nhs = getNextHops();
+        nhs.erase(nh);
+        m_nexthops = intern(std::move(nhs));
     }
 
     const std::string to_string() const
     {
         string nhs_str;
+        const auto &nhs = getNextHops();
 
-        for (auto it = m_nexthops.begin(); it != m_nexthops.end(); ++it)
+        for (auto it = nhs.begin(); it != nhs.end(); ++it)
         {
-            if (it != m_nexthops.begin())
+            if (it != nhs.begin())
             {
                 nhs_str += NHG_DELIMITER;
             }
@@ -223,13 +232,192 @@ public:
 
     void clear()
     {
-        m_nexthops.clear();
+        m_nexthops = emptySet();
+    }
+
+    /* Number of distinct next hop sets in use */
+    static size_t getInternedCount()
+    {
+        auto &interner = getInterner();
+        std::lock_guard<std::mutex> lock(interner.mutex);
+        return interner.sets.size();
     }
 
 private:
-    std::set<NextHopKey> m_nexthops;
-    bool m_overlay_nexthops;
-    bool m_srv6_nexthops;
+    struct NextHopSet
+    {
+        std::set<NextHopKey>                nexthops;
+        uint64_t                            id;
+        size_t                              hash;
+        mutable std::vector<std::string>    parsed;     // strings parsed to this set
+    };
+
+    typedef std::shared_ptr<const NextHopSet> NextHopSetPtr;
+
+    /* Next hops, then weights, as the next hop sets were compared */
+    struct NextHopSetLess
+    {
+        bool operator()(const std::set<NextHopKey> *a, const std::set<NextHopKey> *b) const
+        {
+            if (*a < *b)
+            {
+                return true;
+            }
+            else if (*a == *b)
+            {
+                auto it1 = a->begin();
+                for (auto& it2 : *b)
+                {
+                    if (it1->weight < it2.weight)
+                    {
+                        return true;
+                    }
+                    else if (it1->weight > it2.weight)
+                    {
+                        return false;
+                    }
+                    it1++;
+                }
+            }
+            return false;
+        }
+    };
+
+    struct InternedSet
+    {
+        const NextHopSet                    *set;
+        std::weak_ptr<const NextHopSet>     ptr;
+    };
+
+    struct Interner
+    {
+        std::mutex                                                                  mutex;
+        uint64_t                                                                    next_id = 0;
+        std::map<const std::set<NextHopKey> *, InternedSet, NextHopSetLess>        sets;
+        std::unordered_map<std::string, InternedSet>                                parsed;
+    };
+
+    /* Never destroyed, keys may be released after exit */
+    static Interner &getInterner()
+    {
+        static Interner *interner = new Interner();
+        return *interner;
+    }
+
+    static const NextHopSetPtr &emptySet()
+    {
+        static const NextHopSetPtr empty = intern(std::set<NextHopKey>());
+        return empty;
+    }
+
+    /* The alias of an ip_string or ip_string@Vrf next hop is looked up in the router interfaces */
+    static bool dependsOnRouterIntfs(const std::string &nh)
+    {
+        auto pos = nh.find(NH_DELIMITER);
+        return pos == std::string::npos || !nh.compare(pos + 1, strlen(VRF_PREFIX), VRF_PREFIX);
+    }
+
+    static NextHopSetPtr parse(const std::string &str, const std::function<bool(std::set<NextHopKey> &)> &build)
+    {
+        auto &interner = getInterner();
+        {
+            std::lock_guard<std::mutex> lock(interner.mutex);
+            auto it = interner.parsed.find(str);
+            if (it != interner.parsed.end())
+            {
+                if (auto nhs = it->second.ptr.lock())
+                {
+                    return nhs;
+                }
+            }
+        }
+
+        std::set<NextHopKey> nhs;
+        bool cacheable = build(nhs);
+        return intern(std::move(nhs), cacheable ? &str : nullptr);
+    }
+
+    static NextHopSetPtr intern(std::set<NextHopKey> &&nhs, const std::string *parsed = nullptr)
+    {
+        auto &interner = getInterner();
+        std::lock_guard<std::mutex> lock(interner.mutex);
+
+        NextHopSetPtr nhset;
+        auto it = interner.sets.find(&nhs);
+        if (it != interner.sets.end())
+        {
+            nhset = it->second.ptr.lock();
+            if (!nhset)
+            {
+                /* Being released, replaced by a new set */
+                interner.sets.erase(it);
+            }
+        }
+
+        if (!nhset)
+        {
+            auto *created = new NextHopSet();
+            created->nexthops = std::move(nhs);
+            created->id = interner.next_id++;
+            created->hash = 0;
+            for (const auto &nh : created->nexthops)
+            {
+                created->hash = created->hash * 31 + std::hash<std::string>()(nh.to_string()) + nh.weight;
+            }
+            nhset = NextHopSetPtr(created, release);
+            interner.sets[&created->nexthops] = { created, nhset };
+        }
+
+        if (parsed)
+        {
+            auto &entry = interner.parsed[*parsed];
+            if (entry.set != nhset.get())
+            {
+                entry = { nhset.get(), nhset };
+                nhset->parsed.push_back(*parsed);
+            }
+        }
+
+        return nhset;
+    }
+
+    static void release(const NextHopSet *nhset)
+    {
+        auto &interner = getInterner();
+        {
+            std::lock_guard<std::mutex> lock(interner.mutex);
+            auto it = interner.sets.find(&nhset->nexthops);
+            if (it != interner.sets.end() && it->second.set == nhset)
+            {
+                interner.sets.erase(it);
+            }
+            for (const auto &str : nhset->parsed)
+            {
+                auto parsed = interner.parsed.find(str);
+                if (parsed != interner.parsed.end() && parsed->second.set == nhset)
+                {
+                    interner.parsed.erase(parsed);
+                }
+            }
+        }
+        delete nhset;
+    }
+
+    NextHopSetPtr m_nexthops;
+    bool m_overlay_nexthops = false;
+    bool m_srv6_nexthops = false;
 };
 
+namespace std
+{
+    template <>
+    struct hash<NextHopGroupKey>
+    {
+        size_t operator()(const NextHopGroupKey &key) const
+        {
+            return key.hash();
+        }
+    };
+}
+
 #endif /* SWSS_NEXTHOPGROUPKEY_H */
@@ -4,6 +4,7 @@ extern "C" {
 
 #include "logger.h"
 #include "notifications.h"
+#include "recorder.h"
 #include "switchorch.h"
 
 extern SwitchOrch *gSwitchOrch;
@@ -43,6 +44,9 @@ void on_switch_shutdown_request(sai_object_id_t switch_id)
     /* TODO: Later a better restart story will be told here */
     SWSS_LOG_ERROR("Syncd stopped");
 
+    /* Write out the queued records before orchagent exits */
+    swss::Recorder::Instance().flush();
+
     if (gSwitchOrch->isFatalEventReceived())
     {
         SWSS_LOG_ERROR("Orchagent aborted due to fatal SAI error received");
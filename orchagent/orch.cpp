@@ -78,83 +78,21 @@ void ConsumerBase::addToSync(const KeyOpFieldsValuesTuple &entry)
 {
     SWSS_LOG_ENTER();
 
-    string key = kfvKey(entry);
-    string op  = kfvOp(entry);
+    const string &key = kfvKey(entry);
 
-    /* Record incoming tasks */
-    Recorder::Instance().swss.record(dumpTuple(entry));
+    /* Record incoming tasks, the tuple is only dumped when recording is enabled */
+    Recorder::Instance().swss.record([&]() { return dumpTuple(entry); });
 
     /*
-    * m_toSync is a multimap which will allow one key with multiple values,
-    * Also, the order of the key-value pairs whose keys compare equivalent
-    * is the order of insertion and does not change. (since C++11)
-    */
+     * m_toSync keeps at most a DEL then a SET per key, a DEL overwrites the
+     * pending tasks of the key and a SET is combined with the pending one.
+     */
+    m_toSync.merge(key, entry);
 
-    /* If a new task comes we directly put it into getConsumerTable().m_toSync map */
-    if (m_toSync.find(key) == m_toSync.end())
+    if (m_orch)
     {
-        m_toSync.emplace(key, entry);
+        m_orch->schedule(this);
     }
-
-    /* if a DEL task comes, we overwrite the old key */
-    else if (op == DEL_COMMAND)
-    {
-        m_toSync.erase(key);
-        m_toSync.emplace(key, entry);
-    }
-    else
-    {
-        /*
-        * Now we are trying to add the key-value with SET.
-        * We maintain maximum two values per key.
-        * In case there is one key-value, it should be DEL or SET
-        * In case there are two key-value pairs, it should be DEL then SET
-        * The code logic is following:
-        * We iterate the values with the key, we skip the value with DEL and then
-        * check if that was the only one (I,E, the iter pointer now points to end or next key),
-        * in such case, we insert the key-value with SET.
-        * If there was a SET already (I,E, the pointer still points to the same key), we combine the kfv.
-        */
-        auto ret = m_toSync.equal_range(key);
-        auto iter = ret.first;
-        for (; iter != ret.second; ++iter)
-        {
-            auto old_op = kfvOp(iter->second);
-            if (old_op == SET_COMMAND)
-                break;
-        }
-        if (iter == ret.second)
-        {
-            m_toSync.emplace(key, entry);
-        }
-        else
-        {
-            KeyOpFieldsValuesTuple existing_data = iter->second;
-
-            auto new_values = kfvFieldsValues(entry);
-            auto existing_values = kfvFieldsValues(existing_data);
-
-
-            for (auto it : new_values)
-            {
-                string field = fvField(it);
-                string value = fvValue(it);
-
-                auto iu = existing_values.begin();
-                while (iu != existing_values.end())
-                {
-                    string ofield = fvField(*iu);
-                    if (field == ofield)
-                        iu = existing_values.erase(iu);
-                    else
-                        iu++;
-                }
-                existing_values.push_back(FieldValueTuple(field, value));
-            }
-            iter->second = KeyOpFieldsValuesTuple(key, op, existing_values);
-        }
-    }
-
 }
 
 size_t ConsumerBase::addToSync(const std::deque<KeyOpFieldsValuesTuple> &entries)
@@ -548,9 +486,64 @@ string Orch::objectReferenceInfo(
 
 void Orch::doTask()
 {
-    for (auto &it : m_consumerMap)
+    /*
+     * Only consumers in the pending set hold tasks, drain() is a no-op for
+     * the others. Take a snapshot since doTask(Consumer) may schedule more.
+     */
+    vector<ConsumerBase *> pending;
+    pending.reserve(m_pendingConsumers.size());
+    for (auto &it : m_pendingConsumers)
     {
-        it.second->drain();
+        pending.push_back(it.second);
+    }
+
+    for (auto consumer : pending)
+    {
+        consumer->drain();
+    }
+
+    prunePendingConsumers();
+}
+
+void Orch::schedule(ConsumerBase *consumer)
+{
+    /* New data may resolve whatever the consumer was waiting for, retry it right away */
+    consumer->m_hasNewData = true;
+    consumer->m_retryBackoff = std::chrono::milliseconds(0);
+    consumer->m_retryDue = std::chrono::steady_clock::time_point();
+
+    if (consumer->m_scheduled)
+    {
+        return;
+    }
+
+    /* Consumers not owned by this Orch are drained by whoever owns them */
+    auto it = m_consumerMap.find(consumer->getName());
+    if (it == m_consumerMap.end() || it->second.get() != consumer)
+    {
+        return;
+    }
+
+    consumer->m_scheduled = true;
+    m_pendingConsumers.emplace(consumer->getName(), consumer);
+}
+
+void Orch::prunePendingConsumers()
+{
+    auto it = m_pendingConsumers.begin();
+    while (it != m_pendingConsumers.end())
+    {
+        auto consumer = it->second;
+        if (consumer->m_toSync.empty())
+        {
+            consumer->m_scheduled = false;
+            consumer->m_retryBackoff = std::chrono::milliseconds(0);
+            it = m_pendingConsumers.erase(it);
+        }
+        else
+        {
+            ++it;
+        }
     }
 }
 
@@ -7,6 +7,7 @@
 #include <set>
 #include <memory>
 #include <utility>
+#include <chrono>
 
 extern "C" {
 #include <sai.h>
@@ -24,6 +25,7 @@ extern "C" {
 #include "macaddress.h"
 #include "response_publisher.h"
 #include "recorder.h"
+#include "syncmap.h"
 
 const char delimiter           = ':';
 const char list_item_delimiter = ',';
@@ -79,10 +81,6 @@ typedef std::map<std::string, std::shared_ptr<object_reference_map>> type_map;
 typedef std::map<std::string, sai_object_id_t> object_map;
 typedef std::pair<std::string, sai_object_id_t> object_map_pair;
 
-// Use multimap to support multiple OpFieldsValues for the same key (e,g, DEL and SET)
-// The order of the key-value pairs whose keys compare equivalent is the order of
-// insertion and does not change. (since C++11)
-typedef std::multimap<std::string, swss::KeyOpFieldsValuesTuple> SyncMap;
 
 typedef std::pair<std::string, int> table_name_with_pri_t;
 
@@ -166,6 +164,16 @@ public:
 
     size_t refillToSync();
     size_t refillToSync(swss::Table* table);
+
+    /*
+     * Scheduling state, maintained by Orch::schedule() and OrchScheduler.
+     * m_scheduled is set while the consumer is in its Orch pending set,
+     * m_hasNewData is set whenever a task is added to m_toSync.
+     */
+    bool m_scheduled = false;
+    bool m_hasNewData = false;
+    std::chrono::milliseconds m_retryBackoff{0};
+    std::chrono::steady_clock::time_point m_retryDue;
 };
 
 class Consumer : public ConsumerBase {
@@ -237,7 +245,7 @@ public:
     // otherwise fallback to cold start
     virtual bool bake();
 
-    /* Iterate all consumers in m_consumerMap and run doTask(Consumer) */
+    /* Iterate all consumers with pending tasks and run doTask(Consumer) */
     virtual void doTask();
 
     /* Run doTask against a specific executor */
@@ -251,9 +259,28 @@ public:
      * @brief Flush pending responses
      */
     void flushResponses();
+
+    /* Mark the consumer as having tasks in m_toSync */
+    void schedule(ConsumerBase *consumer);
+
+    /* Drop consumers whose m_toSync became empty from the pending set */
+    void prunePendingConsumers();
+
+    const std::map<std::string, ConsumerBase *> &getPendingConsumers() const
+    {
+        return m_pendingConsumers;
+    }
+
+    size_t getExecutorCount() const
+    {
+        return m_consumerMap.size();
+    }
 protected:
     ConsumerMap m_consumerMap;
 
+    /* Consumers which have tasks in m_toSync, ordered the same as m_consumerMap */
+    std::map<std::string, ConsumerBase *> m_pendingConsumers;
+
     Orch();
     ref_resolve_status resolveFieldRefValue(type_map&, const std::string&, const std::string&, swss::KeyOpFieldsValuesTuple&, sai_object_id_t&, std::string&);
     std::set<std::string> generateIdListFromMap(unsigned long idsMap, sai_uint32_t maxId);
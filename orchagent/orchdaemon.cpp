@@ -2,6 +2,7 @@
 #include <unordered_map>
 #include <chrono>
 #include <limits.h>
+#include <inttypes.h>
 #include "orchdaemon.h"
 #include "logger.h"
 #include <sairedis.h>
@@ -16,8 +17,6 @@
 using namespace std;
 using namespace swss;
 
-/* select() function timeout retry time */
-#define SELECT_TIMEOUT 1000
 #define PFC_WD_POLL_MSECS 100
 
 #define APP_FABRIC_MONITOR_PORT_TABLE_NAME      "FABRIC_PORT_TABLE"
@@ -807,10 +806,7 @@ void OrchDaemon::flush()
         handleSaiFailure(true);
     }
 
-    for (auto* orch: m_orchList)
-    {
-        orch->flushResponses();
-    }
+    ResponsePublisher::flushAll();
 }
 
 /* Release the file handle so the log can be rotated */
@@ -833,6 +829,9 @@ void OrchDaemon::start()
 
     Recorder::Instance().sairedis.setRotate(false);
 
+    /* Responses are sent by the flush at the end of each loop iteration */
+    ResponsePublisher::setDeferredFlush(true);
+
     for (Orch *o : m_orchList)
     {
         m_select->addSelectables(o->getSelectables());
@@ -845,7 +844,7 @@ void OrchDaemon::start()
         Selectable *s;
         int ret;
 
-        ret = m_select->select(&s, SELECT_TIMEOUT);
+        ret = m_select->select(&s, m_scheduler.getTimeout(SELECT_TIMEOUT));
 
         auto tend = std::chrono::high_resolution_clock::now();
         heartBeat(tend);
@@ -867,6 +866,9 @@ void OrchDaemon::start()
 
         if (ret == Select::TIMEOUT)
         {
+            /* Retry the tasks whose backoff expired while nothing was selected */
+            m_scheduler.drain();
+
             /* Let sairedis to flush all SAI function call to ASIC DB.
              * Normally the redis pipeline will flush when enough request
              * accumulated. Still it is possible that small amount of
@@ -887,12 +889,13 @@ void OrchDaemon::start()
         auto *c = (Executor *)s;
         c->execute();
 
-        /* After each iteration, periodically check all m_toSync map to
-         * execute all the remaining tasks that need to be retried. */
+        /* After each iteration, drain the consumers which still have tasks
+         * in m_toSync, either new ones or the ones that need to be retried. */
+        m_scheduler.drain();
 
-        /* TODO: Abstract Orch class to have a specific todo list */
-        for (Orch *o : m_orchList)
-            o->doTask();
+        /* Hand the responses published in this iteration to the writer
+         * threads, repeated writes of a key have been coalesced into one. */
+        ResponsePublisher::flushAll();
 
         /*
          * Asked to check warm restart readiness.
@@ -916,7 +919,7 @@ void OrchDaemon::start()
                     {
                         for (auto& pair: gPortsOrch->getAllPorts())
                         {
-                            auto& port = pair.second;
+                            auto port = pair.second;
                             gPortsOrch->setBridgePortLearningFDB(port, SAI_BRIDGE_PORT_FDB_LEARNING_MODE_DISABLE);
                         }
                     }
@@ -1098,9 +1101,19 @@ void OrchDaemon::heartBeat(std::chrono::time_point<std::chrono::high_resolution_
         m_lastHeartBeat = tcurrent;
         // output heart beat message to supervisord with 'PROCESS_COMMUNICATION_STDOUT' event: http://supervisord.org/events.html
         cout << "<!--XSUPERVISOR:BEGIN-->heartbeat<!--XSUPERVISOR:END-->" << endl;
+
+        logSchedulerCounters();
     }
 }
 
+void OrchDaemon::logSchedulerCounters()
+{
+    const auto &counters = m_scheduler.getCounters();
+    SWSS_LOG_INFO("Scheduler consumers drained: %" PRIu64 ", skipped: %" PRIu64 ", deferred: %" PRIu64,
+                  counters.drained, counters.skipped, counters.deferred);
+    m_scheduler.resetCounters();
+}
+
 void OrchDaemon::freezeAndHeartBeat(unsigned int duration)
 {
     while (duration > 0)
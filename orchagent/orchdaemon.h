@@ -6,6 +6,7 @@
 #include "consumertable.h"
 #include "zmqserver.h"
 #include "select.h"
+#include "orchscheduler.h"
 
 #include "portsorch.h"
 #include "fabricportsorch.h"
@@ -96,6 +97,7 @@ private:
     bool m_fabricQueueStatEnabled = true;
 
     std::vector<Orch *> m_orchList;
+    OrchScheduler m_scheduler{m_orchList};
     Select *m_select;
     
     std::chrono::time_point<std::chrono::high_resolution_clock> m_lastHeartBeat;
@@ -104,6 +106,8 @@ private:
 
     void heartBeat(std::chrono::time_point<std::chrono::high_resolution_clock> tcurrent);
 
+    void logSchedulerCounters();
+
     void freezeAndHeartBeat(unsigned int duration);
 };
 
@@ -0,0 +1,111 @@
+#include <algorithm>
+#include "orchscheduler.h"
+#include "logger.h"
+
+using namespace std;
+using namespace swss;
+
+OrchScheduler::OrchScheduler(const vector<Orch *> &orchList) :
+    m_orchList(orchList)
+{
+}
+
+void OrchScheduler::drain()
+{
+    auto now = chrono::steady_clock::now();
+
+    for (Orch *o : m_orchList)
+    {
+        /* Consumers may have been drained directly by Executor::execute() */
+        o->prunePendingConsumers();
+
+        const auto &pendingConsumers = o->getPendingConsumers();
+        if (pendingConsumers.empty())
+        {
+            m_counters.skipped += o->getExecutorCount();
+            continue;
+        }
+
+        bool due = false;
+        for (const auto &it : pendingConsumers)
+        {
+            if (it.second->m_retryDue <= now)
+            {
+                due = true;
+                break;
+            }
+        }
+
+        if (!due)
+        {
+            m_counters.deferred += pendingConsumers.size();
+            m_counters.skipped += o->getExecutorCount() - pendingConsumers.size();
+            continue;
+        }
+
+        vector<pair<ConsumerBase *, size_t>> drained;
+        drained.reserve(pendingConsumers.size());
+        for (const auto &it : pendingConsumers)
+        {
+            it.second->m_hasNewData = false;
+            drained.emplace_back(it.second, it.second->m_toSync.size());
+        }
+
+        /* Orch may override doTask() to drain its tables in a specific order */
+        o->doTask();
+
+        for (const auto &it : drained)
+        {
+            updateRetryState(it.first, it.second, now);
+        }
+        o->prunePendingConsumers();
+
+        m_counters.drained += drained.size();
+        m_counters.skipped += o->getExecutorCount() - drained.size();
+    }
+}
+
+void OrchScheduler::updateRetryState(ConsumerBase *consumer, size_t pendingBefore,
+                                     chrono::steady_clock::time_point now)
+{
+    if (consumer->m_toSync.empty() || consumer->m_hasNewData ||
+        consumer->m_toSync.size() < pendingBefore)
+    {
+        consumer->m_retryBackoff = chrono::milliseconds(0);
+        consumer->m_retryDue = now;
+        return;
+    }
+
+    /* Nothing was processed, the remaining tasks are waiting on something else */
+    if (consumer->m_retryBackoff.count() == 0)
+    {
+        consumer->m_retryBackoff = chrono::milliseconds(RETRY_BACKOFF_MIN_MSECS);
+    }
+    else
+    {
+        consumer->m_retryBackoff = min(consumer->m_retryBackoff * 2,
+                                       chrono::milliseconds(RETRY_BACKOFF_MAX_MSECS));
+    }
+    consumer->m_retryDue = now + consumer->m_retryBackoff;
+
+    SWSS_LOG_DEBUG("Defer retry of %s with %zu pending tasks for %ld ms",
+                   consumer->getName().c_str(), consumer->m_toSync.size(),
+                   (long)consumer->m_retryBackoff.count());
+}
+
+int OrchScheduler::getTimeout(int maxTimeout) const
+{
+    for (Orch *o : m_orchList)
+    {
+        for (const auto &it : o->getPendingConsumers())
+        {
+            /* Deferred consumers wait for the next drain, they do not wake up orchagent */
+            if (!it.second->m_toSync.empty() && it.second->m_retryBackoff.count() == 0)
+            {
+                return 0;
+            }
+        }
+    }
+
+    return maxTimeout;
+}
@@ -0,0 +1,65 @@
+#ifndef SWSS_ORCHSCHEDULER_H
+#define SWSS_ORCHSCHEDULER_H
+
+#include <chrono>
+#include <vector>
+
+#include "orch.h"
+
+/* select() function timeout retry time */
+#define SELECT_TIMEOUT 1000
+
+/* Backoff applied to consumers whose retry made no progress */
+#define RETRY_BACKOFF_MIN_MSECS 1
+#define RETRY_BACKOFF_MAX_MSECS SELECT_TIMEOUT
+
+/*
+ * OrchScheduler drains only the consumers with pending tasks, instead of
+ * calling doTask() on every Orch after each event.
+ *
+ * Orch::schedule() keeps the set of consumers with non-empty m_toSync.
+ * An Orch is drained when at least one of its pending consumers is due.
+ * A consumer whose retry did not make progress is deferred with an
+ * exponential backoff, which is reset when new data arrives for it or when
+ * one of its own retries makes progress. A deferred consumer does not
+ * shorten the select timeout: it is retried by the first drain after its
+ * backoff expired, which happens at the latest on the next select timeout,
+ * as before the scheduler.
+ */
+class OrchScheduler
+{
+public:
+    struct Counters
+    {
+        uint64_t drained = 0;   // consumers visited by a drain
+        uint64_t skipped = 0;   // executors skipped because they had nothing to do
+        uint64_t deferred = 0;  // pending consumers skipped because of retry backoff
+    };
+
+    OrchScheduler(const std::vector<Orch *> &orchList);
+
+    /* Run doTask() on each Orch with due pending consumers, in m_orchList order */
+    void drain();
+
+    /* 0 when a consumer with new data or progress is pending, maxTimeout otherwise */
+    int getTimeout(int maxTimeout) const;
+
+    const Counters &getCounters() const
+    {
+        return m_counters;
+    }
+
+    void resetCounters()
+    {
+        m_counters = Counters();
+    }
+
+private:
+    const std::vector<Orch *> &m_orchList;
+    Counters m_counters;
+
+    void updateRetryState(ConsumerBase *consumer, size_t pendingBefore,
+                          std::chrono::steady_clock::time_point now);
+};
+
+#endif /* SWSS_ORCHSCHEDULER_H */
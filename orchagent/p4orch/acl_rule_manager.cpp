@@ -556,41 +556,38 @@ ReturnCodeOr<P4AclRuleAppDbEntry> AclRuleManager::deserializeAclRuleAppDbEntry(
     app_db_entry.acl_table_name = acl_table_name;
     app_db_entry.db_key = concatTableNameAndRuleKey(acl_table_name, key);
     // Parse rule key : match fields and priority
-    try
+    P4RTKeyFields rule_key_fields;
+    if (!rule_key_fields.parse(key))
+    {
+        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize ACL rule match key";
+    }
+    for (const auto &rule_key_field : rule_key_fields.fields())
     {
-        const auto &rule_key_json = nlohmann::json::parse(key);
-        if (!rule_key_json.is_object())
+        if (rule_key_field.name == kPriority)
         {
-            return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Invalid ACL rule key: should be a JSON object.";
+            if (rule_key_field.type != P4RTKeyFields::UNSIGNED)
+            {
+                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
+                       << "Invalid ACL rule priority type: should be uint32_t";
+            }
+            app_db_entry.priority = static_cast<uint32_t>(rule_key_field.number);
+            continue;
         }
-        for (auto rule_key_it = rule_key_json.begin(); rule_key_it != rule_key_json.end(); ++rule_key_it)
+        else
         {
-            if (rule_key_it.key() == kPriority)
+            const auto &tokenized_match_field = tokenize(rule_key_field.name, kFieldDelimiter);
+            if (tokenized_match_field.size() <= 1 || tokenized_match_field[0] != kMatchPrefix)
             {
-                if (!rule_key_it.value().is_number_unsigned())
-                {
-                    return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
-                           << "Invalid ACL rule priority type: should be uint32_t";
-                }
-                app_db_entry.priority = rule_key_it.value();
-                continue;
+                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
+                       << "Unknown ACL match field string " << QuotedVar(rule_key_field.name);
             }
-            else
+            if (rule_key_field.type != P4RTKeyFields::STRING)
             {
-                const auto &tokenized_match_field = tokenize(rule_key_it.key(), kFieldDelimiter);
-                if (tokenized_match_field.size() <= 1 || tokenized_match_field[0] != kMatchPrefix)
-                {
-                    return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
-                           << "Unknown ACL match field string " << QuotedVar(rule_key_it.key());
-                }
-                app_db_entry.match_fvs[tokenized_match_field[1]] = rule_key_it.value();
+                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize ACL rule match key";
             }
+            app_db_entry.match_fvs[tokenized_match_field[1]] = rule_key_field.value;
         }
     }
-    catch (std::exception &e)
-    {
-        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize ACL rule match key";
-    }
 
     for (const auto &it : attributes)
     {
@@ -242,7 +242,7 @@ void AclTableManager::drain()
         const std::string &operation = kfvOp(key_op_fvs_tuple);
         if (operation == SET_COMMAND)
         {
-            auto app_db_entry_or = deserializeAclTableDefinitionAppDbEntry(db_key, attributes);
+            auto app_db_entry_or = getAclTableDefinitionAppDbEntry(db_key, attributes);
             if (!app_db_entry_or.ok())
             {
                 status = app_db_entry_or.status();
@@ -283,6 +283,7 @@ void AclTableManager::drain()
         else if (operation == DEL_COMMAND)
         {
             status = processDeleteTableRequest(db_key);
+            m_aclTableDefinitionAppDbEntries.erase(db_key);
         }
         else
         {
@@ -376,6 +377,23 @@ ReturnCodeOr<P4AclTableDefinitionAppDbEntry> AclTableManager::deserializeAclTabl
     return app_db_entry;
 }
 
+ReturnCodeOr<P4AclTableDefinitionAppDbEntry> AclTableManager::getAclTableDefinitionAppDbEntry(
+    const std::string &key, const std::vector<swss::FieldValueTuple> &attributes)
+{
+    auto it = m_aclTableDefinitionAppDbEntries.find(key);
+    if (it != m_aclTableDefinitionAppDbEntries.end() && it->second.first == attributes)
+    {
+        return it->second.second;
+    }
+
+    auto app_db_entry_or = deserializeAclTableDefinitionAppDbEntry(key, attributes);
+    if (app_db_entry_or.ok())
+    {
+        m_aclTableDefinitionAppDbEntries[key] = std::make_pair(attributes, *app_db_entry_or);
+    }
+    return app_db_entry_or;
+}
+
 ReturnCode AclTableManager::validateAclTableDefinitionAppDbEntry(const P4AclTableDefinitionAppDbEntry &app_db_entry)
 {
     // Perform generic APP DB entry validations. Operation specific
@@ -981,7 +999,7 @@ std::string AclTableManager::verifyState(const std::string &key, const std::vect
     }
 
     ReturnCode status;
-    auto app_db_entry_or = deserializeAclTableDefinitionAppDbEntry(key_content, tuple);
+    auto app_db_entry_or = getAclTableDefinitionAppDbEntry(key_content, tuple);
     if (!app_db_entry_or.ok())
     {
         status = app_db_entry_or.status();
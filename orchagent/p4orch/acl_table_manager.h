@@ -2,6 +2,7 @@
 
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -49,6 +50,11 @@ class AclTableManager : public ObjectManagerInterface
     ReturnCodeOr<P4AclTableDefinitionAppDbEntry> deserializeAclTableDefinitionAppDbEntry(
         const std::string &key, const std::vector<swss::FieldValueTuple> &attributes);
 
+    // Returns the deserialized entry from the cache if the table definition
+    // has the same attributes, deserializes and caches it otherwise.
+    ReturnCodeOr<P4AclTableDefinitionAppDbEntry> getAclTableDefinitionAppDbEntry(
+        const std::string &key, const std::vector<swss::FieldValueTuple> &attributes);
+
     // Create new ACL table definition.
     ReturnCode createAclTable(P4AclTableDefinition &acl_table, sai_object_id_t *acl_table_oid,
                               sai_object_id_t *acl_group_member_oid);
@@ -113,6 +119,11 @@ class AclTableManager : public ObjectManagerInterface
     P4OidMapper *m_p4OidMapper;
     ResponsePublisherInterface *m_publisher;
     P4AclTableDefinitions m_aclTableDefinitions;
+    // Deserialized APP DB entries of the table definitions, with the attributes
+    // they were deserialized from, keyed by table name.
+    std::unordered_map<std::string,
+                       std::pair<std::vector<swss::FieldValueTuple>, P4AclTableDefinitionAppDbEntry>>
+        m_aclTableDefinitionAppDbEntries;
     std::deque<swss::KeyOpFieldsValuesTuple> m_entries;
     std::map<sai_acl_stage_t, std::vector<std::string>> m_aclTablesByStage;
 
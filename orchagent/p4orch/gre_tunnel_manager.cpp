@@ -220,12 +220,8 @@ ReturnCodeOr<P4GreTunnelAppDbEntry> GreTunnelManager::deserializeP4GreTunnelAppD
     app_db_entry.encap_src_ip = swss::IpAddress("0.0.0.0");
     app_db_entry.encap_dst_ip = swss::IpAddress("0.0.0.0");
 
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.tunnel_id = j[prependMatchField(p4orch::kTunnelId)];
-    }
-    catch (std::exception &ex)
+    P4RTKeyFields key_fields;
+    if (!key_fields.parse(key) || !key_fields.getMatchFieldValue(p4orch::kTunnelId, &app_db_entry.tunnel_id))
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize GRE tunnel id";
     }
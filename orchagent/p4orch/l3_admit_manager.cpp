@@ -162,11 +162,19 @@ ReturnCodeOr<P4L3AdmitAppDbEntry> L3AdmitManager::deserializeP4L3AdmitAppDbEntry
 
     try
     {
-        nlohmann::json j = nlohmann::json::parse(key);
+        P4RTKeyFields key_fields;
+        if (!key_fields.parse(key))
+        {
+            return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize l3 admit key";
+        }
         // "match/dst_mac":"00:02:03:04:00:00&ff:ff:ff:ff:00:00"
-        if (j.find(prependMatchField(p4orch::kDstMac)) != j.end())
+        if (key_fields.getMatchField(p4orch::kDstMac) != nullptr)
         {
-            std::string dst_mac_data_and_mask = j[prependMatchField(p4orch::kDstMac)];
+            std::string dst_mac_data_and_mask;
+            if (!key_fields.getMatchFieldValue(p4orch::kDstMac, &dst_mac_data_and_mask))
+            {
+                return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize l3 admit key";
+            }
             const auto &data_and_mask = swss::tokenize(dst_mac_data_and_mask, p4orch::kDataMaskDelimiter);
             app_db_entry.mac_address_data = swss::MacAddress(trim(data_and_mask[0]));
             if (data_and_mask.size() > 1)
@@ -186,18 +194,19 @@ ReturnCodeOr<P4L3AdmitAppDbEntry> L3AdmitManager::deserializeP4L3AdmitAppDbEntry
         }
 
         // "priority":2030
-        auto priority_j = j[p4orch::kPriority];
-        if (!priority_j.is_number_unsigned())
+        const auto *priority_field = key_fields.getField(p4orch::kPriority);
+        if (priority_field == nullptr || priority_field->type != P4RTKeyFields::UNSIGNED)
         {
             return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM)
                    << "Invalid l3 admit entry priority type: should be uint32_t";
         }
-        app_db_entry.priority = static_cast<uint32_t>(priority_j);
+        app_db_entry.priority = static_cast<uint32_t>(priority_field->number);
 
         // "match/in_port":"Ethernet0"
-        if (j.find(prependMatchField(p4orch::kInPort)) != j.end())
+        if (key_fields.getMatchField(p4orch::kInPort) != nullptr &&
+            !key_fields.getMatchFieldValue(p4orch::kInPort, &app_db_entry.port_name))
         {
-            app_db_entry.port_name = j[prependMatchField(p4orch::kInPort)];
+            return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize l3 admit key";
         }
     }
     catch (std::exception &ex)
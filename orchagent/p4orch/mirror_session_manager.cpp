@@ -26,24 +26,20 @@ ReturnCode MirrorSessionManager::getSaiObject(const std::string &json_key, sai_o
 {
     std::string value;
 
-    try
+    P4RTKeyFields key_fields;
+    if (!key_fields.parse(json_key))
     {
-        nlohmann::json j = nlohmann::json::parse(json_key);
-        if (j.find(prependMatchField(p4orch::kMirrorSessionId)) != j.end())
-        {
-            value = j.at(prependMatchField(p4orch::kMirrorSessionId)).get<std::string>();
-            object_key = KeyGenerator::generateMirrorSessionKey(value);
-            object_type = SAI_OBJECT_TYPE_MIRROR_SESSION;
-            return ReturnCode();
-        }
-        else
-        {
-            SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kMirrorSessionId);
-        }
+        SWSS_LOG_ERROR("json_key parse error");
     }
-    catch (std::exception &ex)
+    else if (key_fields.getMatchFieldValue(p4orch::kMirrorSessionId, &value))
     {
-        SWSS_LOG_ERROR("json_key parse error");
+        object_key = KeyGenerator::generateMirrorSessionKey(value);
+        object_type = SAI_OBJECT_TYPE_MIRROR_SESSION;
+        return ReturnCode();
+    }
+    else
+    {
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kMirrorSessionId);
     }
 
     return StatusCode::SWSS_RC_INVALID_PARAM;
@@ -187,12 +183,9 @@ ReturnCodeOr<P4MirrorSessionAppDbEntry> MirrorSessionManager::deserializeP4Mirro
 
     P4MirrorSessionAppDbEntry app_db_entry = {};
 
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.mirror_session_id = j[prependMatchField(p4orch::kMirrorSessionId)];
-    }
-    catch (std::exception &ex)
+    P4RTKeyFields key_fields;
+    if (!key_fields.parse(key) ||
+        !key_fields.getMatchFieldValue(p4orch::kMirrorSessionId, &app_db_entry.mirror_session_id))
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize mirror session id";
     }
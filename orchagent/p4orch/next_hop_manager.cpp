@@ -152,24 +152,20 @@ ReturnCode NextHopManager::getSaiObject(const std::string &json_key, sai_object_
 {
     std::string value;
 
-    try
+    P4RTKeyFields key_fields;
+    if (!key_fields.parse(json_key))
     {
-        nlohmann::json j = nlohmann::json::parse(json_key);
-        if (j.find(prependMatchField(p4orch::kNexthopId)) != j.end())
-        {
-            value = j.at(prependMatchField(p4orch::kNexthopId)).get<std::string>();
-            object_key = KeyGenerator::generateNextHopKey(value);
-            object_type = SAI_OBJECT_TYPE_NEXT_HOP;
-            return ReturnCode();
-        }
-        else
-        {
-            SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kNexthopId);
-        }
+        SWSS_LOG_ERROR("json_key parse error");
     }
-    catch (std::exception &ex)
+    else if (key_fields.getMatchFieldValue(p4orch::kNexthopId, &value))
     {
-        SWSS_LOG_ERROR("json_key parse error");
+        object_key = KeyGenerator::generateNextHopKey(value);
+        object_type = SAI_OBJECT_TYPE_NEXT_HOP;
+        return ReturnCode();
+    }
+    else
+    {
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kNexthopId);
     }
 
     return StatusCode::SWSS_RC_INVALID_PARAM;
@@ -273,12 +269,8 @@ ReturnCodeOr<P4NextHopAppDbEntry> NextHopManager::deserializeP4NextHopAppDbEntry
     P4NextHopAppDbEntry app_db_entry = {};
     app_db_entry.neighbor_id = swss::IpAddress("0.0.0.0");
 
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.next_hop_id = j[prependMatchField(p4orch::kNexthopId)];
-    }
-    catch (std::exception &ex)
+    P4RTKeyFields key_fields;
+    if (!key_fields.parse(key) || !key_fields.getMatchFieldValue(p4orch::kNexthopId, &app_db_entry.next_hop_id))
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize next hop id";
     }
@@ -84,7 +84,7 @@ class P4Orch : public Orch
     swss::NotificationConsumer *m_portStatusNotificationConsumer;
 
     // Sepcial publisher that writes to APPL DB instead of APPL STATE DB.
-    ResponsePublisher m_publisher{"APPL_DB", /*bool buffered=*/true, /*db_write_thread=*/true};
+    ResponsePublisher m_publisher{"APPL_DB", /*bool buffered=*/true};
 
     friend class p4orch::test::WcmpManagerTest;
 };
@@ -1,5 +1,7 @@
 #include "p4orch/p4orch_util.h"
 
+#include <cstring>
+
 #include "p4orch/p4orch.h"
 #include "schema.h"
 
@@ -31,6 +33,520 @@ void parseP4RTKey(const std::string &key, std::string *table_name, std::string *
     *key_content = key.substr(pos + 1);
 }
 
+namespace
+{
+
+// Nesting limit of the values that are skipped in a P4RT key.
+constexpr int kMaxKeyValueDepth = 64;
+
+void skipWhitespace(const char *&p, const char *end)
+{
+    while (p < end && (*p == ' ' || *p == '\t' || *p == '\n' || *p == '\r'))
+    {
+        p++;
+    }
+}
+
+bool parseHex4(const char *&p, const char *end, uint32_t *code)
+{
+    if (end - p < 4)
+    {
+        return false;
+    }
+    *code = 0;
+    for (int i = 0; i < 4; i++, p++)
+    {
+        char c = *p;
+        *code <<= 4;
+        if (c >= '0' && c <= '9')
+            *code |= static_cast<uint32_t>(c - '0');
+        else if (c >= 'a' && c <= 'f')
+            *code |= static_cast<uint32_t>(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F')
+            *code |= static_cast<uint32_t>(c - 'A' + 10);
+        else
+            return false;
+    }
+    return true;
+}
+
+void appendUtf8(uint32_t code, std::string *out)
+{
+    if (code < 0x80)
+    {
+        out->push_back(static_cast<char>(code));
+    }
+    else if (code < 0x800)
+    {
+        out->push_back(static_cast<char>(0xC0 | (code >> 6)));
+        out->push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    }
+    else if (code < 0x10000)
+    {
+        out->push_back(static_cast<char>(0xE0 | (code >> 12)));
+        out->push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        out->push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    }
+    else
+    {
+        out->push_back(static_cast<char>(0xF0 | (code >> 18)));
+        out->push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+        out->push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+        out->push_back(static_cast<char>(0x80 | (code & 0x3F)));
+    }
+}
+
+// Returns the length of the well-formed UTF-8 sequence at p, 0 if it is
+// malformed.
+size_t utf8SequenceLength(const char *p, const char *end)
+{
+    auto byte = [&](size_t i) { return static_cast<unsigned char>(p[i]); };
+    auto continuation = [&](size_t i, unsigned char low, unsigned char high) {
+        return p + i < end && byte(i) >= low && byte(i) <= high;
+    };
+
+    unsigned char lead = byte(0);
+    if (lead >= 0xC2 && lead <= 0xDF)
+        return continuation(1, 0x80, 0xBF) ? 2 : 0;
+    if (lead == 0xE0)
+        return continuation(1, 0xA0, 0xBF) && continuation(2, 0x80, 0xBF) ? 3 : 0;
+    if ((lead >= 0xE1 && lead <= 0xEC) || lead == 0xEE || lead == 0xEF)
+        return continuation(1, 0x80, 0xBF) && continuation(2, 0x80, 0xBF) ? 3 : 0;
+    if (lead == 0xED)
+        return continuation(1, 0x80, 0x9F) && continuation(2, 0x80, 0xBF) ? 3 : 0;
+    if (lead == 0xF0)
+        return continuation(1, 0x90, 0xBF) && continuation(2, 0x80, 0xBF) && continuation(3, 0x80, 0xBF) ? 4 : 0;
+    if (lead >= 0xF1 && lead <= 0xF3)
+        return continuation(1, 0x80, 0xBF) && continuation(2, 0x80, 0xBF) && continuation(3, 0x80, 0xBF) ? 4 : 0;
+    if (lead == 0xF4)
+        return continuation(1, 0x80, 0x8F) && continuation(2, 0x80, 0xBF) && continuation(3, 0x80, 0xBF) ? 4 : 0;
+    return 0;
+}
+
+// Parses the JSON string at p into out, or only checks it if out is nullptr.
+bool parseString(const char *&p, const char *end, std::string *out)
+{
+    if (p == end || *p != '"')
+    {
+        return false;
+    }
+    p++;
+    while (p < end)
+    {
+        // Copy the run of characters that need no decoding at once.
+        const char *run = p;
+        while (p < end && *p != '"' && *p != '\\' && static_cast<unsigned char>(*p) >= 0x20 &&
+               static_cast<unsigned char>(*p) < 0x80)
+        {
+            p++;
+        }
+        if (out != nullptr)
+        {
+            out->append(run, p);
+        }
+        if (p == end)
+        {
+            break;
+        }
+
+        unsigned char c = static_cast<unsigned char>(*p);
+        if (c == '"')
+        {
+            p++;
+            return true;
+        }
+        if (c < 0x20)
+        {
+            return false;
+        }
+        if (c >= 0x80)
+        {
+            size_t len = utf8SequenceLength(p, end);
+            if (len == 0)
+            {
+                return false;
+            }
+            if (out != nullptr)
+            {
+                out->append(p, len);
+            }
+            p += len;
+            continue;
+        }
+
+        // Escape sequence
+        if (++p == end)
+        {
+            return false;
+        }
+        char escaped = *p++;
+        uint32_t code;
+        switch (escaped)
+        {
+        case '"':
+        case '\\':
+        case '/':
+            code = static_cast<uint32_t>(escaped);
+            break;
+        case 'b':
+            code = '\b';
+            break;
+        case 'f':
+            code = '\f';
+            break;
+        case 'n':
+            code = '\n';
+            break;
+        case 'r':
+            code = '\r';
+            break;
+        case 't':
+            code = '\t';
+            break;
+        case 'u':
+            if (!parseHex4(p, end, &code))
+            {
+                return false;
+            }
+            if (code >= 0xDC00 && code <= 0xDFFF)
+            {
+                return false;
+            }
+            if (code >= 0xD800 && code <= 0xDBFF)
+            {
+                uint32_t low;
+                if (end - p < 2 || p[0] != '\\' || p[1] != 'u')
+                {
+                    return false;
+                }
+                p += 2;
+                if (!parseHex4(p, end, &low) || low < 0xDC00 || low > 0xDFFF)
+                {
+                    return false;
+                }
+                code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+            }
+            break;
+        default:
+            return false;
+        }
+        if (out != nullptr)
+        {
+            appendUtf8(code, out);
+        }
+    }
+    return false;
+}
+
+// Parses the JSON number at p. Sets is_unsigned if it is an integer without
+// sign that fits in 64 bits, as nlohmann::json stores it.
+bool parseNumber(const char *&p, const char *end, bool *is_unsigned, uint64_t *number)
+{
+    bool integer = true;
+    if (p < end && *p == '-')
+    {
+        integer = false;
+        p++;
+    }
+    if (p == end || *p < '0' || *p > '9')
+    {
+        return false;
+    }
+    uint64_t value = 0;
+    if (*p == '0')
+    {
+        p++;
+    }
+    else
+    {
+        while (p < end && *p >= '0' && *p <= '9')
+        {
+            uint64_t digit = static_cast<uint64_t>(*p - '0');
+            if (value > (UINT64_MAX - digit) / 10)
+            {
+                integer = false;
+            }
+            value = value * 10 + digit;
+            p++;
+        }
+    }
+    if (p < end && *p == '.')
+    {
+        integer = false;
+        p++;
+        if (p == end || *p < '0' || *p > '9')
+        {
+            return false;
+        }
+        while (p < end && *p >= '0' && *p <= '9')
+        {
+            p++;
+        }
+    }
+    if (p < end && (*p == 'e' || *p == 'E'))
+    {
+        integer = false;
+        p++;
+        if (p < end && (*p == '+' || *p == '-'))
+        {
+            p++;
+        }
+        if (p == end || *p < '0' || *p > '9')
+        {
+            return false;
+        }
+        while (p < end && *p >= '0' && *p <= '9')
+        {
+            p++;
+        }
+    }
+    *is_unsigned = integer;
+    *number = integer ? value : 0;
+    return true;
+}
+
+bool parseLiteral(const char *&p, const char *end, const char *literal)
+{
+    size_t len = strlen(literal);
+    if (static_cast<size_t>(end - p) < len || memcmp(p, literal, len) != 0)
+    {
+        return false;
+    }
+    p += len;
+    return true;
+}
+
+// Parses the JSON value at p into field. Values other than strings and
+// unsigned integers are only checked.
+bool parseValue(const char *&p, const char *end, int depth, P4RTKeyFields::Field *field)
+{
+    if (p == end)
+    {
+        return false;
+    }
+    if (field != nullptr)
+    {
+        field->type = P4RTKeyFields::OTHER;
+        field->value.clear();
+        field->number = 0;
+    }
+    switch (*p)
+    {
+    case '"':
+        if (field != nullptr)
+        {
+            field->type = P4RTKeyFields::STRING;
+            return parseString(p, end, &field->value);
+        }
+        return parseString(p, end, nullptr);
+    case 't':
+        return parseLiteral(p, end, "true");
+    case 'f':
+        return parseLiteral(p, end, "false");
+    case 'n':
+        return parseLiteral(p, end, "null");
+    case '[':
+    case '{': {
+        if (depth >= kMaxKeyValueDepth)
+        {
+            return false;
+        }
+        bool object = (*p++ == '{');
+        char close = object ? '}' : ']';
+        skipWhitespace(p, end);
+        if (p < end && *p == close)
+        {
+            p++;
+            return true;
+        }
+        while (true)
+        {
+            if (object)
+            {
+                if (!parseString(p, end, nullptr))
+                {
+                    return false;
+                }
+                skipWhitespace(p, end);
+                if (p == end || *p++ != ':')
+                {
+                    return false;
+                }
+                skipWhitespace(p, end);
+            }
+            if (!parseValue(p, end, depth + 1, nullptr))
+            {
+                return false;
+            }
+            skipWhitespace(p, end);
+            if (p == end)
+            {
+                return false;
+            }
+            if (*p == close)
+            {
+                p++;
+                return true;
+            }
+            if (*p++ != ',')
+            {
+                return false;
+            }
+            skipWhitespace(p, end);
+        }
+    }
+    default: {
+        bool is_unsigned;
+        uint64_t number;
+        if (!parseNumber(p, end, &is_unsigned, &number))
+        {
+            return false;
+        }
+        if (field != nullptr && is_unsigned)
+        {
+            field->type = P4RTKeyFields::UNSIGNED;
+            field->number = number;
+        }
+        return true;
+    }
+    }
+}
+
+bool isMatchField(const std::string &field_name, const std::string &name)
+{
+    const size_t prefix_len = strlen(p4orch::kMatchPrefix);
+    return field_name.size() == prefix_len + 1 + name.size() &&
+           field_name.compare(0, prefix_len, p4orch::kMatchPrefix) == 0 &&
+           field_name[prefix_len] == p4orch::kFieldDelimiter &&
+           field_name.compare(prefix_len + 1, std::string::npos, name) == 0;
+}
+
+bool parseKeyObject(const char *p, const char *end, std::vector<P4RTKeyFields::Field> *fields)
+{
+    // Byte order mark, which nlohmann::json skips as well
+    if (end - p >= 3 && memcmp(p, "\xEF\xBB\xBF", 3) == 0)
+    {
+        p += 3;
+    }
+    skipWhitespace(p, end);
+    if (p == end || *p++ != '{')
+    {
+        return false;
+    }
+    skipWhitespace(p, end);
+    if (p < end && *p == '}')
+    {
+        p++;
+    }
+    else
+    {
+        P4RTKeyFields::Field field;
+        while (true)
+        {
+            field.name.clear();
+            if (!parseString(p, end, &field.name))
+            {
+                return false;
+            }
+            skipWhitespace(p, end);
+            if (p == end || *p++ != ':')
+            {
+                return false;
+            }
+            skipWhitespace(p, end);
+            if (!parseValue(p, end, 1, &field))
+            {
+                return false;
+            }
+
+            P4RTKeyFields::Field *existing = nullptr;
+            for (auto &f : *fields)
+            {
+                if (f.name == field.name)
+                {
+                    existing = &f;
+                    break;
+                }
+            }
+            if (existing != nullptr)
+            {
+                std::swap(*existing, field);
+            }
+            else
+            {
+                fields->push_back(std::move(field));
+                field = P4RTKeyFields::Field();
+            }
+
+            skipWhitespace(p, end);
+            if (p == end)
+            {
+                return false;
+            }
+            if (*p == '}')
+            {
+                p++;
+                break;
+            }
+            if (*p++ != ',')
+            {
+                return false;
+            }
+            skipWhitespace(p, end);
+        }
+    }
+    skipWhitespace(p, end);
+    return p == end;
+}
+
+} // namespace
+
+bool P4RTKeyFields::parse(const std::string &key_content)
+{
+    m_fields.clear();
+    if (!parseKeyObject(key_content.data(), key_content.data() + key_content.size(), &m_fields))
+    {
+        m_fields.clear();
+        return false;
+    }
+    return true;
+}
+
+const P4RTKeyFields::Field *P4RTKeyFields::getField(const std::string &name) const
+{
+    for (const auto &field : m_fields)
+    {
+        if (field.name == name)
+        {
+            return &field;
+        }
+    }
+    return nullptr;
+}
+
+const P4RTKeyFields::Field *P4RTKeyFields::getMatchField(const std::string &name) const
+{
+    for (const auto &field : m_fields)
+    {
+        if (isMatchField(field.name, name))
+        {
+            return &field;
+        }
+    }
+    return nullptr;
+}
+
+bool P4RTKeyFields::getMatchFieldValue(const std::string &name, std::string *value) const
+{
+    const auto *field = getMatchField(name);
+    if (field == nullptr || field->type != STRING)
+    {
+        return false;
+    }
+    *value = field->value;
+    return true;
+}
+
 std::string verifyAttrs(const std::vector<swss::FieldValueTuple> &targets,
                         const std::vector<swss::FieldValueTuple> &exp, const std::vector<swss::FieldValueTuple> &opt,
                         bool allow_unknown)
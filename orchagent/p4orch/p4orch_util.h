@@ -317,6 +317,58 @@ ActionInfo *getTableActionInfo(TableInfo *table, const std::string &action_name)
 // Key content: {content}
 void parseP4RTKey(const std::string &key, std::string *table_name, std::string *key_content);
 
+// Fields of the key content of a P4RT entry, a JSON object of match fields
+// and priority.
+// Example: {"match/router_interface_id":"intf-3/4","priority":15}
+// The key content is parsed in a single pass into the fields with their typed
+// values, instead of building a nlohmann::json document for it. The JSON
+// grammar is checked the same way. A field that is repeated keeps its last
+// value.
+class P4RTKeyFields
+{
+  public:
+    enum ValueType
+    {
+        STRING,
+        // Non-negative integer, eg. the priority.
+        UNSIGNED,
+        // Any other JSON value.
+        OTHER
+    };
+
+    struct Field
+    {
+        std::string name;
+        ValueType type;
+        // Set for STRING.
+        std::string value;
+        // Set for UNSIGNED.
+        uint64_t number;
+    };
+
+    // Parses the key content. Returns false if it is not a JSON object.
+    bool parse(const std::string &key_content);
+
+    // Returns nullptr if the key doesn't have the field.
+    const Field *getField(const std::string &name) const;
+
+    // Same as getField(prependMatchField(name)).
+    const Field *getMatchField(const std::string &name) const;
+
+    // Copies the value of a match field. Returns false if the key doesn't have
+    // the field or the value isn't a string.
+    bool getMatchFieldValue(const std::string &name, std::string *value) const;
+
+    // Fields in the order they appear in the key.
+    const std::vector<Field> &fields() const
+    {
+        return m_fields;
+    }
+
+  private:
+    std::vector<Field> m_fields;
+};
+
 // State verification function that verifies the table attributes.
 // Returns a non-empty string if verification fails.
 //
@@ -328,34 +328,17 @@ ReturnCodeOr<P4RouteEntry> RouteManager::deserializeRouteEntry(const std::string
 
     P4RouteEntry route_entry = {};
     std::string route_prefix;
-    try
+    P4RTKeyFields key_fields;
+    if (!key_fields.parse(key) || !key_fields.getMatchFieldValue(p4orch::kVrfId, &route_entry.vrf_id))
     {
-        nlohmann::json j = nlohmann::json::parse(key);
-        route_entry.vrf_id = j[prependMatchField(p4orch::kVrfId)];
-        if (table_name == APP_P4RT_IPV4_TABLE_NAME)
-        {
-            if (j.find(prependMatchField(p4orch::kIpv4Dst)) != j.end())
-            {
-                route_prefix = j[prependMatchField(p4orch::kIpv4Dst)];
-            }
-            else
-            {
-                route_prefix = "0.0.0.0/0";
-            }
-        }
-        else
-        {
-            if (j.find(prependMatchField(p4orch::kIpv6Dst)) != j.end())
-            {
-                route_prefix = j[prependMatchField(p4orch::kIpv6Dst)];
-            }
-            else
-            {
-                route_prefix = "::/0";
-            }
-        }
+        return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize route key";
     }
-    catch (std::exception &ex)
+    const char *dst_field = (table_name == APP_P4RT_IPV4_TABLE_NAME) ? p4orch::kIpv4Dst : p4orch::kIpv6Dst;
+    if (key_fields.getMatchField(dst_field) == nullptr)
+    {
+        route_prefix = (table_name == APP_P4RT_IPV4_TABLE_NAME) ? "0.0.0.0/0" : "::/0";
+    }
+    else if (!key_fields.getMatchFieldValue(dst_field, &route_prefix))
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize route key";
     }
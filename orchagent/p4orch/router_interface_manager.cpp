@@ -126,12 +126,9 @@ ReturnCodeOr<P4RouterInterfaceAppDbEntry> RouterInterfaceManager::deserializeRou
     SWSS_LOG_ENTER();
 
     P4RouterInterfaceAppDbEntry app_db_entry = {};
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        app_db_entry.router_interface_id = j[prependMatchField(p4orch::kRouterInterfaceId)];
-    }
-    catch (std::exception &ex)
+    P4RTKeyFields key_fields;
+    if (!key_fields.parse(key) ||
+        !key_fields.getMatchFieldValue(p4orch::kRouterInterfaceId, &app_db_entry.router_interface_id))
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize router interface id";
     }
@@ -342,25 +339,20 @@ ReturnCode RouterInterfaceManager::getSaiObject(const std::string &json_key, sai
 {
     std::string value;
 
-    try
+    P4RTKeyFields key_fields;
+    if (!key_fields.parse(json_key))
     {
-        nlohmann::json j = nlohmann::json::parse(json_key);
-        if (j.find(prependMatchField(p4orch::kRouterInterfaceId)) != j.end())
-        {
-            value = j.at(prependMatchField(p4orch::kRouterInterfaceId)).get<std::string>();
-            object_key = KeyGenerator::generateRouterInterfaceKey(value);
-            object_type = SAI_OBJECT_TYPE_ROUTER_INTERFACE;
-            return ReturnCode();
-        }
-        else
-        {
-            SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query",
-                           p4orch::kRouterInterfaceId);
-        }
+        SWSS_LOG_ERROR("json_key parse error");
     }
-    catch (std::exception &ex)
+    else if (key_fields.getMatchFieldValue(p4orch::kRouterInterfaceId, &value))
     {
-        SWSS_LOG_ERROR("json_key parse error");
+        object_key = KeyGenerator::generateRouterInterfaceKey(value);
+        object_type = SAI_OBJECT_TYPE_ROUTER_INTERFACE;
+        return ReturnCode();
+    }
+    else
+    {
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kRouterInterfaceId);
     }
 
     return StatusCode::SWSS_RC_INVALID_PARAM;
@@ -46,9 +46,9 @@ bool PortsOrch::isPortAdminUp(const string &alias)
     return true;
 }
 
-std::map<string, Port> &PortsOrch::getAllPorts()
+const std::map<string, Port> &PortsOrch::getAllPorts()
 {
-    return m_portList;
+    return m_portList.ports();
 }
 
 bool PortsOrch::bake()
@@ -93,6 +93,36 @@ bool PortsOrch::getPort(sai_object_id_t id, Port &port)
     return false;
 }
 
+Port *PortsOrch::findPort(const string &alias)
+{
+    return m_portList.lookup(alias);
+}
+
+Port *PortsOrch::findPort(sai_object_id_t id)
+{
+    for (auto &p : m_portList)
+    {
+        if (p.second.m_port_id == id)
+        {
+            return &p.second;
+        }
+    }
+    return nullptr;
+}
+
+Port *PortsOrch::findPortByBridgePortId(sai_object_id_t bridge_port_id)
+{
+    return nullptr;
+}
+
+void PortsOrch::increasePortFdbCount(const string &alias)
+{
+}
+
+void PortsOrch::decreasePortFdbCount(const string &alias)
+{
+}
+
 void PortsOrch::increasePortRefCount(const string &alias)
 {
 }
@@ -2,7 +2,11 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <iostream>
+#include <nlohmann/json.hpp>
 #include <string>
+#include <vector>
 
 #include "ipprefix.h"
 #include "swssnet.h"
@@ -57,6 +61,121 @@ TEST(P4OrchUtilTest, ParseP4RTKeyTest)
     EXPECT_TRUE(key.empty());
 }
 
+TEST(P4OrchUtilTest, P4RTKeyFieldsTest)
+{
+    P4RTKeyFields key_fields;
+    ASSERT_TRUE(key_fields.parse(R"({"match/router_interface_id":"intf-3/4","match/neighbor_id":"10.0.0.22",)"
+                                 R"("priority":15})"));
+    ASSERT_EQ(3u, key_fields.fields().size());
+    std::string value;
+    EXPECT_TRUE(key_fields.getMatchFieldValue("router_interface_id", &value));
+    EXPECT_EQ("intf-3/4", value);
+    EXPECT_TRUE(key_fields.getMatchFieldValue("neighbor_id", &value));
+    EXPECT_EQ("10.0.0.22", value);
+    EXPECT_FALSE(key_fields.getMatchFieldValue("priority", &value));
+    EXPECT_FALSE(key_fields.getMatchFieldValue("vrf_id", &value));
+    ASSERT_NE(nullptr, key_fields.getField("priority"));
+    EXPECT_EQ(P4RTKeyFields::UNSIGNED, key_fields.getField("priority")->type);
+    EXPECT_EQ(15u, key_fields.getField("priority")->number);
+
+    // Escapes, whitespace, values of other types and repeated fields.
+    ASSERT_TRUE(key_fields.parse(" \r\n{ \"match/a\\/b\" : \"\\\"\\\\\\b\\f\\n\\r\\t\\u00e9\\ud83d\\ude00\" ,"
+                                 "\"match/c\":-1, \"match/d\":1.5e3, \"match/e\":[1,{\"x\":null}], \"match/f\":true,"
+                                 "\"priority\":18446744073709551616, \"match/c\":\"x\"}\t"));
+    ASSERT_EQ(6u, key_fields.fields().size());
+    EXPECT_TRUE(key_fields.getMatchFieldValue("a/b", &value));
+    EXPECT_EQ("\"\\\b\f\n\r\t\xc3\xa9\xf0\x9f\x98\x80", value);
+    EXPECT_TRUE(key_fields.getMatchFieldValue("c", &value));
+    EXPECT_EQ("x", value);
+    EXPECT_EQ(P4RTKeyFields::OTHER, key_fields.getMatchField("d")->type);
+    EXPECT_EQ(P4RTKeyFields::OTHER, key_fields.getMatchField("e")->type);
+    EXPECT_EQ(P4RTKeyFields::OTHER, key_fields.getMatchField("f")->type);
+    EXPECT_EQ(P4RTKeyFields::OTHER, key_fields.getField("priority")->type);
+
+    EXPECT_TRUE(key_fields.parse("{}"));
+    EXPECT_TRUE(key_fields.fields().empty());
+    EXPECT_TRUE(key_fields.parse("{\"match/x\":\"\xe4\xb8\xad\"}"));
+    EXPECT_TRUE(key_fields.getMatchFieldValue("x", &value));
+    EXPECT_EQ("\xe4\xb8\xad", value);
+
+    const std::vector<std::string> invalid_keys = {
+        "",
+        "invalid",
+        "[]",
+        "\"match/x\"",
+        "{",
+        "{\"match/x\":\"y\"",
+        "{\"match/x\":\"y\",}",
+        "{\"match/x\" \"y\"}",
+        "{\"match/x\":\"y\"} {}",
+        "{match/x:\"y\"}",
+        "{\"match/x\":'y'}",
+        "{\"match/x\":01}",
+        "{\"match/x\":1.}",
+        "{\"match/x\":tru}",
+        "{\"match/x\":[1,]}",
+        "{\"match/x\":{\"y\"}}",
+        // Invalid escape, lone surrogates, control character, overlong and
+        // surrogate UTF-8 sequences.
+        "{\"match/x\":\"\\x\"}",
+        "{\"match/x\":\"\\ud83d\"}",
+        "{\"match/x\":\"\\ude00\"}",
+        "{\"match/x\":\"a\nb\"}",
+        "{\"match/x\":\"\xc0\xaf\"}",
+        "{\"match/x\":\"\xed\xa0\x80\"}",
+    };
+    for (const auto &invalid_key : invalid_keys)
+    {
+        EXPECT_FALSE(key_fields.parse(invalid_key)) << invalid_key;
+        EXPECT_TRUE(key_fields.fields().empty()) << invalid_key;
+    }
+}
+
+TEST(P4OrchUtilTest, P4RTKeyFieldsThroughputTest)
+{
+    const int kNumKeys = 100000;
+    std::vector<std::string> keys;
+    keys.reserve(kNumKeys);
+    for (int i = 0; i < kNumKeys; i++)
+    {
+        keys.push_back(R"({"match/ether_type":"0x0800","match/ipv4_dst":"10.)" + std::to_string(i >> 16) + "." +
+                       std::to_string((i >> 8) & 0xff) + "." + std::to_string(i & 0xff) +
+                       R"( & 255.255.255.255","match/in_port":"Ethernet)" + std::to_string(i % 64) +
+                       R"(","priority":)" + std::to_string(i % 1000) + "}");
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::string> json_values(kNumKeys);
+    for (int i = 0; i < kNumKeys; i++)
+    {
+        const auto &j = nlohmann::json::parse(keys[i]);
+        json_values[i] = j[prependMatchField("ipv4_dst")].get<std::string>();
+    }
+    auto json_duration =
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    start = std::chrono::steady_clock::now();
+    std::vector<std::string> values(kNumKeys);
+    std::vector<uint64_t> priorities(kNumKeys);
+    P4RTKeyFields key_fields;
+    for (int i = 0; i < kNumKeys; i++)
+    {
+        ASSERT_TRUE(key_fields.parse(keys[i]));
+        ASSERT_TRUE(key_fields.getMatchFieldValue("ipv4_dst", &values[i]));
+        priorities[i] = key_fields.getField(p4orch::kPriority)->number;
+    }
+    auto duration = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start);
+
+    std::cout << kNumKeys << " P4RT keys parsed in " << json_duration.count() << "ms with nlohmann::json, "
+              << duration.count() << "ms with P4RTKeyFields" << std::endl;
+
+    for (int i = 0; i < kNumKeys; i++)
+    {
+        ASSERT_EQ(json_values[i], values[i]);
+        ASSERT_EQ(static_cast<uint64_t>(i % 1000), priorities[i]);
+    }
+}
+
 TEST(P4OrchUtilTest, PrependMatchFieldShouldSucceed)
 {
     EXPECT_EQ(prependMatchField("str"), "match/str");
@@ -122,16 +122,8 @@ ReturnCodeOr<P4WcmpGroupEntry> WcmpManager::deserializeP4WcmpGroupAppDbEntry(
     const std::string &key, const std::vector<swss::FieldValueTuple> &attributes)
 {
     P4WcmpGroupEntry app_db_entry = {};
-    try
-    {
-        nlohmann::json j = nlohmann::json::parse(key);
-        if (!j.is_object())
-        {
-            return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Invalid WCMP group key: should be a JSON object.";
-        }
-        app_db_entry.wcmp_group_id = j[prependMatchField(kWcmpGroupId)];
-    }
-    catch (std::exception &ex)
+    P4RTKeyFields key_fields;
+    if (!key_fields.parse(key) || !key_fields.getMatchFieldValue(kWcmpGroupId, &app_db_entry.wcmp_group_id))
     {
         return ReturnCode(StatusCode::SWSS_RC_INVALID_PARAM) << "Failed to deserialize WCMP group key";
     }
@@ -739,24 +731,20 @@ ReturnCode WcmpManager::getSaiObject(const std::string &json_key, sai_object_typ
 {
     std::string value;
 
-    try
+    P4RTKeyFields key_fields;
+    if (!key_fields.parse(json_key))
     {
-        nlohmann::json j = nlohmann::json::parse(json_key);
-        if (j.find(prependMatchField(p4orch::kWcmpGroupId)) != j.end())
-        {
-            value = j.at(prependMatchField(p4orch::kWcmpGroupId)).get<std::string>();
-            object_key = KeyGenerator::generateWcmpGroupKey(value);
-            object_type = SAI_OBJECT_TYPE_NEXT_HOP_GROUP;
-            return ReturnCode();
-        }
-        else
-        {
-            SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kWcmpGroupId);
-        }
+        SWSS_LOG_ERROR("json_key parse error");
     }
-    catch (std::exception &ex)
+    else if (key_fields.getMatchFieldValue(p4orch::kWcmpGroupId, &value))
     {
-        SWSS_LOG_ERROR("json_key parse error");
+        object_key = KeyGenerator::generateWcmpGroupKey(value);
+        object_type = SAI_OBJECT_TYPE_NEXT_HOP_GROUP;
+        return ReturnCode();
+    }
+    else
+    {
+        SWSS_LOG_ERROR("%s match parameter absent: required for dependent object query", p4orch::kWcmpGroupId);
     }
 
     return StatusCode::SWSS_RC_INVALID_PARAM;
@@ -0,0 +1,16 @@
+-- KEYS - queue IDs
+-- ARGV[1] - counters db index
+-- ARGV[2] - counters table name
+-- ARGV[3] - poll time interval (milliseconds)
+-- return nothing
+
+-- Tells orchagent the PFC watchdog counters were polled, so that it detects
+-- and restores the PFC storms from them (orchagent -W native). The time is
+-- the one pfc_detect_<platform>.lua would have read.
+
+local timestamp_struct = redis.call('TIME')
+local timestamp = string.format('%d.%06d', tonumber(timestamp_struct[1]), tonumber(timestamp_struct[2]))
+
+redis.call('PUBLISH', 'PFC_WD_POLL', '["poll","' .. timestamp .. '","interval","' .. ARGV[3] .. '"]')
+
+return {}
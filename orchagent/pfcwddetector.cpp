@@ -0,0 +1,485 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+#include "pfcwddetector.h"
+#include "orch.h"
+#include "logger.h"
+#include "schema.h"
+#include "sai_serialize.h"
+
+using namespace std;
+using namespace swss;
+
+#define PFC_COUNTER_PREFIX              "SAI_PORT_STAT_PFC_"
+#define PFC_RX_PACKETS_SUFFIX           "_RX_PKTS"
+#define QUEUE_OCCUPANCY_COUNTER         "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES"
+#define QUEUE_PACKETS_COUNTER           "SAI_QUEUE_STAT_PACKETS"
+#define DEBUG_STORM_FIELD               "DEBUG_STORM"
+#define DEBUG_STORM_ENABLED             "enabled"
+
+bool getPfcWdDetectorConfig(const string &platform, PfcWdDetectorConfig &config)
+{
+    config = PfcWdDetectorConfig();
+
+    if (platform == MLNX_PLATFORM_SUBSTRING)
+    {
+        config.durationCounter = "_RX_PAUSE_DURATION_US";
+        config.durationRatio = 0.99;
+        config.rxPacketsCondition = false;
+        config.effectivePollTime = true;
+    }
+    else if (platform == VS_PLATFORM_SUBSTRING)
+    {
+        config.durationCounter = "_RX_PAUSE_DURATION_US";
+    }
+    else if (platform == BFN_PLATFORM_SUBSTRING)
+    {
+        config.durationCounter = "_RX_PAUSE_DURATION";
+    }
+    else if (platform == NPS_PLATFORM_SUBSTRING)
+    {
+        config.durationCounter = "_RX_PAUSE_DURATION";
+        config.resetLastOnStorm = false;
+    }
+    else
+    {
+        return false;
+    }
+
+    return true;
+}
+
+namespace
+{
+    /* Lua converts strings to numbers with strtod, do the same so the results are identical */
+    bool toNumber(const string &str, double &value)
+    {
+        const char *begin = str.c_str();
+        char *end = nullptr;
+
+        value = strtod(begin, &end);
+        return end != begin;
+    }
+
+    /* How Lua converts a number to a string */
+    string luaString(double value)
+    {
+        char buf[32];
+
+        snprintf(buf, sizeof(buf), "%.14g", value);
+        return buf;
+    }
+
+    /* How redis stores the numbers it is given by a script */
+    string redisString(double value)
+    {
+        char buf[32];
+
+        snprintf(buf, sizeof(buf), "%.17g", value);
+        return buf;
+    }
+}
+
+PfcWdDetector::PfcWdDetector(DBConnector *countersDb, const PfcWdDetectorConfig &config) :
+    m_config(config),
+    m_countersReader(countersDb, COUNTERS_TABLE)
+{
+    for (uint8_t i = 0; i < PFC_WD_PRIORITY_MAX; i++)
+    {
+        m_rxPacketsFields.push_back(PFC_COUNTER_PREFIX + to_string(i) + PFC_RX_PACKETS_SUFFIX);
+        m_durationFields.push_back(PFC_COUNTER_PREFIX + to_string(i) + config.durationCounter);
+    }
+}
+
+bool PfcWdDetector::hasQueue(sai_object_id_t queueId) const
+{
+    return m_queueIndex.find(queueId) != m_queueIndex.end();
+}
+
+void PfcWdDetector::addQueue(sai_object_id_t queueId, sai_object_id_t portId, uint8_t index,
+                             uint32_t detectionTime, uint32_t restorationTime, bool alert)
+{
+    SWSS_LOG_ENTER();
+
+    if (index >= PFC_WD_PRIORITY_MAX)
+    {
+        SWSS_LOG_ERROR("Invalid PFC priority %u of queue 0x%" PRIx64, index, queueId);
+        return;
+    }
+
+    /* As the plugins, which read the times from COUNTERS, keep the time left */
+    auto it = m_queueIndex.find(queueId);
+    if (it != m_queueIndex.end())
+    {
+        auto &queue = m_queues[it->second];
+        queue.detectionTime = detectionTime;
+        queue.restorationTime = restorationTime;
+        queue.alert = alert;
+        return;
+    }
+
+    auto port = m_portIndex.find(portId);
+    if (port == m_portIndex.end())
+    {
+        port = m_portIndex.emplace(portId, m_ports.size()).first;
+        m_portIds.push_back(portId);
+        m_ports.emplace_back();
+        m_ports.back().key = sai_serialize_object_id(portId);
+        m_ports.back().queueCount = 0;
+        m_ports.back().rxValid = 0;
+        m_ports.back().durationValid = 0;
+    }
+    m_ports[port->second].queueCount++;
+
+    Queue queue = {};
+    queue.id = queueId;
+    queue.key = sai_serialize_object_id(queueId);
+    queue.port = port->second;
+    queue.index = index;
+    queue.alert = alert;
+    queue.detectionTime = detectionTime;
+    queue.restorationTime = restorationTime;
+    queue.detectionTimeLeft = detectionTime;
+    queue.restorationTimeLeft = restorationTime;
+
+    m_queueIndex[queueId] = m_queues.size();
+    m_queues.push_back(queue);
+    m_keysChanged = true;
+
+    SWSS_LOG_INFO("Detecting PFC storms on queue %s", m_queues.back().key.c_str());
+}
+
+void PfcWdDetector::removeQueue(sai_object_id_t queueId)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_queueIndex.find(queueId);
+    if (it == m_queueIndex.end())
+    {
+        return;
+    }
+
+    size_t idx = it->second;
+    size_t portIdx = m_queues[idx].port;
+    m_queueIndex.erase(it);
+    m_keysChanged = true;
+
+    /* The last queue takes the place of the removed one */
+    if (idx != m_queues.size() - 1)
+    {
+        m_queues[idx] = std::move(m_queues.back());
+        m_queueIndex[m_queues[idx].id] = idx;
+    }
+    m_queues.pop_back();
+
+    if (--m_ports[portIdx].queueCount != 0)
+    {
+        return;
+    }
+
+    /* Same for the ports */
+    m_portIndex.erase(m_portIds[portIdx]);
+    size_t last = m_ports.size() - 1;
+    if (portIdx != last)
+    {
+        m_ports[portIdx] = std::move(m_ports.back());
+        m_portIds[portIdx] = m_portIds.back();
+        m_portIndex[m_portIds[portIdx]] = portIdx;
+
+        for (auto &queue : m_queues)
+        {
+            if (queue.port == last)
+            {
+                queue.port = portIdx;
+            }
+        }
+    }
+    m_ports.pop_back();
+    m_portIds.pop_back();
+}
+
+void PfcWdDetector::setStormed(sai_object_id_t queueId, bool stormed)
+{
+    auto it = m_queueIndex.find(queueId);
+    if (it != m_queueIndex.end())
+    {
+        m_queues[it->second].stormed = stormed;
+    }
+}
+
+void PfcWdDetector::readCounters()
+{
+    const size_t prefixLen = sizeof(PFC_COUNTER_PREFIX) - 1;
+
+    if (m_keysChanged)
+    {
+        m_keys.clear();
+        for (const auto &port : m_ports)
+        {
+            m_keys.push_back(port.key);
+        }
+        for (const auto &queue : m_queues)
+        {
+            m_keys.push_back(queue.key);
+        }
+        m_keysChanged = false;
+    }
+
+    m_countersReader.get(m_keys, m_fvs);
+
+    for (size_t i = 0; i < m_ports.size(); i++)
+    {
+        auto &port = m_ports[i];
+        port.rxValid = 0;
+        port.durationValid = 0;
+
+        /* Only SAI_PORT_STAT_PFC_<priority>_* fields are of interest */
+        for (const auto &fv : m_fvs[i])
+        {
+            const auto &field = fvField(fv);
+            if (field.size() <= prefixLen + 1 || field.compare(0, prefixLen, PFC_COUNTER_PREFIX) != 0)
+            {
+                continue;
+            }
+
+            unsigned priority = static_cast<unsigned>(field[prefixLen] - '0');
+            if (priority >= PFC_WD_PRIORITY_MAX)
+            {
+                continue;
+            }
+
+            if (field == m_rxPacketsFields[priority])
+            {
+                if (toNumber(fvValue(fv), port.rxPackets[priority]))
+                {
+                    port.rxValid |= static_cast<uint8_t>(1 << priority);
+                }
+            }
+            else if (field == m_durationFields[priority])
+            {
+                if (toNumber(fvValue(fv), port.duration[priority]))
+                {
+                    port.durationValid |= static_cast<uint8_t>(1 << priority);
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < m_queues.size(); i++)
+    {
+        auto &queue = m_queues[i];
+        queue.valid = false;
+        queue.debugStorm = false;
+
+        bool occupancy = false;
+        bool packets = false;
+        for (const auto &fv : m_fvs[m_ports.size() + i])
+        {
+            const auto &field = fvField(fv);
+
+            if (field == QUEUE_OCCUPANCY_COUNTER)
+            {
+                occupancy = toNumber(fvValue(fv), queue.occupancy);
+            }
+            else if (field == QUEUE_PACKETS_COUNTER)
+            {
+                packets = toNumber(fvValue(fv), queue.packets);
+            }
+            else if (field == DEBUG_STORM_FIELD)
+            {
+                queue.debugStorm = fvValue(fv) == DEBUG_STORM_ENABLED;
+            }
+        }
+
+        queue.valid = occupancy && packets;
+    }
+}
+
+void PfcWdDetector::poll(uint32_t intervalMs, double now, vector<PfcWdDetectorEvent> &events)
+{
+    SWSS_LOG_ENTER();
+
+    const double pollTime = static_cast<double>(intervalMs) * 1000;
+    double detectPollTime = pollTime;
+    vector<FieldValueTuple> pollInfo;
+
+    if (m_config.effectivePollTime)
+    {
+        /* The plugin keeps the timestamp as a string, and computes the time between polls from it */
+        string timestamp = luaString(now);
+        if (m_hasLastPoll)
+        {
+            double last = 0;
+            toNumber(m_lastTimestamp, last);
+            detectPollTime = (now - last) * 1000000;
+
+            pollInfo.emplace_back("timestamp", timestamp);
+            pollInfo.emplace_back("timestamp_last", m_lastTimestamp);
+            pollInfo.emplace_back("effective_poll_time", luaString(detectPollTime));
+            if (m_hasLastEffectivePollTime)
+            {
+                pollInfo.emplace_back("effective_pfcwd_poll_time_last", redisString(m_lastEffectivePollTime));
+            }
+
+            m_lastEffectivePollTime = detectPollTime;
+            m_hasLastEffectivePollTime = true;
+        }
+        m_lastTimestamp = timestamp;
+        m_hasLastPoll = true;
+    }
+
+    if (m_queues.empty() || m_bigRedSwitch)
+    {
+        return;
+    }
+
+    readCounters();
+
+    for (auto &queue : m_queues)
+    {
+        if (!queue.stormed || queue.alert)
+        {
+            detect(queue, detectPollTime, pollInfo, events);
+        }
+        else if (queue.restorationTime != 0)
+        {
+            restore(queue, pollTime, events);
+        }
+    }
+}
+
+/* pfc_detect_<platform>.lua for one queue */
+void PfcWdDetector::detect(Queue &queue, double pollTime, const vector<FieldValueTuple> &pollInfo,
+                           vector<PfcWdDetectorEvent> &events)
+{
+    const Port &port = m_ports[queue.port];
+    const uint8_t priority = queue.index;
+
+    if (!queue.valid || !(port.rxValid & port.durationValid & (1 << priority)))
+    {
+        return;
+    }
+
+    const double rxPackets = port.rxPackets[priority];
+    const double duration = port.duration[priority];
+    bool isDeadlock = false;
+
+    /* Without the last counters this is a first run, only the counters are kept */
+    if (queue.hasPacketsLast && queue.hasRxPacketsLast && queue.hasDurationLast)
+    {
+        /* Nothing moved on an operational queue that was not being detected, nothing can change */
+        if (!queue.stormed && !queue.debugStorm &&
+            queue.detectionTimeLeft == queue.detectionTime &&
+            queue.packets == queue.packetsLast &&
+            rxPackets == queue.rxPacketsLast &&
+            duration == queue.durationLast)
+        {
+            return;
+        }
+
+        bool noTx = queue.packets - queue.packetsLast == 0;
+        bool paused = (duration - queue.durationLast) > (pollTime * m_config.durationRatio);
+        bool storm;
+
+        if (m_config.rxPacketsCondition)
+        {
+            storm = (queue.occupancy > 0 && noTx && rxPackets - queue.rxPacketsLast > 0) ||
+                    queue.debugStorm ||
+                    (queue.occupancy == 0 && noTx && paused);
+        }
+        else
+        {
+            storm = (queue.occupancy > 0 && noTx && paused) || queue.debugStorm;
+        }
+
+        if (storm)
+        {
+            if (queue.detectionTimeLeft <= pollTime)
+            {
+                PfcWdDetectorEvent event = { queue.id, PFC_WD_STORM_EVENT, {} };
+                if (m_config.effectivePollTime && !pollInfo.empty())
+                {
+                    event.values = {
+                        { "occupancy", luaString(queue.occupancy) },
+                        { "packets", luaString(queue.packets) },
+                        { "packets_last", luaString(queue.packetsLast) },
+                        { "pfc_rx_packets", luaString(rxPackets) },
+                        { "pfc_rx_packets_last", luaString(queue.rxPacketsLast) },
+                        { "pfc_duration", luaString(duration) },
+                        { "pfc_duration_last", luaString(queue.durationLast) }
+                    };
+                    event.values.insert(event.values.end(), pollInfo.begin(), pollInfo.end());
+                }
+                events.push_back(std::move(event));
+
+                if (m_config.resetLastOnStorm)
+                {
+                    queue.hasRxPacketsLast = false;
+                    queue.hasDurationLast = false;
+                }
+                isDeadlock = true;
+                queue.detectionTimeLeft = queue.detectionTime;
+            }
+            else
+            {
+                queue.detectionTimeLeft -= pollTime;
+            }
+        }
+        else
+        {
+            if (queue.alert && queue.stormed)
+            {
+                events.push_back({ queue.id, PFC_WD_RESTORE_EVENT, {} });
+            }
+            queue.detectionTimeLeft = queue.detectionTime;
+        }
+    }
+
+    queue.packetsLast = queue.packets;
+    queue.hasPacketsLast = true;
+    if (!isDeadlock || !m_config.resetLastOnStorm)
+    {
+        queue.rxPacketsLast = rxPackets;
+        queue.durationLast = duration;
+        queue.hasRxPacketsLast = true;
+        queue.hasDurationLast = true;
+    }
+}
+
+/* pfc_restore.lua for one queue */
+void PfcWdDetector::restore(Queue &queue, double pollTime, vector<PfcWdDetectorEvent> &events)
+{
+    const Port &port = m_ports[queue.port];
+    const uint8_t priority = queue.index;
+
+    if (!(port.rxValid & (1 << priority)))
+    {
+        return;
+    }
+
+    const double rxPackets = port.rxPackets[priority];
+
+    if (queue.hasRxPacketsLast)
+    {
+        if (rxPackets - queue.rxPacketsLast == 0 && !queue.debugStorm)
+        {
+            if (queue.restorationTimeLeft <= pollTime)
+            {
+                events.push_back({ queue.id, PFC_WD_RESTORE_EVENT, {} });
+                queue.restorationTimeLeft = queue.restorationTime;
+            }
+            else
+            {
+                queue.restorationTimeLeft -= pollTime;
+            }
+        }
+        else
+        {
+            queue.restorationTimeLeft = queue.restorationTime;
+        }
+    }
+
+    queue.rxPacketsLast = rxPackets;
+    queue.hasRxPacketsLast = true;
+}
@@ -0,0 +1,162 @@
+#ifndef SWSS_PFCWDDETECTOR_H
+#define SWSS_PFCWDDETECTOR_H
+
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "dbconnector.h"
+#include "table.h"
+#include "batchtablereader.h"
+
+extern "C" {
+#include "sai.h"
+}
+
+#define PFC_WD_PRIORITY_MAX     8
+
+#define PFC_WD_STORM_EVENT      "storm"
+#define PFC_WD_RESTORE_EVENT    "restore"
+
+/* How the pfc_detect_<platform>.lua plugin of a platform tells a PFC storm from the counters */
+struct PfcWdDetectorConfig
+{
+    /* Port counter with the time a priority was paused, SAI_PORT_STAT_PFC_<priority><durationCounter> */
+    std::string durationCounter;
+    /* Paused for longer than this share of the poll interval */
+    double durationRatio = 0.8;
+    /* A queue with backlog that sent nothing is also in storm when PFC frames were received */
+    bool rxPacketsCondition = true;
+    /* The last PFC counters of a queue are forgotten when a storm is detected on it */
+    bool resetLastOnStorm = true;
+    /* The time measured between two polls is used instead of the poll interval, and published with a storm */
+    bool effectivePollTime = false;
+};
+
+/* The detection of a platform, false when only its plugin has it */
+bool getPfcWdDetectorConfig(const std::string &platform, PfcWdDetectorConfig &config);
+
+struct PfcWdDetectorEvent
+{
+    sai_object_id_t queueId;
+    /* PFC_WD_STORM_EVENT or PFC_WD_RESTORE_EVENT */
+    std::string event;
+    /* What the plugin publishes with the event */
+    std::vector<swss::FieldValueTuple> values;
+};
+
+/*
+ * PfcWdDetector detects in orchagent the PFC storms and their end the PFC
+ * watchdog flex counter plugins detect inside redis at each poll: same
+ * counters, same conditions, same detection and restoration times.
+ *
+ * The plugins read and rewrite the state of every queue in COUNTERS at each
+ * poll. Here queues are kept in one array with their state, COUNTERS is only
+ * read, in one round trip, and a queue is only evaluated when its counters
+ * changed or a storm is being detected or restored on it. The events are returned to the caller,
+ * which handles them as the notifications of the plugins.
+ */
+class PfcWdDetector
+{
+public:
+    PfcWdDetector(swss::DBConnector *countersDb, const PfcWdDetectorConfig &config);
+
+    /* Start or update the detection on a queue, times in microseconds, no restoration when 0 */
+    void addQueue(sai_object_id_t queueId, sai_object_id_t portId, uint8_t index,
+                  uint32_t detectionTime, uint32_t restorationTime, bool alert);
+    void removeQueue(sai_object_id_t queueId);
+    bool hasQueue(sai_object_id_t queueId) const;
+    size_t getQueueCount() const
+    {
+        return m_queues.size();
+    }
+
+    /* A storm action is in place on the queue, PFC_WD_STATUS is not operational */
+    void setStormed(sai_object_id_t queueId, bool stormed);
+    /* The queues are left as they are while BIG_RED_SWITCH mode is on */
+    void setBigRedSwitch(bool enabled)
+    {
+        m_bigRedSwitch = enabled;
+    }
+
+    /*
+     * Read the counters polled at a given time in seconds, and add the storms
+     * detected and restored at this poll to events
+     */
+    void poll(uint32_t intervalMs, double now, std::vector<PfcWdDetectorEvent> &events);
+
+private:
+    struct Queue
+    {
+        sai_object_id_t id;
+        std::string key;
+        size_t port;
+        uint8_t index;
+        bool alert;
+        bool stormed;
+
+        double detectionTime;
+        double restorationTime;
+        double detectionTimeLeft;
+        double restorationTimeLeft;
+
+        /* Counters read at this poll */
+        bool valid;
+        bool debugStorm;
+        double occupancy;
+        double packets;
+
+        /* Counters kept from a previous poll, as <counter>_last by the plugins */
+        bool hasPacketsLast;
+        bool hasRxPacketsLast;
+        bool hasDurationLast;
+        double packetsLast;
+        double rxPacketsLast;
+        double durationLast;
+    };
+
+    struct Port
+    {
+        std::string key;
+        size_t queueCount;
+        /* Priorities whose counters were read at this poll */
+        uint8_t rxValid;
+        uint8_t durationValid;
+        double rxPackets[PFC_WD_PRIORITY_MAX];
+        double duration[PFC_WD_PRIORITY_MAX];
+    };
+
+    PfcWdDetectorConfig m_config;
+    BatchTableReader m_countersReader;
+
+    std::vector<Queue> m_queues;
+    std::unordered_map<sai_object_id_t, size_t> m_queueIndex;
+    std::vector<Port> m_ports;
+    std::unordered_map<sai_object_id_t, size_t> m_portIndex;
+    std::vector<sai_object_id_t> m_portIds;
+
+    /* COUNTERS keys of the ports then of the queues, all read at once at each poll */
+    std::vector<std::string> m_keys;
+    bool m_keysChanged = true;
+    std::vector<std::vector<swss::FieldValueTuple>> m_fvs;
+
+    /* SAI_PORT_STAT_PFC_<priority>_RX_PKTS and the duration counter, by priority */
+    std::vector<std::string> m_rxPacketsFields;
+    std::vector<std::string> m_durationFields;
+
+    bool m_bigRedSwitch = false;
+
+    /* Time of the last poll, for the effective poll time */
+    bool m_hasLastPoll = false;
+    std::string m_lastTimestamp;
+    bool m_hasLastEffectivePollTime = false;
+    double m_lastEffectivePollTime = 0;
+
+    void readCounters();
+    void detect(Queue &queue, double pollTime, const std::vector<swss::FieldValueTuple> &pollInfo,
+                std::vector<PfcWdDetectorEvent> &events);
+    void restore(Queue &queue, double pollTime, std::vector<PfcWdDetectorEvent> &events);
+};
+
+#endif /* SWSS_PFCWDDETECTOR_H */
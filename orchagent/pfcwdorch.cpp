@@ -33,10 +33,30 @@ extern sai_port_api_t *sai_port_api;
 extern sai_queue_api_t *sai_queue_api;
 
 extern event_handle_t g_events_handle;
+extern bool gNativePfcWdDetection;
 
 extern SwitchOrch *gSwitchOrch;
 extern PortsOrch *gPortsOrch;
 
+namespace
+{
+    // The additional info of a storm, as logged and published in the pfc-storm event
+    string serializeEventInfo(const vector<swss::FieldValueTuple> &values)
+    {
+        string info;
+        for (auto &fv : values)
+        {
+            info += fvField(fv) + ":" + fvValue(fv) + "|";
+        }
+        if (!info.empty())
+        {
+            info.pop_back();
+        }
+
+        return info;
+    }
+}
+
 template <typename DropHandler, typename ForwardHandler>
 PfcWdOrch<DropHandler, ForwardHandler>::PfcWdOrch(DBConnector *db, vector<string> &tableNames):
     Orch(db, tableNames),
@@ -590,6 +610,12 @@ bool PfcWdSwOrch<DropHandler, ForwardHandler>::registerInWdDb(const Port& port,
         // Create internal entry
         m_entryMap.emplace(queueId, PfcWdQueueEntry(action, port.m_port_id, i, port.m_alias));
 
+        if (m_detector)
+        {
+            m_detector->addQueue(queueId, port.m_port_id, i, detectionTime * 1000, restorationTime * 1000,
+                                 action == PfcWdAction::PFC_WD_ACTION_ALERT);
+        }
+
         // Initialize PFC WD related counters
         PfcWdActionHandler::initWdCounters(
                 this->getCountersTable(),
@@ -668,6 +694,11 @@ void PfcWdSwOrch<DropHandler, ForwardHandler>::unregisterFromWdDb(const Port& po
 
         m_entryMap.erase(queueId);
 
+        if (m_detector)
+        {
+            m_detector->removeQueue(queueId);
+        }
+
         // Clean up
         string countersKey = this->getCountersTable()->getTableName() + this->getCountersTable()->getTableNameSeparator() + sai_serialize_object_id(queueId);
         this->getCountersDb()->hdel(countersKey, {"PFC_WD_DETECTION_TIME", "PFC_WD_RESTORATION_TIME", "PFC_WD_ACTION", "PFC_WD_STATUS"});
@@ -693,40 +724,79 @@ PfcWdSwOrch<DropHandler, ForwardHandler>::PfcWdSwOrch(
 {
     SWSS_LOG_ENTER();
 
-    string detectSha, restoreSha;
-    string detectPluginName = "pfc_detect_" + this->m_platform + ".lua";
-    string restorePluginName;
     string pollIntervalStr = to_string(m_pollInterval);
-    string plugins;
-    if (this->m_platform == CISCO_8000_PLATFORM_SUBSTRING) {
-        restorePluginName = "pfc_restore_" + this->m_platform + ".lua";
-    } else {
-        restorePluginName = "pfc_restore.lua";
-    }
+    PfcWdDetectorConfig detectorConfig;
 
-    try
+    if (gNativePfcWdDetection && getPfcWdDetectorConfig(this->m_platform, detectorConfig))
     {
-        string detectLuaScript = swss::loadLuaScript(detectPluginName);
-        detectSha = swss::loadRedisScript(
-                this->getCountersDb().get(),
-                detectLuaScript);
+        // The storms are detected by m_detector each time the plugin tells the counters were polled
+        string pollSha;
+        try
+        {
+            string pollLuaScript = swss::loadLuaScript(PFC_WD_POLL_PLUGIN_NAME);
+            pollSha = swss::loadRedisScript(
+                    this->getCountersDb().get(),
+                    pollLuaScript);
+        }
+        catch (...)
+        {
+            SWSS_LOG_WARN("Lua script and polling interval for PFC watchdog were not set successfully");
+        }
+
+        setFlexCounterGroupParameter(PFC_WD_FLEX_COUNTER_GROUP,
+                                     pollIntervalStr,
+                                     STATS_MODE_READ,
+                                     QUEUE_PLUGIN_FIELD,
+                                     pollSha);
 
-        string restoreLuaScript = swss::loadLuaScript(restorePluginName);
-        restoreSha = swss::loadRedisScript(
+        m_detector = make_unique<PfcWdDetector>(this->getCountersDb().get(), detectorConfig);
+        m_detectorPollNotificationConsumer = new swss::NotificationConsumer(
                 this->getCountersDb().get(),
-                restoreLuaScript);
-        plugins = detectSha + "," + restoreSha;
+                PFC_WD_POLL_CHANNEL);
+        SWSS_LOG_NOTICE("Detecting PFC storms in orchagent on platform %s", this->m_platform.c_str());
     }
-    catch (...)
+    else
     {
-        SWSS_LOG_WARN("Lua scripts and polling interval for PFC watchdog were not set successfully");
-    }
+        if (gNativePfcWdDetection)
+        {
+            SWSS_LOG_NOTICE("PFC storms are only detected by the flex counter plugins on platform %s",
+                            this->m_platform.c_str());
+        }
 
-    setFlexCounterGroupParameter(PFC_WD_FLEX_COUNTER_GROUP,
-                                 pollIntervalStr,
-                                 STATS_MODE_READ,
-                                 QUEUE_PLUGIN_FIELD,
-                                 plugins);
+        string detectSha, restoreSha;
+        string detectPluginName = "pfc_detect_" + this->m_platform + ".lua";
+        string restorePluginName;
+        string plugins;
+        if (this->m_platform == CISCO_8000_PLATFORM_SUBSTRING) {
+            restorePluginName = "pfc_restore_" + this->m_platform + ".lua";
+        } else {
+            restorePluginName = "pfc_restore.lua";
+        }
+
+        try
+        {
+            string detectLuaScript = swss::loadLuaScript(detectPluginName);
+            detectSha = swss::loadRedisScript(
+                    this->getCountersDb().get(),
+                    detectLuaScript);
+
+            string restoreLuaScript = swss::loadLuaScript(restorePluginName);
+            restoreSha = swss::loadRedisScript(
+                    this->getCountersDb().get(),
+                    restoreLuaScript);
+            plugins = detectSha + "," + restoreSha;
+        }
+        catch (...)
+        {
+            SWSS_LOG_WARN("Lua scripts and polling interval for PFC watchdog were not set successfully");
+        }
+
+        setFlexCounterGroupParameter(PFC_WD_FLEX_COUNTER_GROUP,
+                                     pollIntervalStr,
+                                     STATS_MODE_READ,
+                                     QUEUE_PLUGIN_FIELD,
+                                     plugins);
+    }
 
     auto consumer = new swss::NotificationConsumer(
             this->getCountersDb().get(),
@@ -740,6 +810,11 @@ PfcWdSwOrch<DropHandler, ForwardHandler>::PfcWdSwOrch(
     Orch::addExecutor(executor);
     timer->start();
 
+    if (m_detectorPollNotificationConsumer)
+    {
+        Orch::addExecutor(new Notifier(m_detectorPollNotificationConsumer, this, "PFC_WD_POLL_NOTIFICATIONS"));
+    }
+
     auto ssTable = new swss::SubscriberStateTable(
             m_applDb.get(), APP_PFC_WD_TABLE_NAME, TableConsumable::DEFAULT_POP_BATCH_SIZE, default_orch_pri);
     auto ssConsumer = new Consumer(ssTable, this, APP_PFC_WD_TABLE_NAME);
@@ -899,26 +974,22 @@ void PfcWdSwOrch<DropHandler, ForwardHandler>::doTask(swss::NotificationConsumer
 {
     SWSS_LOG_ENTER();
 
+    if (&wdNotification == m_detectorPollNotificationConsumer)
+    {
+        doDetectorPollTask(wdNotification);
+        return;
+    }
+
     string queueIdStr;
     string event;
     vector<swss::FieldValueTuple> values;
 
     wdNotification.pop(queueIdStr, event, values);
 
-    string info;
-    for (auto &fv : values)
-    {
-        info += fvField(fv) + ":" + fvValue(fv) + "|";
-    }
-    if (!info.empty())
-    {
-        info.pop_back();
-    }
-
     sai_object_id_t queueId = SAI_NULL_OBJECT_ID;
     sai_deserialize_object_id(queueIdStr, queueId);
 
-    if (!startWdActionOnQueue(event, queueId, info))
+    if (!startWdActionOnQueue(event, queueId, serializeEventInfo(values)))
     {
         SWSS_LOG_ERROR("Failed to start PFC watchdog %s event action on queue %s", event.c_str(), queueIdStr.c_str());
     }
@@ -939,6 +1010,76 @@ void PfcWdSwOrch<DropHandler, ForwardHandler>::doTask(SelectableTimer &timer)
 
 }
 
+template <typename DropHandler, typename ForwardHandler>
+void PfcWdSwOrch<DropHandler, ForwardHandler>::doDetectorPollTask(swss::NotificationConsumer &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    // Only the last poll matters when several were notified since the previous wake-up
+    std::deque<KeyOpFieldsValuesTuple> polls;
+    consumer.pops(polls);
+    if (polls.empty())
+    {
+        return;
+    }
+
+    const auto &poll = polls.back();
+    const auto &timestamp = kfvKey(poll);
+    double now = 0;
+    uint32_t interval = 0;
+
+    try
+    {
+        // The seconds and microseconds of redis TIME, added as the detect plugins do
+        auto dot = timestamp.find('.');
+        now = static_cast<double>(to_uint<uint32_t>(timestamp.substr(0, dot)));
+        if (dot != string::npos)
+        {
+            now += static_cast<double>(to_uint<uint32_t>(timestamp.substr(dot + 1))) / 1000000;
+        }
+
+        for (const auto &fv : kfvFieldsValues(poll))
+        {
+            if (fvField(fv) == "interval")
+            {
+                interval = to_uint<uint32_t>(fvValue(fv));
+            }
+        }
+    }
+    catch (const exception &e)
+    {
+        SWSS_LOG_ERROR("Invalid PFC watchdog poll %s: %s", timestamp.c_str(), e.what());
+        return;
+    }
+
+    pollDetector(now, interval);
+}
+
+template <typename DropHandler, typename ForwardHandler>
+void PfcWdSwOrch<DropHandler, ForwardHandler>::pollDetector(double now, uint32_t intervalMs)
+{
+    SWSS_LOG_ENTER();
+
+    // The plugins read the status of a queue from PFC_WD_STATUS, set while it has a storm action
+    for (const auto &entry : m_entryMap)
+    {
+        m_detector->setStormed(entry.first, entry.second.handler != nullptr);
+    }
+    m_detector->setBigRedSwitch(m_bigRedSwitchFlag);
+
+    vector<PfcWdDetectorEvent> events;
+    m_detector->poll(intervalMs, now, events);
+
+    for (const auto &event : events)
+    {
+        if (!startWdActionOnQueue(event.event, event.queueId, serializeEventInfo(event.values)))
+        {
+            SWSS_LOG_ERROR("Failed to start PFC watchdog %s event action on queue 0x%" PRIx64,
+                           event.event.c_str(), event.queueId);
+        }
+    }
+}
+
 template <typename DropHandler, typename ForwardHandler>
 void PfcWdSwOrch<DropHandler, ForwardHandler>::report_pfc_storm(
         sai_object_id_t id, const PfcWdQueueEntry *entry, const string &info)
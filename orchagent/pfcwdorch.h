@@ -4,6 +4,7 @@
 #include "orch.h"
 #include "port.h"
 #include "pfcactionhandler.h"
+#include "pfcwddetector.h"
 #include "producertable.h"
 #include "notificationconsumer.h"
 #include "timer.h"
@@ -14,6 +15,8 @@ extern "C" {
 }
 
 #define PFC_WD_FLEX_COUNTER_GROUP       "PFC_WD"
+#define PFC_WD_POLL_PLUGIN_NAME         "pfc_wd_poll.lua"
+#define PFC_WD_POLL_CHANNEL             "PFC_WD_POLL"
 
 const string pfc_wd_flex_counter_group = PFC_WD_FLEX_COUNTER_GROUP;
 
@@ -132,6 +135,9 @@ private:
 
     void report_pfc_storm(sai_object_id_t id, const PfcWdQueueEntry *, const string&);
 
+    void doDetectorPollTask(swss::NotificationConsumer &consumer);
+    void pollDetector(double now, uint32_t intervalMs);
+
     map<sai_object_id_t, PfcWdQueueEntry> m_entryMap;
     map<sai_object_id_t, PfcWdQueueEntry> m_brsEntryMap;
 
@@ -142,6 +148,10 @@ private:
     bool m_bigRedSwitchFlag = false;
     int m_pollInterval;
 
+    // Storms detected in orchagent instead of by the flex counter plugins
+    unique_ptr<PfcWdDetector> m_detector;
+    swss::NotificationConsumer *m_detectorPollNotificationConsumer = nullptr;
+
     shared_ptr<DBConnector> m_applDb = nullptr;
     // Track queues in storm
     shared_ptr<Table> m_applTable = nullptr;
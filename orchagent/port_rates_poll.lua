@@ -0,0 +1,16 @@
+-- KEYS - port IDs
+-- ARGV[1] - counters db index
+-- ARGV[2] - counters table name
+-- ARGV[3] - poll time interval
+-- return log
+
+-- Tells orchagent the port counters were polled, so that it computes the
+-- rates from them (orchagent -R native). The rates are computed over the
+-- time between two polls, the interval is only used for the first one.
+
+local timestamp_struct = redis.call('TIME')
+local timestamp = string.format('%d.%06d', tonumber(timestamp_struct[1]), tonumber(timestamp_struct[2]))
+
+redis.call('PUBLISH', 'PORT_RATES_POLL', '["poll","' .. timestamp .. '","interval","' .. ARGV[3] .. '"]')
+
+return {}
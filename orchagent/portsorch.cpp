@@ -18,6 +18,7 @@
 #include <tuple>
 #include <sstream>
 #include <unordered_set>
+#include <chrono>
 
 #include <netinet/if_ether.h>
 #include "net/if.h"
@@ -63,6 +64,8 @@ extern string gMySwitchType;
 extern int32_t gVoqMySwitchId;
 extern string gMyHostName;
 extern string gMyAsicName;
+extern bool gNativeCounterRates;
+extern size_t gMaxBulkSize;
 extern event_handle_t g_events_handle;
 
 // defines ------------------------------------------------------------------------------------------------------------
@@ -560,16 +563,17 @@ PortsOrch::PortsOrch(DBConnector *db, DBConnector *stateDb, vector<table_name_wi
     m_gearboxTable = unique_ptr<Table>(new Table(db, "_GEARBOX_TABLE"));
 
     /* Initialize queue tables */
-    m_queueTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_QUEUE_NAME_MAP));
-    m_voqTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_VOQ_NAME_MAP));
-    m_queuePortTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_QUEUE_PORT_MAP));
-    m_queueIndexTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_QUEUE_INDEX_MAP));
-    m_queueTypeTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_QUEUE_TYPE_MAP));
+    m_counterMapPipeline = unique_ptr<RedisPipeline>(new RedisPipeline(m_counter_db.get()));
+    m_queueTable = unique_ptr<Table>(new Table(m_counterMapPipeline.get(), COUNTERS_QUEUE_NAME_MAP, true));
+    m_voqTable = unique_ptr<Table>(new Table(m_counterMapPipeline.get(), COUNTERS_VOQ_NAME_MAP, true));
+    m_queuePortTable = unique_ptr<Table>(new Table(m_counterMapPipeline.get(), COUNTERS_QUEUE_PORT_MAP, true));
+    m_queueIndexTable = unique_ptr<Table>(new Table(m_counterMapPipeline.get(), COUNTERS_QUEUE_INDEX_MAP, true));
+    m_queueTypeTable = unique_ptr<Table>(new Table(m_counterMapPipeline.get(), COUNTERS_QUEUE_TYPE_MAP, true));
 
     /* Initialize ingress priority group tables */
-    m_pgTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_PG_NAME_MAP));
-    m_pgPortTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_PG_PORT_MAP));
-    m_pgIndexTable = unique_ptr<Table>(new Table(m_counter_db.get(), COUNTERS_PG_INDEX_MAP));
+    m_pgTable = unique_ptr<Table>(new Table(m_counterMapPipeline.get(), COUNTERS_PG_NAME_MAP, true));
+    m_pgPortTable = unique_ptr<Table>(new Table(m_counterMapPipeline.get(), COUNTERS_PG_PORT_MAP, true));
+    m_pgIndexTable = unique_ptr<Table>(new Table(m_counterMapPipeline.get(), COUNTERS_PG_INDEX_MAP, true));
 
     m_state_db = shared_ptr<DBConnector>(new DBConnector("STATE_DB", 0));
     m_stateBufferMaximumValueTable = unique_ptr<Table>(new Table(m_state_db.get(), STATE_BUFFER_MAXIMUM_VALUE_TABLE));
@@ -609,11 +613,37 @@ PortsOrch::PortsOrch(DBConnector *db, DBConnector *stateDb, vector<table_name_wi
                                  PG_PLUGIN_FIELD,
                                  pgWmSha);
 
-    setFlexCounterGroupParameter(PORT_STAT_COUNTER_FLEX_COUNTER_GROUP,
-                                 PORT_RATE_FLEX_COUNTER_POLLING_INTERVAL_MS,
-                                 STATS_MODE_READ,
-                                 PORT_PLUGIN_FIELD,
-                                 portRateSha);
+    if (gNativeCounterRates)
+    {
+        /* The plugin only tells m_portRates the counters were polled, the rates are computed from them here */
+        string portRatesPollSha;
+        try
+        {
+            string portRatesPollLuaScript = swss::loadLuaScript(PORT_RATES_POLL_PLUGIN_NAME);
+            portRatesPollSha = swss::loadRedisScript(m_counter_db.get(), portRatesPollLuaScript);
+        }
+        catch (const runtime_error &e)
+        {
+            SWSS_LOG_ERROR("Port rates poll plugin was not loaded successfully: %s", e.what());
+        }
+
+        setFlexCounterGroupParameter(PORT_STAT_COUNTER_FLEX_COUNTER_GROUP,
+                                     PORT_RATE_FLEX_COUNTER_POLLING_INTERVAL_MS,
+                                     STATS_MODE_READ,
+                                     PORT_PLUGIN_FIELD,
+                                     portRatesPollSha);
+
+        m_portRates = make_unique<RatesEngine>(m_counter_db.get(), getPortRatesConfig());
+        m_portRatesPollNotificationConsumer = new swss::NotificationConsumer(m_counter_db.get(), PORT_RATES_POLL_CHANNEL);
+    }
+    else
+    {
+        setFlexCounterGroupParameter(PORT_STAT_COUNTER_FLEX_COUNTER_GROUP,
+                                     PORT_RATE_FLEX_COUNTER_POLLING_INTERVAL_MS,
+                                     STATS_MODE_READ,
+                                     PORT_PLUGIN_FIELD,
+                                     portRateSha);
+    }
 
     setFlexCounterGroupParameter(PG_DROP_STAT_COUNTER_FLEX_COUNTER_GROUP,
                                  PG_DROP_FLEX_STAT_COUNTER_POLL_MSECS,
@@ -811,6 +841,11 @@ PortsOrch::PortsOrch(DBConnector *db, DBConnector *stateDb, vector<table_name_wi
 
     auto executor = new ExecutableTimer(m_port_state_poller, this, "PORT_STATE_POLLER");
     Orch::addExecutor(executor);
+
+    if (m_portRatesPollNotificationConsumer)
+    {
+        Orch::addExecutor(new Notifier(m_portRatesPollNotificationConsumer, this, "PORT_RATES_POLL_NOTIFICATIONS"));
+    }
 }
 
 void PortsOrch::initializeCpuPort()
@@ -1393,9 +1428,9 @@ bool PortsOrch::isPortAdminUp(const string &alias)
     return it->second.m_admin_state_up;
 }
 
-map<string, Port>& PortsOrch::getAllPorts()
+const map<string, Port>& PortsOrch::getAllPorts()
 {
-    return m_portList;
+    return m_portList.ports();
 }
 
 unordered_set<string>& PortsOrch::getAllVlans()
@@ -1407,36 +1442,61 @@ bool PortsOrch::getPort(string alias, Port &p)
 {
     SWSS_LOG_ENTER();
 
-    if (m_portList.find(alias) == m_portList.end())
+    Port *port = m_portList.lookup(alias);
+    if (!port)
     {
         return false;
     }
-    else
-    {
-        p = m_portList[alias];
-        return true;
-    }
+
+    p = *port;
+    return true;
 }
 
 bool PortsOrch::getPort(sai_object_id_t id, Port &port)
 {
     SWSS_LOG_ENTER();
 
+    Port *p = findPort(id);
+    if (!p)
+    {
+        return false;
+    }
+
+    port = *p;
+    return true;
+}
+
+Port *PortsOrch::findPort(const string &alias)
+{
+    return m_portList.lookup(alias);
+}
+
+Port *PortsOrch::findPort(sai_object_id_t id)
+{
     auto itr = saiOidToAlias.find(id);
     if (itr == saiOidToAlias.end())
     {
-        return false;
+        return nullptr;
     }
-    else
+
+    Port *port = m_portList.lookup(itr->second);
+    if (!port)
     {
-        if (!getPort(itr->second, port))
-        {
-            SWSS_LOG_THROW("Inconsistent saiOidToAlias map and m_portList map: oid=%" PRIx64, id);
-        }
-        return true;
+        SWSS_LOG_THROW("Inconsistent saiOidToAlias map and m_portList map: oid=%" PRIx64, id);
     }
+    return port;
+}
 
-    return false;
+Port *PortsOrch::findPortByBridgePortId(sai_object_id_t bridge_port_id)
+{
+    /* Bridge port OIDs are indexed along with the port OIDs */
+    auto itr = saiOidToAlias.find(bridge_port_id);
+    if (itr == saiOidToAlias.end())
+    {
+        return nullptr;
+    }
+
+    return m_portList.lookup(itr->second);
 }
 
 void PortsOrch::increasePortRefCount(const string &alias)
@@ -1451,6 +1511,20 @@ void PortsOrch::decreasePortRefCount(const string &alias)
     m_port_ref_count[alias]--;
 }
 
+void PortsOrch::increasePortFdbCount(const string &alias)
+{
+    Port *port = m_portList.lookup(alias);
+    assert(port);
+    port->m_fdb_count++;
+}
+
+void PortsOrch::decreasePortFdbCount(const string &alias)
+{
+    Port *port = m_portList.lookup(alias);
+    assert(port);
+    port->m_fdb_count--;
+}
+
 void PortsOrch::increaseBridgePortRefCount(Port &port)
 {
     assert (m_bridge_port_ref_count.find(port.m_alias) != m_bridge_port_ref_count.end());
@@ -1478,13 +1552,13 @@ bool PortsOrch::getPortByBridgePortId(sai_object_id_t bridge_port_id, Port &port
     {
         return false;
     }
-    else
+
+    Port *p = m_portList.lookup(itr->second);
+    if (p)
     {
-        getPort(itr->second, port);
-        return true;
+        port = *p;
     }
-
-    return false;
+    return true;
 }
 
 bool PortsOrch::addSubPort(Port &port, const string &alias, const string &vlan, const bool &adminUp, const uint32_t &mtu)
@@ -3451,6 +3525,7 @@ sai_status_t PortsOrch::removePort(sai_object_id_t port_id)
 
     /* Remove port counters */
     port_stat_manager.clearCounterIdList(port.m_port_id);
+    removePortRates(port);
     port_buffer_drop_stat_manager.clearCounterIdList(port.m_port_id);
 
     /*
@@ -3547,6 +3622,7 @@ bool PortsOrch::initPort(const PortConfig &port)
                     auto port_counter_stats = generateCounterStats(PORT_STAT_COUNTER_FLEX_COUNTER_GROUP);
                     port_stat_manager.setCounterIdList(p.m_port_id,
                             CounterType::PORT, port_counter_stats);
+                    addPortRates(p);
                     auto gbport_counter_stats = generateCounterStats(PORT_STAT_COUNTER_FLEX_COUNTER_GROUP, true);
                     if (p.m_system_side_id)
                         gb_port_stat_manager.setCounterIdList(p.m_system_side_id,
@@ -3617,6 +3693,7 @@ void PortsOrch::deInitPort(string alias, sai_object_id_t port_id)
     if ((flex_counters_orch->getPortCountersState()))
     {
         port_stat_manager.clearCounterIdList(p.m_port_id);
+        removePortRates(p);
     }
 
     if (flex_counters_orch->getPortBufferDropCountersState())
@@ -3943,6 +4020,17 @@ void PortsOrch::doPortTask(Consumer &consumer)
             {
                 std::vector<PortConfig> portsToAddList;
                 std::vector<sai_object_id_t> portsToRemoveList;
+                std::vector<sai_object_id_t> portsToInitList;
+
+                auto phaseStart = std::chrono::steady_clock::now();
+                auto phaseMs = [&phaseStart]()
+                {
+                    auto now = std::chrono::steady_clock::now();
+                    auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(now - phaseStart);
+                    phaseStart = now;
+                    return (int64_t)elapsed.count();
+                };
+                int64_t removeMs = 0, addMs = 0, queryMs = 0, initMs = 0;
 
                 // Port remove comparison logic
                 for (auto it = m_portListLaneMap.begin(); it != m_portListLaneMap.end();)
@@ -3965,13 +4053,33 @@ void PortsOrch::doPortTask(Consumer &consumer)
                         SWSS_LOG_THROW("PortsOrch initialization failure");
                     }
                 }
+                removeMs = phaseMs();
 
                 // Port add comparison logic
+                for (const auto &cit : m_lanesAliasSpeedMap)
+                {
+                    auto lanes = m_portListLaneMap.find(cit.first);
+                    if (lanes == m_portListLaneMap.end())
+                    {
+                        portsToAddList.push_back(cit.second);
+                        continue;
+                    }
+
+                    auto port = m_portList.find(cit.second.key);
+                    if (port == m_portList.end() || port->second.m_port_id != lanes->second)
+                    {
+                        portsToInitList.push_back(lanes->second);
+                    }
+                }
+
+                size_t initCount = portsToInitList.size();
+                prefetchPortAttributes(portsToInitList);
+                queryMs = phaseMs();
+
                 for (auto it = m_lanesAliasSpeedMap.begin(); it != m_lanesAliasSpeedMap.end();)
                 {
                     if (m_portListLaneMap.find(it->first) == m_portListLaneMap.end())
                     {
-                        portsToAddList.push_back(it->second);
                         it++;
                         continue;
                     }
@@ -3988,6 +4096,7 @@ void PortsOrch::doPortTask(Consumer &consumer)
 
                     it++;
                 }
+                initMs = phaseMs();
 
                 // Bulk port add
                 if (!portsToAddList.empty())
@@ -3997,6 +4106,17 @@ void PortsOrch::doPortTask(Consumer &consumer)
                         SWSS_LOG_THROW("PortsOrch initialization failure");
                     }
 
+                    portsToInitList.clear();
+                    for (const auto &cit : portsToAddList)
+                    {
+                        portsToInitList.push_back(m_portListLaneMap[cit.lanes.value]);
+                    }
+                    initCount += portsToInitList.size();
+                    addMs = phaseMs();
+
+                    prefetchPortAttributes(portsToInitList);
+                    queryMs += phaseMs();
+
                     for (const auto &cit : portsToAddList)
                     {
                         if (!initPort(cit))
@@ -4008,6 +4128,19 @@ void PortsOrch::doPortTask(Consumer &consumer)
                         initPortSupportedSpeeds(cit.key, m_portListLaneMap[cit.lanes.value]);
                         initPortSupportedFecModes(cit.key, m_portListLaneMap[cit.lanes.value]);
                     }
+                    initMs += phaseMs();
+                }
+
+                // Drop what was left by the ports which failed to initialize
+                m_prefetchedObjectLists.clear();
+                m_prefetchedMaximumHeadroom.clear();
+
+                if (initCount || !portsToRemoveList.empty())
+                {
+                    SWSS_LOG_NOTICE("Ports brought up in %" PRId64 " ms: removed %zu in %" PRId64 " ms, created %zu in %" PRId64
+                                    " ms, queried attributes in %" PRId64 " ms, initialized %zu in %" PRId64 " ms",
+                                    removeMs + addMs + queryMs + initMs, portsToRemoveList.size(), removeMs,
+                                    portsToAddList.size(), addMs, queryMs, initCount, initMs);
                 }
 
                 setPortConfigState(PORT_CONFIG_DONE);
@@ -5707,10 +5840,169 @@ void PortsOrch::initializeVoqs(Port &port)
     SWSS_LOG_INFO("Get voqs for port %s", port.m_alias.c_str());
 }
 
+void PortsOrch::getPortAttributeBulk(const vector<sai_object_id_t> &portIds, vector<sai_attribute_t> &attrs, vector<sai_status_t> &statuses)
+{
+    SWSS_LOG_ENTER();
+
+    size_t bulk_size = gMaxBulkSize ? gMaxBulkSize : portIds.size();
+    vector<uint32_t> attr_counts;
+    vector<sai_attribute_t *> attr_lists;
+
+    statuses.assign(portIds.size(), SAI_STATUS_NOT_EXECUTED);
+
+    for (size_t begin = 0; begin < portIds.size(); begin += bulk_size)
+    {
+        size_t count = min(bulk_size, portIds.size() - begin);
+        bool   queried = false;
+
+        attr_counts.assign(count, 1);
+        attr_lists.resize(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            attr_lists[i] = &attrs[begin + i];
+        }
+
+        if (m_portBulkGetSupported)
+        {
+            sai_status_t status = sai_bulk_object_get_attribute(gSwitchId, SAI_OBJECT_TYPE_PORT, (uint32_t)count, &portIds[begin],
+                                                                attr_counts.data(), attr_lists.data(),
+                                                                SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR, &statuses[begin]);
+            if ((status == SAI_STATUS_NOT_IMPLEMENTED) || (status == SAI_STATUS_NOT_SUPPORTED))
+            {
+                SWSS_LOG_NOTICE("Bulk get of port attributes is not supported, querying them one port at a time");
+                m_portBulkGetSupported = false;
+            }
+            else
+            {
+                queried = true;
+            }
+        }
+
+        if (!queried)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                statuses[begin + i] = sai_port_api->get_port_attribute(portIds[begin + i], 1, attr_lists[i]);
+            }
+        }
+    }
+}
+
+void PortsOrch::prefetchPortAttributes(const vector<sai_object_id_t> &portIds)
+{
+    SWSS_LOG_ENTER();
+
+    if (portIds.empty() || gMySwitchType == "dpu")
+    {
+        return;
+    }
+
+    /* The number of objects of each list, then the lists */
+    const vector<pair<sai_attr_id_t, sai_attr_id_t>> objectLists = {
+        { SAI_PORT_ATTR_NUMBER_OF_INGRESS_PRIORITY_GROUPS, SAI_PORT_ATTR_INGRESS_PRIORITY_GROUP_LIST },
+        { SAI_PORT_ATTR_QOS_NUMBER_OF_QUEUES, SAI_PORT_ATTR_QOS_QUEUE_LIST },
+        { SAI_PORT_ATTR_QOS_NUMBER_OF_SCHEDULER_GROUPS, SAI_PORT_ATTR_QOS_SCHEDULER_GROUP_LIST },
+    };
+
+    vector<sai_attribute_t> attrs(portIds.size());
+    vector<sai_status_t> statuses;
+
+    for (const auto &objectList : objectLists)
+    {
+        for (auto &attr : attrs)
+        {
+            attr.id = objectList.first;
+        }
+        getPortAttributeBulk(portIds, attrs, statuses);
+
+        vector<sai_object_id_t> listPortIds;
+        vector<sai_attribute_t> listAttrs;
+
+        for (size_t i = 0; i < portIds.size(); i++)
+        {
+            /* A failure is left to the query of the port on its own, which handles it */
+            if (statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                continue;
+            }
+
+            auto &list = m_prefetchedObjectLists[portIds[i]][objectList.second];
+            list.resize(attrs[i].value.u32);
+            if (list.empty())
+            {
+                continue;
+            }
+
+            sai_attribute_t attr;
+            attr.id = objectList.second;
+            attr.value.objlist.count = (uint32_t)list.size();
+            attr.value.objlist.list = list.data();
+
+            listPortIds.push_back(portIds[i]);
+            listAttrs.push_back(attr);
+        }
+
+        getPortAttributeBulk(listPortIds, listAttrs, statuses);
+
+        for (size_t i = 0; i < listPortIds.size(); i++)
+        {
+            if (statuses[i] != SAI_STATUS_SUCCESS)
+            {
+                m_prefetchedObjectLists[listPortIds[i]].erase(objectList.second);
+            }
+        }
+    }
+
+    for (auto &attr : attrs)
+    {
+        attr.id = SAI_PORT_ATTR_QOS_MAXIMUM_HEADROOM_SIZE;
+    }
+    getPortAttributeBulk(portIds, attrs, statuses);
+
+    for (size_t i = 0; i < portIds.size(); i++)
+    {
+        if (statuses[i] == SAI_STATUS_SUCCESS)
+        {
+            m_prefetchedMaximumHeadroom[portIds[i]] = attrs[i].value.u32;
+        }
+    }
+}
+
+bool PortsOrch::takePrefetchedObjectList(sai_object_id_t port_id, sai_attr_id_t attr_id, vector<sai_object_id_t> &list)
+{
+    auto port = m_prefetchedObjectLists.find(port_id);
+    if (port == m_prefetchedObjectLists.end())
+    {
+        return false;
+    }
+
+    auto it = port->second.find(attr_id);
+    if (it == port->second.end())
+    {
+        return false;
+    }
+
+    list.swap(it->second);
+    port->second.erase(it);
+    if (port->second.empty())
+    {
+        m_prefetchedObjectLists.erase(port);
+    }
+
+    return true;
+}
+
 void PortsOrch::initializeQueues(Port &port)
 {
     SWSS_LOG_ENTER();
 
+    if (takePrefetchedObjectList(port.m_port_id, SAI_PORT_ATTR_QOS_QUEUE_LIST, port.m_queue_ids))
+    {
+        port.m_queue_lock.resize(port.m_queue_ids.size());
+        SWSS_LOG_INFO("Get %zu queues for port %s", port.m_queue_ids.size(), port.m_alias.c_str());
+        return;
+    }
+
     sai_attribute_t attr;
     attr.id = SAI_PORT_ATTR_QOS_NUMBER_OF_QUEUES;
     sai_status_t status = sai_port_api->get_port_attribute(port.m_port_id, 1, &attr);
@@ -5756,6 +6048,12 @@ void PortsOrch::initializeSchedulerGroups(Port &port)
     std::vector<sai_object_id_t> scheduler_group_ids;
     SWSS_LOG_ENTER();
 
+    if (takePrefetchedObjectList(port.m_port_id, SAI_PORT_ATTR_QOS_SCHEDULER_GROUP_LIST, scheduler_group_ids))
+    {
+        SWSS_LOG_INFO("Got %zu scheduler groups for port %s", scheduler_group_ids.size(), port.m_alias.c_str());
+        return;
+    }
+
     sai_attribute_t attr;
     attr.id = SAI_PORT_ATTR_QOS_NUMBER_OF_SCHEDULER_GROUPS;
     sai_status_t status = sai_port_api->get_port_attribute(port.m_port_id, 1, &attr);
@@ -5799,6 +6097,12 @@ void PortsOrch::initializePriorityGroups(Port &port)
 {
     SWSS_LOG_ENTER();
 
+    if (takePrefetchedObjectList(port.m_port_id, SAI_PORT_ATTR_INGRESS_PRIORITY_GROUP_LIST, port.m_priority_group_ids))
+    {
+        SWSS_LOG_INFO("Get %zu priority groups for port %s", port.m_priority_group_ids.size(), port.m_alias.c_str());
+        return;
+    }
+
     sai_attribute_t attr;
     attr.id = SAI_PORT_ATTR_NUMBER_OF_INGRESS_PRIORITY_GROUPS;
     sai_status_t status = sai_port_api->get_port_attribute(port.m_port_id, 1, &attr);
@@ -5844,7 +6148,19 @@ void PortsOrch::initializePortBufferMaximumParameters(Port &port)
 
     attr.id = SAI_PORT_ATTR_QOS_MAXIMUM_HEADROOM_SIZE;
 
-    sai_status_t status = sai_port_api->get_port_attribute(port.m_port_id, 1, &attr);
+    sai_status_t status;
+    auto headroom = m_prefetchedMaximumHeadroom.find(port.m_port_id);
+    if (headroom != m_prefetchedMaximumHeadroom.end())
+    {
+        attr.value.u32 = headroom->second;
+        m_prefetchedMaximumHeadroom.erase(headroom);
+        status = SAI_STATUS_SUCCESS;
+    }
+    else
+    {
+        status = sai_port_api->get_port_attribute(port.m_port_id, 1, &attr);
+    }
+
     if (status != SAI_STATUS_SUCCESS)
     {
         SWSS_LOG_NOTICE("Unable to get the maximum headroom for port %s rv:%d, ignored", port.m_alias.c_str(), status);
@@ -7358,6 +7674,7 @@ void PortsOrch::generateQueueMap(map<string, FlexCounterQueueStates> queuesState
             generateQueueMapPerPort(it.second, queuesStateVector.at(it.second.m_alias), true);
         }
     }
+    m_counterMapPipeline->flush();
 
     m_isQueueMapGenerated = true;
 }
@@ -7670,6 +7987,7 @@ void PortsOrch::createPortBufferQueueCounters(const Port &port, string queues, b
     m_queuePortTable->set("", queuePortVector);
     m_queueIndexTable->set("", queueIndexVector);
     m_queueTypeTable->set("", queueTypeVector);
+    m_counterMapPipeline->flush();
 
     CounterCheckOrch::getInstance().addPort(port);
 }
@@ -7725,6 +8043,7 @@ void PortsOrch::removePortBufferQueueCounters(const Port &port, string queues, b
             stopFlexCounterPolling(gSwitchId, key);
         }
     }
+    m_counterMapPipeline->flush();
 
     CounterCheckOrch::getInstance().removePort(port);
 }
@@ -7761,6 +8080,7 @@ void PortsOrch::generatePriorityGroupMap(map<string, FlexCounterPgStates> pgsSta
             generatePriorityGroupMapPerPort(it.second, pgsStateVector.at(it.second.m_alias));
         }
     }
+    m_counterMapPipeline->flush();
 
     m_isPriorityGroupMapGenerated = true;
 }
@@ -7841,6 +8161,7 @@ void PortsOrch::createPortBufferPgCounters(const Port& port, string pgs)
     m_pgTable->set("", pgVector);
     m_pgPortTable->set("", pgPortVector);
     m_pgIndexTable->set("", pgIndexVector);
+    m_counterMapPipeline->flush();
 
     CounterCheckOrch::getInstance().addPort(port);
 }
@@ -8023,6 +8344,7 @@ void PortsOrch::removePortBufferPgCounters(const Port& port, string pgs)
             stopFlexCounterPolling(gSwitchId, key);
         }
     }
+    m_counterMapPipeline->flush();
 
     CounterCheckOrch::getInstance().removePort(port);
 }
@@ -8045,6 +8367,7 @@ void PortsOrch::generatePortCounterMap()
         }
         port_stat_manager.setCounterIdList(it.second.m_port_id,
                 CounterType::PORT, port_counter_stats);
+        addPortRates(it.second);
         if (it.second.m_system_side_id)
             gb_port_stat_manager.setCounterIdList(it.second.m_system_side_id,
                     CounterType::PORT, gbport_counter_stats, it.second.m_switch_id);
@@ -8056,6 +8379,93 @@ void PortsOrch::generatePortCounterMap()
     m_isPortCounterMapGenerated = true;
 }
 
+void PortsOrch::addPortRates(const Port &port)
+{
+    if (m_portRates)
+    {
+        m_portRates->addObject(sai_serialize_object_id(port.m_port_id), port.m_alias);
+    }
+}
+
+void PortsOrch::removePortRates(const Port &port)
+{
+    if (m_portRates)
+    {
+        m_portRates->removeObject(sai_serialize_object_id(port.m_port_id));
+    }
+}
+
+void PortsOrch::doPortRatesPollTask(NotificationConsumer &consumer)
+{
+    SWSS_LOG_ENTER();
+
+    std::deque<KeyOpFieldsValuesTuple> polls;
+    consumer.pops(polls);
+
+    /* The counters were overwritten by each poll, only the last one is left to compute the rates from */
+    if (polls.empty())
+    {
+        return;
+    }
+
+    const auto &poll = polls.back();
+    double timestamp;
+    uint32_t interval = 0;
+
+    try
+    {
+        timestamp = stod(kfvKey(poll));
+        for (const auto &fv : kfvFieldsValues(poll))
+        {
+            if (fvField(fv) == "interval")
+            {
+                interval = to_uint<uint32_t>(fvValue(fv));
+            }
+        }
+    }
+    catch (const exception &e)
+    {
+        SWSS_LOG_ERROR("Invalid port rates poll %s: %s", kfvKey(poll).c_str(), e.what());
+        return;
+    }
+
+    pollPortRates(timestamp, interval);
+}
+
+void PortsOrch::pollPortRates(double timestamp, uint32_t interval_ms)
+{
+    if (m_portRates->getObjectCount() == 0)
+    {
+        return;
+    }
+
+    /* A poll that was notified before the port counters were disabled */
+    auto flex_counters_orch = gDirectory.get<FlexCounterOrch*>();
+    if (!flex_counters_orch->getPortCountersPollingState())
+    {
+        return;
+    }
+
+    /* The lanes and speed of a port may have changed since the last poll */
+    for (const auto &it : m_portListLaneMap)
+    {
+        auto alias = saiOidToAlias.find(it.second);
+        if (alias == saiOidToAlias.end())
+        {
+            continue;
+        }
+
+        Port *port = m_portList.lookup(alias->second);
+        if (port)
+        {
+            m_portRates->setLanes(sai_serialize_object_id(it.second),
+                                  static_cast<uint32_t>(it.first.size()), port->m_speed);
+        }
+    }
+
+    m_portRates->poll(timestamp, interval_ms);
+}
+
 void PortsOrch::generatePortBufferDropCounterMap()
 {
     if (m_isPortBufferDropCounterMapGenerated)
@@ -8091,6 +8501,12 @@ void PortsOrch::doTask(NotificationConsumer &consumer)
 {
     SWSS_LOG_ENTER();
 
+    if (&consumer == m_portRatesPollNotificationConsumer)
+    {
+        doPortRatesPollTask(consumer);
+        return;
+    }
+
     /* Wait for all ports to be initialized */
     if (!allPortsReady())
     {
@@ -15,6 +15,7 @@
 #include "saihelper.h"
 #include "lagid.h"
 #include "flexcounterorch.h"
+#include "ratesengine.h"
 #include "events.h"
 
 #include "port/port_capabilities.h"
@@ -35,6 +36,8 @@
 #define PG_WATERMARK_FLEX_STAT_COUNTER_POLL_MSECS    "60000"
 #define PG_DROP_FLEX_STAT_COUNTER_POLL_MSECS         "10000"
 #define PORT_RATE_FLEX_COUNTER_POLLING_INTERVAL_MS   "1000"
+#define PORT_RATES_POLL_PLUGIN_NAME "port_rates_poll.lua"
+#define PORT_RATES_POLL_CHANNEL "PORT_RATES_POLL"
 
 typedef std::vector<sai_uint32_t> PortSupportedSpeeds;
 typedef std::set<sai_port_fec_mode_t> PortSupportedFecModes;
@@ -122,6 +125,110 @@ struct PortCapability
 
 typedef PortCapability<PortSupportedFecModes> PortFecModeCapability_t;
 
+/*
+ * PortMap is the alias ordered port list of PortsOrch, with a hashed alias
+ * index for lookups. The index is filled by lookup() and points to the map
+ * nodes, which stay in place until erased, so every removal goes through
+ * erase() to drop the index entry. The map itself is only exposed read-only.
+ */
+class PortMap
+{
+public:
+    typedef map<string, Port>::iterator iterator;
+    typedef map<string, Port>::const_iterator const_iterator;
+
+    PortMap() = default;
+
+    /* The index points into this map, copies start with an empty one */
+    PortMap(const PortMap &other) : m_ports(other.m_ports) {}
+
+    PortMap& operator=(const PortMap &other)
+    {
+        m_index.clear();
+        m_ports = other.m_ports;
+        return *this;
+    }
+
+    Port *lookup(const string &alias)
+    {
+        auto idx = m_index.find(alias);
+        if (idx != m_index.end())
+        {
+            return idx->second;
+        }
+
+        auto it = m_ports.find(alias);
+        if (it == m_ports.end())
+        {
+            return nullptr;
+        }
+
+        m_index.emplace(alias, &it->second);
+        return &it->second;
+    }
+
+    Port& operator[](const string &alias)
+    {
+        return m_ports[alias];
+    }
+
+    iterator find(const string &alias)
+    {
+        return m_ports.find(alias);
+    }
+
+    const_iterator find(const string &alias) const
+    {
+        return m_ports.find(alias);
+    }
+
+    iterator begin()
+    {
+        return m_ports.begin();
+    }
+
+    const_iterator begin() const
+    {
+        return m_ports.begin();
+    }
+
+    iterator end()
+    {
+        return m_ports.end();
+    }
+
+    const_iterator end() const
+    {
+        return m_ports.end();
+    }
+
+    size_t size() const
+    {
+        return m_ports.size();
+    }
+
+    size_t erase(const string &alias)
+    {
+        m_index.erase(alias);
+        return m_ports.erase(alias);
+    }
+
+    iterator erase(iterator pos)
+    {
+        m_index.erase(pos->first);
+        return m_ports.erase(pos);
+    }
+
+    const map<string, Port>& ports() const
+    {
+        return m_ports;
+    }
+
+private:
+    map<string, Port> m_ports;
+    unordered_map<string, Port *> m_index;
+};
+
 class PortsOrch : public Orch, public Subject
 {
 public:
@@ -133,7 +240,7 @@ public:
     bool isGearboxEnabled();
     bool isPortAdminUp(const string &alias);
 
-    map<string, Port>& getAllPorts();
+    const map<string, Port>& getAllPorts();
     bool bake() override;
     void cleanPortTable(const vector<string>& keys);
     bool getBridgePort(sai_object_id_t id, Port &port);
@@ -143,6 +250,17 @@ public:
     void increasePortRefCount(const string &alias);
     void decreasePortRefCount(const string &alias);
     bool getPortByBridgePortId(sai_object_id_t bridge_port_id, Port &port);
+    /*
+     * Lookups returning the port in place instead of a copy, or nullptr.
+     * The pointer stays valid until the port is removed, so it must not be
+     * kept across tasks. Updates go through setPort(), or through the
+     * counter helpers below.
+     */
+    Port *findPort(const string &alias);
+    Port *findPort(sai_object_id_t id);
+    Port *findPortByBridgePortId(sai_object_id_t bridge_port_id);
+    void increasePortFdbCount(const string &alias);
+    void decreasePortFdbCount(const string &alias);
     void setPort(string alias, Port port);
     void getCpuPort(Port &port);
     void initHostTxReadyState(Port &port);
@@ -255,6 +373,8 @@ private:
     unique_ptr<Table> m_portTable;
     unique_ptr<Table> m_sendToIngressPortTable;
     unique_ptr<Table> m_gearboxTable;
+    /* The queue and PG name maps are buffered here and flushed once they are all written */
+    unique_ptr<RedisPipeline> m_counterMapPipeline;
     unique_ptr<Table> m_queueTable;
     unique_ptr<Table> m_voqTable;
     unique_ptr<Table> m_queuePortTable;
@@ -322,7 +442,7 @@ private:
     sai_uint32_t m_portCount;
     map<set<uint32_t>, sai_object_id_t> m_portListLaneMap;
     map<set<uint32_t>, PortConfig> m_lanesAliasSpeedMap;
-    map<string, Port> m_portList;
+    PortMap m_portList;
     map<string, Port> m_pluggedModulesPort;
     map<string, vlan_members_t> m_portVlanMember;
     map<string, std::vector<sai_object_id_t>> m_port_voq_ids;
@@ -350,6 +470,15 @@ private:
 
     swss::SelectableTimer *m_port_state_poller = nullptr;
 
+    /* Port rates computed in orchagent instead of by the port_rates.lua plugin */
+    unique_ptr<RatesEngine> m_portRates;
+    NotificationConsumer* m_portRatesPollNotificationConsumer = nullptr;
+
+    void addPortRates(const Port &port);
+    void removePortRates(const Port &port);
+    void doPortRatesPollTask(NotificationConsumer &consumer);
+    void pollPortRates(double timestamp, uint32_t interval_ms);
+
     bool m_cmisModuleAsicSyncSupported = false;
 
     void doTask() override;
@@ -377,6 +506,19 @@ private:
     void initializeSchedulerGroups(Port &port);
     void initializeVoqs(Port &port);
 
+    /*
+     * Object lists and maximum headroom of the ports about to be initialized,
+     * got with one SAI bulk call per attribute for all the ports instead of
+     * one call per port. A port missing here is queried on its own.
+     */
+    map<sai_object_id_t, map<sai_attr_id_t, vector<sai_object_id_t>>> m_prefetchedObjectLists;
+    map<sai_object_id_t, uint32_t> m_prefetchedMaximumHeadroom;
+    bool m_portBulkGetSupported = true;
+
+    void prefetchPortAttributes(const vector<sai_object_id_t> &portIds);
+    void getPortAttributeBulk(const vector<sai_object_id_t> &portIds, vector<sai_attribute_t> &attrs, vector<sai_status_t> &statuses);
+    bool takePrefetchedObjectList(sai_object_id_t port_id, sai_attr_id_t attr_id, vector<sai_object_id_t> &list);
+
     bool addHostIntfs(Port &port, string alias, sai_object_id_t &host_intfs_id);
     bool setHostIntfsStripTag(Port &port, sai_hostif_vlan_tag_t strip);
 
@@ -0,0 +1,491 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ratesengine.h"
+#include "logger.h"
+#include "schema.h"
+
+using namespace std;
+using namespace swss;
+
+#define FEC_CORRECTED_BITS              "SAI_PORT_STAT_IF_IN_FEC_CORRECTED_BITS"
+#define FEC_NOT_CORRECTABLE_FRAMES      "SAI_PORT_STAT_IF_IN_FEC_NOT_CORRECTABLE_FRAMES"
+/* The names port_rates.lua keeps the last FEC counters under */
+#define FEC_CORRECTED_BITS_LAST         "SAI_PORT_STAT_IF_FEC_CORRECTED_BITS_last"
+#define FEC_NOT_CORRECTABLE_FRAMES_LAST "SAI_PORT_STAT_IF_FEC_NOT_CORRECTABLE_FARMES_last"
+#define FEC_PRE_BER_FIELD               "FEC_PRE_BER"
+#define FEC_POST_BER_FIELD              "FEC_POST_BER"
+
+/* Statistical average used for the post FEC BER */
+#define RS_AVERAGE_FRAME_BER            1e-8
+
+RatesConfig getPortRatesConfig()
+{
+    RatesConfig config;
+
+    config.kind = "PORT";
+    config.counters = {
+        "SAI_PORT_STAT_IF_IN_UCAST_PKTS",
+        "SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS",
+        "SAI_PORT_STAT_IF_OUT_UCAST_PKTS",
+        "SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS",
+        "SAI_PORT_STAT_IF_IN_OCTETS",
+        "SAI_PORT_STAT_IF_OUT_OCTETS"
+    };
+    config.rates = {
+        { "RX_BPS", { 4 } },
+        { "RX_PPS", { 0, 1 } },
+        { "TX_BPS", { 5 } },
+        { "TX_PPS", { 2, 3 } }
+    };
+    config.fecBer = true;
+
+    return config;
+}
+
+namespace
+{
+    /* Lua converts strings to numbers with strtod, do the same so the results are identical */
+    bool toNumber(const string &str, double &value)
+    {
+        const char *begin = str.c_str();
+        char *end = nullptr;
+
+        value = strtod(begin, &end);
+        return end != begin;
+    }
+
+    /* How redis stores the numbers it is given by a script */
+    string toString(double value)
+    {
+        char buf[32];
+
+        snprintf(buf, sizeof(buf), "%.17g", value);
+        return buf;
+    }
+
+    double serdesSpeed(uint32_t laneCount, uint32_t speed)
+    {
+        if (laneCount == 0 || speed == 0 || speed % laneCount != 0)
+        {
+            return 0;
+        }
+
+        switch (speed / laneCount)
+        {
+            case 1000:
+                return 1.25e+9;
+            case 10000:
+                return 10.3125e+9;
+            case 25000:
+                return 25.78125e+9;
+            case 50000:
+                return 53.125e+9;
+            case 100000:
+                return 106.25e+9;
+            default:
+                return 0;
+        }
+    }
+
+    template <typename T>
+    void swapRemove(vector<T> &values, size_t idx)
+    {
+        if (idx != values.size() - 1)
+        {
+            values[idx] = std::move(values.back());
+        }
+        values.pop_back();
+    }
+}
+
+RatesEngine::RatesEngine(DBConnector *countersDb, const RatesConfig &config) :
+    m_config(config),
+    m_countersReader(countersDb, COUNTERS_TABLE),
+    m_pipeline(countersDb),
+    m_ratesTable(&m_pipeline, RATES_TABLE_NAME, true),
+    m_counters(config.counters.size()),
+    m_last(config.counters.size()),
+    m_raw(config.counters.size()),
+    m_rates(config.rates.size())
+{
+}
+
+bool RatesEngine::hasObject(const string &oid) const
+{
+    return m_index.find(oid) != m_index.end();
+}
+
+void RatesEngine::addObject(const string &oid, const string &name)
+{
+    SWSS_LOG_ENTER();
+
+    if (hasObject(oid))
+    {
+        return;
+    }
+
+    size_t idx = m_oids.size();
+    m_index[oid] = idx;
+    m_oids.push_back(oid);
+    m_names.push_back(name);
+    m_state.push_back(State::NONE);
+    m_valid.push_back(0);
+
+    for (size_t c = 0; c < m_counters.size(); c++)
+    {
+        m_counters[c].push_back(0);
+        m_last[c].push_back(0);
+        m_raw[c].emplace_back();
+    }
+    for (auto &rate : m_rates)
+    {
+        rate.push_back(0);
+    }
+
+    m_hasFec.push_back(0);
+    m_hasFecLast.push_back(0);
+    m_fecCorrBits.push_back(0);
+    m_fecUncorrFrames.push_back(0);
+    m_fecCorrBitsLast.push_back(0);
+    m_fecUncorrFramesLast.push_back(0);
+    m_fecCorrBitsRaw.emplace_back();
+    m_fecUncorrFramesRaw.emplace_back();
+    m_laneCount.push_back(0);
+    m_serdesSpeed.push_back(0);
+
+    loadState(idx);
+
+    SWSS_LOG_INFO("Computing %s rates of %s %s", m_config.kind.c_str(), name.c_str(), oid.c_str());
+}
+
+void RatesEngine::removeObject(const string &oid)
+{
+    SWSS_LOG_ENTER();
+
+    auto it = m_index.find(oid);
+    if (it == m_index.end())
+    {
+        return;
+    }
+
+    size_t idx = it->second;
+    m_index.erase(it);
+
+    /* The last object takes the place of the removed one */
+    if (idx != m_oids.size() - 1)
+    {
+        m_index[m_oids.back()] = idx;
+    }
+
+    swapRemove(m_oids, idx);
+    swapRemove(m_names, idx);
+    swapRemove(m_state, idx);
+    swapRemove(m_valid, idx);
+
+    for (size_t c = 0; c < m_counters.size(); c++)
+    {
+        swapRemove(m_counters[c], idx);
+        swapRemove(m_last[c], idx);
+        swapRemove(m_raw[c], idx);
+    }
+    for (auto &rate : m_rates)
+    {
+        swapRemove(rate, idx);
+    }
+
+    swapRemove(m_hasFec, idx);
+    swapRemove(m_hasFecLast, idx);
+    swapRemove(m_fecCorrBits, idx);
+    swapRemove(m_fecUncorrFrames, idx);
+    swapRemove(m_fecCorrBitsLast, idx);
+    swapRemove(m_fecUncorrFramesLast, idx);
+    swapRemove(m_fecCorrBitsRaw, idx);
+    swapRemove(m_fecUncorrFramesRaw, idx);
+    swapRemove(m_laneCount, idx);
+    swapRemove(m_serdesSpeed, idx);
+}
+
+void RatesEngine::setLanes(const string &oid, uint32_t laneCount, uint32_t speed)
+{
+    auto it = m_index.find(oid);
+    if (it == m_index.end())
+    {
+        return;
+    }
+
+    m_laneCount[it->second] = laneCount;
+    m_serdesSpeed[it->second] = serdesSpeed(laneCount, speed);
+}
+
+/* Resume from the state a plugin or a previous engine left in RATES */
+void RatesEngine::loadState(size_t idx)
+{
+    const string &oid = m_oids[idx];
+    string value;
+
+    if (!m_ratesTable.hget(oid + ":" + m_config.kind, RATES_INIT_DONE_FIELD, value))
+    {
+        return;
+    }
+
+    State state;
+    if (value == "DONE")
+    {
+        state = State::DONE;
+    }
+    else if (value == "COUNTERS_LAST")
+    {
+        state = State::COUNTERS_LAST;
+    }
+    else
+    {
+        return;
+    }
+
+    vector<FieldValueTuple> fvs;
+    m_ratesTable.get(oid, fvs);
+
+    unordered_map<string, string> fields;
+    for (const auto &fv : fvs)
+    {
+        fields[fvField(fv)] = fvValue(fv);
+    }
+
+    auto lookup = [&fields](const string &field, double &number) {
+        auto it = fields.find(field);
+        return it != fields.end() && toNumber(it->second, number);
+    };
+
+    /* Without the last counters the rates can't be computed, start over */
+    for (size_t c = 0; c < m_config.counters.size(); c++)
+    {
+        if (!lookup(m_config.counters[c] + RATES_LAST_SUFFIX, m_last[c][idx]))
+        {
+            return;
+        }
+    }
+
+    for (size_t r = 0; r < m_config.rates.size(); r++)
+    {
+        if (state == State::DONE && !lookup(m_config.rates[r].first, m_rates[r][idx]))
+        {
+            state = State::COUNTERS_LAST;
+        }
+    }
+
+    m_hasFecLast[idx] = lookup(FEC_CORRECTED_BITS_LAST, m_fecCorrBitsLast[idx]) &&
+                        lookup(FEC_NOT_CORRECTABLE_FRAMES_LAST, m_fecUncorrFramesLast[idx]);
+
+    m_state[idx] = state;
+}
+
+void RatesEngine::readCounters()
+{
+    m_countersReader.get(m_oids, m_fvs);
+
+    for (size_t idx = 0; idx < m_oids.size(); idx++)
+    {
+        const auto &fvs = m_fvs[idx];
+
+        m_valid[idx] = 0;
+        m_hasFec[idx] = 0;
+
+        size_t found = 0;
+        bool corrBits = false;
+        bool uncorrFrames = false;
+
+        for (const auto &fv : fvs)
+        {
+            const auto &field = fvField(fv);
+
+            for (size_t c = 0; c < m_config.counters.size(); c++)
+            {
+                if (field == m_config.counters[c])
+                {
+                    m_raw[c][idx] = fvValue(fv);
+                    toNumber(fvValue(fv), m_counters[c][idx]);
+                    found++;
+                    break;
+                }
+            }
+
+            if (!m_config.fecBer)
+            {
+                continue;
+            }
+
+            if (field == FEC_CORRECTED_BITS)
+            {
+                m_fecCorrBitsRaw[idx] = fvValue(fv);
+                toNumber(fvValue(fv), m_fecCorrBits[idx]);
+                corrBits = true;
+            }
+            else if (field == FEC_NOT_CORRECTABLE_FRAMES)
+            {
+                m_fecUncorrFramesRaw[idx] = fvValue(fv);
+                toNumber(fvValue(fv), m_fecUncorrFrames[idx]);
+                uncorrFrames = true;
+            }
+        }
+
+        m_valid[idx] = found == m_config.counters.size();
+        m_hasFec[idx] = corrBits && uncorrFrames;
+    }
+}
+
+/*
+ * The arithmetic is done in the order of the plugin, so the rates are the
+ * same to the last bit: new = (sum(counters) - sum(last)) * (1000 / delta),
+ * then rate = alpha * new + (1 - alpha) * rate once smoothing started.
+ */
+void RatesEngine::computeRates(double alpha, double delta)
+{
+    const size_t count = m_oids.size();
+    const double scale = 1000 / delta;
+    const double oneMinusAlpha = 1.0 - alpha;
+
+    m_current.resize(count);
+    m_previous.resize(count);
+
+    for (size_t r = 0; r < m_config.rates.size(); r++)
+    {
+        const auto &sources = m_config.rates[r].second;
+        double *rate = m_rates[r].data();
+
+        const double *cur = m_counters[sources[0]].data();
+        const double *last = m_last[sources[0]].data();
+        for (size_t idx = 0; idx < count; idx++)
+        {
+            m_current[idx] = cur[idx];
+            m_previous[idx] = last[idx];
+        }
+        for (size_t s = 1; s < sources.size(); s++)
+        {
+            cur = m_counters[sources[s]].data();
+            last = m_last[sources[s]].data();
+            for (size_t idx = 0; idx < count; idx++)
+            {
+                m_current[idx] += cur[idx];
+                m_previous[idx] += last[idx];
+            }
+        }
+
+        for (size_t idx = 0; idx < count; idx++)
+        {
+            if (!m_valid[idx] || m_state[idx] == State::NONE)
+            {
+                continue;
+            }
+
+            double rateNew = (m_current[idx] - m_previous[idx]) * scale;
+            rate[idx] = m_state[idx] == State::DONE ? alpha * rateNew + oneMinusAlpha * rate[idx] : rateNew;
+        }
+    }
+}
+
+void RatesEngine::writeRates(double delta)
+{
+    vector<FieldValueTuple> fvs;
+
+    for (size_t idx = 0; idx < m_oids.size(); idx++)
+    {
+        if (!m_valid[idx])
+        {
+            continue;
+        }
+
+        fvs.clear();
+
+        if (m_state[idx] != State::NONE)
+        {
+            for (size_t r = 0; r < m_config.rates.size(); r++)
+            {
+                fvs.emplace_back(m_config.rates[r].first, toString(m_rates[r][idx]));
+            }
+        }
+
+        for (size_t c = 0; c < m_config.counters.size(); c++)
+        {
+            fvs.emplace_back(m_config.counters[c] + RATES_LAST_SUFFIX, m_raw[c][idx]);
+            m_last[c][idx] = m_counters[c][idx];
+        }
+
+        /*
+         * The BER is -1 until the counters were read twice. The plugin fails
+         * when it has no last FEC counters to compute it from, the BER is
+         * left at -1 instead.
+         */
+        if (m_hasFec[idx])
+        {
+            double preBer = -1;
+            double postBer = -1;
+
+            if (m_state[idx] != State::NONE && m_hasFecLast[idx])
+            {
+                double serdesRateTotal = m_laneCount[idx] * m_serdesSpeed[idx] * delta / 1000;
+
+                preBer = (m_fecCorrBits[idx] - m_fecCorrBitsLast[idx]) / serdesRateTotal;
+                postBer = (m_fecUncorrFrames[idx] - m_fecUncorrFramesLast[idx]) * RS_AVERAGE_FRAME_BER / serdesRateTotal;
+            }
+
+            fvs.emplace_back(FEC_CORRECTED_BITS_LAST, m_fecCorrBitsRaw[idx]);
+            fvs.emplace_back(FEC_NOT_CORRECTABLE_FRAMES_LAST, m_fecUncorrFramesRaw[idx]);
+            fvs.emplace_back(FEC_PRE_BER_FIELD, toString(preBer));
+            fvs.emplace_back(FEC_POST_BER_FIELD, toString(postBer));
+
+            m_fecCorrBitsLast[idx] = m_fecCorrBits[idx];
+            m_fecUncorrFramesLast[idx] = m_fecUncorrFrames[idx];
+            m_hasFecLast[idx] = 1;
+        }
+
+        m_ratesTable.set(m_oids[idx], fvs);
+
+        if (m_state[idx] == State::NONE)
+        {
+            m_ratesTable.set(m_oids[idx] + ":" + m_config.kind, { { RATES_INIT_DONE_FIELD, "COUNTERS_LAST" } });
+            m_state[idx] = State::COUNTERS_LAST;
+        }
+        else if (m_state[idx] == State::COUNTERS_LAST)
+        {
+            m_ratesTable.set(m_oids[idx] + ":" + m_config.kind, { { RATES_INIT_DONE_FIELD, "DONE" } });
+            m_state[idx] = State::DONE;
+        }
+    }
+
+    m_ratesTable.flush();
+}
+
+void RatesEngine::poll(double timestamp, uint32_t intervalMs)
+{
+    SWSS_LOG_ENTER();
+
+    if (m_oids.empty())
+    {
+        return;
+    }
+
+    /* The rates are computed over the time since the last counters were read */
+    double delta = m_hasLastPoll ? (timestamp - m_lastPoll) * 1000 : static_cast<double>(intervalMs);
+    if (delta <= 0)
+    {
+        SWSS_LOG_INFO("Ignored %s poll at %f, not after the previous one at %f",
+                      m_config.kind.c_str(), timestamp, m_lastPoll);
+        return;
+    }
+
+    string value;
+    double alpha;
+    if (!m_ratesTable.hget(m_config.kind, m_config.kind + "_ALPHA", value) || !toNumber(value, alpha))
+    {
+        SWSS_LOG_DEBUG("%s_ALPHA is not defined", m_config.kind.c_str());
+        return;
+    }
+
+    readCounters();
+    computeRates(alpha, delta);
+    writeRates(delta);
+
+    m_hasLastPoll = true;
+    m_lastPoll = timestamp;
+}
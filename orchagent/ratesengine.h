@@ -0,0 +1,127 @@
+#ifndef SWSS_RATESENGINE_H
+#define SWSS_RATESENGINE_H
+
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "batchtablereader.h"
+#include "dbconnector.h"
+#include "redispipeline.h"
+#include "table.h"
+
+#define RATES_TABLE_NAME            "RATES"
+#define RATES_INIT_DONE_FIELD       "INIT_DONE"
+#define RATES_LAST_SUFFIX           "_last"
+
+/* What the rates of one kind of counter object are computed from */
+struct RatesConfig
+{
+    /* RATES:<kind> holds <kind>_ALPHA, RATES:<oid>:<kind> holds INIT_DONE */
+    std::string kind;
+    /* COUNTERS fields read at each poll, kept in RATES:<oid> as <field>_last */
+    std::vector<std::string> counters;
+    /* The RATES fields and the indexes of the counters summed into each of them */
+    std::vector<std::pair<std::string, std::vector<size_t>>> rates;
+    /* Also compute FEC_PRE_BER and FEC_POST_BER from the FEC counters */
+    bool fecBer = false;
+};
+
+/* The rates computed by port_rates.lua */
+RatesConfig getPortRatesConfig();
+
+/*
+ * RatesEngine computes in orchagent the RATES the rates flex counter plugins
+ * compute inside redis at each poll: same fields, smoothed with the same
+ * <kind>_ALPHA over the same poll interval, with the same arithmetic.
+ *
+ * The plugins look up each object with a scan of the counter name map and
+ * keep their whole state in RATES. Here objects are indexed by OID, counters
+ * and rates are kept in contiguous arrays, one per field, the counters of all
+ * the objects are read in one round trip and RATES is only written. The
+ * state left in RATES by a plugin is picked up when an object is added, so
+ * the plugin and the engine can take over from each other.
+ */
+class RatesEngine
+{
+public:
+    RatesEngine(swss::DBConnector *countersDb, const RatesConfig &config);
+
+    /* Start or stop computing the rates of an object, by serialized OID */
+    void addObject(const std::string &oid, const std::string &name);
+    void removeObject(const std::string &oid);
+    bool hasObject(const std::string &oid) const;
+    size_t getObjectCount() const
+    {
+        return m_oids.size();
+    }
+
+    /* Lane count and speed in Mbps of a port, used for the FEC BER */
+    void setLanes(const std::string &oid, uint32_t laneCount, uint32_t speed);
+
+    /*
+     * Read the counters polled at timestamp, in seconds, compute the rates over
+     * the time since the previous poll and write them to RATES. The previous
+     * poll is taken intervalMs before the first one. A poll that is not newer
+     * than the previous one is ignored.
+     */
+    void poll(double timestamp, uint32_t intervalMs);
+
+private:
+    enum class State : uint8_t
+    {
+        NONE,
+        COUNTERS_LAST,
+        DONE
+    };
+
+    RatesConfig m_config;
+
+    BatchTableReader m_countersReader;
+    swss::RedisPipeline m_pipeline;
+    swss::Table m_ratesTable;
+
+    /* OID to index in the arrays below */
+    std::unordered_map<std::string, size_t> m_index;
+    std::vector<std::string> m_oids;
+    std::vector<std::string> m_names;
+    std::vector<State> m_state;
+    /* The counters read at this poll */
+    std::vector<std::vector<swss::FieldValueTuple>> m_fvs;
+    /* All the counters were read at this poll */
+    std::vector<uint8_t> m_valid;
+
+    /* Per counter, then per object */
+    std::vector<std::vector<double>> m_counters;
+    std::vector<std::vector<double>> m_last;
+    std::vector<std::vector<std::string>> m_raw;
+
+    /* Per rate, then per object */
+    std::vector<std::vector<double>> m_rates;
+    std::vector<double> m_current;
+    std::vector<double> m_previous;
+
+    /* FEC counters, per object */
+    std::vector<uint8_t> m_hasFec;
+    std::vector<uint8_t> m_hasFecLast;
+    std::vector<double> m_fecCorrBits;
+    std::vector<double> m_fecUncorrFrames;
+    std::vector<double> m_fecCorrBitsLast;
+    std::vector<double> m_fecUncorrFramesLast;
+    std::vector<std::string> m_fecCorrBitsRaw;
+    std::vector<std::string> m_fecUncorrFramesRaw;
+    std::vector<double> m_laneCount;
+    std::vector<double> m_serdesSpeed;
+
+    bool m_hasLastPoll = false;
+    double m_lastPoll = 0;
+
+    void loadState(size_t idx);
+    void readCounters();
+    void computeRates(double alpha, double delta);
+    void writeRates(double delta);
+};
+
+#endif /* SWSS_RATESENGINE_H */
@@ -1,10 +1,15 @@
 #include "response_publisher.h"
 
+#include <algorithm>
+#include <atomic>
 #include <fstream>
+#include <map>
 #include <memory>
 #include <string>
 #include <vector>
 
+#include "logger.h"
+
 namespace
 {
 
@@ -28,147 +33,187 @@ std::string PrependedComponent(const ReturnCode &status)
     return kOrchagentComponent;
 }
 
-void RecordDBWrite(const std::string &table, const std::string &key, const std::vector<swss::FieldValueTuple> &attrs,
-                   const std::string &op)
+std::string DumpRecord(const std::string &table, const std::string &key,
+                       const std::vector<swss::FieldValueTuple> &attrs, const std::string &op)
 {
-    if (!swss::Recorder::Instance().respub.isRecord())
-    {
-        return;
-    }
-
     std::string s = table + ":" + key + "|" + op;
     for (const auto &attr : attrs)
     {
         s += "|" + fvField(attr) + ":" + fvValue(attr);
     }
+    return s;
+}
 
-    swss::Recorder::Instance().respub.record(s);
+void RecordDBWrite(const std::string &table, const std::string &key, const std::vector<swss::FieldValueTuple> &attrs,
+                   const std::string &op)
+{
+    swss::Recorder::Instance().respub.record([&]() { return DumpRecord(table, key, attrs, op); });
 }
 
 void RecordResponse(const std::string &response_channel, const std::string &key,
                     const std::vector<swss::FieldValueTuple> &attrs, const std::string &status)
 {
-    if (!swss::Recorder::Instance().respub.isRecord())
-    {
-        return;
-    }
+    swss::Recorder::Instance().respub.record([&]() { return DumpRecord(response_channel, key, attrs, status); });
+}
 
-    std::string s = response_channel + ":" + key + "|" + status;
-    for (const auto &attr : attrs)
-    {
-        s += "|" + fvField(attr) + ":" + fvValue(attr);
-    }
+// Services by DB name, a service lives as long as a publisher holds it.
+std::mutex gServicesLock;
+std::map<std::string, std::weak_ptr<ResponsePublisherService>> gServices;
 
-    swss::Recorder::Instance().respub.record(s);
-}
+std::atomic<bool> gDeferredFlush{false};
 
 } // namespace
 
-ResponsePublisher::ResponsePublisher(const std::string &dbName, bool buffered, bool db_write_thread)
-    : m_db(std::make_unique<swss::DBConnector>(dbName, 0)), m_buffered(buffered)
+ResponsePublisherService::ResponsePublisherService(const std::string &dbName)
+    : m_dbName(dbName), m_db(std::make_unique<swss::DBConnector>(dbName, 0)),
+      m_pipe(std::make_unique<swss::RedisPipeline>(m_db.get()))
 {
-    if (m_buffered)
-    {
-        m_ntf_pipe = std::make_unique<swss::RedisPipeline>(m_db.get());
-        m_db_pipe = std::make_unique<swss::RedisPipeline>(m_db.get());
-    }
-    else
-    {
-        m_ntf_pipe = std::make_unique<swss::RedisPipeline>(m_db.get(), 1);
-        m_db_pipe = std::make_unique<swss::RedisPipeline>(m_db.get(), 1);
-    }
-    if (db_write_thread)
-    {
-        m_update_thread = std::unique_ptr<std::thread>(new std::thread(&ResponsePublisher::dbUpdateThread, this));
-    }
 }
 
-ResponsePublisher::~ResponsePublisher()
+ResponsePublisherService::~ResponsePublisherService()
 {
+    flush(/*wait=*/false);
     if (m_update_thread != nullptr)
     {
         {
             std::lock_guard<std::mutex> lock(m_lock);
-            m_queue.emplace(/*table=*/"", /*key=*/"", /*values =*/std::vector<swss::FieldValueTuple>{}, /*op=*/"",
-                            /*replace=*/false, /*flush=*/false, /*shutdown=*/true);
+            m_shutdown = true;
         }
         m_signal.notify_one();
         m_update_thread->join();
     }
 }
 
-void ResponsePublisher::publish(const std::string &table, const std::string &key,
-                                const std::vector<swss::FieldValueTuple> &intent_attrs, const ReturnCode &status,
-                                const std::vector<swss::FieldValueTuple> &state_attrs, bool replace)
+std::shared_ptr<ResponsePublisherService> ResponsePublisherService::getInstance(const std::string &dbName)
 {
-    std::string response_channel = "APPL_DB_" + table + "_RESPONSE_CHANNEL";
-    swss::NotificationProducer notificationProducer{m_ntf_pipe.get(), response_channel, m_buffered};
+    std::lock_guard<std::mutex> lock(gServicesLock);
 
-    auto intent_attrs_copy = intent_attrs;
-    // Add error message as the first field-value-pair.
-    swss::FieldValueTuple err_str("err_str", PrependedComponent(status) + status.message());
-    intent_attrs_copy.insert(intent_attrs_copy.begin(), err_str);
-    // Sends the response to the notification channel.
-    notificationProducer.send(status.codeStr(), key, intent_attrs_copy);
-    RecordResponse(response_channel, key, intent_attrs_copy, status.codeStr());
+    auto service = gServices[dbName].lock();
+    if (service == nullptr)
+    {
+        service = std::make_shared<ResponsePublisherService>(dbName);
+        gServices[dbName] = service;
+    }
+    return service;
+}
 
-    // Write to the DB only if:
-    // 1) A write operation is being performed and state attributes are specified.
-    // 2) A successful delete operation.
-    if ((intent_attrs.size() && state_attrs.size()) || (status.ok() && !intent_attrs.size()))
+void ResponsePublisherService::flushAll()
+{
+    std::vector<std::shared_ptr<ResponsePublisherService>> services;
     {
-        writeToDB(table, key, state_attrs, intent_attrs.size() ? SET_COMMAND : DEL_COMMAND, replace);
+        std::lock_guard<std::mutex> lock(gServicesLock);
+        for (const auto &it : gServices)
+        {
+            auto service = it.second.lock();
+            if (service != nullptr)
+            {
+                services.push_back(service);
+            }
+        }
+    }
+
+    for (const auto &service : services)
+    {
+        service->flush(/*wait=*/false);
     }
 }
 
-void ResponsePublisher::publish(const std::string &table, const std::string &key,
-                                const std::vector<swss::FieldValueTuple> &intent_attrs, const ReturnCode &status,
-                                bool replace)
+void ResponsePublisherService::notify(const std::string &channel, const std::string &op, const std::string &key,
+                                      const std::vector<swss::FieldValueTuple> &values)
 {
-    // If status is OK then intent attributes need to be written in
-    // APPL_STATE_DB. In this case, pass the intent attributes as state
-    // attributes. In case of a failure status, nothing needs to be written in
-    // APPL_STATE_DB.
-    std::vector<swss::FieldValueTuple> state_attrs;
-    if (status.ok())
+    std::lock_guard<std::mutex> lock(m_lock);
+    m_notifications.push_back({channel, op, key, values});
+}
+
+void ResponsePublisherService::write(const std::string &table, const std::string &key,
+                                     const std::vector<swss::FieldValueTuple> &values, const std::string &op,
+                                     bool replace)
+{
+    entry e{table, key, values, op, replace};
+    // The placeholder of an empty entry is merged like any attribute, so a
+    // coalesced write leaves the same fields as the writes it replaces.
+    if (op == SET_COMMAND && e.values.empty())
     {
-        state_attrs = intent_attrs;
+        e.values.emplace_back("NULL", "NULL");
+    }
+
+    std::lock_guard<std::mutex> lock(m_lock);
+
+    auto index = m_entryIndex.find(table + ":" + key);
+    if (index == m_entryIndex.end())
+    {
+        m_entryIndex.emplace(table + ":" + key, m_entries.size());
+        m_entries.push_back(std::move(e));
+        return;
+    }
+
+    auto &pending = m_entries[index->second];
+    if (op == DEL_COMMAND || replace)
+    {
+        pending = std::move(e);
+    }
+    else if (pending.op == DEL_COMMAND)
+    {
+        // Delete followed by set is a replace
+        e.replace = true;
+        pending = std::move(e);
+    }
+    else
+    {
+        for (auto &fv : e.values)
+        {
+            auto it = std::find_if(pending.values.begin(), pending.values.end(),
+                                   [&](const swss::FieldValueTuple &p) { return fvField(p) == fvField(fv); });
+            if (it == pending.values.end())
+            {
+                pending.values.push_back(std::move(fv));
+            }
+            else
+            {
+                fvValue(*it) = std::move(fvValue(fv));
+            }
+        }
     }
-    publish(table, key, intent_attrs, status, state_attrs, replace);
 }
 
-void ResponsePublisher::writeToDB(const std::string &table, const std::string &key,
-                                  const std::vector<swss::FieldValueTuple> &values, const std::string &op, bool replace)
+void ResponsePublisherService::flush(bool wait)
 {
-    if (m_update_thread != nullptr)
+    std::unique_lock<std::mutex> lock(m_lock);
+
+    if (!m_notifications.empty() || !m_entries.empty())
     {
+        m_batches.push({std::move(m_notifications), std::move(m_entries), ++m_queued});
+        m_notifications.clear();
+        m_entries.clear();
+        m_entryIndex.clear();
+
+        if (m_update_thread == nullptr)
         {
-            std::lock_guard<std::mutex> lock(m_lock);
-            m_queue.emplace(table, key, values, op, replace, /*flush=*/false, /*shutdown=*/false);
+            m_update_thread =
+                std::unique_ptr<std::thread>(new std::thread(&ResponsePublisherService::dbUpdateThread, this));
         }
         m_signal.notify_one();
     }
-    else
+
+    if (wait)
     {
-        writeToDBInternal(table, key, values, op, replace);
+        uint64_t queued = m_queued;
+        m_sentSignal.wait(lock, [&]() { return m_sent >= queued; });
     }
-    RecordDBWrite(table, key, values, op);
 }
 
-void ResponsePublisher::writeToDBInternal(const std::string &table, const std::string &key,
-                                          const std::vector<swss::FieldValueTuple> &values, const std::string &op,
-                                          bool replace)
+void ResponsePublisherService::writeToDBInternal(const entry &e)
 {
-    swss::Table applStateTable{m_db_pipe.get(), table, m_buffered};
+    swss::Table applStateTable{m_pipe.get(), e.table, /*buffered=*/true};
 
-    auto attrs = values;
-    if (op == SET_COMMAND)
+    auto attrs = e.values;
+    if (e.op == SET_COMMAND)
     {
-        if (replace)
+        if (e.replace)
         {
-            applStateTable.del(key);
+            applStateTable.del(e.key);
         }
-        if (!values.size())
+        if (!attrs.size())
         {
             attrs.push_back(swss::FieldValueTuple("NULL", "NULL"));
         }
@@ -176,9 +221,9 @@ void ResponsePublisher::writeToDBInternal(const std::string &table, const std::s
         // Write to DB only if the key does not exist or non-NULL attributes are
         // being written to the entry.
         std::vector<swss::FieldValueTuple> fv;
-        if (!applStateTable.get(key, fv))
+        if (!applStateTable.get(e.key, fv))
         {
-            applStateTable.set(key, attrs);
+            applStateTable.set(e.key, attrs);
             return;
         }
         for (auto it = attrs.cbegin(); it != attrs.cend();)
@@ -194,64 +239,140 @@ void ResponsePublisher::writeToDBInternal(const std::string &table, const std::s
         }
         if (attrs.size())
         {
-            applStateTable.set(key, attrs);
+            applStateTable.set(e.key, attrs);
         }
     }
-    else if (op == DEL_COMMAND)
+    else if (e.op == DEL_COMMAND)
     {
-        applStateTable.del(key);
+        applStateTable.del(e.key);
     }
 }
 
-void ResponsePublisher::flush()
+void ResponsePublisherService::dbUpdateThread()
 {
-    m_ntf_pipe->flush();
-    if (m_update_thread != nullptr)
+    while (true)
     {
+        batch b;
+        {
+            std::unique_lock<std::mutex> lock(m_lock);
+            m_signal.wait(lock, [&]() { return !m_batches.empty() || m_shutdown; });
+            if (m_batches.empty())
+            {
+                break;
+            }
+
+            b = std::move(m_batches.front());
+            m_batches.pop();
+        }
+
+        try
+        {
+            for (const auto &n : b.notifications)
+            {
+                swss::NotificationProducer notificationProducer{m_pipe.get(), n.channel, /*buffered=*/true};
+                notificationProducer.send(n.op, n.key, n.values);
+            }
+            for (const auto &e : b.entries)
+            {
+                writeToDBInternal(e);
+            }
+            m_pipe->flush();
+        }
+        catch (const std::exception &e)
+        {
+            SWSS_LOG_ERROR("Failed to send %zu responses and %zu writes to %s: %s", b.notifications.size(),
+                           b.entries.size(), m_dbName.c_str(), e.what());
+        }
+
         {
             std::lock_guard<std::mutex> lock(m_lock);
-            m_queue.emplace(/*table=*/"", /*key=*/"", /*values =*/std::vector<swss::FieldValueTuple>{}, /*op=*/"",
-                            /*replace=*/false, /*flush=*/true, /*shutdown=*/false);
+            m_sent = b.id;
         }
-        m_signal.notify_one();
+        m_sentSignal.notify_all();
     }
-    else
+}
+
+ResponsePublisher::ResponsePublisher(const std::string &dbName, bool buffered)
+    : m_service(ResponsePublisherService::getInstance(dbName)), m_buffered(buffered)
+{
+}
+
+ResponsePublisher::~ResponsePublisher()
+{
+    flush();
+}
+
+void ResponsePublisher::publish(const std::string &table, const std::string &key,
+                                const std::vector<swss::FieldValueTuple> &intent_attrs, const ReturnCode &status,
+                                const std::vector<swss::FieldValueTuple> &state_attrs, bool replace)
+{
+    std::string response_channel = "APPL_DB_" + table + "_RESPONSE_CHANNEL";
+
+    auto intent_attrs_copy = intent_attrs;
+    // Add error message as the first field-value-pair.
+    swss::FieldValueTuple err_str("err_str", PrependedComponent(status) + status.message());
+    intent_attrs_copy.insert(intent_attrs_copy.begin(), err_str);
+    // Sends the response to the notification channel.
+    m_service->notify(response_channel, status.codeStr(), key, intent_attrs_copy);
+    RecordResponse(response_channel, key, intent_attrs_copy, status.codeStr());
+
+    // Write to the DB only if:
+    // 1) A write operation is being performed and state attributes are specified.
+    // 2) A successful delete operation.
+    if ((intent_attrs.size() && state_attrs.size()) || (status.ok() && !intent_attrs.size()))
     {
-        m_db_pipe->flush();
+        writeToDB(table, key, state_attrs, intent_attrs.size() ? SET_COMMAND : DEL_COMMAND, replace);
+    }
+    else if (!m_buffered && !gDeferredFlush)
+    {
+        m_service->flush(/*wait=*/true);
+    }
+}
+
+void ResponsePublisher::publish(const std::string &table, const std::string &key,
+                                const std::vector<swss::FieldValueTuple> &intent_attrs, const ReturnCode &status,
+                                bool replace)
+{
+    // If status is OK then intent attributes need to be written in
+    // APPL_STATE_DB. In this case, pass the intent attributes as state
+    // attributes. In case of a failure status, nothing needs to be written in
+    // APPL_STATE_DB.
+    std::vector<swss::FieldValueTuple> state_attrs;
+    if (status.ok())
+    {
+        state_attrs = intent_attrs;
+    }
+    publish(table, key, intent_attrs, status, state_attrs, replace);
+}
+
+void ResponsePublisher::writeToDB(const std::string &table, const std::string &key,
+                                  const std::vector<swss::FieldValueTuple> &values, const std::string &op, bool replace)
+{
+    m_service->write(table, key, values, op, replace);
+    RecordDBWrite(table, key, values, op);
+
+    if (!m_buffered && !gDeferredFlush)
+    {
+        m_service->flush(/*wait=*/true);
     }
 }
 
+void ResponsePublisher::flush()
+{
+    m_service->flush(/*wait=*/!gDeferredFlush);
+}
+
 void ResponsePublisher::setBuffered(bool buffered)
 {
     m_buffered = buffered;
 }
 
-void ResponsePublisher::dbUpdateThread()
+void ResponsePublisher::flushAll()
 {
-    while (true)
-    {
-        entry e;
-        {
-            std::unique_lock<std::mutex> lock(m_lock);
-            while (m_queue.empty())
-            {
-                m_signal.wait(lock);
-            }
+    ResponsePublisherService::flushAll();
+}
 
-            e = m_queue.front();
-            m_queue.pop();
-        }
-        if (e.shutdown)
-        {
-            break;
-        }
-        if (e.flush)
-        {
-            m_db_pipe->flush();
-        }
-        else
-        {
-            writeToDBInternal(e.table, e.key, e.values, e.op, e.replace);
-        }
-    }
+void ResponsePublisher::setDeferredFlush(bool deferred)
+{
+    gDeferredFlush = deferred;
 }
@@ -15,13 +15,96 @@
 #include "response_publisher_interface.h"
 #include "table.h"
 
+// The notifications and DB writes of all the ResponsePublishers for the same DB
+// go through one ResponsePublisherService. It owns a single redis pipeline, which
+// is only used by its writer thread.
+//
+// Responses are collected in a flush window. A flush hands them to the writer
+// thread as one batch. Notifications are all sent, in order. Writes to the same
+// key within the window are coalesced into one, so only the last status is written.
+class ResponsePublisherService
+{
+  public:
+    explicit ResponsePublisherService(const std::string &dbName);
+
+    ~ResponsePublisherService();
+
+    // Returns the service for the DB, created when no publisher holds it.
+    static std::shared_ptr<ResponsePublisherService> getInstance(const std::string &dbName);
+
+    // Flushes the services of all the DBs without waiting.
+    static void flushAll();
+
+    void notify(const std::string &channel, const std::string &op, const std::string &key,
+                const std::vector<swss::FieldValueTuple> &values);
+
+    void write(const std::string &table, const std::string &key, const std::vector<swss::FieldValueTuple> &values,
+               const std::string &op, bool replace);
+
+    /**
+     * @brief Hand the responses of the flush window to the writer thread
+     *
+     * @param wait Flag whether to wait until all responses queued so far are sent
+     */
+    void flush(bool wait);
+
+  private:
+    struct notification
+    {
+        std::string channel;
+        std::string op;
+        std::string key;
+        std::vector<swss::FieldValueTuple> values;
+    };
+
+    struct entry
+    {
+        std::string table;
+        std::string key;
+        std::vector<swss::FieldValueTuple> values;
+        std::string op;
+        bool replace;
+    };
+
+    struct batch
+    {
+        std::vector<notification> notifications;
+        std::vector<entry> entries;
+        uint64_t id;
+    };
+
+    void dbUpdateThread();
+    void writeToDBInternal(const entry &e);
+
+    std::string m_dbName;
+    std::unique_ptr<swss::DBConnector> m_db;
+    std::unique_ptr<swss::RedisPipeline> m_pipe;
+
+    // Flush window, key of m_entryIndex is <table>:<key>
+    std::vector<notification> m_notifications;
+    std::vector<entry> m_entries;
+    std::unordered_map<std::string, size_t> m_entryIndex;
+
+    // Thread to send the batches, started by the first flush.
+    std::unique_ptr<std::thread> m_update_thread;
+    std::queue<batch> m_batches;
+    uint64_t m_queued{0};
+    uint64_t m_sent{0};
+    bool m_shutdown{false};
+    std::mutex m_lock;
+    std::condition_variable m_signal;
+    std::condition_variable m_sentSignal;
+};
+
 // This class performs two tasks when publish is called:
 // 1. Sends a notification into the redis channel.
 // 2. Writes the operation into the DB.
+// Both go through the ResponsePublisherService of the DB.
 class ResponsePublisher : public ResponsePublisherInterface
 {
   public:
-    explicit ResponsePublisher(const std::string &dbName, bool buffered = false, bool db_write_thread = false);
+    // The service of the DB always writes from its own thread.
+    explicit ResponsePublisher(const std::string &dbName, bool buffered = false);
 
     virtual ~ResponsePublisher();
 
@@ -60,40 +143,21 @@ class ResponsePublisher : public ResponsePublisherInterface
      */
     void setBuffered(bool buffered);
 
-  private:
-    struct entry
-    {
-        std::string table;
-        std::string key;
-        std::vector<swss::FieldValueTuple> values;
-        std::string op;
-        bool replace;
-        bool flush;
-        bool shutdown;
-
-        entry()
-        {
-        }
-
-        entry(const std::string &table, const std::string &key, const std::vector<swss::FieldValueTuple> &values,
-              const std::string &op, bool replace, bool flush, bool shutdown)
-            : table(table), key(key), values(values), op(op), replace(replace), flush(flush), shutdown(shutdown)
-        {
-        }
-    };
+    /**
+     * @brief Flush pending responses of all publishers, OrchDaemon calls it at the end of each loop iteration
+     */
+    static void flushAll();
 
-    void dbUpdateThread();
-    void writeToDBInternal(const std::string &table, const std::string &key,
-                           const std::vector<swss::FieldValueTuple> &values, const std::string &op, bool replace);
+    /**
+     * @brief Set deferred flush mode
+     *
+     * @param deferred Flag whether responses are only sent by flushAll. Otherwise responses of unbuffered
+     *                 publishers are sent right away, and flush waits until the responses are sent.
+     */
+    static void setDeferredFlush(bool deferred);
 
-    std::unique_ptr<swss::DBConnector> m_db;
-    std::unique_ptr<swss::RedisPipeline> m_ntf_pipe;
-    std::unique_ptr<swss::RedisPipeline> m_db_pipe;
+  private:
+    std::shared_ptr<ResponsePublisherService> m_service;
 
     bool m_buffered{false};
-    // Thread to write to DB.
-    std::unique_ptr<std::thread> m_update_thread;
-    std::queue<entry> m_queue;
-    mutable std::mutex m_lock;
-    std::condition_variable m_signal;
 };
@@ -145,7 +145,7 @@ RouteOrch::RouteOrch(DBConnector *db, vector<table_name_with_pri_t> &tableNames,
     gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
 
     /* Add default IPv4 route into the m_syncdRoutes */
-    m_syncdRoutes[gVirtualRouterId][default_ip_prefix] = RouteNhg();
+    m_syncdRoutes[gVirtualRouterId].set(default_ip_prefix, RouteNhg());
 
     SWSS_LOG_NOTICE("Create IPv4 default route with packet action drop");
 
@@ -165,7 +165,7 @@ RouteOrch::RouteOrch(DBConnector *db, vector<table_name_with_pri_t> &tableNames,
     gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV6_ROUTE);
 
     /* Add default IPv6 route into the m_syncdRoutes */
-    m_syncdRoutes[gVirtualRouterId][v6_default_ip_prefix] = RouteNhg();
+    m_syncdRoutes[gVirtualRouterId].set(v6_default_ip_prefix, RouteNhg());
 
     SWSS_LOG_NOTICE("Create IPv6 default route with packet action drop");
 
@@ -317,15 +317,12 @@ void RouteOrch::attach(Observer *observer, const IpAddress& dstAddr, sai_object_
         /* Find the prefixes that cover the destination IP */
         if (m_syncdRoutes.find(vrf_id) != m_syncdRoutes.end())
         {
-            for (auto route : m_syncdRoutes.at(vrf_id))
+            auto &routeTable = observerEntry->second.routeTable;
+            m_syncdRoutes.at(vrf_id).getCoveringRoutes(dstAddr, routeTable);
+            for (const auto &route : routeTable)
             {
-                if (route.first.isAddressInSubnet(dstAddr))
-                {
-                    SWSS_LOG_INFO("Prefix %s covers destination address",
-                            route.first.to_string().c_str());
-                    observerEntry->second.routeTable.emplace(
-                            route.first, route.second);
-                }
+                SWSS_LOG_INFO("Prefix %s covers destination address",
+                        route.first.to_string().c_str());
             }
         }
     }
@@ -385,65 +382,71 @@ bool RouteOrch::validnexthopinNextHopGroup(const NextHopKey &nexthop, uint32_t&
 {
     SWSS_LOG_ENTER();
 
-    sai_object_id_t nexthop_id;
-    sai_status_t status;
     count = 0;
 
-    for (auto nhopgroup = m_syncdNextHopGroups.begin();
-         nhopgroup != m_syncdNextHopGroups.end(); ++nhopgroup)
+    auto nhopgroups = m_nextHopGroupRefs.find(nexthop);
+    if (nhopgroups != m_nextHopGroupRefs.end())
     {
+        vector<NextHopGroupTable::value_type *> nhgs(nhopgroups->second.begin(), nhopgroups->second.end());
+        vector<sai_object_id_t> nhgm_ids(nhgs.size(), SAI_NULL_OBJECT_ID);
+        vector<sai_status_t> statuses(nhgs.size());
 
-        if (!(nhopgroup->first.contains(nexthop)))
+        for (size_t i = 0; i < nhgs.size(); i++)
         {
-            continue;
-        }
+            auto nhopgroup = nhgs[i];
+            vector<sai_attribute_t> nhgm_attrs;
+            sai_attribute_t nhgm_attr;
 
-        vector<sai_attribute_t> nhgm_attrs;
-        sai_attribute_t nhgm_attr;
+            /* get updated nhkey with possible weight */
+            auto nhkey = nhopgroup->first.getNextHops().find(nexthop);
 
-        /* get updated nhkey with possible weight */
-        auto nhkey = nhopgroup->first.getNextHops().find(nexthop);
+            nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_GROUP_ID;
+            nhgm_attr.value.oid = nhopgroup->second.next_hop_group_id;
+            nhgm_attrs.push_back(nhgm_attr);
 
-        nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_GROUP_ID;
-        nhgm_attr.value.oid = nhopgroup->second.next_hop_group_id;
-        nhgm_attrs.push_back(nhgm_attr);
+            nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
+            nhgm_attr.value.oid = m_neighOrch->getNextHopId(nexthop);
+            nhgm_attrs.push_back(nhgm_attr);
 
-        nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_NEXT_HOP_ID;
-        nhgm_attr.value.oid = m_neighOrch->getNextHopId(nexthop);
-        nhgm_attrs.push_back(nhgm_attr);
+            if (nhkey->weight)
+            {
+                nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_WEIGHT;
+                nhgm_attr.value.s32 = nhkey->weight;
+                nhgm_attrs.push_back(nhgm_attr);
+            }
 
-        if (nhkey->weight)
-        {
-            nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_WEIGHT;
-            nhgm_attr.value.s32 = nhkey->weight;
-            nhgm_attrs.push_back(nhgm_attr);
-        }
+            if (m_switchOrch->checkOrderedEcmpEnable())
+            {
+                nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_SEQUENCE_ID;
+                nhgm_attr.value.u32 = nhopgroup->second.nhopgroup_members[nexthop].seq_id;
+                nhgm_attrs.push_back(nhgm_attr);
+            }
 
-        if (m_switchOrch->checkOrderedEcmpEnable())
-        {
-            nhgm_attr.id = SAI_NEXT_HOP_GROUP_MEMBER_ATTR_SEQUENCE_ID;
-            nhgm_attr.value.u32 = nhopgroup->second.nhopgroup_members[nexthop].seq_id;
-            nhgm_attrs.push_back(nhgm_attr);
+            gNextHopGroupMemberBulker.create_entry(&nhgm_ids[i],
+                                                   &statuses[i],
+                                                   (uint32_t)nhgm_attrs.size(),
+                                                   nhgm_attrs.data());
         }
 
-        status = sai_next_hop_group_api->create_next_hop_group_member(&nexthop_id, gSwitchId,
-                                                                      (uint32_t)nhgm_attrs.size(),
-                                                                      nhgm_attrs.data());
-
-        if (status != SAI_STATUS_SUCCESS)
+        gNextHopGroupMemberBulker.flush();
+        for (size_t i = 0; i < nhgs.size(); i++)
         {
-            SWSS_LOG_ERROR("Failed to add next hop member to group %" PRIx64 ": %d\n",
-                           nhopgroup->second.next_hop_group_id, status);
-            task_process_status handle_status = handleSaiCreateStatus(SAI_API_NEXT_HOP_GROUP, status);
-            if (handle_status != task_success)
+            auto nhopgroup = nhgs[i];
+            if (statuses[i] != SAI_STATUS_SUCCESS)
             {
-                return parseHandleSaiStatusFailure(handle_status);
+                SWSS_LOG_ERROR("Failed to add next hop member %s to group %" PRIx64 ": %d\n",
+                               nexthop.to_string().c_str(), nhopgroup->second.next_hop_group_id, statuses[i]);
+                task_process_status handle_status = handleSaiCreateStatus(SAI_API_NEXT_HOP_GROUP, statuses[i]);
+                if (handle_status != task_success)
+                {
+                    return parseHandleSaiStatusFailure(handle_status);
+                }
             }
-        }
 
-        ++count;
-        gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
-        nhopgroup->second.nhopgroup_members[nexthop].next_hop_id = nexthop_id;
+            ++count;
+            gCrmOrch->incCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
+            nhopgroup->second.nhopgroup_members[nexthop].next_hop_id = nhgm_ids[i];
+        }
     }
 
     if (!m_fgNhgOrch->validNextHopInNextHopGroup(nexthop))
@@ -458,35 +461,50 @@ bool RouteOrch::invalidnexthopinNextHopGroup(const NextHopKey &nexthop, uint32_t
 {
     SWSS_LOG_ENTER();
 
-    sai_object_id_t nexthop_id;
-    sai_status_t status;
     count = 0;
 
-    for (auto nhopgroup = m_syncdNextHopGroups.begin();
-         nhopgroup != m_syncdNextHopGroups.end(); ++nhopgroup)
+    auto nhopgroups = m_nextHopGroupRefs.find(nexthop);
+    if (nhopgroups != m_nextHopGroupRefs.end())
     {
+        vector<NextHopGroupTable::value_type *> nhgs;
+        vector<sai_object_id_t> nhgm_ids;
 
-        if (!(nhopgroup->first.contains(nexthop)))
+        for (auto nhopgroup : nhopgroups->second)
         {
-            continue;
+            auto nhgm = nhopgroup->second.nhopgroup_members.find(nexthop);
+            if (nhgm == nhopgroup->second.nhopgroup_members.end() ||
+                nhgm->second.next_hop_id == SAI_NULL_OBJECT_ID)
+            {
+                continue;
+            }
+
+            nhgs.push_back(nhopgroup);
+            nhgm_ids.push_back(nhgm->second.next_hop_id);
         }
 
-        nexthop_id = nhopgroup->second.nhopgroup_members[nexthop].next_hop_id;
-        status = sai_next_hop_group_api->remove_next_hop_group_member(nexthop_id);
+        vector<sai_status_t> statuses(nhgm_ids.size());
+        for (size_t i = 0; i < nhgm_ids.size(); i++)
+        {
+            gNextHopGroupMemberBulker.remove_entry(&statuses[i], nhgm_ids[i]);
+        }
 
-        if (status != SAI_STATUS_SUCCESS)
+        gNextHopGroupMemberBulker.flush();
+        for (size_t i = 0; i < nhgm_ids.size(); i++)
         {
-            SWSS_LOG_ERROR("Failed to remove next hop member %" PRIx64 " from group %" PRIx64 ": %d\n",
-                           nexthop_id, nhopgroup->second.next_hop_group_id, status);
-            task_process_status handle_status = handleSaiRemoveStatus(SAI_API_NEXT_HOP_GROUP, status);
-            if (handle_status != task_success)
+            if (statuses[i] != SAI_STATUS_SUCCESS)
             {
-                return parseHandleSaiStatusFailure(handle_status);
+                SWSS_LOG_ERROR("Failed to remove next hop member %" PRIx64 " from group %" PRIx64 ": %d\n",
+                               nhgm_ids[i], nhgs[i]->second.next_hop_group_id, statuses[i]);
+                task_process_status handle_status = handleSaiRemoveStatus(SAI_API_NEXT_HOP_GROUP, statuses[i]);
+                if (handle_status != task_success)
+                {
+                    return parseHandleSaiStatusFailure(handle_status);
+                }
             }
-        }
 
-        ++count;
-        gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
+            ++count;
+            gCrmOrch->decCrmResUsedCounter(CrmResourceType::CRM_NEXTHOP_GROUP_MEMBER);
+        }
     }
 
     if (!m_fgNhgOrch->invalidNextHopInNextHopGroup(nexthop))
@@ -560,7 +578,7 @@ void RouteOrch::doTask(Consumer& consumer)
                 {
                     /* Mark all current routes as dirty (DEL) in consumer.m_toSync map */
                     SWSS_LOG_NOTICE("Start resync routes\n");
-                    for (auto j : m_syncdRoutes)
+                    for (const auto &j : m_syncdRoutes)
                     {
                         string vrf;
 
@@ -569,7 +587,7 @@ void RouteOrch::doTask(Consumer& consumer)
                             vrf = m_vrfOrch->getVRFname(j.first) + ":";
                         }
 
-                        for (auto i : j.second)
+                        for (const auto &i : j.second)
                         {
                             vector<FieldValueTuple> v;
                             key = vrf + i.first.to_string();
@@ -1448,6 +1466,11 @@ bool RouteOrch::addNextHopGroup(const NextHopGroupKey &nexthops)
     next_hop_group_entry.ref_count = 0;
     m_syncdNextHopGroups[nexthops] = next_hop_group_entry;
 
+    /* Index the group under each of its next hops for the next hop flag updates */
+    auto *syncd_nhg = &*m_syncdNextHopGroups.find(nexthops);
+    for (auto it : next_hop_set)
+        m_nextHopGroupRefs[it].insert(syncd_nhg);
+
     return true;
 }
 
@@ -1566,6 +1589,19 @@ bool RouteOrch::removeNextHopGroup(const NextHopGroupKey &nexthops)
         }
     }
 
+    for (auto it : next_hop_set)
+    {
+        auto nhopgroups = m_nextHopGroupRefs.find(it);
+        if (nhopgroups != m_nextHopGroupRefs.end())
+        {
+            nhopgroups->second.erase(&*next_hop_group_entry);
+            if (nhopgroups->second.empty())
+            {
+                m_nextHopGroupRefs.erase(nhopgroups);
+            }
+        }
+    }
+
     m_syncdNextHopGroups.erase(nexthops);
 
     return true;
@@ -1755,7 +1791,7 @@ bool RouteOrch::addRoute(RouteBulkContext& ctx, const NextHopGroupKey &nextHops)
 
     if (m_syncdRoutes.find(vrf_id) == m_syncdRoutes.end())
     {
-        m_syncdRoutes.emplace(vrf_id, RouteTable());
+        m_syncdRoutes.emplace(vrf_id, RouteStore());
         m_vrfOrch->increaseVrfRefCount(vrf_id);
     }
 
@@ -2372,7 +2408,7 @@ bool RouteOrch::addRoutePost(const RouteBulkContext& ctx, const NextHopGroupKey
         gFlowCounterRouteOrch->handleRouteAdd(vrf_id, ipPrefix);
     }
 
-    m_syncdRoutes[vrf_id][ipPrefix] = RouteNhg(nextHops, ctx.nhg_index);
+    m_syncdRoutes[vrf_id].set(ipPrefix, RouteNhg(nextHops, ctx.nhg_index));
 
     /* add subnet decap term for VIP route */
     const SubnetDecapConfig &config = gTunneldecapOrch->getSubnetDecapConfig();
@@ -2617,10 +2653,10 @@ bool RouteOrch::removeRoutePost(const RouteBulkContext& ctx)
 
     if (ipPrefix.isDefaultRoute() && vrf_id == gVirtualRouterId)
     {
-        it_route_table->second[ipPrefix] = RouteNhg();
+        it_route_table->second.set(ipPrefix, RouteNhg());
 
         /* Notify about default route next hop change */
-        notifyNextHopChangeObservers(vrf_id, ipPrefix, it_route_table->second[ipPrefix].nhg_key, true);
+        notifyNextHopChangeObservers(vrf_id, ipPrefix, it_route_table->second.at(ipPrefix).nhg_key, true);
     }
     else
     {
@@ -13,6 +13,7 @@
 #include "ipaddresses.h"
 #include "ipprefix.h"
 #include "nexthopgroupkey.h"
+#include "routestore.h"
 #include "bulker.h"
 #include "fgnhgorch.h"
 #include <map>
@@ -50,30 +51,6 @@ struct NextHopUpdate
     NextHopGroupKey nexthopGroup;
 };
 
-/*
- * Structure describing the next hop group used by a route.  As the next hop
- * groups can either be owned by RouteOrch or by NhgOrch, we have to keep track
- * of the next hop group index, as it is the one telling us which one owns it.
- */
-struct RouteNhg
-{
-    NextHopGroupKey nhg_key;
-
-    /*
-     * Index of the next hop group used.  Filled only if referencing a
-     * NhgOrch's owned next hop group.
-     */
-    std::string nhg_index;
-
-    RouteNhg() = default;
-    RouteNhg(const NextHopGroupKey& key, const std::string& index) :
-        nhg_key(key), nhg_index(index) {}
-
-    bool operator==(const RouteNhg& rnhg)
-       { return ((nhg_key == rnhg.nhg_key) && (nhg_index == rnhg.nhg_index)); }
-    bool operator!=(const RouteNhg& rnhg) { return !(*this == rnhg); }
-};
-
 struct NextHopObserverEntry;
 
 /* Route destination key for a nexthop */
@@ -90,10 +67,12 @@ struct RouteKey
 
 /* NextHopGroupTable: NextHopGroupKey, NextHopGroupEntry */
 typedef std::map<NextHopGroupKey, NextHopGroupEntry> NextHopGroupTable;
+/* NextHopGroupRefTable: NextHopKey, entries of NextHopGroupTable containing it */
+typedef std::map<NextHopKey, std::set<NextHopGroupTable::value_type *>> NextHopGroupRefTable;
 /* RouteTable: destination network, NextHopGroupKey */
 typedef std::map<IpPrefix, RouteNhg> RouteTable;
-/* RouteTables: vrf_id, RouteTable */
-typedef std::map<sai_object_id_t, RouteTable> RouteTables;
+/* RouteTables: vrf_id, routes of the VRF */
+typedef std::map<sai_object_id_t, RouteStore> RouteTables;
 /* LabelRouteTable: destination label, next hop address(es) */
 typedef std::map<Label, RouteNhg> LabelRouteTable;
 /* LabelRouteTables: vrf_id, LabelRouteTable */
@@ -248,6 +227,7 @@ private:
     RouteTables m_syncdRoutes;
     LabelRouteTables m_syncdLabelRoutes;
     NextHopGroupTable m_syncdNextHopGroups;
+    NextHopGroupRefTable m_nextHopGroupRefs;
     NextHopRouteTable m_nextHops;
 
     std::set<std::pair<NextHopGroupKey, sai_object_id_t>> m_bulkNhgReducedRefCnt;
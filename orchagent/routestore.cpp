@@ -0,0 +1,454 @@
+#include <arpa/inet.h>
+#include <sys/socket.h>
+#include <algorithm>
+#include <stdexcept>
+
+#include "routestore.h"
+
+using namespace std;
+using namespace swss;
+
+template <typename Route>
+pair<size_t, size_t> RouteStore::Family<Route>::lowerBound(const Route &route) const
+{
+    /* First chunk whose last route is not ordered before route */
+    auto chunk = lower_bound(chunks.begin(), chunks.end(), route,
+                             [](const vector<Route> &c, const Route &r) { return c.back() < r; });
+    if (chunk == chunks.end())
+    {
+        return { chunks.size(), 0 };
+    }
+
+    auto pos = lower_bound(chunk->begin(), chunk->end(), route);
+    return { (size_t)(chunk - chunks.begin()), (size_t)(pos - chunk->begin()) };
+}
+
+template <typename Route>
+const Route *RouteStore::Family<Route>::find(const Route &route) const
+{
+    auto pos = lowerBound(route);
+    if (pos.first == chunks.size() || route < chunks[pos.first][pos.second])
+    {
+        return nullptr;
+    }
+
+    return &chunks[pos.first][pos.second];
+}
+
+template <typename Route>
+int64_t RouteStore::Family<Route>::set(const Route &route)
+{
+    auto pos = lowerBound(route);
+    if (pos.first < chunks.size())
+    {
+        auto &found = chunks[pos.first][pos.second];
+        if (!(route < found))
+        {
+            int64_t nhg = found.nhg;
+            found.nhg = route.nhg;
+            return nhg;
+        }
+    }
+    else if (chunks.empty())
+    {
+        chunks.emplace_back();
+        pos = { 0, 0 };
+    }
+    else
+    {
+        pos = { chunks.size() - 1, chunks.back().size() };
+    }
+
+    auto &chunk = chunks[pos.first];
+    if (chunk.size() == chunk.capacity())
+    {
+        /* Grow by a quarter, a chunk has little unused room */
+        chunk.reserve(min<size_t>(ROUTESTORE_CHUNK_SIZE + 1, chunk.size() + chunk.size() / 4 + 1));
+    }
+    chunk.insert(chunk.begin() + pos.second, route);
+    size++;
+    lengths[route.len]++;
+
+    if (chunk.size() > ROUTESTORE_CHUNK_SIZE)
+    {
+        /*
+         * Routes added in order leave full chunks behind them, others split
+         * the chunk in halves.
+         */
+        size_t split = chunk.size() / 2;
+        if (pos.first + 1 == chunks.size() && pos.second + 1 == chunk.size())
+        {
+            split = chunk.size() - 1;
+        }
+        else if (pos.first == 0 && pos.second == 0)
+        {
+            split = 1;
+        }
+
+        vector<Route> upper(chunk.begin() + split, chunk.end());
+        chunk.resize(split);
+        chunk.shrink_to_fit();
+        chunks.insert(chunks.begin() + pos.first + 1, move(upper));
+    }
+
+    return -1;
+}
+
+template <typename Route>
+int64_t RouteStore::Family<Route>::erase(const Route &route)
+{
+    auto pos = lowerBound(route);
+    if (pos.first == chunks.size() || route < chunks[pos.first][pos.second])
+    {
+        return -1;
+    }
+
+    auto &chunk = chunks[pos.first];
+    int64_t nhg = chunk[pos.second].nhg;
+    chunk.erase(chunk.begin() + pos.second);
+    size--;
+    lengths[route.len]--;
+
+    if (chunk.empty())
+    {
+        chunks.erase(chunks.begin() + pos.first);
+    }
+    else if (pos.first + 1 < chunks.size() &&
+             chunk.size() + chunks[pos.first + 1].size() <= ROUTESTORE_CHUNK_SIZE / 2)
+    {
+        auto &next = chunks[pos.first + 1];
+        chunk.insert(chunk.end(), next.begin(), next.end());
+        chunks.erase(chunks.begin() + pos.first + 1);
+    }
+    else if (chunk.capacity() > 2 * chunk.size() + 16)
+    {
+        chunk.shrink_to_fit();
+    }
+
+    return nhg;
+}
+
+template <typename Route>
+size_t RouteStore::Family<Route>::getMemoryUsage() const
+{
+    size_t bytes = chunks.capacity() * sizeof(vector<Route>);
+    for (const auto &chunk : chunks)
+    {
+        bytes += chunk.capacity() * sizeof(Route);
+    }
+    return bytes;
+}
+
+RouteStore::V4Route RouteStore::toV4Route(const IpPrefix &prefix)
+{
+    V4Route route;
+    route.addr = ntohl(prefix.getIp().getIp().ip_addr.ipv4_addr);
+    route.len = (uint8_t)prefix.getMaskLength();
+    route.nhg = 0;
+    return route;
+}
+
+RouteStore::V6Route RouteStore::toV6Route(const IpPrefix &prefix)
+{
+    auto ip = prefix.getIp().getIp();
+    V6Route route;
+    route.hi = 0;
+    route.lo = 0;
+    for (int i = 0; i < 8; i++)
+    {
+        route.hi = (route.hi << 8) | ip.ip_addr.ipv6_addr[i];
+        route.lo = (route.lo << 8) | ip.ip_addr.ipv6_addr[i + 8];
+    }
+    route.len = (uint8_t)prefix.getMaskLength();
+    route.nhg = 0;
+    return route;
+}
+
+IpPrefix RouteStore::toPrefix(const V4Route &route)
+{
+    ip_addr_t ip;
+    ip.family = AF_INET;
+    ip.ip_addr.ipv4_addr = htonl(route.addr);
+    return IpPrefix(ip, route.len);
+}
+
+IpPrefix RouteStore::toPrefix(const V6Route &route)
+{
+    ip_addr_t ip;
+    ip.family = AF_INET6;
+    for (int i = 0; i < 8; i++)
+    {
+        ip.ip_addr.ipv6_addr[i] = (uint8_t)(route.hi >> (56 - 8 * i));
+        ip.ip_addr.ipv6_addr[i + 8] = (uint8_t)(route.lo >> (56 - 8 * i));
+    }
+    return IpPrefix(ip, route.len);
+}
+
+uint32_t RouteStore::addNhgRef(const RouteNhg &nhg)
+{
+    auto it = m_nhgIndex.find(nhg);
+    if (it != m_nhgIndex.end())
+    {
+        m_nhgs[it->second].refs++;
+        return it->second;
+    }
+
+    uint32_t index;
+    if (!m_freeNhgs.empty())
+    {
+        index = m_freeNhgs.back();
+        m_freeNhgs.pop_back();
+        m_nhgs[index] = { nhg, 1 };
+    }
+    else
+    {
+        index = (uint32_t)m_nhgs.size();
+        m_nhgs.push_back({ nhg, 1 });
+    }
+    m_nhgIndex.emplace(nhg, index);
+
+    return index;
+}
+
+void RouteStore::removeNhgRef(uint32_t index)
+{
+    auto &entry = m_nhgs[index];
+    if (--entry.refs == 0)
+    {
+        m_nhgIndex.erase(entry.nhg);
+        entry.nhg = RouteNhg();
+        m_freeNhgs.push_back(index);
+    }
+}
+
+RouteStore::const_iterator RouteStore::begin() const
+{
+    return const_iterator(this, FAMILY_V4, 0, 0);
+}
+
+RouteStore::const_iterator RouteStore::find(const IpPrefix &prefix) const
+{
+    if (prefix.isV4())
+    {
+        auto route = toV4Route(prefix);
+        auto pos = m_v4.lowerBound(route);
+        if (pos.first < m_v4.chunks.size() && !(route < m_v4.chunks[pos.first][pos.second]))
+        {
+            return const_iterator(this, FAMILY_V4, pos.first, pos.second);
+        }
+    }
+    else
+    {
+        auto route = toV6Route(prefix);
+        auto pos = m_v6.lowerBound(route);
+        if (pos.first < m_v6.chunks.size() && !(route < m_v6.chunks[pos.first][pos.second]))
+        {
+            return const_iterator(this, FAMILY_V6, pos.first, pos.second);
+        }
+    }
+
+    return end();
+}
+
+const RouteNhg &RouteStore::at(const IpPrefix &prefix) const
+{
+    uint32_t nhg;
+    if (prefix.isV4())
+    {
+        auto route = m_v4.find(toV4Route(prefix));
+        if (!route)
+        {
+            throw out_of_range("No route to " + prefix.to_string());
+        }
+        nhg = route->nhg;
+    }
+    else
+    {
+        auto route = m_v6.find(toV6Route(prefix));
+        if (!route)
+        {
+            throw out_of_range("No route to " + prefix.to_string());
+        }
+        nhg = route->nhg;
+    }
+
+    return m_nhgs[nhg].nhg;
+}
+
+void RouteStore::set(const IpPrefix &prefix, const RouteNhg &nhg)
+{
+    int64_t old;
+    uint32_t index = addNhgRef(nhg);
+
+    if (prefix.isV4())
+    {
+        auto route = toV4Route(prefix);
+        route.nhg = index;
+        old = m_v4.set(route);
+    }
+    else
+    {
+        auto route = toV6Route(prefix);
+        route.nhg = index;
+        old = m_v6.set(route);
+    }
+
+    if (old >= 0)
+    {
+        removeNhgRef((uint32_t)old);
+    }
+}
+
+size_t RouteStore::erase(const IpPrefix &prefix)
+{
+    int64_t old = prefix.isV4() ? m_v4.erase(toV4Route(prefix)) : m_v6.erase(toV6Route(prefix));
+    if (old < 0)
+    {
+        return 0;
+    }
+
+    removeNhgRef((uint32_t)old);
+    return 1;
+}
+
+void RouteStore::clear()
+{
+    m_v4 = Family<V4Route>();
+    m_v6 = Family<V6Route>();
+    m_nhgs.clear();
+    m_freeNhgs.clear();
+    m_nhgIndex.clear();
+}
+
+void RouteStore::getCoveringRoutes(const IpAddress &address, map<IpPrefix, RouteNhg> &routes) const
+{
+    /*
+     * For each prefix length in use, the routes covering the address are
+     * the ones from the address masked to the length, with any host bits.
+     */
+    if (address.isV4())
+    {
+        uint32_t addr = ntohl(address.getIp().ip_addr.ipv4_addr);
+        for (uint8_t len = 0; len <= 32; len++)
+        {
+            if (!m_v4.lengths[len])
+            {
+                continue;
+            }
+
+            uint32_t mask = len ? ~0U << (32 - len) : 0;
+            V4Route first = { addr & mask, len, 0 };
+            auto pos = m_v4.lowerBound(first);
+            for (auto it = const_iterator(this, FAMILY_V4, pos.first, pos.second);
+                 it.m_family == FAMILY_V4; ++it)
+            {
+                const auto &route = m_v4.chunks[it.m_chunk][it.m_pos];
+                if (route.len != len || (route.addr & mask) != first.addr)
+                {
+                    break;
+                }
+                routes.emplace(toPrefix(route), m_nhgs[route.nhg].nhg);
+            }
+        }
+    }
+    else
+    {
+        V6Route addr = toV6Route(IpPrefix(address.getIp(), 128));
+        for (uint8_t len = 0; len <= 128; len++)
+        {
+            if (!m_v6.lengths[len])
+            {
+                continue;
+            }
+
+            uint64_t hiMask = len == 0 ? 0 : len >= 64 ? ~0ULL : ~0ULL << (64 - len);
+            uint64_t loMask = len <= 64 ? 0 : ~0ULL << (128 - len);
+            V6Route first = { addr.hi & hiMask, addr.lo & loMask, len, 0 };
+            auto pos = m_v6.lowerBound(first);
+            for (auto it = const_iterator(this, FAMILY_V6, pos.first, pos.second);
+                 it.m_family == FAMILY_V6; ++it)
+            {
+                const auto &route = m_v6.chunks[it.m_chunk][it.m_pos];
+                if (route.len != len || (route.hi & hiMask) != first.hi || (route.lo & loMask) != first.lo)
+                {
+                    break;
+                }
+                routes.emplace(toPrefix(route), m_nhgs[route.nhg].nhg);
+            }
+        }
+    }
+}
+
+size_t RouteStore::getMemoryUsage() const
+{
+    /* A std::map node is the value and four words: color, parent and children */
+    const size_t mapNodeSize = sizeof(pair<const RouteNhg, uint32_t>) + 4 * sizeof(void *);
+
+    return m_v4.getMemoryUsage() + m_v6.getMemoryUsage() +
+           m_nhgs.size() * sizeof(NhgEntry) +
+           m_freeNhgs.capacity() * sizeof(uint32_t) +
+           m_nhgIndex.size() * mapNodeSize;
+}
+
+RouteStore::const_iterator::const_iterator(const RouteStore *store, int family, size_t chunk, size_t pos) :
+    m_store(store), m_family(family), m_chunk(chunk), m_pos(pos)
+{
+    skipEmpty();
+}
+
+void RouteStore::const_iterator::skipEmpty()
+{
+    while (m_family < FAMILY_COUNT)
+    {
+        size_t chunks = m_family == FAMILY_V4 ? m_store->m_v4.chunks.size() : m_store->m_v6.chunks.size();
+        if (m_chunk < chunks)
+        {
+            size_t routes = m_family == FAMILY_V4 ? m_store->m_v4.chunks[m_chunk].size()
+                                                  : m_store->m_v6.chunks[m_chunk].size();
+            if (m_pos < routes)
+            {
+                return;
+            }
+
+            m_chunk++;
+            m_pos = 0;
+            continue;
+        }
+
+        m_family++;
+        m_chunk = 0;
+        m_pos = 0;
+    }
+}
+
+RouteStore::const_iterator::reference RouteStore::const_iterator::operator*() const
+{
+    if (!m_loaded)
+    {
+        uint32_t nhg;
+        if (m_family == FAMILY_V4)
+        {
+            const auto &route = m_store->m_v4.chunks[m_chunk][m_pos];
+            m_value.first = toPrefix(route);
+            nhg = route.nhg;
+        }
+        else
+        {
+            const auto &route = m_store->m_v6.chunks[m_chunk][m_pos];
+            m_value.first = toPrefix(route);
+            nhg = route.nhg;
+        }
+        m_value.second = m_store->m_nhgs[nhg].nhg;
+        m_loaded = true;
+    }
+
+    return m_value;
+}
+
+RouteStore::const_iterator &RouteStore::const_iterator::operator++()
+{
+    m_pos++;
+    m_loaded = false;
+    skipEmpty();
+    return *this;
+}
@@ -0,0 +1,228 @@
+#ifndef SWSS_ROUTESTORE_H
+#define SWSS_ROUTESTORE_H
+
+#include <deque>
+#include <iterator>
+#include <map>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include "ipaddress.h"
+#include "ipprefix.h"
+#include "nexthopgroupkey.h"
+
+/* Maximum number of routes in a chunk of a RouteStore */
+#define ROUTESTORE_CHUNK_SIZE 512
+
+/*
+ * Structure describing the next hop group used by a route.  As the next hop
+ * groups can either be owned by RouteOrch or by NhgOrch, we have to keep track
+ * of the next hop group index, as it is the one telling us which one owns it.
+ */
+struct RouteNhg
+{
+    NextHopGroupKey nhg_key;
+
+    /*
+     * Index of the next hop group used.  Filled only if referencing a
+     * NhgOrch's owned next hop group.
+     */
+    std::string nhg_index;
+
+    RouteNhg() = default;
+    RouteNhg(const NextHopGroupKey& key, const std::string& index) :
+        nhg_key(key), nhg_index(index) {}
+
+    bool operator==(const RouteNhg& rnhg) const
+       { return ((nhg_key == rnhg.nhg_key) && (nhg_index == rnhg.nhg_index)); }
+    bool operator!=(const RouteNhg& rnhg) const { return !(*this == rnhg); }
+};
+
+/*
+ * RouteStore holds the routes of a VRF, as the std::map<IpPrefix, RouteNhg> it
+ * replaces in RouteOrch, with a fraction of its memory.
+ *
+ * Routes are kept per address family in sorted arrays of packed prefixes,
+ * split in chunks of at most ROUTESTORE_CHUNK_SIZE routes so that updates only
+ * move a chunk. A route refers to its next hop group by an index in a table
+ * of the distinct RouteNhg of the VRF: an IPv4 route takes 12 bytes, an IPv6
+ * route 24 bytes.
+ *
+ * Routes are iterated IPv4 first, then IPv6, each by prefix length then
+ * address. Iterators are read only, give a copy of the route, and are
+ * invalidated by any update of the store.
+ */
+class RouteStore
+{
+public:
+    typedef std::pair<IpPrefix, RouteNhg> value_type;
+
+    class const_iterator
+    {
+    public:
+        typedef std::forward_iterator_tag iterator_category;
+        typedef RouteStore::value_type value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const value_type *pointer;
+        typedef const value_type &reference;
+
+        const_iterator() = default;
+
+        reference operator*() const;
+        pointer operator->() const
+        {
+            return &**this;
+        }
+
+        const_iterator &operator++();
+        const_iterator operator++(int)
+        {
+            auto it = *this;
+            ++*this;
+            return it;
+        }
+
+        bool operator==(const const_iterator &o) const
+        {
+            return m_family == o.m_family && m_chunk == o.m_chunk && m_pos == o.m_pos;
+        }
+        bool operator!=(const const_iterator &o) const
+        {
+            return !(*this == o);
+        }
+
+    private:
+        friend class RouteStore;
+
+        const_iterator(const RouteStore *store, int family, size_t chunk, size_t pos);
+        /* Move to the next route when the position is past the end of a chunk */
+        void skipEmpty();
+
+        const RouteStore *m_store = nullptr;
+        int m_family = FAMILY_COUNT;
+        size_t m_chunk = 0;
+        size_t m_pos = 0;
+
+        mutable value_type m_value;
+        mutable bool m_loaded = false;
+    };
+
+    typedef const_iterator iterator;
+
+    RouteStore() = default;
+
+    const_iterator begin() const;
+    const_iterator end() const
+    {
+        return const_iterator();
+    }
+
+    const_iterator find(const IpPrefix &prefix) const;
+    /* Throws std::out_of_range when there is no route to the prefix */
+    const RouteNhg &at(const IpPrefix &prefix) const;
+
+    /* Add the route, or update its next hop group */
+    void set(const IpPrefix &prefix, const RouteNhg &nhg);
+    size_t erase(const IpPrefix &prefix);
+    void clear();
+
+    size_t size() const
+    {
+        return m_v4.size + m_v6.size;
+    }
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /* Add the routes whose prefix contains the address */
+    void getCoveringRoutes(const IpAddress &address, std::map<IpPrefix, RouteNhg> &routes) const;
+
+    /* Bytes allocated for the routes and their next hop groups */
+    size_t getMemoryUsage() const;
+
+private:
+    enum
+    {
+        FAMILY_V4,
+        FAMILY_V6,
+        FAMILY_COUNT
+    };
+
+    struct V4Route
+    {
+        uint32_t addr;      // host order
+        uint8_t len;
+        uint32_t nhg;       // index in m_nhgs
+
+        bool operator<(const V4Route &o) const
+        {
+            return std::tie(len, addr) < std::tie(o.len, o.addr);
+        }
+    };
+
+    struct V6Route
+    {
+        uint64_t hi;        // host order
+        uint64_t lo;
+        uint8_t len;
+        uint32_t nhg;
+
+        bool operator<(const V6Route &o) const
+        {
+            return std::tie(len, hi, lo) < std::tie(o.len, o.hi, o.lo);
+        }
+    };
+
+    template <typename Route>
+    struct Family
+    {
+        std::vector<std::vector<Route>> chunks;
+        size_t size = 0;
+        /* Number of routes per prefix length */
+        uint32_t lengths[129] = {};
+
+        /* Chunk and position of the first route not ordered before route */
+        std::pair<size_t, size_t> lowerBound(const Route &route) const;
+        const Route *find(const Route &route) const;
+        /* Returns the previous next hop group of the route, or -1 when added */
+        int64_t set(const Route &route);
+        /* Returns the next hop group of the removed route, or -1 */
+        int64_t erase(const Route &route);
+        size_t getMemoryUsage() const;
+    };
+
+    struct NhgEntry
+    {
+        RouteNhg nhg;
+        uint32_t refs;
+    };
+
+    struct RouteNhgLess
+    {
+        bool operator()(const RouteNhg &a, const RouteNhg &b) const
+        {
+            return std::tie(a.nhg_key, a.nhg_index) < std::tie(b.nhg_key, b.nhg_index);
+        }
+    };
+
+    Family<V4Route> m_v4;
+    Family<V6Route> m_v6;
+
+    /* Distinct next hop groups of the routes, entries are reused once released */
+    std::deque<NhgEntry> m_nhgs;
+    std::vector<uint32_t> m_freeNhgs;
+    std::map<RouteNhg, uint32_t, RouteNhgLess> m_nhgIndex;
+
+    static V4Route toV4Route(const IpPrefix &prefix);
+    static V6Route toV6Route(const IpPrefix &prefix);
+    static IpPrefix toPrefix(const V4Route &route);
+    static IpPrefix toPrefix(const V6Route &route);
+
+    uint32_t addNhgRef(const RouteNhg &nhg);
+    void removeNhgRef(uint32_t index);
+};
+
+#endif /* SWSS_ROUTESTORE_H */
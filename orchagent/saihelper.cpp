@@ -836,6 +836,8 @@ void handleSaiFailure(bool abort_on_failure)
     }
     if (abort_on_failure)
     {
+        /* The last records are the ones explaining the failure */
+        Recorder::Instance().flush();
         abort();
     }
 }
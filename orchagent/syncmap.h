@@ -0,0 +1,310 @@
+#ifndef SWSS_SYNCMAP_H
+#define SWSS_SYNCMAP_H
+
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "table.h"
+
+/*
+ * SyncMap is the pending task store of a consumer (ConsumerBase::m_toSync).
+ *
+ * It keeps the multimap interface the orchs are written against: entries are
+ * (key, KeyOpFieldsValuesTuple) pairs iterated in key order, the entries of a
+ * key are adjacent, DEL then SET, and iterators are only invalidated by
+ * erasing the entry they point to.
+ *
+ * Each key has a single slot in an ordered map, holding at most one pending
+ * DEL and one SET. merge() folds a new task into the slot of its key: a DEL
+ * replaces the pending tasks, a SET is merged into the pending SET in place.
+ */
+class SyncMap
+{
+public:
+    typedef std::pair<std::string, swss::KeyOpFieldsValuesTuple> value_type;
+
+private:
+    enum
+    {
+        DEL_ENTRY = 0,
+        SET_ENTRY = 1,
+    };
+
+    /* Pending tasks of a key, a slot in the map has at least one of them */
+    struct Slot
+    {
+        value_type entries[2];
+        bool present[2] = { false, false };
+    };
+
+    typedef std::map<std::string, Slot> Slots;
+
+    template <typename V, typename M, typename I>
+    class Iterator : public std::iterator<std::bidirectional_iterator_tag, V>
+    {
+    public:
+        Iterator() = default;
+        Iterator(M *slots, I slot, int entry) : m_slots(slots), m_slot(slot), m_entry(entry) {}
+
+        /* Allow iterator to const_iterator conversion */
+        template <typename V2, typename M2, typename I2>
+        Iterator(const Iterator<V2, M2, I2> &other) :
+            m_slots(other.m_slots), m_slot(other.m_slot), m_entry(other.m_entry) {}
+
+        V &operator*() const { return m_slot->second.entries[m_entry]; }
+        V *operator->() const { return &m_slot->second.entries[m_entry]; }
+
+        Iterator &operator++() { next(); return *this; }
+        Iterator operator++(int) { Iterator tmp = *this; next(); return tmp; }
+        Iterator &operator--() { prev(); return *this; }
+        Iterator operator--(int) { Iterator tmp = *this; prev(); return tmp; }
+
+        template <typename V2, typename M2, typename I2>
+        bool operator==(const Iterator<V2, M2, I2> &other) const
+        {
+            return m_slot == other.m_slot && m_entry == other.m_entry;
+        }
+
+        template <typename V2, typename M2, typename I2>
+        bool operator!=(const Iterator<V2, M2, I2> &other) const
+        {
+            return !(*this == other);
+        }
+
+    private:
+        friend class SyncMap;
+        template <typename V2, typename M2, typename I2> friend class Iterator;
+
+        M *m_slots = nullptr;
+        I m_slot;
+        int m_entry = DEL_ENTRY;
+
+        void next()
+        {
+            do
+            {
+                if (++m_entry > SET_ENTRY)
+                {
+                    ++m_slot;
+                    m_entry = DEL_ENTRY;
+                }
+            } while (m_slot != m_slots->end() && !m_slot->second.present[m_entry]);
+        }
+
+        void prev()
+        {
+            do
+            {
+                if (m_entry-- == DEL_ENTRY)
+                {
+                    --m_slot;
+                    m_entry = SET_ENTRY;
+                }
+            } while (!m_slot->second.present[m_entry]);
+        }
+    };
+
+public:
+    typedef Iterator<value_type, Slots, Slots::iterator> iterator;
+    typedef Iterator<const value_type, const Slots, Slots::const_iterator> const_iterator;
+    typedef std::reverse_iterator<iterator> reverse_iterator;
+    typedef std::reverse_iterator<const_iterator> const_reverse_iterator;
+
+    SyncMap() = default;
+
+    /* Iterators refer to m_slots */
+    SyncMap(const SyncMap&) = delete;
+    SyncMap& operator=(const SyncMap&) = delete;
+
+    iterator begin() { return first(m_slots.begin()); }
+    iterator end() { return iterator(&m_slots, m_slots.end(), DEL_ENTRY); }
+    const_iterator begin() const { return const_cast<SyncMap *>(this)->begin(); }
+    const_iterator end() const { return const_cast<SyncMap *>(this)->end(); }
+    const_iterator cbegin() const { return begin(); }
+    const_iterator cend() const { return end(); }
+    reverse_iterator rbegin() { return reverse_iterator(end()); }
+    reverse_iterator rend() { return reverse_iterator(begin()); }
+    const_reverse_iterator rbegin() const { return const_reverse_iterator(end()); }
+    const_reverse_iterator rend() const { return const_reverse_iterator(begin()); }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    /* First entry of the key, or end() */
+    iterator find(const std::string &key)
+    {
+        auto slot = m_slots.find(key);
+        return slot == m_slots.end() ? end() : first(slot);
+    }
+
+    const_iterator find(const std::string &key) const
+    {
+        return const_cast<SyncMap *>(this)->find(key);
+    }
+
+    size_t count(const std::string &key) const
+    {
+        auto slot = m_slots.find(key);
+        if (slot == m_slots.end())
+        {
+            return 0;
+        }
+        return slot->second.present[DEL_ENTRY] + slot->second.present[SET_ENTRY];
+    }
+
+    std::pair<iterator, iterator> equal_range(const std::string &key)
+    {
+        auto slot = m_slots.find(key);
+        if (slot == m_slots.end())
+        {
+            return std::make_pair(end(), end());
+        }
+        return std::make_pair(first(slot), first(std::next(slot)));
+    }
+
+    std::pair<const_iterator, const_iterator> equal_range(const std::string &key) const
+    {
+        auto range = const_cast<SyncMap *>(this)->equal_range(key);
+        return std::make_pair(const_iterator(range.first), const_iterator(range.second));
+    }
+
+    /* Add the DEL or SET of a key, which must not have one pending already */
+    iterator emplace(const std::string &key, const swss::KeyOpFieldsValuesTuple &kco)
+    {
+        int entry = kfvOp(kco) == DEL_COMMAND ? DEL_ENTRY : SET_ENTRY;
+        auto slot = getSlot(key);
+
+        if (slot->second.present[entry])
+        {
+            throw std::logic_error("SyncMap already has a pending " + kfvOp(kco) + " for " + key);
+        }
+
+        set(slot->second, entry, key, kco);
+        return iterator(&m_slots, slot, entry);
+    }
+
+    /*
+     * Add a task of a key to its pending tasks.
+     * A DEL replaces them. A SET is added after the pending DEL, or merged
+     * into the pending SET: a new field replaces the existing one and is
+     * moved to the end.
+     */
+    void merge(const std::string &key, const swss::KeyOpFieldsValuesTuple &kco)
+    {
+        Slot &s = getSlot(key)->second;
+
+        if (kfvOp(kco) == DEL_COMMAND)
+        {
+            if (s.present[SET_ENTRY])
+            {
+                s.present[SET_ENTRY] = false;
+                s.entries[SET_ENTRY] = value_type();
+                m_size--;
+            }
+            if (s.present[DEL_ENTRY])
+            {
+                s.present[DEL_ENTRY] = false;
+                m_size--;
+            }
+            set(s, DEL_ENTRY, key, kco);
+            return;
+        }
+
+        if (!s.present[SET_ENTRY])
+        {
+            set(s, SET_ENTRY, key, kco);
+            return;
+        }
+
+        auto &existing_values = kfvFieldsValues(s.entries[SET_ENTRY].second);
+        for (const auto &fv : kfvFieldsValues(kco))
+        {
+            const std::string &field = fvField(fv);
+
+            auto it = existing_values.begin();
+            while (it != existing_values.end())
+            {
+                if (fvField(*it) == field)
+                    it = existing_values.erase(it);
+                else
+                    it++;
+            }
+            existing_values.push_back(fv);
+        }
+    }
+
+    iterator erase(const_iterator pos)
+    {
+        /* Mutable iterator to the slot */
+        auto slot = m_slots.erase(pos.m_slot, pos.m_slot);
+        Slot &s = slot->second;
+
+        s.present[pos.m_entry] = false;
+        s.entries[pos.m_entry] = value_type();
+        m_size--;
+
+        if (!s.present[DEL_ENTRY] && !s.present[SET_ENTRY])
+        {
+            return first(m_slots.erase(slot));
+        }
+
+        iterator next(&m_slots, slot, pos.m_entry);
+        return ++next;
+    }
+
+    iterator erase(iterator pos)
+    {
+        return erase(const_iterator(pos));
+    }
+
+    size_t erase(const std::string &key)
+    {
+        size_t erased = count(key);
+        m_slots.erase(key);
+        m_size -= erased;
+        return erased;
+    }
+
+    void clear()
+    {
+        m_slots.clear();
+        m_size = 0;
+    }
+
+private:
+    Slots m_slots;
+    size_t m_size = 0;
+
+    Slots::iterator getSlot(const std::string &key)
+    {
+        auto slot = m_slots.lower_bound(key);
+        if (slot == m_slots.end() || slot->first != key)
+        {
+            slot = m_slots.emplace_hint(slot, key, Slot());
+        }
+        return slot;
+    }
+
+    /* First entry of the slot, or end() */
+    iterator first(Slots::iterator slot)
+    {
+        if (slot == m_slots.end() || slot->second.present[DEL_ENTRY])
+        {
+            return iterator(&m_slots, slot, DEL_ENTRY);
+        }
+        return iterator(&m_slots, slot, SET_ENTRY);
+    }
+
+    void set(Slot &s, int entry, const std::string &key, const swss::KeyOpFieldsValuesTuple &kco)
+    {
+        s.entries[entry].first = key;
+        s.entries[entry].second = kco;
+        s.present[entry] = true;
+        m_size++;
+    }
+};
+
+#endif /* SWSS_SYNCMAP_H */
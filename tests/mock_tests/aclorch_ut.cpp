@@ -2,6 +2,7 @@
 #include "flowcounterrouteorch.h"
 
 extern sai_object_id_t gSwitchId;
+extern size_t gMaxBulkSize;
 
 extern SwitchOrch *gSwitchOrch;
 extern CrmOrch *gCrmOrch;
@@ -1864,6 +1865,169 @@ namespace aclorch_test
         ASSERT_TRUE(orch->m_aclOrch->removeAclRule(tableId, ruleId));
     }
 
+    // Install and remove 1k rules in a single drain, their counters and entries are programmed in bulk
+    TEST_F(AclOrchTest, AclRule_BulkInstall)
+    {
+        const size_t ruleCount = 1000;
+        string tableId = "acl_table_1";
+
+        auto orch = createAclOrch();
+
+        auto kvfAclTable = deque<KeyOpFieldsValuesTuple>({{
+            tableId,
+            SET_COMMAND,
+            {
+                { ACL_TABLE_DESCRIPTION, "L3 table" },
+                { ACL_TABLE_TYPE, TABLE_TYPE_L3 },
+                { ACL_TABLE_STAGE, STAGE_INGRESS },
+                { ACL_TABLE_PORTS, "1,2" }
+            }
+        }});
+
+        orch->doAclTableTask(kvfAclTable);
+
+        auto tableOid = orch->getTableById(tableId);
+        ASSERT_NE(tableOid, SAI_NULL_OBJECT_ID);
+
+        auto tableIt = orch->getAclTables().find(tableOid);
+        ASSERT_NE(tableIt, orch->getAclTables().end());
+        const auto &rules = tableIt->second.rules;
+
+        deque<KeyOpFieldsValuesTuple> kvfAclRules;
+        for (size_t i = 0; i < ruleCount; i++)
+        {
+            kvfAclRules.push_back({
+                tableId + "|acl_rule_" + to_string(i),
+                SET_COMMAND,
+                {
+                    { ACTION_PACKET_ACTION, PACKET_ACTION_DROP },
+                    { MATCH_SRC_IP, "10.0." + to_string(i >> 8) + "." + to_string(i & 0xff) }
+                }
+            });
+        }
+
+        orch->doAclRuleTask(kvfAclRules);
+
+        ASSERT_EQ(rules.size(), ruleCount);
+        for (const auto &it : rules)
+        {
+            ASSERT_NE(it.second->getOid(), SAI_NULL_OBJECT_ID);
+            ASSERT_TRUE(it.second->hasCounter());
+        }
+
+        // A rule deleted and set again in the same drain is replaced
+        auto oldRuleOid = rules.at("acl_rule_0")->getOid();
+        orch->doAclRuleTask({
+            { tableId + "|acl_rule_0", DEL_COMMAND, {} },
+            { tableId + "|acl_rule_0", SET_COMMAND, { { ACTION_PACKET_ACTION, PACKET_ACTION_FORWARD },
+                                                     { MATCH_SRC_IP, "10.0.0.0" } } }
+        });
+        ASSERT_EQ(rules.size(), ruleCount);
+        ASSERT_NE(rules.at("acl_rule_0")->getOid(), SAI_NULL_OBJECT_ID);
+        ASSERT_NE(rules.at("acl_rule_0")->getOid(), oldRuleOid);
+
+        for (auto &kfv : kvfAclRules)
+        {
+            kfvOp(kfv) = DEL_COMMAND;
+            kfvFieldsValues(kfv).clear();
+        }
+
+        orch->doAclRuleTask(kvfAclRules);
+
+        ASSERT_TRUE(rules.empty());
+        ASSERT_TRUE(validateLowerLayerDb(orch.get()));
+    }
+
+    sai_bulk_op_error_mode_t aclBulkCreateMode;
+
+    // Bulk ACL entry create failing the second entry of the call
+    sai_status_t bulkCreateAclEntriesFailSecond(sai_object_id_t switch_id, uint32_t object_count,
+            const uint32_t *attr_count, const sai_attribute_t **attr_list, sai_bulk_op_error_mode_t mode,
+            sai_object_id_t *object_id, sai_status_t *object_statuses)
+    {
+        aclBulkCreateMode = mode;
+
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = (i == 1) ? SAI_STATUS_FAILURE :
+                sai_acl_api->create_acl_entry(&object_id[i], switch_id, attr_count[i], attr_list[i]);
+        }
+
+        return SAI_STATUS_FAILURE;
+    }
+
+    sai_status_t bulkRemoveAclEntries(uint32_t object_count, const sai_object_id_t *object_id,
+            sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+    {
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            object_statuses[i] = sai_acl_api->remove_acl_entry(object_id[i]);
+        }
+
+        return SAI_STATUS_SUCCESS;
+    }
+
+    // One rule failing in a bulk create does not keep the other rules of the drain from being programmed
+    TEST_F(AclOrchTest, AclRule_BulkInstallPartialFailure)
+    {
+        string tableId = "acl_table_1";
+
+        auto orch = createAclOrch();
+
+        orch->doAclTableTask({{
+            tableId,
+            SET_COMMAND,
+            {
+                { ACL_TABLE_DESCRIPTION, "L3 table" },
+                { ACL_TABLE_TYPE, TABLE_TYPE_L3 },
+                { ACL_TABLE_STAGE, STAGE_INGRESS },
+                { ACL_TABLE_PORTS, "1,2" }
+            }
+        }});
+
+        auto tableOid = orch->getTableById(tableId);
+        ASSERT_NE(tableOid, SAI_NULL_OBJECT_ID);
+        const auto &rules = orch->getAclTables().at(tableOid).rules;
+
+        deque<KeyOpFieldsValuesTuple> kvfAclRules;
+        for (size_t i = 0; i < 3; i++)
+        {
+            kvfAclRules.push_back({
+                tableId + "|acl_rule_" + to_string(i),
+                SET_COMMAND,
+                {
+                    { ACTION_PACKET_ACTION, PACKET_ACTION_DROP },
+                    { MATCH_SRC_IP, "10.0.0." + to_string(i) }
+                }
+            });
+        }
+
+        auto &entryBulker = orch->m_aclOrch->m_aclEntryBulker;
+        auto savedEntryBulker = entryBulker;
+        entryBulker = ObjectBulker<sai_acl_api_t>(bulkCreateAclEntriesFailSecond, bulkRemoveAclEntries,
+                                                  gSwitchId, gMaxBulkSize, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR);
+
+        orch->doAclRuleTask(kvfAclRules);
+        entryBulker = savedEntryBulker;
+
+        ASSERT_EQ(aclBulkCreateMode, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR);
+        ASSERT_EQ(rules.size(), 2);
+        ASSERT_NE(rules.find("acl_rule_0"), rules.end());
+        ASSERT_EQ(rules.find("acl_rule_1"), rules.end());
+        ASSERT_NE(rules.find("acl_rule_2"), rules.end());
+        ASSERT_NE(rules.at("acl_rule_0")->getOid(), SAI_NULL_OBJECT_ID);
+        ASSERT_NE(rules.at("acl_rule_2")->getOid(), SAI_NULL_OBJECT_ID);
+
+        // The counter of the failed rule is released
+        ASSERT_TRUE(validateLowerLayerDb(orch.get()));
+
+        // The failed rule is programmed when retried
+        orch->doAclRuleTask({ kvfAclRules[1] });
+        ASSERT_EQ(rules.size(), 3);
+        ASSERT_NE(rules.at("acl_rule_1")->getOid(), SAI_NULL_OBJECT_ID);
+        ASSERT_TRUE(validateLowerLayerDb(orch.get()));
+    }
+
     sai_switch_api_t *old_sai_switch_api;
 
     // The following function is used to override SAI API get_switch_attribute to request passing
@@ -0,0 +1,138 @@
+#include <algorithm>
+#include <string.h>
+
+#include "ut_helper.h"
+#include "mock_table.h"
+#include "batchtablereader.h"
+
+extern redisReply *mockReply;
+extern bool mockRecordCommands;
+extern std::vector<std::string> mockCommands;
+
+namespace batchtablereader_test
+{
+    using namespace std;
+
+    static redisReply *newReply(int type)
+    {
+        auto r = (redisReply *)calloc(sizeof(redisReply), 1);
+        r->type = type;
+        return r;
+    }
+
+    static redisReply *newStringReply(int type, const string &str)
+    {
+        auto r = newReply(type);
+        r->str = strdup(str.c_str());
+        r->len = str.length();
+        return r;
+    }
+
+    static redisReply *newArrayReply(const vector<redisReply *> &elements)
+    {
+        auto r = newReply(REDIS_REPLY_ARRAY);
+        r->elements = elements.size();
+        r->element = (redisReply **)calloc(sizeof(redisReply *), elements.size());
+        copy(elements.begin(), elements.end(), r->element);
+        return r;
+    }
+
+    struct BatchTableReaderTest : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_counters_db;
+        shared_ptr<swss::Table> m_counters;
+
+        void SetUp() override
+        {
+            ::testing_db::reset();
+
+            m_counters_db = make_shared<swss::DBConnector>("COUNTERS_DB", 0);
+            m_counters = make_shared<swss::Table>(m_counters_db.get(), COUNTERS_TABLE);
+        }
+
+        void TearDown() override
+        {
+            mockRecordCommands = false;
+            mockCommands.clear();
+            ::testing_db::reset();
+        }
+
+        size_t countCommands(const string &name)
+        {
+            return count_if(mockCommands.begin(), mockCommands.end(), [&](const string &command) {
+                return command.find("\r\n" + name + "\r\n") != string::npos;
+            });
+        }
+    };
+
+    TEST_F(BatchTableReaderTest, ReadKeysInOneCommand)
+    {
+        m_counters->set("oid:0x1", { { "SAI_PORT_STAT_IF_IN_OCTETS", "100" }, { "SAI_PORT_STAT_IF_OUT_OCTETS", "200" } });
+        m_counters->set("oid:0x2", { { "SAI_PORT_STAT_IF_IN_OCTETS", "300" } });
+        m_counters->set("oid:0x3", { { "SAI_PORT_STAT_IF_IN_OCTETS", "400" } });
+
+        BatchTableReader reader(m_counters_db.get(), COUNTERS_TABLE);
+
+        mockCommands.clear();
+        mockRecordCommands = true;
+
+        vector<vector<swss::FieldValueTuple>> values = { { { "stale", "value" } } };
+        reader.get({ "oid:0x2", "oid:0x4", "oid:0x1", "oid:0x3" }, values);
+
+        // The keys are read by a single script run, in their order, a missing key has no fields
+        ASSERT_EQ(countCommands("EVALSHA"), 1);
+        ASSERT_EQ(countCommands("HGETALL"), 0);
+        ASSERT_EQ(values.size(), 4);
+        ASSERT_EQ(values[0], (vector<swss::FieldValueTuple>{ { "SAI_PORT_STAT_IF_IN_OCTETS", "300" } }));
+        ASSERT_TRUE(values[1].empty());
+        ASSERT_EQ(values[2], (vector<swss::FieldValueTuple>{ { "SAI_PORT_STAT_IF_IN_OCTETS", "100" },
+                                                            { "SAI_PORT_STAT_IF_OUT_OCTETS", "200" } }));
+        ASSERT_EQ(values[3], (vector<swss::FieldValueTuple>{ { "SAI_PORT_STAT_IF_IN_OCTETS", "400" } }));
+
+        // Later changes are seen by the next read, no keys is no command
+        m_counters->set("oid:0x4", { { "SAI_PORT_STAT_IF_IN_OCTETS", "500" } });
+        reader.get({ "oid:0x4" }, values);
+        ASSERT_EQ(values, (vector<vector<swss::FieldValueTuple>>{ { { "SAI_PORT_STAT_IF_IN_OCTETS", "500" } } }));
+
+        reader.get({}, values);
+        ASSERT_TRUE(values.empty());
+        ASSERT_EQ(countCommands("EVALSHA"), 2);
+    }
+
+    TEST_F(BatchTableReaderTest, KeyErrors)
+    {
+        BatchTableReader reader(m_counters_db.get(), COUNTERS_TABLE);
+
+        // A key that is not a hash, an unexpected reply, then a key that is read
+        mockReply = newArrayReply({
+            newStringReply(REDIS_REPLY_ERROR, "WRONGTYPE Operation against a key holding the wrong kind of value"),
+            newReply(REDIS_REPLY_INTEGER),
+            newArrayReply({ newStringReply(REDIS_REPLY_STRING, "field"), newStringReply(REDIS_REPLY_STRING, "value") }),
+        });
+
+        vector<vector<swss::FieldValueTuple>> values;
+        reader.get({ "oid:0x1", "oid:0x2", "oid:0x3" }, values);
+        mockReply = nullptr;
+
+        ASSERT_EQ(values.size(), 3);
+        ASSERT_TRUE(values[0].empty());
+        ASSERT_TRUE(values[1].empty());
+        ASSERT_EQ(values[2], (vector<swss::FieldValueTuple>{ { "field", "value" } }));
+    }
+
+    TEST_F(BatchTableReaderTest, UnexpectedReply)
+    {
+        BatchTableReader reader(m_counters_db.get(), COUNTERS_TABLE);
+        vector<vector<swss::FieldValueTuple>> values;
+
+        // Fewer replies than keys
+        mockReply = newArrayReply({ newArrayReply({}) });
+        EXPECT_THROW(reader.get({ "oid:0x1", "oid:0x2" }, values), runtime_error);
+        mockReply = nullptr;
+
+        // Not an array
+        mockReply = newStringReply(REDIS_REPLY_ERROR, "NOSCRIPT No matching script");
+        EXPECT_THROW(reader.get({ "oid:0x1" }, values), runtime_error);
+        mockReply = nullptr;
+    }
+}
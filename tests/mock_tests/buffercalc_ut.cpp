@@ -0,0 +1,1209 @@
+#include "ut_helper.h"
+#include "buffercalc.h"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <regex>
+#include <set>
+#include <stdexcept>
+
+namespace buffercalc_test
+{
+    using namespace std;
+    using namespace swss;
+
+    typedef map<string, string> Hash;
+
+    /*
+     * buffer_headroom_mellanox.lua, buffer_headroom_barefoot.lua, buffer_pool_mellanox.lua
+     * and buffer_pool_barefoot.lua, statement by statement, over an in memory redis. The vs
+     * plugins are copies of the mellanox ones. Lua converts strings to numbers with strtod,
+     * numbers to strings with %.14g, and raises an error on arithmetic with nil.
+     */
+    class LuaBufferPlugins
+    {
+    public:
+        map<string, Hash> config_db;
+        map<string, Hash> state_db;
+        map<string, Hash> appl_db;
+
+        vector<string> headroom_mellanox(const string &speed, const string &cable, const string &mtu, const string &gearbox, const string &lanes)
+        {
+            double port_speed = number(tonumber(speed));
+            double cable_length = number(tonumber(cable.substr(0, cable.size() - 1)));
+            double port_mtu = number(tonumber(mtu));
+            double gearbox_delay;
+            bool is_8lane = (lanes == "8");
+            vector<string> ret;
+
+            map<double, double> pause_quanta_per_speed = {
+                {800000, 905}, {400000, 905}, {200000, 453}, {100000, 394}, {50000, 147},
+                {40000, 118}, {25000, 80}, {10000, 67}, {1000, 2}, {100, 1}
+            };
+            bool has_pause_quanta = pause_quanta_per_speed.count(port_speed);
+
+            if (!tonumber(gearbox, gearbox_delay))
+            {
+                gearbox_delay = 0;
+            }
+
+            auto asic_keys = keys(state_db, "ASIC_TABLE");
+            bool has_cell_size = false, has_pipeline_latency = false, has_mac_phy_delay = false, has_peer_response_time = false;
+            double cell_size = 0, pipeline_latency = 0, mac_phy_delay = 0, peer_response_time = 0;
+            for (auto &fv : state_db[asic_keys.at(0)])
+            {
+                if (fv.first == "cell_size")
+                {
+                    has_cell_size = tonumber(fv.second, cell_size);
+                }
+                if (fv.first == "pipeline_latency")
+                {
+                    pipeline_latency = number(tonumber(fv.second)) * 1024;
+                    has_pipeline_latency = true;
+                }
+                if (fv.first == "mac_phy_delay")
+                {
+                    mac_phy_delay = number(tonumber(fv.second)) * 1024;
+                    has_mac_phy_delay = true;
+                }
+                if (fv.first == "peer_response_time" && !has_pause_quanta)
+                {
+                    peer_response_time = number(tonumber(fv.second)) * 1024;
+                    has_peer_response_time = true;
+                }
+            }
+
+            double kb_on_tile = 0;
+            if (asic_keys[0].back() == '4' || asic_keys[0].back() == '5')
+            {
+                kb_on_tile = port_speed / 1000 * 120 / 8;
+            }
+
+            auto lossless_traffic_keys = keys(config_db, "LOSSLESS_TRAFFIC_PATTERN");
+            bool has_lossless_mtu = false, has_small_packet_percentage = false;
+            double lossless_mtu = 0, small_packet_percentage = 0;
+            for (auto &fv : config_db[lossless_traffic_keys.at(0)])
+            {
+                if (fv.first == "mtu")
+                {
+                    has_lossless_mtu = tonumber(fv.second, lossless_mtu);
+                }
+                if (fv.first == "small_packet_percentage")
+                {
+                    has_small_packet_percentage = tonumber(fv.second, small_packet_percentage);
+                }
+            }
+
+            auto default_lossless_param_keys = keys(config_db, "DEFAULT_LOSSLESS_BUFFER_PARAMETER");
+            double over_subscribe_ratio;
+            bool has_over_subscribe_ratio = tonumber(hget(config_db, default_lossless_param_keys.at(0), "over_subscribe_ratio"), over_subscribe_ratio);
+
+            double shp_size;
+            bool has_shp_size = tonumber(hget(config_db, "BUFFER_POOL|ingress_lossless_pool", "xoff"), shp_size);
+
+            bool shp_enabled = (has_shp_size && shp_size != 0) || (has_over_subscribe_ratio && over_subscribe_ratio != 0);
+
+            double speed_of_light = 198000000;
+            double minimal_packet_size = 64;
+            double speed_overhead;
+
+            if (is_8lane)
+            {
+                pipeline_latency = number(has_pipeline_latency, pipeline_latency) * 2;
+                speed_overhead = port_mtu;
+            }
+            else
+            {
+                speed_overhead = 0;
+            }
+
+            double worst_case_factor;
+            if (number(has_cell_size, cell_size) > 2 * minimal_packet_size)
+            {
+                worst_case_factor = cell_size / minimal_packet_size;
+            }
+            else
+            {
+                worst_case_factor = (2 * cell_size) / (1 + cell_size);
+            }
+            worst_case_factor = ceil(worst_case_factor);
+
+            number(has_lossless_mtu, lossless_mtu);
+            number(has_small_packet_percentage, small_packet_percentage);
+            double small_packet_percentage_by_byte = 100 * minimal_packet_size / ((small_packet_percentage * minimal_packet_size + (100 - small_packet_percentage) * lossless_mtu) / 100);
+            double cell_occupancy = (100 - small_packet_percentage_by_byte + small_packet_percentage_by_byte * worst_case_factor) / 100;
+
+            double bytes_on_gearbox;
+            if (gearbox_delay == 0)
+            {
+                bytes_on_gearbox = 0;
+            }
+            else
+            {
+                bytes_on_gearbox = port_speed * gearbox_delay / (8 * 1024);
+            }
+
+            if (has_pause_quanta)
+            {
+                peer_response_time = (pause_quanta_per_speed[port_speed]) * 512 / 8;
+                has_peer_response_time = true;
+            }
+
+            double bytes_on_cable = 2 * cable_length * port_speed * 1000000000 / speed_of_light / (8 * 1000);
+            double propagation_delay = port_mtu + bytes_on_cable + 2 * bytes_on_gearbox + number(has_mac_phy_delay, mac_phy_delay) + number(has_peer_response_time, peer_response_time) + kb_on_tile;
+
+            double xoff_value = lossless_mtu + propagation_delay * cell_occupancy;
+            xoff_value = ceil(xoff_value / 1024) * 1024;
+            double xon_value = number(has_pipeline_latency, pipeline_latency);
+            xon_value = ceil(xon_value / 1024) * 1024;
+
+            double headroom_size;
+            if (shp_enabled)
+            {
+                headroom_size = xon_value;
+            }
+            else
+            {
+                headroom_size = xoff_value + xon_value + speed_overhead;
+            }
+            headroom_size = ceil(headroom_size / 1024) * 1024;
+
+            ret.push_back("xon:" + str(ceil(xon_value)));
+            ret.push_back("xoff:" + str(ceil(xoff_value)));
+            ret.push_back("size:" + str(ceil(headroom_size)));
+
+            return ret;
+        }
+
+        vector<string> headroom_barefoot(const string &speed, const string &cable, const string &mtu, const string &gearbox)
+        {
+            double port_speed = number(tonumber(speed));
+            double cable_length = number(tonumber(cable.substr(0, cable.size() - 1)));
+            double port_mtu = number(tonumber(mtu));
+            double gearbox_delay;
+            vector<string> ret;
+
+            map<double, double> pause_quanta_per_speed = {
+                {400000, 905}, {200000, 453}, {100000, 394}, {50000, 147},
+                {40000, 118}, {25000, 80}, {10000, 67}, {1000, 2}, {100, 1}
+            };
+            bool has_pause_quanta = pause_quanta_per_speed.count(port_speed);
+
+            if (!tonumber(gearbox, gearbox_delay))
+            {
+                gearbox_delay = 0;
+            }
+
+            auto asic_keys = keys(state_db, "ASIC_TABLE");
+            bool has_cell_size = false, has_pipeline_latency = false, has_mac_phy_delay = false, has_peer_response_time = false;
+            double cell_size = 0, pipeline_latency = 0, mac_phy_delay = 0, peer_response_time = 0;
+            for (auto &fv : state_db[asic_keys.at(0)])
+            {
+                if (fv.first == "cell_size")
+                {
+                    has_cell_size = tonumber(fv.second, cell_size);
+                }
+                if (fv.first == "pipeline_latency")
+                {
+                    pipeline_latency = number(tonumber(fv.second)) * 1024;
+                    has_pipeline_latency = true;
+                }
+                if (fv.first == "mac_phy_delay")
+                {
+                    mac_phy_delay = number(tonumber(fv.second)) * 1024;
+                    has_mac_phy_delay = true;
+                }
+                if (fv.first == "peer_response_time" && !has_pause_quanta)
+                {
+                    peer_response_time = number(tonumber(fv.second)) * 1024;
+                    has_peer_response_time = true;
+                }
+            }
+
+            auto lossless_traffic_keys = keys(config_db, "LOSSLESS_TRAFFIC_PATTERN");
+            bool has_lossless_mtu = false, has_small_packet_percentage = false;
+            double lossless_mtu = 0, small_packet_percentage = 0;
+            for (auto &fv : config_db[lossless_traffic_keys.at(0)])
+            {
+                if (fv.first == "mtu")
+                {
+                    has_lossless_mtu = tonumber(fv.second, lossless_mtu);
+                }
+                if (fv.first == "small_packet_percentage")
+                {
+                    has_small_packet_percentage = tonumber(fv.second, small_packet_percentage);
+                }
+            }
+
+            double speed_of_light = 198000000;
+            double minimal_packet_size = 64;
+
+            double worst_case_factor;
+            if (number(has_cell_size, cell_size) > 2 * minimal_packet_size)
+            {
+                worst_case_factor = cell_size / minimal_packet_size;
+            }
+            else
+            {
+                worst_case_factor = (2 * cell_size) / (1 + cell_size);
+            }
+
+            number(has_small_packet_percentage, small_packet_percentage);
+            double cell_occupancy = (100 - small_packet_percentage + small_packet_percentage * worst_case_factor) / 100;
+
+            double bytes_on_gearbox;
+            if (gearbox_delay == 0)
+            {
+                bytes_on_gearbox = 0;
+            }
+            else
+            {
+                bytes_on_gearbox = port_speed * gearbox_delay / (8 * 1024);
+            }
+
+            if (has_pause_quanta)
+            {
+                peer_response_time = (pause_quanta_per_speed[port_speed]) * 512 / 8;
+                has_peer_response_time = true;
+            }
+
+            if (port_speed == 400000)
+            {
+                peer_response_time = 2 * number(has_peer_response_time, peer_response_time);
+            }
+
+            double bytes_on_cable = 2 * cable_length * port_speed * 1000000000 / speed_of_light / (8 * 1024);
+            double propagation_delay = port_mtu + bytes_on_cable + 2 * bytes_on_gearbox + number(has_mac_phy_delay, mac_phy_delay) + number(has_peer_response_time, peer_response_time);
+
+            double xoff_value = number(has_lossless_mtu, lossless_mtu) + propagation_delay * cell_occupancy;
+            xoff_value = ceil(xoff_value / 1024) * 1024;
+            double xon_value = number(has_pipeline_latency, pipeline_latency);
+            xon_value = ceil(xon_value / 1024) * 1024;
+
+            double headroom_size = xon_value;
+            headroom_size = ceil(headroom_size / 1024) * 1024;
+
+            ret.push_back("xon:" + str(ceil(xon_value)));
+            ret.push_back("xoff:" + str(ceil(xoff_value)));
+            ret.push_back("size:" + str(ceil(headroom_size)));
+
+            return ret;
+        }
+
+        vector<string> pool_mellanox()
+        {
+            double port_count_8lanes = 0;
+            double lossypg_8lanes = 0;
+            map<string, bool> ingress_profile_is_lossless;
+            double private_headroom = 10 * 1024;
+            vector<string> result;
+            map<string, double> profiles;
+            double total_port = 0;
+            double mgmt_pool_size = 256 * 1024;
+            double egress_mirror_headroom = 10 * 1024;
+            map<string, bool> port_set_8lanes;
+            double lossless_port_count = 0;
+
+            auto iterate_all_items = [&](vector<string> all_items, bool check_lossless)
+            {
+                sort(all_items.begin(), all_items.end());
+                set<string> lossless_ports;
+                for (auto &item : all_items)
+                {
+                    if (item.size() >= 4 && item.substr(item.size() - 4) == "_SET")
+                    {
+                        return 1;
+                    }
+                    smatch port_match, range_match;
+                    if (regex_search(item, port_match, regex("Ethernet[0-9]+")))
+                    {
+                        string port = port_match[0];
+                        regex_search(item, range_match, regex("Ethernet[0-9]+:([^\\s]+)$"));
+                        string range = range_match[1];
+                        auto profile_name_without_table = hget(appl_db, item, "profile");
+                        if (!profile_name_without_table)
+                        {
+                            return 1;
+                        }
+                        string profile_name = "BUFFER_PROFILE_TABLE:" + *profile_name_without_table;
+                        if (!profiles.count(profile_name))
+                        {
+                            return 1;
+                        }
+                        double size;
+                        if (range.size() == 1)
+                        {
+                            size = 1;
+                        }
+                        else
+                        {
+                            size = 1 + number(tonumber(range.substr(range.size() - 1))) - number(tonumber(range.substr(0, 1)));
+                        }
+                        profiles[profile_name] += size;
+                        if (port_set_8lanes.count(port) && port_set_8lanes[port]
+                            && ingress_profile_is_lossless.count(profile_name) && !ingress_profile_is_lossless[profile_name])
+                        {
+                            lossypg_8lanes = lossypg_8lanes + size;
+                        }
+                        if (check_lossless && ingress_profile_is_lossless.count(profile_name) && ingress_profile_is_lossless[profile_name])
+                        {
+                            if (lossless_ports.insert(port).second)
+                            {
+                                lossless_port_count = lossless_port_count + 1;
+                            }
+                        }
+                    }
+                }
+                return 0;
+            };
+
+            auto iterate_profile_list = [&](const vector<string> &all_items)
+            {
+                for (auto &item : all_items)
+                {
+                    if (item.size() >= 4 && item.substr(item.size() - 4) == "_SET")
+                    {
+                        return 1;
+                    }
+                    auto profile_list = hget(appl_db, item, "profile_list");
+                    if (!profile_list)
+                    {
+                        return 0;
+                    }
+                    regex token("[^,]+");
+                    for (sregex_iterator it(profile_list->begin(), profile_list->end(), token); it != sregex_iterator(); ++it)
+                    {
+                        string profile_name = "BUFFER_PROFILE_TABLE:" + it->str();
+                        if (ingress_profile_is_lossless.count(profile_name) && !ingress_profile_is_lossless[profile_name])
+                        {
+                            profile_name = profile_name + "_list";
+                            if (!profiles.count(profile_name))
+                            {
+                                profiles[profile_name] = 0;
+                            }
+                        }
+                        if (!profiles.count(profile_name))
+                        {
+                            return 1;
+                        }
+                        profiles[profile_name] += 1;
+                    }
+                }
+                return 0;
+            };
+
+            auto fetch_buffer_pool_size_from_appldb = [&](bool shp_enabled)
+            {
+                vector<string> buffer_pools;
+                for (auto &key : keys(config_db, "BUFFER_POOL|"))
+                {
+                    if (!hget(config_db, key, "size"))
+                    {
+                        buffer_pools.push_back(key.substr(strlen("BUFFER_POOL|")));
+                    }
+                }
+                for (auto &pool : buffer_pools)
+                {
+                    auto size_field = hget(appl_db, "BUFFER_POOL_TABLE:" + pool, "size");
+                    string size = size_field ? *size_field : "0";
+                    auto xoff = hget(appl_db, "BUFFER_POOL_TABLE:" + pool, "xoff");
+                    if (!xoff)
+                    {
+                        if (shp_enabled && size == "0" && pool == "ingress_lossless_pool")
+                        {
+                            result.push_back(pool + ":2048:1024");
+                        }
+                        else
+                        {
+                            result.push_back(pool + ":" + size);
+                        }
+                    }
+                    else
+                    {
+                        result.push_back(pool + ":" + size + ":" + *xoff);
+                    }
+                }
+            };
+
+            vector<string> ipools, epools;
+            for (auto &pool : keys(config_db, "BUFFER_POOL|"))
+            {
+                auto type = hget(config_db, pool, "type");
+                if (type && *type == "ingress")
+                {
+                    ipools.push_back(pool);
+                }
+                else if (type && *type == "egress")
+                {
+                    epools.push_back(pool);
+                }
+            }
+
+            auto ports_table = keys(config_db, "PORT|");
+            total_port = static_cast<double>(ports_table.size());
+
+            double number_of_lanes = 0;
+            double admin_up_port = 0;
+            double admin_up_8lanes_port = 0;
+            for (auto &port_key : ports_table)
+            {
+                auto lanes = hget(config_db, port_key, "lanes");
+                if (lanes)
+                {
+                    number_of_lanes = static_cast<double>(count(lanes->begin(), lanes->end(), ',')) + 1;
+                    string port = port_key.substr(5);
+                    if (number_of_lanes == 8)
+                    {
+                        port_set_8lanes[port] = true;
+                        port_count_8lanes = port_count_8lanes + 1;
+                    }
+                    else
+                    {
+                        port_set_8lanes[port] = false;
+                    }
+                }
+                auto admin_status = hget(config_db, port_key, "admin_status");
+                if (admin_status && *admin_status == "up")
+                {
+                    admin_up_port = admin_up_port + 1;
+                    if (number_of_lanes == 8)
+                    {
+                        admin_up_8lanes_port = admin_up_8lanes_port + 1;
+                    }
+                }
+                number_of_lanes = 0;
+            }
+
+            auto egress_lossless_pool_size = hget(config_db, "BUFFER_POOL|egress_lossless_pool", "size");
+
+            auto default_lossless_param_keys = keys(config_db, "DEFAULT_LOSSLESS_BUFFER_PARAMETER");
+            bool has_over_subscribe_ratio = true;
+            double over_subscribe_ratio = 0;
+            if (!default_lossless_param_keys.empty())
+            {
+                has_over_subscribe_ratio = tonumber(hget(config_db, default_lossless_param_keys[0], "over_subscribe_ratio"), over_subscribe_ratio);
+            }
+
+            double shp_size;
+            bool has_shp_size = tonumber(hget(config_db, "BUFFER_POOL|ingress_lossless_pool", "xoff"), shp_size);
+
+            bool shp_enabled = false;
+            if (has_over_subscribe_ratio && over_subscribe_ratio != 0)
+            {
+                shp_enabled = true;
+            }
+
+            if (has_shp_size && shp_size != 0)
+            {
+                shp_enabled = true;
+            }
+            else
+            {
+                shp_size = 0;
+            }
+
+            double mmu_size;
+            if (!tonumber(hget(state_db, "BUFFER_MAX_PARAM_TABLE|global", "mmu_size"), mmu_size))
+            {
+                mmu_size = number(tonumber(egress_lossless_pool_size));
+            }
+            auto asic_keys = keys(state_db, "ASIC_TABLE");
+            double cell_size = number(tonumber(hget(state_db, asic_keys.at(0), "cell_size")));
+            double pipeline_latency = number(tonumber(hget(state_db, asic_keys.at(0), "pipeline_latency")));
+
+            double lossypg_reserved = pipeline_latency * 1024;
+            double lossypg_reserved_8lanes = (2 * pipeline_latency - 1) * 1024;
+
+            double number_of_cells = floor(mmu_size / cell_size);
+            double ceiling_mmu_size = number_of_cells * cell_size;
+
+            for (auto &profile : keys(appl_db, "BUFFER_PROFILE"))
+            {
+                if (profile != "BUFFER_PROFILE_TABLE_KEY_SET" && profile != "BUFFER_PROFILE_TABLE_DEL_SET")
+                {
+                    auto pool = hget(appl_db, profile, "pool");
+                    for (auto &ipool : ipools)
+                    {
+                        if ("BUFFER_POOL|" + *pool == ipool)
+                        {
+                            ingress_profile_is_lossless[profile] = (hget(appl_db, profile, "xoff") != nullptr);
+                            break;
+                        }
+                    }
+                    profiles[profile] = 0;
+                }
+            }
+
+            auto all_pgs = keys(appl_db, "BUFFER_PG");
+            auto all_tcs = keys(appl_db, "BUFFER_QUEUE");
+
+            int fail_count = 0;
+            fail_count = fail_count + iterate_all_items(all_pgs, true);
+            fail_count = fail_count + iterate_all_items(all_tcs, false);
+            if (fail_count > 0)
+            {
+                fetch_buffer_pool_size_from_appldb(shp_enabled);
+                return result;
+            }
+
+            auto all_ingress_profile_lists = keys(appl_db, "BUFFER_PORT_INGRESS_PROFILE_LIST");
+            auto all_egress_profile_lists = keys(appl_db, "BUFFER_PORT_EGRESS_PROFILE_LIST");
+
+            fail_count = fail_count + iterate_profile_list(all_ingress_profile_lists);
+            fail_count = fail_count + iterate_profile_list(all_egress_profile_lists);
+            if (fail_count > 0)
+            {
+                fetch_buffer_pool_size_from_appldb(shp_enabled);
+                return result;
+            }
+
+            vector<string> statistics;
+
+            double accumulative_occupied_buffer = 0;
+            double accumulative_xoff = 0;
+
+            for (auto &it : profiles)
+            {
+                auto &name = it.first;
+                double size;
+                if (tonumber(hget(appl_db, name, "size"), size))
+                {
+                    if (ingress_profile_is_lossless.count(name) && !ingress_profile_is_lossless[name])
+                    {
+                        size = size + lossypg_reserved;
+                    }
+                    if (size != 0)
+                    {
+                        if (shp_size == 0)
+                        {
+                            double xon, xoff;
+                            if (tonumber(hget(appl_db, name, "xon"), xon) && tonumber(hget(appl_db, name, "xoff"), xoff) && xon + xoff > size)
+                            {
+                                accumulative_xoff = accumulative_xoff + (xon + xoff - size) * it.second;
+                            }
+                        }
+                        accumulative_occupied_buffer = accumulative_occupied_buffer + size * it.second;
+                    }
+                    statistics.push_back(name + ":" + str(size) + ":" + str(it.second));
+                }
+                else
+                {
+                    statistics.push_back(name + ":-:" + str(it.second));
+                }
+            }
+
+            double lossypg_extra_for_8lanes = (lossypg_reserved_8lanes - lossypg_reserved) * lossypg_8lanes;
+            accumulative_occupied_buffer = accumulative_occupied_buffer + lossypg_extra_for_8lanes;
+
+            double accumulative_private_headroom = 0;
+            bool force_enable_shp = false;
+            if (accumulative_xoff > 0 && !shp_enabled)
+            {
+                force_enable_shp = true;
+                shp_size = 655360;
+                shp_enabled = true;
+            }
+            if (shp_enabled)
+            {
+                accumulative_private_headroom = lossless_port_count * private_headroom;
+                accumulative_occupied_buffer = accumulative_occupied_buffer + accumulative_private_headroom;
+                accumulative_xoff = accumulative_xoff - accumulative_private_headroom;
+                if (accumulative_xoff < 0)
+                {
+                    accumulative_xoff = 0;
+                }
+            }
+
+            double accumulative_management_pg = (admin_up_port - admin_up_8lanes_port) * lossypg_reserved + admin_up_8lanes_port * lossypg_reserved_8lanes;
+            accumulative_occupied_buffer = accumulative_occupied_buffer + accumulative_management_pg;
+
+            double accumulative_egress_mirror_overhead = admin_up_port * egress_mirror_headroom;
+            accumulative_occupied_buffer = accumulative_occupied_buffer + accumulative_egress_mirror_overhead + mgmt_pool_size;
+
+            vector<string> pools_need_update;
+            int ingress_pool_count = 0;
+            bool has_ingress_lossless_pool_size = false;
+            double ingress_lossless_pool_size = 0;
+            for (auto &ipool : ipools)
+            {
+                double size;
+                if (!tonumber(hget(config_db, ipool, "size"), size))
+                {
+                    pools_need_update.push_back(ipool);
+                    ingress_pool_count = ingress_pool_count + 1;
+                }
+                else
+                {
+                    if (ipool == "BUFFER_POOL|ingress_lossless_pool" && shp_enabled && shp_size == 0)
+                    {
+                        ingress_lossless_pool_size = size;
+                        has_ingress_lossless_pool_size = true;
+                    }
+                }
+            }
+
+            for (auto &epool : epools)
+            {
+                if (!hget(config_db, epool, "size"))
+                {
+                    pools_need_update.push_back(epool);
+                }
+            }
+
+            if (shp_enabled && shp_size == 0)
+            {
+                shp_size = ceil(accumulative_xoff / over_subscribe_ratio);
+                if (shp_size == 0)
+                {
+                    shp_size = 655360;
+                }
+            }
+
+            accumulative_occupied_buffer = accumulative_occupied_buffer + shp_size;
+
+            double available_buffer = mmu_size - accumulative_occupied_buffer;
+            double pool_size;
+            if (ingress_pool_count == 1)
+            {
+                pool_size = available_buffer;
+            }
+            else
+            {
+                pool_size = available_buffer / 2;
+            }
+
+            if (pool_size > ceiling_mmu_size)
+            {
+                pool_size = ceiling_mmu_size;
+            }
+
+            bool shp_deployed = false;
+            for (auto &pool : pools_need_update)
+            {
+                double percentage;
+                double effective_pool_size;
+                if (tonumber(hget(config_db, pool, "percentage"), percentage) && percentage >= 0)
+                {
+                    effective_pool_size = available_buffer * percentage / 100;
+                }
+                else
+                {
+                    effective_pool_size = pool_size;
+                }
+                string pool_name = pool.substr(strlen("BUFFER_POOL|"));
+                if (shp_size != 0 && pool_name == "ingress_lossless_pool")
+                {
+                    result.push_back(pool_name + ":" + str(ceil(effective_pool_size)) + ":" + str(ceil(shp_size)));
+                    shp_deployed = true;
+                }
+                else
+                {
+                    result.push_back(pool_name + ":" + str(ceil(effective_pool_size)));
+                }
+            }
+
+            if (!shp_deployed && shp_size != 0 && has_ingress_lossless_pool_size)
+            {
+                result.push_back("ingress_lossless_pool:" + str(ceil(ingress_lossless_pool_size)) + ":" + str(ceil(shp_size)));
+            }
+
+            result.push_back("debug:mmu_size:" + str(mmu_size));
+            result.push_back("debug:accumulative size:" + str(accumulative_occupied_buffer));
+            for (auto &line : statistics)
+            {
+                result.push_back("debug:" + line);
+            }
+            result.push_back("debug:extra_8lanes:" + str(lossypg_reserved_8lanes - lossypg_reserved) + ":" + str(lossypg_8lanes) + ":" + str(port_count_8lanes));
+            result.push_back("debug:mgmt_pool:" + str(mgmt_pool_size));
+            if (shp_enabled)
+            {
+                result.push_back("debug:accumulative_private_headroom:" + str(accumulative_private_headroom));
+                result.push_back("debug:accumulative xoff:" + str(accumulative_xoff));
+                result.push_back(string("debug:force enabled shp:") + (force_enable_shp ? "true" : "false"));
+            }
+            result.push_back("debug:accumulative_mgmt_pg:" + str(accumulative_management_pg));
+            result.push_back("debug:egress_mirror:" + str(accumulative_egress_mirror_overhead));
+            result.push_back(string("debug:shp_enabled:") + (shp_enabled ? "true" : "false"));
+            result.push_back("debug:shp_size:" + str(shp_size));
+            result.push_back("debug:total port:" + str(total_port) + " ports with 8 lanes:" + str(port_count_8lanes));
+            result.push_back("debug:admin up port:" + str(admin_up_port) + " admin up ports with 8 lanes:" + str(admin_up_8lanes_port));
+
+            return result;
+        }
+
+        vector<string> pool_barefoot()
+        {
+            vector<string> result;
+
+            auto asic_keys = keys(state_db, "ASIC_TABLE");
+            double cell_size = number(tonumber(hget(state_db, asic_keys.at(0), "cell_size")));
+
+            double ppg_headroom = 400 * cell_size;
+
+            double ports_num = static_cast<double>(keys(config_db, "PORT|").size());
+
+            double shp_size = ceil(ports_num * 2 * ppg_headroom * 0.7);
+
+            double ingress_lossless_pool_size_fixed = number(tonumber(hget(config_db, "BUFFER_POOL|ingress_lossless_pool", "size")));
+            double ingress_lossy_pool_size_fixed = number(tonumber(hget(config_db, "BUFFER_POOL|ingress_lossy_pool", "size")));
+            double egress_lossy_pool_size_fixed = number(tonumber(hget(config_db, "BUFFER_POOL|egress_lossy_pool", "size")));
+
+            result.push_back("ingress_lossless_pool:" + str(ingress_lossless_pool_size_fixed) + ":" + str(shp_size));
+            result.push_back("ingress_lossy_pool:" + str(ingress_lossy_pool_size_fixed));
+            result.push_back("egress_lossy_pool:" + str(egress_lossy_pool_size_fixed));
+
+            return result;
+        }
+
+    private:
+        /* KEYS <prefix>* */
+        static vector<string> keys(const map<string, Hash> &db, const string &prefix)
+        {
+            vector<string> result;
+            for (auto &it : db)
+            {
+                if (it.first.compare(0, prefix.size(), prefix) == 0)
+                {
+                    result.push_back(it.first);
+                }
+            }
+            return result;
+        }
+
+        static const string *hget(const map<string, Hash> &db, const string &key, const string &field)
+        {
+            auto it = db.find(key);
+            if (it == db.end() || it->second.find(field) == it->second.end())
+            {
+                return nullptr;
+            }
+            return &it->second.at(field);
+        }
+
+        static bool tonumber(const string &value, double &result)
+        {
+            char *end = nullptr;
+            result = strtod(value.c_str(), &end);
+            if (end == value.c_str())
+            {
+                return false;
+            }
+            while (isspace(static_cast<unsigned char>(*end)))
+            {
+                end++;
+            }
+            return *end == '\0';
+        }
+
+        static bool tonumber(const string *value, double &result)
+        {
+            return value && tonumber(*value, result);
+        }
+
+        static pair<bool, double> tonumber(const string *value)
+        {
+            double result = 0;
+            bool valid = tonumber(value, result);
+            return {valid, result};
+        }
+
+        static pair<bool, double> tonumber(const string &value)
+        {
+            return tonumber(&value);
+        }
+
+        /* Arithmetic on nil */
+        static double number(bool valid, double value)
+        {
+            if (!valid)
+            {
+                throw runtime_error("attempt to perform arithmetic on a nil value");
+            }
+            return value;
+        }
+
+        static double number(const pair<bool, double> &value)
+        {
+            return number(value.first, value.second);
+        }
+
+        static string str(double value)
+        {
+            char buf[32];
+            snprintf(buf, sizeof(buf), "%.14g", value);
+            return buf;
+        }
+    };
+
+    struct BufferCalcTest : public ::testing::Test
+    {
+        LuaBufferPlugins m_lua;
+        BufferCalculator m_calculator;
+
+        const map<BufferCalculator::appl_table_t, string> m_applTableNames = {
+            {BufferCalculator::APPL_BUFFER_POOL, "BUFFER_POOL_TABLE:"},
+            {BufferCalculator::APPL_BUFFER_PROFILE, "BUFFER_PROFILE_TABLE:"},
+            {BufferCalculator::APPL_BUFFER_PG, "BUFFER_PG_TABLE:"},
+            {BufferCalculator::APPL_BUFFER_QUEUE, "BUFFER_QUEUE_TABLE:"},
+            {BufferCalculator::APPL_BUFFER_INGRESS_PROFILE_LIST, "BUFFER_PORT_INGRESS_PROFILE_LIST_TABLE:"},
+            {BufferCalculator::APPL_BUFFER_EGRESS_PROFILE_LIST, "BUFFER_PORT_EGRESS_PROFILE_LIST_TABLE:"}
+        };
+
+        static vector<FieldValueTuple> fieldValues(const Hash &hash)
+        {
+            return vector<FieldValueTuple>(hash.begin(), hash.end());
+        }
+
+        void SetUp() override
+        {
+            setAsic("MELLANOX-SPECTRUM-3", "144");
+            m_lua.config_db["LOSSLESS_TRAFFIC_PATTERN|AZURE"] = {{"enabled", "true"}, {"mtu", "1024"}, {"small_packet_percentage", "100"}};
+            m_lua.config_db["DEFAULT_LOSSLESS_BUFFER_PARAMETER|AZURE"] = {{"default_dynamic_th", "0"}};
+        }
+
+        void setAsic(const string &name, const string &cell_size)
+        {
+            m_lua.state_db.erase(m_lua.state_db.lower_bound("ASIC_TABLE"), m_lua.state_db.lower_bound("ASIC_TABLF"));
+            m_lua.state_db["ASIC_TABLE|" + name] = {
+                {"cell_size", cell_size},
+                {"pipeline_latency", "19"},
+                {"mac_phy_delay", "0.8"},
+                {"peer_response_time", "3.8"}
+            };
+        }
+
+        void setOverSubscribeRatio(const string &ratio)
+        {
+            if (ratio.empty())
+            {
+                m_lua.config_db["DEFAULT_LOSSLESS_BUFFER_PARAMETER|AZURE"].erase("over_subscribe_ratio");
+            }
+            else
+            {
+                m_lua.config_db["DEFAULT_LOSSLESS_BUFFER_PARAMETER|AZURE"]["over_subscribe_ratio"] = ratio;
+            }
+        }
+
+        buffer_calc_parameters_t parameters()
+        {
+            buffer_calc_parameters_t params;
+            auto asic = m_lua.state_db.lower_bound("ASIC_TABLE|");
+            params.asic_name = asic->first.substr(strlen("ASIC_TABLE|"));
+            params.asic_table = asic->second;
+            params.lossless_traffic_pattern = m_lua.config_db["LOSSLESS_TRAFFIC_PATTERN|AZURE"];
+            auto &param = m_lua.config_db["DEFAULT_LOSSLESS_BUFFER_PARAMETER|AZURE"];
+            if (param.count("over_subscribe_ratio"))
+            {
+                params.over_subscribe_ratio = param["over_subscribe_ratio"];
+            }
+            auto maxParam = m_lua.state_db.find("BUFFER_MAX_PARAM_TABLE|global");
+            if (maxParam != m_lua.state_db.end())
+            {
+                params.mmu_size = maxParam->second["mmu_size"];
+            }
+            return params;
+        }
+
+        void setPort(const string &port, uint32_t lanes, bool admin_up)
+        {
+            string laneList;
+            for (uint32_t i = 0; i < lanes; i++)
+            {
+                laneList += (i ? "," : "") + to_string(i);
+            }
+            Hash hash = {{"lanes", laneList}, {"speed", "100000"}, {"mtu", "9100"}};
+            if (admin_up)
+            {
+                hash["admin_status"] = "up";
+            }
+            m_lua.config_db["PORT|" + port] = hash;
+            m_calculator.setPort(port, fieldValues(hash));
+        }
+
+        void delPort(const string &port)
+        {
+            m_lua.config_db.erase("PORT|" + port);
+            m_calculator.delPort(port);
+        }
+
+        void setPool(const string &pool, const Hash &hash)
+        {
+            m_lua.config_db["BUFFER_POOL|" + pool] = hash;
+            m_calculator.setPool(pool, fieldValues(hash));
+        }
+
+        void setAppl(BufferCalculator::appl_table_t table, const string &key, const Hash &hash)
+        {
+            auto &entry = m_lua.appl_db[m_applTableNames.at(table) + key];
+            for (auto &it : hash)
+            {
+                entry[it.first] = it.second;
+            }
+            m_calculator.setApplEntry(table, key, fieldValues(hash));
+        }
+
+        void delAppl(BufferCalculator::appl_table_t table, const string &key)
+        {
+            m_lua.appl_db.erase(m_applTableNames.at(table) + key);
+            m_calculator.delApplEntry(table, key);
+        }
+
+        void expectSameHeadroom(const string &vendor, const string &speed, const string &cable, const string &mtu, const string &gearbox, long lanes)
+        {
+            vector<string> native, lua;
+            ASSERT_TRUE(m_calculator.calculateHeadroom(parameters(), speed, cable, mtu, gearbox, lanes, native));
+            if (vendor == "barefoot")
+            {
+                lua = m_lua.headroom_barefoot(speed, cable, mtu, gearbox);
+            }
+            else
+            {
+                lua = m_lua.headroom_mellanox(speed, cable, mtu, gearbox, to_string(lanes));
+            }
+            EXPECT_EQ(native, lua) << vendor << " " << speed << " " << cable << " " << mtu << " " << gearbox << " " << lanes;
+        }
+
+        void expectSamePools(const string &vendor = "mellanox")
+        {
+            vector<string> native, lua;
+            ASSERT_TRUE(m_calculator.calculatePools(parameters(), native));
+            lua = vendor == "barefoot" ? m_lua.pool_barefoot() : m_lua.pool_mellanox();
+
+            sort(native.begin(), native.end());
+            sort(lua.begin(), lua.end());
+            EXPECT_EQ(native, lua);
+        }
+
+        /* A lossy PG, two lossless PGs, three queue ranges and both profile lists on each port */
+        void applyPortBuffer(const string &port, const string &losslessProfile)
+        {
+            setAppl(BufferCalculator::APPL_BUFFER_PG, port + ":0", {{"profile", "ingress_lossy_profile"}});
+            setAppl(BufferCalculator::APPL_BUFFER_PG, port + ":3-4", {{"profile", losslessProfile}});
+            setAppl(BufferCalculator::APPL_BUFFER_QUEUE, port + ":0-2", {{"profile", "egress_lossy_profile"}});
+            setAppl(BufferCalculator::APPL_BUFFER_QUEUE, port + ":3-4", {{"profile", "egress_lossless_profile"}});
+            setAppl(BufferCalculator::APPL_BUFFER_QUEUE, port + ":5-6", {{"profile", "egress_lossy_profile"}});
+            setAppl(BufferCalculator::APPL_BUFFER_INGRESS_PROFILE_LIST, port, {{"profile_list", "ingress_lossy_profile"}});
+            setAppl(BufferCalculator::APPL_BUFFER_EGRESS_PROFILE_LIST, port, {{"profile_list", "egress_lossless_profile,egress_lossy_profile"}});
+        }
+
+        void setLosslessProfile(const string &name, const string &xon, const string &xoff, const string &size)
+        {
+            setAppl(BufferCalculator::APPL_BUFFER_PROFILE, name, {
+                {"xon", xon}, {"xoff", xoff}, {"size", size}, {"pool", "ingress_lossless_pool"}, {"dynamic_th", "0"}
+            });
+        }
+    };
+
+    TEST_F(BufferCalcTest, HeadroomSameAsLua)
+    {
+        const vector<pair<string, string>> asics = {
+            {"MELLANOX-SPECTRUM-3", "144"},
+            {"MELLANOX-SPECTRUM-4", "192"},
+            {"BAREFOOT-TOFINO-2", "80"}
+        };
+        /* 30000 has no pause quanta, the peer response time of the ASIC is used */
+        const vector<string> speeds = {"100", "1000", "10000", "25000", "30000", "40000", "50000", "100000", "200000", "400000", "800000"};
+        const vector<string> cables = {"5m", "40m", "300m"};
+        const vector<string> mtus = {"1500", "9100"};
+        const vector<string> gearboxes = {"", "0", "412"};
+
+        for (auto &vendor : {"mellanox", "vs", "barefoot"})
+        {
+            ASSERT_TRUE(m_calculator.setVendor(vendor));
+
+            for (auto &asic : asics)
+            {
+                setAsic(asic.first, asic.second);
+
+                for (int shp = 0; shp < 3; shp++)
+                {
+                    setOverSubscribeRatio(shp == 1 ? "2" : "");
+                    if (shp == 2)
+                    {
+                        setPool("ingress_lossless_pool", {{"type", "ingress"}, {"mode", "dynamic"}, {"xoff", "1024000"}});
+                    }
+                    else
+                    {
+                        setPool("ingress_lossless_pool", {{"type", "ingress"}, {"mode", "dynamic"}});
+                    }
+
+                    for (auto &speed : speeds)
+                        for (auto &cable : cables)
+                            for (auto &mtu : mtus)
+                                for (auto &gearbox : gearboxes)
+                                    for (long lanes : {4, 8})
+                                        expectSameHeadroom(vendor, speed, cable, mtu, gearbox, lanes);
+                }
+            }
+        }
+
+        ASSERT_FALSE(m_calculator.setVendor("broadcom"));
+    }
+
+    TEST_F(BufferCalcTest, PoolSameAsLua)
+    {
+        ASSERT_TRUE(m_calculator.setVendor("mellanox"));
+
+        m_lua.state_db["BUFFER_MAX_PARAM_TABLE|global"] = {{"mmu_size", "13945824"}};
+        setPool("ingress_lossless_pool", {{"type", "ingress"}, {"mode", "dynamic"}});
+        setPool("egress_lossless_pool", {{"type", "egress"}, {"mode", "dynamic"}, {"size", "13945824"}});
+        setPool("egress_lossy_pool", {{"type", "egress"}, {"mode", "dynamic"}});
+        setAppl(BufferCalculator::APPL_BUFFER_POOL, "ingress_lossless_pool", {{"type", "ingress"}, {"mode", "dynamic"}, {"size", "0"}});
+        setAppl(BufferCalculator::APPL_BUFFER_POOL, "egress_lossless_pool", {{"type", "egress"}, {"mode", "dynamic"}, {"size", "13945824"}});
+        setAppl(BufferCalculator::APPL_BUFFER_POOL, "egress_lossy_pool", {{"type", "egress"}, {"mode", "dynamic"}, {"size", "0"}});
+
+        vector<string> ports;
+        for (uint32_t i = 0; i < 32; i++)
+        {
+            ports.push_back("Ethernet" + to_string(i * 8));
+            setPort(ports.back(), i % 4 == 0 ? 8 : 4, i % 5 != 0);
+        }
+        expectSamePools();
+
+        setAppl(BufferCalculator::APPL_BUFFER_PROFILE, "ingress_lossy_profile", {{"pool", "ingress_lossless_pool"}, {"size", "0"}, {"dynamic_th", "3"}});
+        setAppl(BufferCalculator::APPL_BUFFER_PROFILE, "egress_lossless_profile", {{"pool", "egress_lossless_pool"}, {"size", "0"}, {"dynamic_th", "7"}});
+        setAppl(BufferCalculator::APPL_BUFFER_PROFILE, "egress_lossy_profile", {{"pool", "egress_lossy_pool"}, {"size", "9216"}, {"dynamic_th", "7"}});
+        setLosslessProfile("pg_lossless_100000_5m_profile", "19456", "29696", "49152");
+        for (auto &port : ports)
+        {
+            applyPortBuffer(port, "pg_lossless_100000_5m_profile");
+        }
+        expectSamePools();
+
+        /* Cable length updated on some ports, the old profile is removed once no longer referenced */
+        setLosslessProfile("pg_lossless_100000_40m_profile", "19456", "43008", "62464");
+        for (size_t i = 0; i < ports.size(); i += 3)
+        {
+            setAppl(BufferCalculator::APPL_BUFFER_PG, ports[i] + ":3-4", {{"profile", "pg_lossless_100000_40m_profile"}});
+            expectSamePools();
+        }
+        for (size_t i = 0; i < ports.size(); i++)
+        {
+            if (i % 3)
+            {
+                setAppl(BufferCalculator::APPL_BUFFER_PG, ports[i] + ":3-4", {{"profile", "pg_lossless_100000_40m_profile"}});
+            }
+        }
+        delAppl(BufferCalculator::APPL_BUFFER_PROFILE, "pg_lossless_100000_5m_profile");
+        expectSamePools();
+
+        /* Lanes and admin status updated */
+        setPort(ports[1], 8, true);
+        setPort(ports[4], 4, true);
+        setPort(ports[5], 8, false);
+        expectSamePools();
+
+        /* Shared headroom pool enabled by over subscribe ratio, then by size */
+        setOverSubscribeRatio("2");
+        expectSamePools();
+        setLosslessProfile("pg_lossless_100000_40m_profile", "19456", "43008", "19456");
+        expectSamePools();
+        setPool("ingress_lossless_pool", {{"type", "ingress"}, {"mode", "dynamic"}, {"xoff", "2048000"}});
+        expectSamePools();
+        setOverSubscribeRatio("");
+        setPool("ingress_lossless_pool", {{"type", "ingress"}, {"mode", "dynamic"}});
+        expectSamePools();
+
+        /* Shared headroom pool force enabled by xoff exceeding size */
+        setLosslessProfile("pg_lossless_100000_40m_profile", "19456", "43008", "20480");
+        expectSamePools();
+
+        /* Percentage of the available buffer */
+        setPool("egress_lossy_pool", {{"type", "egress"}, {"mode", "dynamic"}, {"percentage", "40"}});
+        expectSamePools();
+
+        /* A second ingress pool the lossy profile moves to */
+        setPool("ingress_lossy_pool", {{"type", "ingress"}, {"mode", "dynamic"}});
+        setAppl(BufferCalculator::APPL_BUFFER_PROFILE, "ingress_lossy_profile", {{"pool", "ingress_lossy_pool"}});
+        expectSamePools();
+
+        /* Static pool size */
+        setPool("egress_lossy_pool", {{"type", "egress"}, {"mode", "dynamic"}, {"size", "3000000"}});
+        expectSamePools();
+
+        /* Items removed */
+        for (size_t i = 0; i < ports.size(); i += 2)
+        {
+            delAppl(BufferCalculator::APPL_BUFFER_PG, ports[i] + ":3-4");
+            delAppl(BufferCalculator::APPL_BUFFER_QUEUE, ports[i] + ":5-6");
+            delAppl(BufferCalculator::APPL_BUFFER_INGRESS_PROFILE_LIST, ports[i]);
+        }
+        expectSamePools();
+
+        /* Ports removed */
+        for (size_t i = 0; i < ports.size(); i += 4)
+        {
+            delPort(ports[i]);
+        }
+        expectSamePools();
+
+        /* No mmu size in STATE_DB, the size of egress_lossless_pool is taken */
+        m_lua.state_db.erase("BUFFER_MAX_PARAM_TABLE|global");
+        setPool("egress_lossless_pool", {{"type", "egress"}, {"mode", "dynamic"}, {"size", "12000000"}});
+        expectSamePools();
+    }
+
+    TEST_F(BufferCalcTest, PoolFallbackSameAsLua)
+    {
+        ASSERT_TRUE(m_calculator.setVendor("vs"));
+
+        m_lua.state_db["BUFFER_MAX_PARAM_TABLE|global"] = {{"mmu_size", "13945824"}};
+        setPool("ingress_lossless_pool", {{"type", "ingress"}, {"mode", "dynamic"}});
+        setPool("egress_lossless_pool", {{"type", "egress"}, {"mode", "dynamic"}, {"size", "13945824"}});
+        setPool("egress_lossy_pool", {{"type", "egress"}, {"mode", "dynamic"}});
+        setAppl(BufferCalculator::APPL_BUFFER_POOL, "ingress_lossless_pool", {{"type", "ingress"}, {"mode", "dynamic"}, {"size", "0"}});
+        setAppl(BufferCalculator::APPL_BUFFER_POOL, "egress_lossy_pool", {{"type", "egress"}, {"mode", "dynamic"}, {"size", "4000000"}, {"xoff", "0"}});
+        setPort("Ethernet0", 4, true);
+
+        setAppl(BufferCalculator::APPL_BUFFER_PROFILE, "ingress_lossy_profile", {{"pool", "ingress_lossless_pool"}, {"size", "0"}, {"dynamic_th", "3"}});
+        setAppl(BufferCalculator::APPL_BUFFER_PROFILE, "egress_lossless_profile", {{"pool", "egress_lossless_pool"}, {"size", "0"}, {"dynamic_th", "7"}});
+        setAppl(BufferCalculator::APPL_BUFFER_PROFILE, "egress_lossy_profile", {{"pool", "egress_lossy_pool"}, {"size", "9216"}, {"dynamic_th", "7"}});
+        setLosslessProfile("pg_lossless_100000_5m_profile", "19456", "29696", "49152");
+        applyPortBuffer("Ethernet0", "pg_lossless_100000_5m_profile");
+        expectSamePools();
+
+        /* A PG referencing a profile that isn't in APPL_DB */
+        delAppl(BufferCalculator::APPL_BUFFER_PROFILE, "pg_lossless_100000_5m_profile");
+        expectSamePools();
+        setOverSubscribeRatio("2");
+        expectSamePools();
+
+        /* A profile list referencing a profile that isn't in APPL_DB */
+        delAppl(BufferCalculator::APPL_BUFFER_PG, "Ethernet0:3-4");
+        expectSamePools();
+        delAppl(BufferCalculator::APPL_BUFFER_PROFILE, "egress_lossy_profile");
+        delAppl(BufferCalculator::APPL_BUFFER_QUEUE, "Ethernet0:0-2");
+        delAppl(BufferCalculator::APPL_BUFFER_QUEUE, "Ethernet0:5-6");
+        expectSamePools();
+
+        delAppl(BufferCalculator::APPL_BUFFER_EGRESS_PROFILE_LIST, "Ethernet0");
+        expectSamePools();
+    }
+
+    TEST_F(BufferCalcTest, BarefootPoolSameAsLua)
+    {
+        ASSERT_TRUE(m_calculator.setVendor("barefoot"));
+        setAsic("BAREFOOT-TOFINO-2", "80");
+
+        setPool("ingress_lossless_pool", {{"type", "ingress"}, {"mode", "dynamic"}, {"size", "33004032"}});
+        setPool("ingress_lossy_pool", {{"type", "ingress"}, {"mode", "dynamic"}, {"size", "12766208"}});
+        setPool("egress_lossy_pool", {{"type", "egress"}, {"mode", "dynamic"}, {"size", "12766208"}});
+
+        for (uint32_t i = 0; i < 64; i++)
+        {
+            setPort("Ethernet" + to_string(i * 4), 4, true);
+            if (i % 16 == 0)
+            {
+                expectSamePools("barefoot");
+            }
+        }
+        delPort("Ethernet0");
+        expectSamePools("barefoot");
+
+        /* Pool without size */
+        setPool("ingress_lossy_pool", {{"type", "ingress"}, {"mode", "dynamic"}});
+        vector<string> native;
+        ASSERT_FALSE(m_calculator.calculatePools(parameters(), native));
+    }
+}
@@ -342,6 +342,95 @@ namespace consumer_test
 
     }
 
+    TEST_F(ConsumerTest, ConsumerAddToSync_KeyOrdered)
+    {
+        // Test case, the store keeps DEL then SET per key, and keys in key order
+
+        auto entrya = KeyOpFieldsValuesTuple(
+            { "key_b",
+                SET_COMMAND,
+                { { f1, v1a } } });
+
+        auto entryb = KeyOpFieldsValuesTuple(
+            { "key_a",
+                SET_COMMAND,
+                { { f1, v1a },
+                    { f2, v2a } } });
+
+        auto entryc = KeyOpFieldsValuesTuple(
+            { "key_a",
+                DEL_COMMAND,
+                { { } } });
+
+        auto entryd = KeyOpFieldsValuesTuple(
+            { "key_a",
+                SET_COMMAND,
+                { { f2, v2b } } });
+
+        auto entrye = KeyOpFieldsValuesTuple(
+            { "key_a",
+                SET_COMMAND,
+                { { f3, v3a } } });
+
+        kofv_q.push_back(entrya);
+        kofv_q.push_back(entryb);
+        kofv_q.push_back(entryc);
+        kofv_q.push_back(entryd);
+        kofv_q.push_back(entrye);
+        consumer->addToSync(kofv_q);
+
+        ASSERT_EQ(consumer->m_toSync.size(), 3);
+        ASSERT_EQ(consumer->m_toSync.count("key_a"), 2);
+
+        auto it = consumer->m_toSync.begin();
+        ASSERT_EQ(it->second, entryc);
+        ++it;
+        exp_kofv = KeyOpFieldsValuesTuple(
+            { "key_a",
+                SET_COMMAND,
+                { { f2, v2b },
+                    { f3, v3a } } });
+        ASSERT_EQ(it->second, exp_kofv);
+        ++it;
+        ASSERT_EQ(it->second, entrya);
+
+        // A key added later takes its place in key order
+        auto entryf = KeyOpFieldsValuesTuple(
+            { "key_ab",
+                SET_COMMAND,
+                { { f1, v1a } } });
+        consumer->addToSync(entryf);
+        it = consumer->m_toSync.find("key_a");
+        ++it;
+        ++it;
+        ASSERT_EQ(it->second, entryf);
+        ASSERT_EQ(consumer->m_toSync.erase("key_ab"), 1u);
+
+        // Erasing the DEL keeps the SET reachable by key and by iterator
+        auto set_it = std::next(consumer->m_toSync.find("key_a"));
+        it = consumer->m_toSync.erase(consumer->m_toSync.find("key_a"));
+        ASSERT_TRUE(it == set_it);
+        ASSERT_EQ(consumer->m_toSync.find("key_a")->second, exp_kofv);
+        ASSERT_EQ(consumer->m_toSync.count("key_a"), 1);
+        ASSERT_EQ(consumer->m_toSync.size(), 2);
+
+        // Iterating backward from the end visits each entry
+        auto rit = consumer->m_toSync.rbegin();
+        ASSERT_EQ(rit->second, entrya);
+        ++rit;
+        ASSERT_EQ(rit->second, exp_kofv);
+        ++rit;
+        ASSERT_TRUE(rit == consumer->m_toSync.rend());
+
+        // A DEL replaces the pending SET
+        consumer->addToSync(entryc);
+        ASSERT_EQ(consumer->m_toSync.count("key_a"), 1);
+        ASSERT_EQ(consumer->m_toSync.find("key_a")->second, entryc);
+
+        consumer->m_toSync.clear();
+        ASSERT_TRUE(consumer->m_toSync.empty());
+    }
+
     TEST_F(ConsumerTest, ConsumerPops_notification_count)
     {
         int consumer_pops_batch_size = 10;
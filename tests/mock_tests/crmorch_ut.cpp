@@ -0,0 +1,194 @@
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_table.h"
+
+extern sai_acl_api_t *sai_acl_api;
+
+namespace crmorch_test
+{
+    using namespace std;
+
+    uint32_t aclTableGetCount;
+
+    // The ACL counters available can't be queried, the ACL entries available depend on the table
+    sai_status_t getAclTableAttribute(sai_object_id_t table_id, uint32_t attr_count, sai_attribute_t *attr_list)
+    {
+        aclTableGetCount++;
+        for (uint32_t i = 0; i < attr_count; i++)
+        {
+            if (attr_list[i].id == SAI_ACL_TABLE_ATTR_AVAILABLE_ACL_COUNTER)
+            {
+                return SAI_STATUS_NOT_SUPPORTED;
+            }
+            attr_list[i].value.u32 = 100 + (uint32_t)(table_id & 0xff);
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    struct CrmOrchTest : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_config_db;
+        shared_ptr<swss::DBConnector> m_counters_db;
+        shared_ptr<swss::Table> m_countersCrmTable;
+        CrmOrch *m_crmOrch = nullptr;
+
+        void SetUp() override
+        {
+            ::testing_db::reset();
+
+            m_config_db = make_shared<swss::DBConnector>("CONFIG_DB", 0);
+            m_counters_db = make_shared<swss::DBConnector>("COUNTERS_DB", 0);
+            m_countersCrmTable = make_shared<swss::Table>(m_counters_db.get(), COUNTERS_CRM_TABLE);
+            m_crmOrch = new CrmOrch(m_config_db.get(), CFG_CRM_TABLE_NAME);
+        }
+
+        void TearDown() override
+        {
+            delete m_crmOrch;
+            m_crmOrch = nullptr;
+
+            ::testing_db::reset();
+        }
+
+        bool getCounter(const string &key, const string &field, string &value)
+        {
+            return m_countersCrmTable->hget(key, field, value);
+        }
+    };
+
+    TEST_F(CrmOrchTest, PublishesChangedCountersOnly)
+    {
+        string value;
+
+        m_crmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
+        m_crmOrch->incCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
+        Portal::CrmOrchInternal::updateCrmCountersTable(m_crmOrch);
+
+        ASSERT_TRUE(getCounter("STATS", "crm_stats_ipv4_route_used", value));
+        ASSERT_EQ(value, "2");
+        ASSERT_TRUE(getCounter("STATS", "crm_stats_ipv4_route_available", value));
+        ASSERT_EQ(value, "0");
+
+        // Nothing changed, so nothing is written again
+        m_countersCrmTable->del("STATS");
+        Portal::CrmOrchInternal::updateCrmCountersTable(m_crmOrch);
+        ASSERT_FALSE(getCounter("STATS", "crm_stats_ipv4_route_used", value));
+
+        // Only the counter that changed is written
+        m_crmOrch->decCrmResUsedCounter(CrmResourceType::CRM_IPV4_ROUTE);
+        Portal::CrmOrchInternal::updateCrmCountersTable(m_crmOrch);
+        ASSERT_TRUE(getCounter("STATS", "crm_stats_ipv4_route_used", value));
+        ASSERT_EQ(value, "1");
+        ASSERT_FALSE(getCounter("STATS", "crm_stats_ipv4_route_available", value));
+
+        // All the counters are written again once every CRM_COUNTERS_REPUBLISH_POLLS polls
+        for (uint32_t i = 3; i < CRM_COUNTERS_REPUBLISH_POLLS; i++)
+        {
+            Portal::CrmOrchInternal::updateCrmCountersTable(m_crmOrch);
+        }
+        ASSERT_FALSE(getCounter("STATS", "crm_stats_ipv4_route_available", value));
+        Portal::CrmOrchInternal::updateCrmCountersTable(m_crmOrch);
+        ASSERT_TRUE(getCounter("STATS", "crm_stats_ipv4_route_available", value));
+        ASSERT_EQ(value, "0");
+        ASSERT_TRUE(getCounter("STATS", "crm_stats_ipv4_route_used", value));
+        ASSERT_EQ(value, "1");
+    }
+
+    TEST_F(CrmOrchTest, AclTableCounters)
+    {
+        sai_object_id_t tableId = 0x7000000000001;
+        string value;
+
+        m_crmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, tableId);
+        m_crmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, tableId);
+        m_crmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_COUNTER, tableId);
+        m_crmOrch->decCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, tableId);
+
+        auto key = Portal::CrmOrchInternal::getCrmAclTableKey(m_crmOrch, tableId);
+        auto &entries = Portal::CrmOrchInternal::getResource(m_crmOrch, CrmResourceType::CRM_ACL_ENTRY);
+        auto &counters = Portal::CrmOrchInternal::getResource(m_crmOrch, CrmResourceType::CRM_ACL_COUNTER);
+        ASSERT_EQ(entries.countersMap.at(key).usedCounter, 1u);
+        ASSERT_EQ(entries.countersMap.at(key).id, tableId);
+        ASSERT_EQ(entries.countersById.at(tableId), &entries.countersMap.at(key));
+        ASSERT_EQ(counters.countersMap.at(key).usedCounter, 1u);
+
+        Portal::CrmOrchInternal::updateCrmCountersTable(m_crmOrch);
+        ASSERT_TRUE(getCounter(key, "crm_stats_acl_entry_used", value));
+        ASSERT_EQ(value, "1");
+        ASSERT_TRUE(getCounter(key, "crm_stats_acl_counter_used", value));
+        ASSERT_EQ(value, "1");
+
+        // Removing the ACL table drops its entry and counter usage
+        m_crmOrch->decCrmAclUsedCounter(CrmResourceType::CRM_ACL_TABLE, SAI_ACL_STAGE_INGRESS,
+                                        SAI_ACL_BIND_POINT_TYPE_PORT, tableId);
+        ASSERT_TRUE(entries.countersMap.empty());
+        ASSERT_TRUE(entries.countersById.empty());
+        ASSERT_TRUE(counters.countersMap.empty());
+        ASSERT_TRUE(counters.countersById.empty());
+        ASSERT_FALSE(getCounter(key, "crm_stats_acl_entry_used", value));
+    }
+
+    TEST_F(CrmOrchTest, AclTableAttributeNotSupported)
+    {
+        vector<sai_object_id_t> tableIds = { 0x7000000000001, 0x7000000000002 };
+        for (auto tableId : tableIds)
+        {
+            m_crmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_ENTRY, tableId);
+            m_crmOrch->incCrmAclTableUsedCounter(CrmResourceType::CRM_ACL_COUNTER, tableId);
+        }
+
+        auto *aclApi = sai_acl_api;
+        sai_acl_api_t testAclApi = {};
+        testAclApi.get_acl_table_attribute = getAclTableAttribute;
+        sai_acl_api = &testAclApi;
+        Portal::CrmOrchInternal::setAclTableBulkGetSupported(m_crmOrch, false);
+
+        // Both tables are queried, the attributes one by one when they can't be queried together
+        aclTableGetCount = 0;
+        Portal::CrmOrchInternal::getAclTableResAvailability(m_crmOrch);
+        auto &entries = Portal::CrmOrchInternal::getResource(m_crmOrch, CrmResourceType::CRM_ACL_ENTRY);
+        auto &counters = Portal::CrmOrchInternal::getResource(m_crmOrch, CrmResourceType::CRM_ACL_COUNTER);
+        EXPECT_EQ(entries.resStatus, CrmResourceStatus::CRM_RES_SUPPORTED);
+        EXPECT_EQ(counters.resStatus, CrmResourceStatus::CRM_RES_NOT_SUPPORTED);
+        for (auto tableId : tableIds)
+        {
+            EXPECT_EQ(entries.countersById.at(tableId)->availableCounter, 100 + (tableId & 0xff));
+        }
+
+        // Only the ACL entries are queried from then on
+        aclTableGetCount = 0;
+        Portal::CrmOrchInternal::getAclTableResAvailability(m_crmOrch);
+        EXPECT_EQ(aclTableGetCount, 2u);
+
+        sai_acl_api = aclApi;
+    }
+
+    TEST_F(CrmOrchTest, NearThresholdPollingInterval)
+    {
+        auto &routes = Portal::CrmOrchInternal::getResource(m_crmOrch, CrmResourceType::CRM_IPV4_ROUTE);
+        auto &cnt = routes.countersMap["STATS"];
+
+        // Polling only speeds up once configured
+        cnt.usedCounter = 80;
+        cnt.availableCounter = 20;
+        ASSERT_TRUE(Portal::CrmOrchInternal::checkCrmThresholds(m_crmOrch));
+        Portal::CrmOrchInternal::updatePollingInterval(m_crmOrch, true);
+        ASSERT_EQ(Portal::CrmOrchInternal::getTimerInterval(m_crmOrch), chrono::seconds(300));
+
+        Portal::CrmOrchInternal::handleSetCommand(m_crmOrch, "Config", { { "polling_interval_near_threshold", "10" } });
+        Portal::CrmOrchInternal::updatePollingInterval(m_crmOrch, Portal::CrmOrchInternal::checkCrmThresholds(m_crmOrch));
+        ASSERT_EQ(Portal::CrmOrchInternal::getTimerInterval(m_crmOrch), chrono::seconds(10));
+
+        // Back below the low threshold
+        cnt.usedCounter = 10;
+        cnt.availableCounter = 90;
+        ASSERT_FALSE(Portal::CrmOrchInternal::checkCrmThresholds(m_crmOrch));
+        Portal::CrmOrchInternal::updatePollingInterval(m_crmOrch, false);
+        ASSERT_EQ(Portal::CrmOrchInternal::getTimerInterval(m_crmOrch), chrono::seconds(300));
+
+        // The regular interval is used when it is already shorter
+        Portal::CrmOrchInternal::handleSetCommand(m_crmOrch, "Config", { { "polling_interval", "5" } });
+        Portal::CrmOrchInternal::updatePollingInterval(m_crmOrch, true);
+        ASSERT_EQ(Portal::CrmOrchInternal::getTimerInterval(m_crmOrch), chrono::seconds(5));
+    }
+}
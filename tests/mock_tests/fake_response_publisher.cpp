@@ -8,8 +8,8 @@
  * when needed to test code that uses response publisher. */
 std::unique_ptr<MockResponsePublisher> gMockResponsePublisher;
 
-ResponsePublisher::ResponsePublisher(const std::string& dbName, bool buffered, bool db_write_thread) :
-    m_db(std::make_unique<swss::DBConnector>(dbName, 0)), m_buffered(buffered) {}
+ResponsePublisher::ResponsePublisher(const std::string& dbName, bool buffered) :
+    m_buffered(buffered) {}
 
 ResponsePublisher::~ResponsePublisher() {}
 
@@ -44,3 +44,7 @@ void ResponsePublisher::writeToDB(
 void ResponsePublisher::flush() {}
 
 void ResponsePublisher::setBuffered(bool buffered) {}
+
+void ResponsePublisher::flushAll() {}
+
+void ResponsePublisher::setDeferredFlush(bool deferred) {}
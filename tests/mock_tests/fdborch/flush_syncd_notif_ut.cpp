@@ -548,4 +548,75 @@ namespace fdb_syncd_flush_test
         ASSERT_EQ(m_portsOrch->m_portList[VXLAN_REMOTE].m_fdb_count, 1);
         _unhook_sai_fdb_api();
     }
+
+    /* Flushing the entries of one port leaves the entries of the other ports alone */
+    TEST_F(FdbOrchTest, FlushOnlyFlushedPortEntries)
+    {
+        ASSERT_NE(m_portsOrch, nullptr);
+        setUpVlan(m_portsOrch.get());
+        setUpPort(m_portsOrch.get());
+        setUpVlanMember(m_portsOrch.get());
+
+        sai_object_id_t bridge_port_id = m_portsOrch->m_portList[ETH0].m_bridge_port_id;
+        sai_object_id_t bv_id = m_portsOrch->m_portList[VLAN40].m_vlan_info.vlan_oid;
+        const uint32_t learnCount = 16;
+        const uint32_t tableSize = 1000;
+
+        /* Entries learnt on other ports of other VLANs */
+        FdbData data = {};
+        data.type = "dynamic";
+        data.origin = FDB_ORIGIN_LEARN;
+        data.sai_fdb_type = SAI_FDB_ENTRY_TYPE_DYNAMIC;
+        for (uint32_t i = 0; i < tableSize; i++)
+        {
+            FdbEntry entry;
+            uint8_t mac[] = { 0x02, 0x00, (uint8_t)(i >> 16), (uint8_t)(i >> 8), (uint8_t)i, 0x01 };
+            entry.mac = MacAddress(mac);
+            entry.bv_id = 0x26000000001000 + i % 100;
+            entry.port_name = "Ethernet" + to_string(4 + i % 64 * 4);
+            data.bridge_port_id = 0x3a000000003000 + i % 64;
+            m_fdborch->m_entries.set(entry, data);
+        }
+
+        for (uint32_t i = 0; i < learnCount; i++)
+        {
+            triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_LEARNED, { 124, 254, 144, 18, 34, (uint8_t)i }, bridge_port_id, bv_id);
+        }
+        ASSERT_EQ(m_fdborch->m_entries.size(), tableSize + learnCount);
+        ASSERT_EQ(m_portsOrch->m_portList[ETH0].m_fdb_count, learnCount);
+
+        /* The flush is only given the entries of its port */
+        vector<FdbEntryMap::iterator> entries;
+        m_fdborch->m_entries.getEntries(bridge_port_id, SAI_NULL_OBJECT_ID, entries);
+        ASSERT_EQ(entries.size(), learnCount);
+        for (auto it : entries)
+        {
+            ASSERT_EQ(it->second.bridge_port_id, bridge_port_id);
+        }
+
+        for (auto it = m_fdborch->m_entries.begin(); it != m_fdborch->m_entries.end(); it++)
+        {
+            it->second.is_flush_pending = true;
+        }
+
+        triggerUpdate(m_fdborch.get(), SAI_FDB_EVENT_FLUSHED, { 0, 0, 0, 0, 0, 0 }, bridge_port_id, SAI_NULL_OBJECT_ID);
+
+        ASSERT_EQ(m_fdborch->m_entries.size(), tableSize);
+        ASSERT_EQ(m_portsOrch->m_portList[ETH0].m_fdb_count, 0);
+        ASSERT_EQ(m_portsOrch->m_portList[VLAN40].m_fdb_count, 0);
+
+        entries.clear();
+        m_fdborch->m_entries.getEntries(bridge_port_id, SAI_NULL_OBJECT_ID, entries);
+        ASSERT_TRUE(entries.empty());
+
+        /* The entries of the other ports are still there, still waiting for their own flush */
+        for (auto it = m_fdborch->m_entries.begin(); it != m_fdborch->m_entries.end(); it++)
+        {
+            ASSERT_NE(it->second.bridge_port_id, bridge_port_id);
+            ASSERT_TRUE(it->second.is_flush_pending);
+        }
+        entries.clear();
+        m_fdborch->m_entries.getEntries(SAI_NULL_OBJECT_ID, 0x26000000001000, entries);
+        ASSERT_EQ(entries.size(), tableSize / 100);
+    }
 }
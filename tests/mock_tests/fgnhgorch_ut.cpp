@@ -0,0 +1,191 @@
+#define private public
+#include "directory.h"
+#include "fgnhgorch.h"
+#undef private
+#define protected public
+#include "orch.h"
+#undef protected
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_orch_test.h"
+#include "mock_table.h"
+
+extern size_t gMaxBulkSize;
+
+namespace fgnhgorch_test
+{
+    using namespace std;
+    using namespace mock_orch_test;
+
+    /* Next hop each member was set to, and the calls made to set them */
+    map<sai_object_id_t, sai_object_id_t> memberNextHops;
+    vector<uint32_t> bulkSetCounts;
+    vector<sai_bulk_op_error_mode_t> bulkSetModes;
+    uint32_t memberSetCount;
+
+    sai_status_t bulkSetMembers(uint32_t object_count, const sai_object_id_t *object_id,
+            const sai_attribute_t *attr_list, sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+    {
+        bulkSetCounts.push_back(object_count);
+        bulkSetModes.push_back(mode);
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            memberNextHops[object_id[i]] = attr_list[i].value.oid;
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t bulkSetMembersNotSupported(uint32_t object_count, const sai_object_id_t *object_id,
+            const sai_attribute_t *attr_list, sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+    {
+        bulkSetCounts.push_back(object_count);
+        return SAI_STATUS_NOT_SUPPORTED;
+    }
+
+    /* The whole call failed, none of the members was set */
+    sai_status_t bulkSetMembersFailure(uint32_t object_count, const sai_object_id_t *object_id,
+            const sai_attribute_t *attr_list, sai_bulk_op_error_mode_t mode, sai_status_t *object_statuses)
+    {
+        bulkSetCounts.push_back(object_count);
+        return SAI_STATUS_FAILURE;
+    }
+
+    sai_status_t setMemberAttribute(sai_object_id_t next_hop_group_member_id, const sai_attribute_t *attr)
+    {
+        memberSetCount++;
+        memberNextHops[next_hop_group_member_id] = attr->value.oid;
+        return SAI_STATUS_SUCCESS;
+    }
+
+    class FgNhgOrchTest : public MockOrchTest
+    {
+    protected:
+        const IpPrefix m_prefix = IpPrefix("2.2.2.0/24");
+        const NextHopKey m_nextHop1 = NextHopKey(IpAddress("10.0.0.1"), "Ethernet0");
+        const NextHopKey m_nextHop2 = NextHopKey(IpAddress("10.0.0.2"), "Ethernet4");
+        const sai_object_id_t m_nextHopId1 = 0x4000000000001;
+        const sai_object_id_t m_nextHopId2 = 0x4000000000002;
+        const uint32_t m_bucketCount = 7;
+
+        FGNextHopGroupEntry m_entry;
+        size_t m_maxBulkSize;
+        sai_bulk_object_set_attribute_fn m_bulkSet;
+        sai_next_hop_group_api_t *m_nextHopGroupApi;
+        sai_next_hop_group_api_t m_testNextHopGroupApi;
+
+        void PostSetUp() override
+        {
+            ::testing_db::reset();
+            memberNextHops.clear();
+            bulkSetCounts.clear();
+            bulkSetModes.clear();
+            memberSetCount = 0;
+
+            for (uint32_t i = 0; i < m_bucketCount; i++)
+            {
+                m_entry.nhopgroup_members.push_back(0x2d00000000000 + i);
+            }
+
+            m_maxBulkSize = gMaxBulkSize;
+            gMaxBulkSize = 3;
+            m_bulkSet = gFgNhgOrch->m_bulkSetNextHopGroupMembers;
+
+            m_nextHopGroupApi = sai_next_hop_group_api;
+            m_testNextHopGroupApi = *sai_next_hop_group_api;
+            m_testNextHopGroupApi.set_next_hop_group_member_attribute = setMemberAttribute;
+            sai_next_hop_group_api = &m_testNextHopGroupApi;
+        }
+
+        void PreTearDown() override
+        {
+            sai_next_hop_group_api = m_nextHopGroupApi;
+            gFgNhgOrch->m_bulkSetNextHopGroupMembers = m_bulkSet;
+            gFgNhgOrch->m_bulkSetSupported = true;
+            gMaxBulkSize = m_maxBulkSize;
+        }
+
+        /* All the buckets to the first next hop, then the third one moved to the second next hop */
+        void writeBuckets()
+        {
+            for (uint32_t i = 0; i < m_bucketCount; i++)
+            {
+                gFgNhgOrch->writeHashBucketChange(&m_entry, i, m_nextHopId1, m_prefix, m_nextHop1);
+            }
+            gFgNhgOrch->writeHashBucketChange(&m_entry, 2, m_nextHopId2, m_prefix, m_nextHop2);
+        }
+
+        map<string, string> getStateDbBuckets()
+        {
+            Table table(m_state_db.get(), STATE_FG_ROUTE_TABLE_NAME);
+            vector<FieldValueTuple> fvs;
+            table.get(m_prefix.to_string(), fvs);
+            return map<string, string>(fvs.begin(), fvs.end());
+        }
+
+        void expectBucketsSet()
+        {
+            ASSERT_EQ(memberNextHops.size(), m_bucketCount);
+            auto buckets = getStateDbBuckets();
+            ASSERT_EQ(buckets.size(), m_bucketCount);
+
+            for (uint32_t i = 0; i < m_bucketCount; i++)
+            {
+                const auto &nextHop = i == 2 ? m_nextHop2 : m_nextHop1;
+                EXPECT_EQ(memberNextHops[m_entry.nhopgroup_members[i]], i == 2 ? m_nextHopId2 : m_nextHopId1);
+                EXPECT_EQ(buckets[to_string(i)], nextHop.to_string());
+            }
+        }
+    };
+
+    TEST_F(FgNhgOrchTest, BatchedBucketRewrite)
+    {
+        gFgNhgOrch->m_bulkSetNextHopGroupMembers = bulkSetMembers;
+
+        writeBuckets();
+        ASSERT_EQ(gFgNhgOrch->m_hashBucketChanges.size(), m_bucketCount);
+        ASSERT_TRUE(gFgNhgOrch->flushHashBucketChanges(m_prefix));
+
+        /* A bucket rewritten twice is set once, gMaxBulkSize members at a time */
+        ASSERT_EQ(bulkSetCounts, vector<uint32_t>({ 3, 3, 1 }));
+        for (auto mode : bulkSetModes)
+        {
+            EXPECT_EQ(mode, SAI_BULK_OP_ERROR_MODE_IGNORE_ERROR);
+        }
+        ASSERT_EQ(memberSetCount, 0u);
+        ASSERT_TRUE(gFgNhgOrch->m_hashBucketChanges.empty());
+        expectBucketsSet();
+
+        /* Nothing queued, nothing sent */
+        ASSERT_TRUE(gFgNhgOrch->flushHashBucketChanges(m_prefix));
+        ASSERT_EQ(bulkSetCounts.size(), 3u);
+    }
+
+    TEST_F(FgNhgOrchTest, BulkSetNotSupported)
+    {
+        gFgNhgOrch->m_bulkSetNextHopGroupMembers = bulkSetMembersNotSupported;
+
+        writeBuckets();
+        ASSERT_TRUE(gFgNhgOrch->flushHashBucketChanges(m_prefix));
+
+        /* Bulk set is only tried once, the members are then set one at a time */
+        ASSERT_EQ(bulkSetCounts, vector<uint32_t>({ 3 }));
+        ASSERT_FALSE(gFgNhgOrch->m_bulkSetSupported);
+        ASSERT_EQ(memberSetCount, m_bucketCount);
+        expectBucketsSet();
+    }
+
+    TEST_F(FgNhgOrchTest, BucketsNotSet)
+    {
+        gFgNhgOrch->m_bulkSetNextHopGroupMembers = bulkSetMembersFailure;
+
+        writeBuckets();
+        ASSERT_FALSE(gFgNhgOrch->flushHashBucketChanges(m_prefix));
+
+        /* Every batch is tried, none of the buckets is written to STATE_DB */
+        ASSERT_EQ(bulkSetCounts, vector<uint32_t>({ 3, 3, 1 }));
+        ASSERT_TRUE(memberNextHops.empty());
+        ASSERT_TRUE(getStateDbBuckets().empty());
+        ASSERT_TRUE(gFgNhgOrch->m_hashBucketChanges.empty());
+    }
+}
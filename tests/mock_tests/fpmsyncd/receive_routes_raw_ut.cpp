@@ -0,0 +1,310 @@
+#include "ut_helpers_fpmsyncd.h"
+#include "gtest/gtest.h"
+#include <gmock/gmock.h>
+#include "mock_table.h"
+#include <chrono>
+#include <iostream>
+#include <net/if.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include "ipaddress.h"
+#include "ipprefix.h"
+#include <swss/netdispatcher.h>
+
+#define private public // Need to access internal cache
+#include "fpmlink.h"
+#include "routesync.h"
+#undef private
+
+using namespace swss;
+using namespace testing;
+
+namespace ut_fpmsyncd
+{
+    struct RawNextHop
+    {
+        std::string gateway;
+        int ifindex;
+        uint8_t hops;
+    };
+
+    /* Build an FPM message containing a regular route */
+    std::vector<uint8_t> create_route_fpm_msg(uint16_t cmd, const std::string &prefix,
+                                              const std::vector<RawNextHop> &nexthops,
+                                              uint32_t table_id = 0, uint8_t rtm_type = RTN_UNICAST)
+    {
+        IpPrefix dst(prefix);
+        struct nlmsg nl_obj;
+        memset(&nl_obj, 0, sizeof(nl_obj));
+
+        nl_obj.n.nlmsg_len = NLMSG_LENGTH(sizeof(struct rtmsg));
+        nl_obj.n.nlmsg_flags = NLM_F_CREATE | NLM_F_REQUEST;
+        nl_obj.n.nlmsg_type = cmd;
+        nl_obj.r.rtm_family = dst.getIp().getIp().family;
+        nl_obj.r.rtm_dst_len = (unsigned char)dst.getMaskLength();
+        nl_obj.r.rtm_scope = RT_SCOPE_UNIVERSE;
+        nl_obj.r.rtm_protocol = RTPROT_BGP;
+        nl_obj.r.rtm_type = rtm_type;
+
+        if (dst.isV4())
+        {
+            nl_attr_put32(&nl_obj.n, sizeof(nl_obj), RTA_DST, dst.getIp().getV4Addr());
+        }
+        else
+        {
+            nl_attr_put(&nl_obj.n, sizeof(nl_obj), RTA_DST, dst.getIp().getV6Addr(), 16);
+        }
+
+        if (table_id)
+        {
+            nl_attr_put32(&nl_obj.n, sizeof(nl_obj), RTA_TABLE, table_id);
+        }
+
+        auto put_gateway = [&](const std::string &gateway)
+        {
+            IpAddress gw(gateway);
+            if (gw.isV4())
+            {
+                nl_attr_put32(&nl_obj.n, sizeof(nl_obj), RTA_GATEWAY, gw.getV4Addr());
+            }
+            else
+            {
+                nl_attr_put(&nl_obj.n, sizeof(nl_obj), RTA_GATEWAY, gw.getV6Addr(), 16);
+            }
+        };
+
+        if (nexthops.size() == 1)
+        {
+            put_gateway(nexthops[0].gateway);
+            nl_attr_put32(&nl_obj.n, sizeof(nl_obj), RTA_OIF, (uint32_t)nexthops[0].ifindex);
+        }
+        else if (nexthops.size() > 1)
+        {
+            struct rtattr *multipath = NLMSG_TAIL(&nl_obj.n);
+            nl_attr_put(&nl_obj.n, sizeof(nl_obj), RTA_MULTIPATH, NULL, 0);
+
+            for (const auto &nh : nexthops)
+            {
+                struct rtnexthop *rtnh = reinterpret_cast<struct rtnexthop *>(NLMSG_TAIL(&nl_obj.n));
+                rtnh->rtnh_len = sizeof(*rtnh);
+                rtnh->rtnh_ifindex = nh.ifindex;
+                rtnh->rtnh_hops = nh.hops;
+                nl_obj.n.nlmsg_len += (uint32_t)RTNH_ALIGN(sizeof(*rtnh));
+
+                put_gateway(nh.gateway);
+                rtnh->rtnh_len = (unsigned short)((uint8_t *)NLMSG_TAIL(&nl_obj.n) - (uint8_t *)rtnh);
+            }
+
+            multipath->rta_len = (unsigned short)((uint8_t *)NLMSG_TAIL(&nl_obj.n) - (uint8_t *)multipath);
+        }
+
+        size_t msg_len = fpm_data_len_to_msg_len(nl_obj.n.nlmsg_len);
+        std::vector<uint8_t> buffer(msg_len, 0);
+
+        fpm_msg_hdr_t *hdr = reinterpret_cast<fpm_msg_hdr_t *>(buffer.data());
+        hdr->version = FPM_PROTO_VERSION;
+        hdr->msg_type = FPM_MSG_TYPE_NETLINK;
+        hdr->msg_len = htons((uint16_t)msg_len);
+        memcpy(buffer.data() + FPM_MSG_HDR_LEN, &nl_obj.n, nl_obj.n.nlmsg_len);
+
+        return buffer;
+    }
+
+    struct FpmSyncdRawRoutesTest : public ::testing::Test
+    {
+        std::shared_ptr<swss::DBConnector> m_app_db;
+        std::shared_ptr<swss::RedisPipeline> pipeline;
+        std::shared_ptr<RouteSync> m_routeSync;
+        std::shared_ptr<FpmLink> m_fpmLink;
+        std::shared_ptr<swss::Table> m_routeTable;
+
+        virtual void SetUp() override
+        {
+            testing_db::reset();
+
+            m_app_db = std::make_shared<swss::DBConnector>("APPL_DB", 0);
+            pipeline = std::make_shared<swss::RedisPipeline>(m_app_db.get());
+            m_routeSync = std::make_shared<RouteSync>(pipeline.get());
+            m_routeSync->setSuppressionEnabled(true);
+            m_fpmLink = std::make_shared<FpmLink>(m_routeSync.get());
+            m_routeTable = std::make_shared<swss::Table>(m_app_db.get(), APP_ROUTE_TABLE_NAME);
+
+            /* Routes falling back to libnl are dispatched to RouteSync::onMsg() */
+            NetDispatcher::getInstance().registerMessageHandler(RTM_NEWROUTE, m_routeSync.get());
+            NetDispatcher::getInstance().registerMessageHandler(RTM_DELROUTE, m_routeSync.get());
+        }
+
+        virtual void TearDown() override
+        {
+            NetDispatcher::getInstance().unregisterMessageHandler(RTM_NEWROUTE);
+            NetDispatcher::getInstance().unregisterMessageHandler(RTM_DELROUTE);
+        }
+
+        void process(std::vector<uint8_t> &msg)
+        {
+            m_fpmLink->processFpmMessage(reinterpret_cast<fpm_msg_hdr_t *>(msg.data()));
+        }
+
+        std::map<std::string, std::vector<FieldValueTuple>> dumpRouteTable()
+        {
+            std::map<std::string, std::vector<FieldValueTuple>> routes;
+            std::vector<std::string> keys;
+
+            m_routeTable->getKeys(keys);
+            for (const auto &key : keys)
+            {
+                m_routeTable->get(key, routes[key]);
+            }
+            return routes;
+        }
+
+        std::vector<std::vector<uint8_t>> createRoutes()
+        {
+            return {
+                create_route_fpm_msg(RTM_NEWROUTE, "10.1.0.0/24", { { "192.168.1.1", 10, 0 } }),
+                create_route_fpm_msg(RTM_NEWROUTE, "10.2.0.0/24", { { "192.168.1.1", 10, 0 } }, 10),
+                create_route_fpm_msg(RTM_NEWROUTE, "10.3.0.1/32", { { "192.168.1.1", 10, 0 } }),
+                create_route_fpm_msg(RTM_NEWROUTE, "10.4.0.0/24", {}, 0, RTN_BLACKHOLE),
+                create_route_fpm_msg(RTM_NEWROUTE, "2001:db8:1::/64",
+                                     { { "fe80::1", 10, 0 }, { "fe80::2", 7, 0 } }),
+                create_route_fpm_msg(RTM_NEWROUTE, "2001:db8::/64",
+                                     { { "fe80::1", 10, 1 }, { "fe80::2", 10, 2 } }),
+                create_route_fpm_msg(RTM_NEWROUTE, "10.5.0.0/24", { { "192.168.1.1", 10, 0 } }, 30),
+            };
+        }
+    };
+
+    TEST_F(FpmSyncdRawRoutesTest, RawDecodeRoutes)
+    {
+        for (auto &msg : createRoutes())
+        {
+            process(msg);
+        }
+
+        std::string value;
+
+        ASSERT_TRUE(m_routeTable->hget("10.1.0.0/24", "nexthop", value));
+        ASSERT_EQ(value, "192.168.1.1");
+        ASSERT_TRUE(m_routeTable->hget("10.1.0.0/24", "ifname", value));
+        ASSERT_EQ(value, "Vrf10");
+        ASSERT_FALSE(m_routeTable->hget("10.1.0.0/24", "weight", value));
+
+        ASSERT_TRUE(m_routeTable->hget("Vrf10:10.2.0.0/24", "nexthop", value));
+        ASSERT_EQ(value, "192.168.1.1");
+
+        /* Host routes are keyed without prefix length, as nl_addr2str() does */
+        ASSERT_TRUE(m_routeTable->hget("10.3.0.1", "nexthop", value));
+
+        ASSERT_TRUE(m_routeTable->hget("10.4.0.0/24", "blackhole", value));
+        ASSERT_EQ(value, "true");
+
+        ASSERT_TRUE(m_routeTable->hget("2001:db8::/64", "nexthop", value));
+        ASSERT_EQ(value, "fe80::1,fe80::2");
+        ASSERT_TRUE(m_routeTable->hget("2001:db8::/64", "ifname", value));
+        ASSERT_EQ(value, "Vrf10,Vrf10");
+        ASSERT_TRUE(m_routeTable->hget("2001:db8::/64", "weight", value));
+        ASSERT_EQ(value, "1,2");
+
+        ASSERT_TRUE(m_routeTable->hget("2001:db8:1::/64", "ifname", value));
+        ASSERT_EQ(value, "Vrf10,unknown");
+        ASSERT_FALSE(m_routeTable->hget("2001:db8:1::/64", "weight", value));
+
+        /* Routes of an invalid VRF are dropped */
+        ASSERT_EQ(dumpRouteTable().size(), 6);
+
+        /* The names of resolved interfaces are cached */
+        ASSERT_EQ(m_routeSync->m_ifNameCache.count(10), 1);
+        ASSERT_EQ(m_routeSync->m_ifNameCache.count(7), 0);
+
+        auto del = create_route_fpm_msg(RTM_DELROUTE, "2001:db8::/64", {});
+        process(del);
+        ASSERT_FALSE(m_routeTable->hget("2001:db8::/64", "nexthop", value));
+    }
+
+    TEST_F(FpmSyncdRawRoutesTest, RawDecodeMatchesLibnl)
+    {
+        for (auto &msg : createRoutes())
+        {
+            process(msg);
+        }
+        auto rawRoutes = dumpRouteTable();
+
+        testing_db::reset();
+        m_routeSync->setRawRouteDecodeEnabled(false);
+
+        for (auto &msg : createRoutes())
+        {
+            process(msg);
+        }
+        auto libnlRoutes = dumpRouteTable();
+
+        ASSERT_EQ(rawRoutes, libnlRoutes);
+    }
+
+    TEST_F(FpmSyncdRawRoutesTest, FallbackToLibnl)
+    {
+        /* Default route carries no RTA_DST */
+        struct nlmsg nl_obj;
+        memset(&nl_obj, 0, sizeof(nl_obj));
+        nl_obj.n.nlmsg_len = NLMSG_LENGTH(sizeof(struct rtmsg));
+        nl_obj.n.nlmsg_type = RTM_NEWROUTE;
+        nl_obj.r.rtm_family = AF_INET;
+        nl_obj.r.rtm_type = RTN_UNICAST;
+        ASSERT_FALSE(m_routeSync->onRouteMsgRaw(&nl_obj.n));
+
+        /* MPLS routes */
+        nl_obj.r.rtm_family = AF_MPLS;
+        ASSERT_FALSE(m_routeSync->onRouteMsgRaw(&nl_obj.n));
+
+        /* Unknown ifindex is not cached, a link event flushes the cache */
+        std::string name;
+        ASSERT_FALSE(m_routeSync->getIfNameCached(7, name));
+        ASSERT_TRUE(m_routeSync->getIfNameCached(10, name));
+        ASSERT_EQ(name, "Vrf10");
+        ASSERT_EQ(m_routeSync->m_ifNameCache.size(), 1);
+        m_routeSync->refillLinkCache();
+        ASSERT_TRUE(m_routeSync->m_ifNameCache.empty());
+    }
+
+    /*
+     * Compare the decoding throughput of both paths over a stream of ECMP
+     * routes. Timings are only reported, the outputs are checked to match.
+     * Opt-in: --gtest_also_run_disabled_tests --gtest_filter=FpmSyncdRawRoutesTest.DISABLED_RawDecodeBenchmark
+     */
+    TEST_F(FpmSyncdRawRoutesTest, DISABLED_RawDecodeBenchmark)
+    {
+        const int routeCount = 20000;
+        std::vector<std::vector<uint8_t>> stream;
+
+        stream.reserve(routeCount);
+        for (int i = 0; i < routeCount; i++)
+        {
+            std::string prefix = "10." + std::to_string((i >> 8) & 0xff) + "." + std::to_string(i & 0xff) + ".0/24";
+            stream.push_back(create_route_fpm_msg(RTM_NEWROUTE, prefix,
+                                                  { { "192.168.1.1", 10, 0 }, { "192.168.2.1", 10, 0 } }));
+        }
+
+        auto run = [&](bool raw)
+        {
+            testing_db::reset();
+            m_routeSync->setRawRouteDecodeEnabled(raw);
+
+            auto start = std::chrono::steady_clock::now();
+            for (auto &msg : stream)
+            {
+                process(msg);
+            }
+            auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+            std::cout << (raw ? "raw decoder: " : "libnl: ")
+                      << (elapsed > 0 ? (double)routeCount / elapsed : 0) << " routes/sec" << std::endl;
+            return dumpRouteTable();
+        };
+
+        auto libnlRoutes = run(false);
+        auto rawRoutes = run(true);
+
+        ASSERT_EQ(rawRoutes.size(), routeCount);
+        ASSERT_EQ(rawRoutes, libnlRoutes);
+    }
+}
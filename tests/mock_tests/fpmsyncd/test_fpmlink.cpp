@@ -20,6 +20,8 @@ class FpmLinkTest : public ::testing::Test
 public:
     void SetUp() override
     {
+        /* Routes are expected to go through libnl and NetDispatcher */
+        m_routeSync.setRawRouteDecodeEnabled(false);
         NetDispatcher::getInstance().registerMessageHandler(RTM_NEWROUTE, &m_mock);
         NetDispatcher::getInstance().registerMessageHandler(RTM_DELROUTE, &m_mock);
     }
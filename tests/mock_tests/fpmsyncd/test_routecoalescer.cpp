@@ -0,0 +1,152 @@
+#include "gtest/gtest.h"
+#include "mock_table.h"
+#include "producerstatetable.h"
+
+#define private public // Need to access the coalescing window
+#include "fpmsyncd/routecoalescer.h"
+#include "fpmsyncd/routesync.h"
+#undef private
+
+using namespace swss;
+
+class RouteCoalescerTest : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        testing_db::reset();
+    }
+
+    bool hasRoute(const std::string &key)
+    {
+        std::vector<FieldValueTuple> fvs;
+        return m_routeTable.get(key, fvs);
+    }
+
+    std::string getNexthop(const std::string &key)
+    {
+        std::string value;
+        m_routeTable.hget(key, "nexthop", value);
+        return value;
+    }
+
+    DBConnector m_db{"APPL_DB", 0};
+    RedisPipeline m_pipeline{&m_db, 1};
+    ProducerStateTable m_producer{&m_pipeline, APP_ROUTE_TABLE_NAME, true};
+    Table m_routeTable{&m_db, APP_ROUTE_TABLE_NAME};
+    RouteCoalescer m_coalescer{m_producer};
+};
+
+TEST_F(RouteCoalescerTest, Disabled)
+{
+    ASSERT_FALSE(m_coalescer.isEnabled());
+
+    m_coalescer.set("1.0.0.0/24", { { "nexthop", "10.0.0.1" } });
+    ASSERT_EQ(getNexthop("1.0.0.0/24"), "10.0.0.1");
+    ASSERT_EQ(m_coalescer.getPendingCount(), 0);
+
+    m_coalescer.del("1.0.0.0/24");
+    ASSERT_FALSE(hasRoute("1.0.0.0/24"));
+    ASSERT_EQ(m_coalescer.getCounters().written, 2);
+}
+
+TEST_F(RouteCoalescerTest, LatestStateWins)
+{
+    m_coalescer.setWindow(100);
+
+    m_coalescer.set("1.0.0.0/24", { { "nexthop", "10.0.0.1" } });
+    m_coalescer.set("1.0.0.0/24", { { "nexthop", "10.0.0.2" } });
+    m_coalescer.set("Vrf1:1.0.0.0/24", { { "nexthop", "10.0.0.3" } });
+
+    ASSERT_FALSE(hasRoute("1.0.0.0/24"));
+    ASSERT_EQ(m_coalescer.getPendingCount(), 2);
+    ASSERT_GT(m_coalescer.flushExpired(), 0);
+    ASSERT_FALSE(hasRoute("1.0.0.0/24"));
+
+    // Window expired
+    m_coalescer.m_windowStart -= std::chrono::milliseconds(100);
+    ASSERT_EQ(m_coalescer.flushExpired(), -1);
+
+    ASSERT_EQ(getNexthop("1.0.0.0/24"), "10.0.0.2");
+    ASSERT_EQ(getNexthop("Vrf1:1.0.0.0/24"), "10.0.0.3");
+
+    const auto &counters = m_coalescer.getCounters();
+    ASSERT_EQ(counters.received, 3);
+    ASSERT_EQ(counters.written, 2);
+    ASSERT_EQ(counters.coalesced, 1);
+
+    // Update then delete of an existing route is written as a delete
+    m_coalescer.set("1.0.0.0/24", { { "nexthop", "10.0.0.4" } });
+    m_coalescer.del("1.0.0.0/24");
+    m_coalescer.flush();
+    ASSERT_FALSE(hasRoute("1.0.0.0/24"));
+    ASSERT_EQ(counters.cancelled, 0);
+    ASSERT_EQ(counters.coalesced, 2);
+}
+
+TEST_F(RouteCoalescerTest, AddDeleteCancelled)
+{
+    m_coalescer.setWindow(100);
+
+    m_coalescer.del("1.0.0.0/24");
+    m_coalescer.flush();
+    ASSERT_EQ(m_coalescer.getCounters().written, 1);
+
+    // The route is known to be absent from APPL_DB, add and delete cancel out
+    m_coalescer.set("1.0.0.0/24", { { "nexthop", "10.0.0.1" } });
+    m_coalescer.del("1.0.0.0/24");
+    ASSERT_EQ(m_coalescer.getPendingCount(), 0);
+    ASSERT_EQ(m_coalescer.getCounters().cancelled, 1);
+
+    m_coalescer.flush();
+    ASSERT_EQ(m_coalescer.getCounters().written, 1);
+
+    // Once written, the route is no longer known to be absent
+    m_coalescer.set("1.0.0.0/24", { { "nexthop", "10.0.0.1" } });
+    m_coalescer.flush("1.0.0.0/24");
+    ASSERT_EQ(getNexthop("1.0.0.0/24"), "10.0.0.1");
+
+    m_coalescer.set("1.0.0.0/24", { { "nexthop", "10.0.0.2" } });
+    m_coalescer.del("1.0.0.0/24");
+    ASSERT_EQ(m_coalescer.getPendingCount(), 1);
+    m_coalescer.flush();
+    ASSERT_FALSE(hasRoute("1.0.0.0/24"));
+}
+
+TEST_F(RouteCoalescerTest, SizeBound)
+{
+    m_coalescer.setWindow(1000, 2);
+
+    m_coalescer.set("1.0.0.0/24", { { "nexthop", "10.0.0.1" } });
+    ASSERT_FALSE(hasRoute("1.0.0.0/24"));
+
+    m_coalescer.set("2.0.0.0/24", { { "nexthop", "10.0.0.1" } });
+    ASSERT_TRUE(hasRoute("1.0.0.0/24"));
+    ASSERT_TRUE(hasRoute("2.0.0.0/24"));
+    ASSERT_EQ(m_coalescer.getPendingCount(), 0);
+
+    // Disabling the window writes what is pending
+    m_coalescer.set("3.0.0.0/24", { { "nexthop", "10.0.0.1" } });
+    m_coalescer.setWindow(0);
+    ASSERT_TRUE(hasRoute("3.0.0.0/24"));
+}
+
+TEST_F(RouteCoalescerTest, RouteSyncCoalescing)
+{
+    RouteSync routeSync{&m_pipeline};
+    routeSync.setRouteCoalesceWindow(100);
+
+    routeSync.setRouteEntry("1.0.0.0/24", RTPROT_KERNEL, "10.0.0.1", "Ethernet0", "", "");
+    routeSync.setRouteEntry("1.0.0.0/24", RTPROT_KERNEL, "10.0.0.2", "Ethernet0", "", "");
+    ASSERT_FALSE(hasRoute("1.0.0.0/24"));
+
+    routeSync.flushRoutes();
+    ASSERT_EQ(getNexthop("1.0.0.0/24"), "10.0.0.2");
+
+    routeSync.delRouteEntry("1.0.0.0/24");
+    ASSERT_TRUE(hasRoute("1.0.0.0/24"));
+    routeSync.flushRoutes();
+    ASSERT_FALSE(hasRoute("1.0.0.0/24"));
+
+    ASSERT_EQ(routeSync.getRouteCoalesceCounters().coalesced, 1);
+}
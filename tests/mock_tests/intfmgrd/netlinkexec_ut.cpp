@@ -0,0 +1,122 @@
+#include "gtest/gtest.h"
+#include <functional>
+#include <sched.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <sys/wait.h>
+#include "netlinkexec.h"
+
+using namespace std;
+using namespace swss;
+
+namespace netlinkexec_ut
+{
+    /* Exit code of the child when it could not get its own network namespace */
+    const int netnsUnavailable = 77;
+
+    /*
+     * Run the test body in a child process with its own network namespace, so
+     * that neither the host interfaces nor the following tests are affected.
+     * Returns the exit code of the child, 0 when the body passed.
+     */
+    int runInNetns(const function<void()> &body)
+    {
+        pid_t pid = fork();
+        if (pid == 0)
+        {
+            if (unshare(CLONE_NEWNET) != 0)
+            {
+                _exit(netnsUnavailable);
+            }
+
+            body();
+            _exit(::testing::Test::HasFailure() ? 1 : 0);
+        }
+
+        int status = 0;
+        if (pid < 0 || waitpid(pid, &status, 0) < 0 || !WIFEXITED(status))
+        {
+            return -1;
+        }
+        return WEXITSTATUS(status);
+    }
+
+    TEST(NetlinkExecTest, NotOpened)
+    {
+        NetlinkExec nl;
+        ASSERT_FALSE(nl.isOpen());
+        ASSERT_FALSE(nl.addLink("Loopback0", "dummy"));
+        ASSERT_FALSE(nl.delLink("Loopback0"));
+
+        nl.beginBatch();
+        ASSERT_FALSE(nl.setLinkMtu("Loopback0", 9100));
+        ASSERT_FALSE(nl.commit());
+        ASSERT_EQ(nl.getResults(), vector<bool>({ false }));
+    }
+
+    TEST(NetlinkExecTest, LinkAndAddress)
+    {
+        int ret = runInNetns([]()
+        {
+            NetlinkExec nl;
+            ASSERT_TRUE(nl.open());
+
+            ASSERT_TRUE(nl.addLink("Bridge", "bridge", 9100, true));
+            ASSERT_NE(if_nametoindex("Bridge"), 0);
+            ASSERT_FALSE(nl.addLink("Bridge", "bridge"));
+            ASSERT_EQ(nl.getLastError(), EEXIST);
+
+            ASSERT_TRUE(nl.setLinkMtu("Bridge", 1500));
+            ASSERT_TRUE(nl.setLinkAddress("Bridge", MacAddress("00:11:22:33:44:55")));
+            ASSERT_TRUE(nl.setLinkAdminState("Bridge", false));
+
+            ASSERT_TRUE(nl.addAddress("Bridge", IpPrefix("10.0.0.1/24"), true));
+            ASSERT_TRUE(nl.addAddress("Bridge", IpPrefix("2001::1/64"), false, 256));
+            ASSERT_FALSE(nl.addAddress("Bridge", IpPrefix("10.0.0.1/24"), true));
+            ASSERT_TRUE(nl.delAddress("Bridge", IpPrefix("10.0.0.1/24")));
+        });
+
+        if (ret == netnsUnavailable)
+        {
+            GTEST_SKIP() << "No permission to create a network namespace";
+        }
+        ASSERT_EQ(ret, 0);
+    }
+
+    TEST(NetlinkExecTest, BatchResults)
+    {
+        int ret = runInNetns([]()
+        {
+            NetlinkExec nl;
+            ASSERT_TRUE(nl.open());
+            ASSERT_TRUE(nl.addLink("Bridge", "bridge"));
+
+            /* One failed request fails the batch, the others are still applied */
+            nl.beginBatch();
+            ASSERT_TRUE(nl.delLink("Bridge"));
+            ASSERT_TRUE(nl.delLink("Bridge"));
+            /* Unknown master is detected when the request is queued */
+            ASSERT_FALSE(nl.setLinkMaster("Ethernet0", "Vrf1"));
+            ASSERT_TRUE(nl.addLink("Bridge2", "bridge"));
+            ASSERT_FALSE(nl.commit());
+            ASSERT_EQ(nl.getResults(), vector<bool>({ true, false, false, true }));
+            ASSERT_EQ(if_nametoindex("Bridge"), 0);
+            ASSERT_NE(if_nametoindex("Bridge2"), 0);
+
+            /* A failure outside of a batch does not fail the next one */
+            ASSERT_FALSE(nl.setLinkMaster("Bridge2", "Vrf1"));
+            ASSERT_EQ(nl.getResults(), vector<bool>({ false }));
+
+            nl.beginBatch();
+            ASSERT_TRUE(nl.setLinkMtu("Bridge2", 1500));
+            ASSERT_TRUE(nl.commit());
+            ASSERT_EQ(nl.getResults(), vector<bool>({ true }));
+        });
+
+        if (ret == netnsUnavailable)
+        {
+            GTEST_SKIP() << "No permission to create a network namespace";
+        }
+        ASSERT_EQ(ret, 0);
+    }
+}
@@ -8,6 +8,18 @@
 #include <map>
 
 #include "dbconnector.h"
+#include "mock_table.h"
+
+namespace testing_db
+{
+    std::map<const redisContext *, int> gContextDbIds;
+
+    int getDbId(const redisContext *c)
+    {
+        auto it = gContextDbIds.find(c);
+        return it == gContextDbIds.end() ? -1 : it->second;
+    }
+}
 
 namespace swss
 {
@@ -20,6 +32,7 @@ namespace swss
         conn->tcp.port = port;
         conn->fd = socket(AF_UNIX, SOCK_DGRAM, 0);
         setContext(conn);
+        testing_db::gContextDbIds[conn] = m_dbId;
     }
 
     DBConnector::DBConnector(int dbId, const std::string &unixPath, unsigned int timeout) :
@@ -30,6 +43,7 @@ namespace swss
         conn->unix_sock.path = strdup(unixPath.c_str());
         conn->fd = socket(AF_UNIX, SOCK_DGRAM, 0);
         setContext(conn);
+        testing_db::gContextDbIds[conn] = m_dbId;
     }
 
     DBConnector::DBConnector(const std::string& dbName, unsigned int timeout, bool isTcpConn)
@@ -46,6 +60,7 @@ namespace swss
             conn->tcp.port = swss::SonicDBConfig::getDbPort(dbName);
             conn->fd = socket(AF_UNIX, SOCK_DGRAM, 0);
             setContext(conn);
+            testing_db::gContextDbIds[conn] = m_dbId;
         }
         else
         {
@@ -54,6 +69,7 @@ namespace swss
             conn->unix_sock.path = strdup(swss::SonicDBConfig::getDbSock(dbName).c_str());
             conn->fd = socket(AF_UNIX, SOCK_DGRAM, 0);
             setContext(conn);
+            testing_db::gContextDbIds[conn] = m_dbId;
         }
     }
 
@@ -1,26 +1,75 @@
 #include <stdlib.h>
 #include <hiredis/hiredis.h>
 #include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "mock_table.h"
 
 // Add a global redisReply for user to mock
 redisReply *mockReply = nullptr;
 
-int redisGetReply(redisContext *c, void **reply)
+// Formatted commands sent to redis, recorded while mockRecordCommands is set
+bool mockRecordCommands = false;
+std::vector<std::string> mockCommands;
+
+// Arguments of the last formatted command sent on each connection, until its reply is read
+static std::map<const redisContext *, std::vector<std::string>> lastCommands;
+
+// Arguments of a command in the redis protocol: *<argc>\r\n then $<len>\r\n<arg>\r\n for each argument
+static std::vector<std::string> parseCommand(const char *cmd, size_t len)
 {
-    if (mockReply == nullptr)
+    std::vector<std::string> argv;
+    std::string command(cmd, len);
+
+    size_t pos = command.find("\r\n");
+    while (pos != std::string::npos && pos + 3 < command.length() && command[pos + 2] == '$')
     {
-        *reply = calloc(sizeof(redisReply), 1);
-        ((redisReply *)*reply)->type = 3;
+        size_t argStart = command.find("\r\n", pos + 2);
+        if (argStart == std::string::npos)
+        {
+            break;
+        }
+        size_t argLen = strtoul(command.c_str() + pos + 3, nullptr, 10);
+        argv.push_back(command.substr(argStart + 2, argLen));
+        pos = argStart + 2 + argLen;
     }
-    else
+
+    return argv;
+}
+
+int redisGetReply(redisContext *c, void **reply)
+{
+    if (mockReply != nullptr)
     {
         *reply = mockReply;
+        return 0;
+    }
+
+    auto command = lastCommands.find(c);
+    if (command != lastCommands.end())
+    {
+        *reply = testing_db::reply(c, command->second);
+        lastCommands.erase(command);
+        if (*reply != nullptr)
+        {
+            return 0;
+        }
     }
+
+    *reply = calloc(sizeof(redisReply), 1);
+    ((redisReply *)*reply)->type = 3;
     return 0;
 }
 
 int redisAppendFormattedCommand(redisContext *c, const char *cmd, size_t len)
 {
+    if (mockRecordCommands)
+    {
+        mockCommands.emplace_back(cmd, len);
+    }
+    lastCommands[c] = parseCommand(cmd, len);
     return 0;
 }
 
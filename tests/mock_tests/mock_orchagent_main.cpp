@@ -17,6 +17,8 @@ int32_t gVoqMySwitchId = 0;
 string gMyHostName = "Linecard1";
 string gMyAsicName = "Asic0";
 bool gTraditionalFlexCounter = false;
+bool gNativeCounterRates = false;
+bool gNativePfcWdDetection = false;
 
 VRFOrch *gVrfOrch;
 
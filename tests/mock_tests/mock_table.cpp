@@ -1,8 +1,12 @@
 #include "table.h"
 #include "producerstatetable.h"
 #include "producertable.h"
+#include "batchtablereader.h"
+#include "mock_table.h"
 #include <set>
 #include <memory>
+#include <stdlib.h>
+#include <string.h>
 
 using TableDataT = std::map<std::string, std::vector<swss::FieldValueTuple>>;
 using TablesT = std::map<std::string, TableDataT>;
@@ -14,10 +18,93 @@ namespace testing_db
     TablesT gTables;
     std::map<int, TablesT> gDB;
 
+    // Lua scripts loaded in redis, their SHA is their index
+    std::vector<std::string> gScripts;
+
     void reset()
     {
         gDB.clear();
     }
+
+    static redisReply *newReply(int type)
+    {
+        auto r = (redisReply *)calloc(sizeof(redisReply), 1);
+        r->type = type;
+        return r;
+    }
+
+    static redisReply *newStringReply(const std::string &str)
+    {
+        auto r = newReply(REDIS_REPLY_STRING);
+        r->str = (char *)malloc(str.length() + 1);
+        memcpy(r->str, str.c_str(), str.length() + 1);
+        r->len = str.length();
+        return r;
+    }
+
+    static redisReply *newArrayReply(size_t elements)
+    {
+        auto r = newReply(REDIS_REPLY_ARRAY);
+        r->elements = elements;
+        r->element = (redisReply **)calloc(sizeof(redisReply *), elements);
+        return r;
+    }
+
+    /* HGETALL of a full key, the table name is the part before the first separator */
+    static redisReply *hgetall(int dbId, const std::string &fullKey)
+    {
+        auto sep = fullKey.find_first_of(":|");
+        if (sep != std::string::npos)
+        {
+            auto &table = gDB[dbId][fullKey.substr(0, sep)];
+            auto it = table.find(fullKey.substr(sep + 1));
+            if (it != table.end())
+            {
+                auto r = newArrayReply(2 * it->second.size());
+                for (size_t i = 0; i < it->second.size(); i++)
+                {
+                    r->element[2 * i] = newStringReply(fvField(it->second[i]));
+                    r->element[2 * i + 1] = newStringReply(fvValue(it->second[i]));
+                }
+                return r;
+            }
+        }
+        return newArrayReply(0);
+    }
+
+    redisReply *reply(const redisContext *c, const std::vector<std::string> &argv)
+    {
+        if (argv.size() == 3 && argv[0] == "SCRIPT" && argv[1] == "LOAD")
+        {
+            gScripts.push_back(argv[2]);
+            return newStringReply(std::to_string(gScripts.size() - 1));
+        }
+
+        // The batch reads of BatchTableReader are the only scripts run over the mocked tables
+        if (argv.size() >= 3 && argv[0] == "EVALSHA")
+        {
+            if (argv[1].empty() || argv[1].find_first_not_of("0123456789") != std::string::npos)
+            {
+                return nullptr;
+            }
+
+            size_t sha = strtoul(argv[1].c_str(), nullptr, 10);
+            size_t keys = strtoul(argv[2].c_str(), nullptr, 10);
+            if (sha >= gScripts.size() || gScripts[sha] != BatchTableReader::luaScript || argv.size() < 3 + keys)
+            {
+                return nullptr;
+            }
+
+            auto r = newArrayReply(keys);
+            for (size_t i = 0; i < keys; i++)
+            {
+                r->element[i] = hgetall(getDbId(c), argv[3 + i]);
+            }
+            return r;
+        }
+
+        return nullptr;
+    }
 }
 
 namespace swss
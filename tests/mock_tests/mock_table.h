@@ -1,8 +1,19 @@
 #pragma once
 
+#include <string>
+#include <vector>
+
+#include <hiredis/hiredis.h>
+
 #include "table.h"
 
 namespace testing_db
 {
     void reset();
+
+    /* DB of a connection of the mocked DBConnector, -1 when unknown */
+    int getDbId(const redisContext *c);
+
+    /* Reply of the mocked tables to a command sent on a connection, nullptr when they don't answer it */
+    redisReply *reply(const redisContext *c, const std::vector<std::string> &argv);
 }
@@ -0,0 +1,308 @@
+#define private public
+#include "natorch.h"
+#undef private
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_table.h"
+
+extern sai_nat_api_t *sai_nat_api;
+extern size_t gMaxBulkSize;
+
+extern bool mockRecordCommands;
+extern std::vector<std::string> mockCommands;
+
+namespace natorch_test
+{
+    using namespace std;
+
+    typedef tuple<int, uint32_t, uint32_t, uint16_t, uint16_t> SaiNatKey;
+
+    sai_nat_api_t ut_sai_nat_api;
+    sai_nat_api_t *pold_sai_nat_api;
+    sai_switch_api_t ut_sai_switch_api;
+    sai_switch_api_t *pold_sai_switch_api;
+
+    /* Entries whose hit bit is set in the hardware */
+    set<SaiNatKey> hit_entries;
+    sai_status_t bulk_get_status;
+    uint32_t bulk_get_calls;
+    uint32_t bulk_get_entries;
+    uint32_t single_get_calls;
+
+    SaiNatKey getSaiNatKey(const sai_nat_entry_t &nat_entry)
+    {
+        return make_tuple((int)nat_entry.nat_type, nat_entry.data.key.src_ip, nat_entry.data.key.dst_ip,
+                          nat_entry.data.key.l4_src_port, nat_entry.data.key.l4_dst_port);
+    }
+
+    void getHitBit(const sai_nat_entry_t *nat_entry, uint32_t attr_count, sai_attribute_t *attr_list)
+    {
+        for (uint32_t i = 0; i < attr_count; i++)
+        {
+            if (attr_list[i].id == SAI_NAT_ENTRY_ATTR_HIT_BIT)
+            {
+                attr_list[i].value.booldata = hit_entries.count(getSaiNatKey(*nat_entry)) > 0;
+            }
+        }
+    }
+
+    sai_status_t _ut_stub_sai_get_nat_entry_attribute(
+        _In_ const sai_nat_entry_t *nat_entry,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list)
+    {
+        single_get_calls++;
+        getHitBit(nat_entry, attr_count, attr_list);
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_sai_get_nat_entries_attribute(
+        _In_ uint32_t object_count,
+        _In_ const sai_nat_entry_t *nat_entry,
+        _In_ const uint32_t *attr_count,
+        _Inout_ sai_attribute_t **attr_list,
+        _In_ sai_bulk_op_error_mode_t mode,
+        _Out_ sai_status_t *object_statuses)
+    {
+        bulk_get_calls++;
+        if (bulk_get_status != SAI_STATUS_SUCCESS)
+        {
+            return bulk_get_status;
+        }
+
+        bulk_get_entries += object_count;
+        for (uint32_t i = 0; i < object_count; i++)
+        {
+            getHitBit(&nat_entry[i], attr_count[i], attr_list[i]);
+            object_statuses[i] = SAI_STATUS_SUCCESS;
+        }
+        return SAI_STATUS_SUCCESS;
+    }
+
+    sai_status_t _ut_stub_sai_get_switch_attribute(
+        _In_ sai_object_id_t switch_id,
+        _In_ uint32_t attr_count,
+        _Inout_ sai_attribute_t *attr_list)
+    {
+        if (attr_count == 1 && attr_list[0].id == SAI_SWITCH_ATTR_AVAILABLE_SNAT_ENTRY)
+        {
+            attr_list[0].value.u32 = 1024;
+            return SAI_STATUS_SUCCESS;
+        }
+        return SAI_STATUS_NOT_SUPPORTED;
+    }
+
+    void _hook_sai_apis()
+    {
+        ut_sai_nat_api = {};
+        pold_sai_nat_api = sai_nat_api;
+        ut_sai_nat_api.get_nat_entry_attribute = _ut_stub_sai_get_nat_entry_attribute;
+        ut_sai_nat_api.get_nat_entries_attribute = _ut_stub_sai_get_nat_entries_attribute;
+        sai_nat_api = &ut_sai_nat_api;
+
+        ut_sai_switch_api = {};
+        pold_sai_switch_api = sai_switch_api;
+        ut_sai_switch_api.get_switch_attribute = _ut_stub_sai_get_switch_attribute;
+        sai_switch_api = &ut_sai_switch_api;
+    }
+
+    void _unhook_sai_apis()
+    {
+        sai_nat_api = pold_sai_nat_api;
+        sai_switch_api = pold_sai_switch_api;
+    }
+
+    struct NatOrchTest : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_app_db;
+        shared_ptr<swss::DBConnector> m_state_db;
+        unique_ptr<NatOrch> m_natOrch;
+        size_t m_maxBulkSize;
+        time_t m_now;
+
+        void SetUp() override
+        {
+            ::testing_db::reset();
+            _hook_sai_apis();
+
+            hit_entries.clear();
+            bulk_get_status = SAI_STATUS_SUCCESS;
+            bulk_get_calls = 0;
+            bulk_get_entries = 0;
+            single_get_calls = 0;
+
+            m_app_db = make_shared<swss::DBConnector>("APPL_DB", 0);
+            m_state_db = make_shared<swss::DBConnector>("STATE_DB", 0);
+
+            vector<table_name_with_pri_t> nat_tables = {
+                { APP_NAT_TABLE_NAME, 0 },
+                { APP_NAPT_TABLE_NAME, 0 },
+                { APP_NAT_TWICE_TABLE_NAME, 0 },
+                { APP_NAPT_TWICE_TABLE_NAME, 0 },
+            };
+            m_natOrch = unique_ptr<NatOrch>(new NatOrch(m_app_db.get(), m_state_db.get(), nat_tables, nullptr, nullptr));
+
+            /* Several bulks per table */
+            m_maxBulkSize = gMaxBulkSize;
+            gMaxBulkSize = 2;
+
+            struct timespec time_now;
+            clock_gettime(CLOCK_MONOTONIC, &time_now);
+            m_now = time_now.tv_sec;
+
+            mockCommands.clear();
+            mockRecordCommands = true;
+        }
+
+        void TearDown() override
+        {
+            mockRecordCommands = false;
+            mockCommands.clear();
+
+            gMaxBulkSize = m_maxBulkSize;
+            m_natOrch.reset();
+            _unhook_sai_apis();
+            ::testing_db::reset();
+        }
+
+        /* Last seen active long enough ago to age out when the hit bit is clear */
+        time_t idleSince(int timeout)
+        {
+            return m_now - timeout - 1;
+        }
+
+        NatEntry::iterator addNat(const string &ip, const string &translated_ip, const string &nat_type, time_t activeTime)
+        {
+            NatEntryValue value = { IpAddress(translated_ip), nat_type, "dynamic", activeTime, 0, true };
+            return m_natOrch->m_natEntries.emplace(IpAddress(ip), value).first;
+        }
+
+        NaptEntry::iterator addNapt(const string &ip, int port, const string &translated_ip, int translated_port,
+                                    const string &nat_type, time_t activeTime)
+        {
+            NaptEntryKey key = { IpAddress(ip), port, "UDP" };
+            NaptEntryValue value = { IpAddress(translated_ip), translated_port, nat_type, "dynamic", activeTime, 0, true };
+            return m_natOrch->m_naptEntries.emplace(key, value).first;
+        }
+
+        TwiceNatEntry::iterator addTwiceNat(const string &src_ip, const string &dst_ip, time_t activeTime)
+        {
+            TwiceNatEntryKey key = { IpAddress(src_ip), IpAddress(dst_ip) };
+            TwiceNatEntryValue value = { IpAddress("20.0.0.1"), IpAddress("20.0.0.2"), "dynamic", activeTime, 0, true };
+            return m_natOrch->m_twiceNatEntries.emplace(key, value).first;
+        }
+
+        template <typename Iterator>
+        void setHit(const Iterator &iter)
+        {
+            sai_nat_entry_t nat_entry;
+            m_natOrch->getSaiNatEntry(iter, nat_entry);
+            hit_entries.insert(getSaiNatKey(nat_entry));
+        }
+
+        size_t countAgeOut(const string &op, const string &key)
+        {
+            string data = "\"" + op + "\",\"" + key + "\"";
+            size_t count = 0;
+            for (const auto &command : mockCommands)
+            {
+                if (command.find(data) != string::npos)
+                {
+                    count++;
+                }
+            }
+            return count;
+        }
+
+        void addEntries()
+        {
+            /* Hit in the SNAT direction */
+            setHit(addNat("10.0.0.1", "192.168.0.1", "snat", idleSince(m_natOrch->timeout)));
+
+            /* Hit in the DNAT direction only */
+            addNat("10.0.0.2", "192.168.0.2", "snat", idleSince(m_natOrch->timeout));
+            setHit(addNat("192.168.0.2", "10.0.0.2", "dnat", idleSince(m_natOrch->timeout)));
+
+            /* Not hit and idle for longer than the timeout */
+            addNat("10.0.0.3", "192.168.0.3", "snat", idleSince(m_natOrch->timeout));
+
+            /* Not hit, but seen active recently */
+            addNat("10.0.0.4", "192.168.0.4", "snat", m_now);
+
+            setHit(addNapt("10.0.0.5", 1000, "192.168.0.5", 2000, "snat", idleSince(m_natOrch->udp_timeout)));
+            addNapt("10.0.0.6", 1000, "192.168.0.6", 2000, "snat", idleSince(m_natOrch->udp_timeout));
+
+            setHit(addTwiceNat("10.0.0.7", "10.0.1.7", idleSince(m_natOrch->timeout)));
+            addTwiceNat("10.0.0.8", "10.0.1.8", idleSince(m_natOrch->timeout));
+        }
+
+        void checkAgeOut()
+        {
+            ASSERT_GE(m_natOrch->m_natEntries.at(IpAddress("10.0.0.1")).activeTime, m_now);
+            ASSERT_GE(m_natOrch->m_natEntries.at(IpAddress("10.0.0.2")).activeTime, m_now);
+            ASSERT_EQ(countAgeOut("AGEOUT-SINGLE-NAT", "10.0.0.1"), 0u);
+            ASSERT_EQ(countAgeOut("AGEOUT-SINGLE-NAT", "10.0.0.2"), 0u);
+            ASSERT_EQ(countAgeOut("AGEOUT-SINGLE-NAT", "10.0.0.3"), 1u);
+            ASSERT_EQ(countAgeOut("AGEOUT-SINGLE-NAT", "10.0.0.4"), 0u);
+
+            ASSERT_EQ(countAgeOut("AGEOUT-SINGLE-NAPT", "UDP:10.0.0.5:1000"), 0u);
+            ASSERT_EQ(countAgeOut("AGEOUT-SINGLE-NAPT", "UDP:10.0.0.6:1000"), 1u);
+
+            ASSERT_EQ(countAgeOut("AGEOUT-TWICE-NAT", "10.0.0.7:10.0.1.7"), 0u);
+            ASSERT_EQ(countAgeOut("AGEOUT-TWICE-NAT", "10.0.0.8:10.0.1.8"), 1u);
+        }
+    };
+
+    TEST_F(NatOrchTest, QueryHitBitsBulk)
+    {
+        addEntries();
+
+        m_natOrch->queryHitBits();
+
+        /*
+         * SNAT: 4 entries in 2 bulks, then the reverse DNAT of the one not hit
+         * that has one. SNAPT: 2 entries in 1 bulk, the one not hit has no
+         * reverse DNAPT. Twice NAT: 2 entries in 1 bulk.
+         */
+        ASSERT_EQ(bulk_get_calls, 5u);
+        ASSERT_EQ(bulk_get_entries, 9u);
+        ASSERT_EQ(single_get_calls, 0u);
+        ASSERT_TRUE(m_natOrch->m_natBulkGetSupported);
+
+        checkAgeOut();
+    }
+
+    TEST_F(NatOrchTest, QueryHitBitsBulkNotSupported)
+    {
+        addEntries();
+        bulk_get_status = SAI_STATUS_NOT_SUPPORTED;
+
+        m_natOrch->queryHitBits();
+
+        /* The bulk get is tried once, then each entry is queried on its own */
+        ASSERT_EQ(bulk_get_calls, 1u);
+        ASSERT_EQ(bulk_get_entries, 0u);
+        ASSERT_EQ(single_get_calls, 9u);
+        ASSERT_FALSE(m_natOrch->m_natBulkGetSupported);
+
+        checkAgeOut();
+
+        m_natOrch->queryHitBits();
+        ASSERT_EQ(bulk_get_calls, 1u);
+        ASSERT_EQ(single_get_calls, 18u);
+    }
+
+    TEST_F(NatOrchTest, QueryHitBitsBulkNotImplemented)
+    {
+        addEntries();
+        bulk_get_status = SAI_STATUS_NOT_IMPLEMENTED;
+
+        m_natOrch->queryHitBits();
+
+        ASSERT_EQ(bulk_get_calls, 1u);
+        ASSERT_EQ(single_get_calls, 9u);
+        ASSERT_FALSE(m_natOrch->m_natBulkGetSupported);
+
+        checkAgeOut();
+    }
+}
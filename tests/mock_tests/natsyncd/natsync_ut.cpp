@@ -0,0 +1,231 @@
+#include <arpa/inet.h>
+#include <memory>
+#include <netlink/addr.h>
+#include <netlink/netfilter/ct.h>
+#include <netlink/netfilter/nfnl.h>
+
+#include "gtest/gtest.h"
+#include "mock_table.h"
+#include "natsyncd/natsync.h"
+
+using namespace std;
+using namespace swss;
+
+namespace natsync_test
+{
+    const int ctNew = NFNLMSG_TYPE(NFNL_SUBSYS_CTNETLINK, IPCTNL_MSG_CT_NEW);
+    const int ctDelete = NFNLMSG_TYPE(NFNL_SUBSYS_CTNETLINK, IPCTNL_MSG_CT_DELETE);
+
+    const uint32_t tcpSnatStatus = IPS_CONFIRMED | IPS_SEEN_REPLY | IPS_ASSURED | IPS_SRC_NAT | IPS_SRC_NAT_DONE;
+
+    /* A conntrack notification of a connection translated from src to natSrc */
+    struct ConnTrack
+    {
+        string src;
+        uint16_t srcPort;
+        string dst;
+        uint16_t dstPort;
+        string natSrc;
+        uint16_t natSrcPort;
+    };
+
+    void setAddress(struct nfnl_ct *ct, int repl, bool source, const string &ip)
+    {
+        struct in_addr addr;
+        inet_pton(AF_INET, ip.c_str(), &addr);
+
+        struct nl_addr *nlAddr = nl_addr_build(AF_INET, &addr, sizeof(addr));
+        if (source)
+        {
+            nfnl_ct_set_src(ct, repl, nlAddr);
+        }
+        else
+        {
+            nfnl_ct_set_dst(ct, repl, nlAddr);
+        }
+        nl_addr_put(nlAddr);
+    }
+
+    struct nfnl_ct *buildConnTrack(const ConnTrack &conn, uint32_t id)
+    {
+        struct nfnl_ct *ct = nfnl_ct_alloc();
+
+        nfnl_ct_set_family(ct, AF_INET);
+        nfnl_ct_set_proto(ct, IPPROTO_TCP);
+        nfnl_ct_set_status(ct, tcpSnatStatus);
+        nfnl_ct_set_id(ct, id);
+
+        /* Original direction */
+        setAddress(ct, 0, true, conn.src);
+        setAddress(ct, 0, false, conn.dst);
+        nfnl_ct_set_src_port(ct, 0, conn.srcPort);
+        nfnl_ct_set_dst_port(ct, 0, conn.dstPort);
+
+        /* Reply direction, to the translated source */
+        setAddress(ct, 1, true, conn.dst);
+        setAddress(ct, 1, false, conn.natSrc);
+        nfnl_ct_set_src_port(ct, 1, conn.dstPort);
+        nfnl_ct_set_dst_port(ct, 1, conn.natSrcPort);
+
+        return ct;
+    }
+
+    class NatSyncTest : public ::testing::Test
+    {
+    public:
+        void SetUp() override
+        {
+            testing_db::reset();
+        }
+
+        void createNatSync()
+        {
+            m_natSync = make_shared<NatSync>(&m_pipeline, &m_appDb, &m_stateDb, nullptr);
+        }
+
+        void notify(int type, const ConnTrack &conn, uint32_t id = 1)
+        {
+            struct nfnl_ct *ct = buildConnTrack(conn, id);
+            m_natSync->onMsg(type, (struct nl_object *)ct);
+            nfnl_ct_put(ct);
+        }
+
+        bool hasEntry(Table &table, const string &key)
+        {
+            vector<FieldValueTuple> fvs;
+            return table.get(key, fvs);
+        }
+
+        string getField(Table &table, const string &key, const string &field)
+        {
+            string value;
+            table.hget(key, field, value);
+            return value;
+        }
+
+        /* Apply the updates of the NAT tables, as natsyncd does when its subscriptions are selected */
+        void processNatTables()
+        {
+            for (auto subscriber : m_natSync->getNatTableSubscribers())
+            {
+                ASSERT_TRUE(m_natSync->processNatTable(subscriber));
+            }
+        }
+
+        DBConnector m_appDb{"APPL_DB", 0};
+        DBConnector m_stateDb{"STATE_DB", 0};
+        RedisPipeline m_pipeline{&m_appDb};
+        Table m_natTable{&m_appDb, APP_NAT_TABLE_NAME};
+        Table m_naptTable{&m_appDb, APP_NAPT_TABLE_NAME};
+        Table m_naptPoolTable{&m_appDb, APP_NAPT_POOL_IP_TABLE_NAME};
+        shared_ptr<NatSync> m_natSync;
+    };
+
+    TEST_F(NatSyncTest, SnatAndSnapt)
+    {
+        createNatSync();
+
+        /* Same L4 port and no pool for the translated IP: basic SNAT */
+        notify(ctNew, { "10.0.0.2", 1000, "30.0.0.1", 80, "20.0.0.1", 1000 });
+        ASSERT_EQ(getField(m_natTable, "10.0.0.2", "translated_ip"), "20.0.0.1");
+        ASSERT_EQ(getField(m_natTable, "10.0.0.2", "entry_type"), "dynamic");
+        ASSERT_EQ(getField(m_natTable, "20.0.0.1", "translated_ip"), "10.0.0.2");
+
+        /* Translated L4 port: SNAPT */
+        notify(ctNew, { "10.0.0.3", 1000, "30.0.0.1", 80, "20.0.0.1", 2000 });
+        ASSERT_EQ(getField(m_naptTable, "TCP:10.0.0.3:1000", "translated_l4_port"), "2000");
+        ASSERT_EQ(getField(m_naptTable, "TCP:20.0.0.1:2000", "translated_ip"), "10.0.0.3");
+
+        notify(ctDelete, { "10.0.0.3", 1000, "30.0.0.1", 80, "20.0.0.1", 2000 });
+        ASSERT_FALSE(hasEntry(m_naptTable, "TCP:10.0.0.3:1000"));
+        ASSERT_FALSE(hasEntry(m_naptTable, "TCP:20.0.0.1:2000"));
+
+        notify(ctDelete, { "10.0.0.2", 1000, "30.0.0.1", 80, "20.0.0.1", 1000 });
+        ASSERT_FALSE(hasEntry(m_natTable, "10.0.0.2"));
+        ASSERT_FALSE(hasEntry(m_natTable, "20.0.0.1"));
+    }
+
+    TEST_F(NatSyncTest, PoolAddress)
+    {
+        /* The pool is read by the subscription when natsyncd starts */
+        m_naptPoolTable.set("20.0.0.1", { { "port_range", "1024-65535" } });
+        createNatSync();
+
+        /* The translated IP is a pool IP: SNAPT even with the same L4 port */
+        notify(ctNew, { "10.0.0.2", 1000, "30.0.0.1", 80, "20.0.0.1", 1000 });
+        ASSERT_EQ(getField(m_naptTable, "TCP:10.0.0.2:1000", "translated_ip"), "20.0.0.1");
+        ASSERT_FALSE(hasEntry(m_natTable, "10.0.0.2"));
+
+        /* A pool added later is known once its subscription is processed */
+        m_naptPoolTable.set("20.0.0.2", { { "port_range", "1024-65535" } });
+        notify(ctNew, { "10.0.0.3", 1000, "30.0.0.1", 80, "20.0.0.2", 1000 });
+        ASSERT_TRUE(hasEntry(m_natTable, "10.0.0.3"));
+
+        processNatTables();
+        notify(ctNew, { "10.0.0.4", 1000, "30.0.0.1", 80, "20.0.0.2", 1000 });
+        ASSERT_TRUE(hasEntry(m_naptTable, "TCP:10.0.0.4:1000"));
+    }
+
+    TEST_F(NatSyncTest, StaticEntry)
+    {
+        m_naptTable.set("TCP:10.0.0.2:1000", { { "entry_type", "static" },
+                                               { "nat_type", "snat" },
+                                               { "translated_ip", "20.0.0.9" },
+                                               { "translated_l4_port", "3000" } });
+
+        /*
+         * The subscriptions of the tests take the entries out of the tables:
+         * natsyncd only knows them from its cache.
+         */
+        createNatSync();
+        ASSERT_FALSE(hasEntry(m_naptTable, "TCP:10.0.0.2:1000"));
+
+        /* The static entry has priority over the connection */
+        notify(ctNew, { "10.0.0.2", 1000, "30.0.0.1", 80, "20.0.0.1", 2000 });
+        ASSERT_FALSE(hasEntry(m_naptTable, "TCP:10.0.0.2:1000"));
+        ASSERT_FALSE(hasEntry(m_naptTable, "TCP:20.0.0.1:2000"));
+
+        /* The reverse entry of a connection is checked too */
+        notify(ctNew, { "10.0.0.7", 1000, "30.0.0.1", 80, "10.0.0.2", 1000 });
+        ASSERT_FALSE(hasEntry(m_naptTable, "TCP:10.0.0.7:1000"));
+    }
+
+    TEST_F(NatSyncTest, DuplicateNotification)
+    {
+        createNatSync();
+
+        notify(ctNew, { "10.0.0.3", 1000, "30.0.0.1", 80, "20.0.0.1", 2000 });
+        m_naptTable.set("TCP:10.0.0.3:1000", { { "translated_l4_port", "0" } });
+
+        /* The entry is known as soon as natsyncd writes it */
+        notify(ctNew, { "10.0.0.3", 1000, "30.0.0.1", 80, "20.0.0.1", 2000 });
+        ASSERT_EQ(getField(m_naptTable, "TCP:10.0.0.3:1000", "translated_l4_port"), "0");
+    }
+
+    TEST_F(NatSyncTest, DeleteAndQuickReAdd)
+    {
+        createNatSync();
+        const ConnTrack conn = { "10.0.0.3", 1000, "30.0.0.1", 80, "20.0.0.1", 2000 };
+
+        notify(ctNew, conn);
+        vector<FieldValueTuple> fvs, reverseFvs;
+        ASSERT_TRUE(m_naptTable.get("TCP:10.0.0.3:1000", fvs));
+        ASSERT_TRUE(m_naptTable.get("TCP:20.0.0.1:2000", reverseFvs));
+
+        /* The subscription reads the added entries back only after natsyncd deleted them */
+        notify(ctDelete, conn);
+        m_naptTable.set("TCP:10.0.0.3:1000", fvs);
+        m_naptTable.set("TCP:20.0.0.1:2000", reverseFvs);
+        processNatTables();
+
+        /* The connection set up again is not taken for a duplicate of the deleted one */
+        notify(ctNew, conn);
+        ASSERT_EQ(getField(m_naptTable, "TCP:10.0.0.3:1000", "translated_l4_port"), "2000");
+        ASSERT_EQ(getField(m_naptTable, "TCP:20.0.0.1:2000", "translated_ip"), "10.0.0.3");
+
+        /* Once the table shows the last write, its updates apply again */
+        processNatTables();
+        notify(ctNew, conn);
+        ASSERT_FALSE(hasEntry(m_naptTable, "TCP:10.0.0.3:1000"));
+    }
+}
@@ -246,6 +246,148 @@ namespace neighorch_test
         ASSERT_EQ(gNeighOrch->m_syncdNeighbors.count(VLAN4000_NEIGH), 1);
     }
 
+    TEST_F(NeighOrchTest, BulkNeighbors)
+    {
+        Consumer *consumer = dynamic_cast<Consumer *>(gNeighOrch->getExecutor(APP_NEIGH_TABLE_NAME));
+        const vector<string> ips = { "192.168.0.10", "192.168.0.11", "192.168.0.12" };
+        auto neighKey = [](const string &ip) { return VLAN_1000 + ":" + ip; };
+
+        // Several neighbors are created with the bulkers
+        EXPECT_CALL(*mock_sai_neighbor_api, create_neighbor_entry).Times(0);
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        for (const auto &ip : ips)
+        {
+            entries.push_back({ neighKey(ip), SET_COMMAND, { { "neigh", MAC1 }, { "family", "IPv4" } } });
+        }
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gNeighOrch)->doTask();
+
+        ASSERT_TRUE(consumer->m_toSync.empty());
+        for (const auto &ip : ips)
+        {
+            NeighborEntry neighbor = { ip, VLAN_1000 };
+            ASSERT_EQ(gNeighOrch->m_syncdNeighbors.count(neighbor), 1);
+            ASSERT_TRUE(gNeighOrch->isHwConfigured(neighbor));
+            ASSERT_TRUE(gNeighOrch->hasNextHop(neighbor));
+        }
+
+        // A still referenced neighbor is kept for retry, the others are removed in bulk
+        EXPECT_CALL(*mock_sai_neighbor_api, remove_neighbor_entry).Times(0);
+        NextHopKey referenced = { ips[0], VLAN_1000 };
+        gNeighOrch->increaseNextHopRefCount(referenced);
+        entries.clear();
+        for (const auto &ip : ips)
+        {
+            entries.push_back({ neighKey(ip), DEL_COMMAND, { } });
+        }
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gNeighOrch)->doTask();
+
+        ASSERT_EQ(consumer->m_toSync.size(), 1);
+        ASSERT_EQ(consumer->m_toSync.begin()->first, neighKey(ips[0]));
+        ASSERT_EQ(gNeighOrch->m_syncdNeighbors.count(referenced), 1);
+        for (size_t i = 1; i < ips.size(); i++)
+        {
+            NeighborEntry neighbor = { ips[i], VLAN_1000 };
+            ASSERT_EQ(gNeighOrch->m_syncdNeighbors.count(neighbor), 0);
+            ASSERT_FALSE(gNeighOrch->hasNextHop(neighbor));
+        }
+
+        // Removed and learned again in the same drain
+        gNeighOrch->decreaseNextHopRefCount(referenced);
+        consumer->addToSync({ { neighKey(ips[0]), SET_COMMAND, { { "neigh", MAC3 }, { "family", "IPv4" } } },
+                              { neighKey(ips[1]), SET_COMMAND, { { "neigh", MAC3 }, { "family", "IPv4" } } } });
+        static_cast<Orch *>(gNeighOrch)->doTask();
+
+        ASSERT_TRUE(consumer->m_toSync.empty());
+        for (size_t i = 0; i < 2; i++)
+        {
+            NeighborEntry neighbor = { ips[i], VLAN_1000 };
+            ASSERT_EQ(gNeighOrch->m_syncdNeighbors.count(neighbor), 1);
+            ASSERT_EQ(gNeighOrch->m_syncdNeighbors[neighbor].mac, MacAddress(MAC3));
+            ASSERT_TRUE(gNeighOrch->hasNextHop(neighbor));
+        }
+    }
+
+    TEST_F(NeighOrchTest, BulkNeighborsNotExecuted)
+    {
+        Consumer *consumer = dynamic_cast<Consumer *>(gNeighOrch->getExecutor(APP_NEIGH_TABLE_NAME));
+        const vector<string> ips = { "192.168.0.10", "192.168.0.11", "192.168.0.12" };
+        auto neighKey = [](const string &ip) { return VLAN_1000 + ":" + ip; };
+        NeighborEntry skipped = { ips[1], VLAN_1000 };
+
+        // The bulk calls fail without reaching the second neighbor
+        EXPECT_CALL(*mock_sai_neighbor_api, create_neighbor_entries)
+            .WillOnce([](CREATE_BULK_PARAMS(neighbor)) {
+                for (uint32_t i = 0; i < object_count; i++)
+                {
+                    object_statuses[i] = (i == 1) ? SAI_STATUS_NOT_EXECUTED
+                        : old_sai_neighbor_api->create_neighbor_entry(&neighbor_entry[i], attr_count[i], attr_list[i]);
+                }
+                return SAI_STATUS_FAILURE;
+            });
+        EXPECT_CALL(*mock_sai_neighbor_api, remove_neighbor_entries)
+            .WillOnce([](REMOVE_BULK_PARAMS(neighbor)) {
+                for (uint32_t i = 0; i < object_count; i++)
+                {
+                    object_statuses[i] = (i == 1) ? SAI_STATUS_NOT_EXECUTED
+                        : old_sai_neighbor_api->remove_neighbor_entry(&neighbor_entry[i]);
+                }
+                return SAI_STATUS_FAILURE;
+            });
+
+        // The neighbor not created is retried, without the next hop created along with it
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        for (const auto &ip : ips)
+        {
+            entries.push_back({ neighKey(ip), SET_COMMAND, { { "neigh", MAC1 }, { "family", "IPv4" } } });
+        }
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gNeighOrch)->doTask();
+
+        ASSERT_EQ(consumer->m_toSync.size(), 1);
+        ASSERT_EQ(consumer->m_toSync.begin()->first, neighKey(ips[1]));
+        ASSERT_EQ(gNeighOrch->m_syncdNeighbors.count(skipped), 0);
+        ASSERT_FALSE(gNeighOrch->hasNextHop(skipped));
+        for (size_t i : { 0, 2 })
+        {
+            NeighborEntry neighbor = { ips[i], VLAN_1000 };
+            ASSERT_EQ(gNeighOrch->m_syncdNeighbors.count(neighbor), 1);
+            ASSERT_TRUE(gNeighOrch->hasNextHop(neighbor));
+        }
+
+        static_cast<Orch *>(gNeighOrch)->doTask();
+
+        ASSERT_TRUE(consumer->m_toSync.empty());
+        ASSERT_EQ(gNeighOrch->m_syncdNeighbors.count(skipped), 1);
+        ASSERT_TRUE(gNeighOrch->hasNextHop(skipped));
+
+        // The neighbor not removed is retried, its next hop is already gone
+        entries.clear();
+        for (const auto &ip : ips)
+        {
+            entries.push_back({ neighKey(ip), DEL_COMMAND, { } });
+        }
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gNeighOrch)->doTask();
+
+        ASSERT_EQ(consumer->m_toSync.size(), 1);
+        ASSERT_EQ(consumer->m_toSync.begin()->first, neighKey(ips[1]));
+        ASSERT_EQ(gNeighOrch->m_syncdNeighbors.count(skipped), 1);
+        ASSERT_FALSE(gNeighOrch->hasNextHop(skipped));
+        for (size_t i : { 0, 2 })
+        {
+            NeighborEntry neighbor = { ips[i], VLAN_1000 };
+            ASSERT_EQ(gNeighOrch->m_syncdNeighbors.count(neighbor), 0);
+            ASSERT_FALSE(gNeighOrch->hasNextHop(neighbor));
+        }
+
+        static_cast<Orch *>(gNeighOrch)->doTask();
+
+        ASSERT_TRUE(consumer->m_toSync.empty());
+        ASSERT_EQ(gNeighOrch->m_syncdNeighbors.count(skipped), 0);
+    }
+
     TEST_F(NeighOrchTest, MultiVlanDuplicateNeighborMissingExistingVlanPort)
     {
         LearnNeighbor(VLAN_1000, TEST_IP, MAC1);
@@ -0,0 +1,198 @@
+#include <map>
+#include <memory>
+#include <string.h>
+#include <netlink/addr.h>
+#include <netlink/route/link.h>
+#include <netlink/route/neighbour.h>
+
+#include "gtest/gtest.h"
+#include "mock_table.h"
+#include "neighsyncd/neighsync.h"
+
+using namespace std;
+using namespace swss;
+
+/* Names of the interfaces of the neighbors, looked up by LinkCache */
+static map<int, string> gIfNames = {
+    { 10, "Vlan1000" },
+    { 20, "Ethernet0" },
+    { 30, "PortChannel1" },
+};
+
+extern "C"
+{
+
+char *rtnl_link_i2name(struct nl_cache *cache, int ifindex, char *dst, size_t len)
+{
+    auto it = gIfNames.find(ifindex);
+    if (it == gIfNames.end())
+    {
+        return NULL;
+    }
+    strncpy(dst, it->second.c_str(), len);
+    return dst;
+}
+
+}
+
+namespace neighsync_test
+{
+    class NeighSyncTest : public ::testing::Test
+    {
+    public:
+        void SetUp() override
+        {
+            testing_db::reset();
+        }
+
+        void createNeighSync()
+        {
+            m_neighSync = make_shared<NeighSync>(&m_pipeline, &m_stateDb, &m_cfgDb);
+        }
+
+        void notify(int type, int ifindex, int family, const string &ip, int state = NUD_REACHABLE,
+                    const string &mac = "00:11:22:33:44:55")
+        {
+            struct rtnl_neigh *neigh = rtnl_neigh_alloc();
+            struct nl_addr *dst = nullptr;
+            struct nl_addr *lladdr = nullptr;
+
+            rtnl_neigh_set_ifindex(neigh, ifindex);
+            rtnl_neigh_set_family(neigh, family);
+            rtnl_neigh_set_state(neigh, state);
+            ASSERT_EQ(nl_addr_parse(ip.c_str(), family, &dst), 0);
+            rtnl_neigh_set_dst(neigh, dst);
+            ASSERT_EQ(nl_addr_parse(mac.c_str(), AF_LLC, &lladdr), 0);
+            rtnl_neigh_set_lladdr(neigh, lladdr);
+
+            m_neighSync->onMsg(type, (struct nl_object *)neigh);
+
+            nl_addr_put(dst);
+            nl_addr_put(lladdr);
+            rtnl_neigh_put(neigh);
+        }
+
+        string getMac(const string &key)
+        {
+            string value;
+            m_neighTable.hget(key, "neigh", value);
+            return value;
+        }
+
+        bool hasNeighbor(const string &key)
+        {
+            vector<FieldValueTuple> fvs;
+            return m_neighTable.get(key, fvs);
+        }
+
+        /* Apply the CONFIG_DB updates, as neighsyncd does when its subscriptions are selected */
+        void processCfgTables()
+        {
+            m_neighSync->processCfgPeerSwitch();
+            m_neighSync->processCfgInterface(*m_neighSync->getCfgVlanInterfaceTable());
+            m_neighSync->processCfgInterface(*m_neighSync->getCfgLagInterfaceTable());
+            m_neighSync->processCfgInterface(*m_neighSync->getCfgInterfaceTable());
+        }
+
+        DBConnector m_appDb{"APPL_DB", 0};
+        DBConnector m_stateDb{"STATE_DB", 0};
+        DBConnector m_cfgDb{"CONFIG_DB", 0};
+        RedisPipeline m_pipeline{&m_appDb};
+        Table m_neighTable{&m_appDb, APP_NEIGH_TABLE_NAME};
+        Table m_peerSwitchTable{&m_cfgDb, CFG_PEER_SWITCH_TABLE_NAME};
+        Table m_vlanIntfTable{&m_cfgDb, CFG_VLAN_INTF_TABLE_NAME};
+        Table m_lagIntfTable{&m_cfgDb, CFG_LAG_INTF_TABLE_NAME};
+        Table m_intfTable{&m_cfgDb, CFG_INTF_TABLE_NAME};
+        shared_ptr<NeighSync> m_neighSync;
+    };
+
+    TEST_F(NeighSyncTest, Neighbor)
+    {
+        createNeighSync();
+
+        notify(RTM_NEWNEIGH, 20, AF_INET, "10.0.0.2");
+        ASSERT_EQ(getMac("Ethernet0:10.0.0.2"), "00:11:22:33:44:55");
+
+        notify(RTM_DELNEIGH, 20, AF_INET, "10.0.0.2");
+        ASSERT_FALSE(hasNeighbor("Ethernet0:10.0.0.2"));
+
+        /* Unresolved neighbors are removed */
+        notify(RTM_NEWNEIGH, 20, AF_INET, "10.0.0.3");
+        notify(RTM_NEWNEIGH, 20, AF_INET, "10.0.0.3", NUD_FAILED);
+        ASSERT_FALSE(hasNeighbor("Ethernet0:10.0.0.3"));
+    }
+
+    TEST_F(NeighSyncTest, PeerSwitch)
+    {
+        /* The peer switch is read by the subscription when neighsyncd starts */
+        m_peerSwitchTable.set("peer", { { "address_ipv4", "10.1.0.33" } });
+        createNeighSync();
+
+        /* Dual ToR: IPv4 link-local neighbors are ignored, unresolved ones get a zero MAC */
+        notify(RTM_NEWNEIGH, 10, AF_INET, "169.254.0.1");
+        ASSERT_FALSE(hasNeighbor("Vlan1000:169.254.0.1"));
+
+        notify(RTM_NEWNEIGH, 10, AF_INET, "192.168.0.2", NUD_FAILED);
+        ASSERT_EQ(getMac("Vlan1000:192.168.0.2"), "00:00:00:00:00:00");
+        notify(RTM_DELNEIGH, 10, AF_INET, "192.168.0.2", NUD_FAILED);
+        ASSERT_FALSE(hasNeighbor("Vlan1000:192.168.0.2"));
+    }
+
+    TEST_F(NeighSyncTest, PeerSwitchAdded)
+    {
+        createNeighSync();
+
+        notify(RTM_NEWNEIGH, 10, AF_INET, "169.254.0.1");
+        ASSERT_TRUE(hasNeighbor("Vlan1000:169.254.0.1"));
+
+        /* A peer switch added later is known once its subscription is processed */
+        m_peerSwitchTable.set("peer", { { "address_ipv4", "10.1.0.33" } });
+        notify(RTM_NEWNEIGH, 10, AF_INET, "169.254.0.2");
+        ASSERT_TRUE(hasNeighbor("Vlan1000:169.254.0.2"));
+
+        processCfgTables();
+        notify(RTM_NEWNEIGH, 10, AF_INET, "169.254.0.3");
+        ASSERT_FALSE(hasNeighbor("Vlan1000:169.254.0.3"));
+    }
+
+    TEST_F(NeighSyncTest, Ipv6LinkLocal)
+    {
+        /* The interfaces are read by the subscriptions when neighsyncd starts */
+        m_vlanIntfTable.set("Vlan1000", { { "ipv6_use_link_local_only", "enable" } });
+        m_lagIntfTable.set("PortChannel1", { { "ipv6_use_link_local_only", "disable" } });
+        m_intfTable.set("Ethernet0|fc00::1/126", { { "scope", "global" } });
+        createNeighSync();
+
+        notify(RTM_NEWNEIGH, 10, AF_INET6, "fe80::1");
+        ASSERT_TRUE(hasNeighbor("Vlan1000:fe80::1"));
+
+        notify(RTM_NEWNEIGH, 30, AF_INET6, "fe80::2");
+        ASSERT_FALSE(hasNeighbor("PortChannel1:fe80::2"));
+
+        /* An IP address entry is not the interface entry */
+        notify(RTM_NEWNEIGH, 20, AF_INET6, "fe80::3");
+        ASSERT_FALSE(hasNeighbor("Ethernet0:fe80::3"));
+
+        /* Global neighbors don't depend on the mode */
+        notify(RTM_NEWNEIGH, 20, AF_INET6, "fc00::2");
+        ASSERT_TRUE(hasNeighbor("Ethernet0:fc00::2"));
+
+        /* A mode changed later applies once its subscription is processed */
+        m_intfTable.set("Ethernet0", { { "ipv6_use_link_local_only", "enable" } });
+        m_lagIntfTable.set("PortChannel1", { { "ipv6_use_link_local_only", "enable" } });
+        notify(RTM_NEWNEIGH, 20, AF_INET6, "fe80::3");
+        ASSERT_FALSE(hasNeighbor("Ethernet0:fe80::3"));
+
+        processCfgTables();
+        notify(RTM_NEWNEIGH, 20, AF_INET6, "fe80::3");
+        ASSERT_TRUE(hasNeighbor("Ethernet0:fe80::3"));
+        notify(RTM_NEWNEIGH, 30, AF_INET6, "fe80::2");
+        ASSERT_TRUE(hasNeighbor("PortChannel1:fe80::2"));
+
+        /* Removing a link-local neighbor does not depend on the mode */
+        m_vlanIntfTable.set("Vlan1000", { { "ipv6_use_link_local_only", "disable" } });
+        processCfgTables();
+        notify(RTM_DELNEIGH, 10, AF_INET6, "fe80::1");
+        ASSERT_FALSE(hasNeighbor("Vlan1000:fe80::1"));
+    }
+}
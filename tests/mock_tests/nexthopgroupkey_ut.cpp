@@ -0,0 +1,101 @@
+#include "ut_helper.h"
+#include "nexthopgroupkey.h"
+
+#include <unordered_map>
+
+namespace nexthopgroupkey_test
+{
+    using namespace std;
+
+    struct NextHopGroupKeyTest : public ::testing::Test
+    {
+        NextHopGroupKeyTest() {}
+    };
+
+    TEST_F(NextHopGroupKeyTest, SameNextHops)
+    {
+        NextHopGroupKey nhg1("10.0.0.1@Ethernet0,10.0.0.2@Ethernet4");
+        NextHopGroupKey nhg2("10.0.0.2@Ethernet4,10.0.0.1@Ethernet0");
+        NextHopGroupKey nhg3("10.0.0.1@Ethernet0,10.0.0.3@Ethernet8");
+
+        // Keys with the same next hops share them
+        ASSERT_EQ(nhg1, nhg2);
+        ASSERT_EQ(&nhg1.getNextHops(), &nhg2.getNextHops());
+        ASSERT_EQ(nhg1.hash(), nhg2.hash());
+        ASSERT_FALSE(nhg1 < nhg2);
+        ASSERT_FALSE(nhg2 < nhg1);
+
+        ASSERT_NE(nhg1, nhg3);
+        ASSERT_TRUE((nhg1 < nhg3) != (nhg3 < nhg1));
+
+        NextHopGroupKey copy = nhg1;
+        ASSERT_EQ(&copy.getNextHops(), &nhg1.getNextHops());
+        ASSERT_EQ(copy.to_string(), "10.0.0.1@Ethernet0,10.0.0.2@Ethernet4");
+    }
+
+    TEST_F(NextHopGroupKeyTest, Weights)
+    {
+        NextHopGroupKey nhg1("10.0.0.1@Ethernet0,10.0.0.2@Ethernet4", string("1,2"));
+        NextHopGroupKey nhg2("10.0.0.1@Ethernet0,10.0.0.2@Ethernet4", string("2,1"));
+        NextHopGroupKey nhg3("10.0.0.1@Ethernet0,10.0.0.2@Ethernet4", string("1,2"));
+        NextHopGroupKey nhg4("10.0.0.1@Ethernet0,10.0.0.2@Ethernet4");
+
+        ASSERT_NE(nhg1, nhg2);
+        ASSERT_EQ(nhg1, nhg3);
+        ASSERT_NE(nhg1, nhg4);
+        ASSERT_EQ(nhg1.getNextHops().begin()->weight, 1u);
+        ASSERT_EQ(nhg2.getNextHops().begin()->weight, 2u);
+    }
+
+    TEST_F(NextHopGroupKeyTest, AddRemove)
+    {
+        NextHopGroupKey nhg("10.0.0.1@Ethernet0,10.0.0.2@Ethernet4");
+        NextHopGroupKey copy = nhg;
+
+        copy.remove("10.0.0.2", string("Ethernet4"));
+        ASSERT_EQ(copy, NextHopGroupKey("10.0.0.1@Ethernet0"));
+        ASSERT_EQ(nhg.getSize(), 2u);
+
+        copy.add(NextHopKey("10.0.0.2", string("Ethernet4")));
+        ASSERT_EQ(copy, nhg);
+
+        copy.clear();
+        ASSERT_EQ(copy, NextHopGroupKey());
+        ASSERT_EQ(copy.getSize(), 0u);
+        ASSERT_TRUE(copy.contains(NextHopGroupKey()));
+        ASSERT_FALSE(copy.contains(nhg));
+    }
+
+    TEST_F(NextHopGroupKeyTest, Release)
+    {
+        size_t count = NextHopGroupKey::getInternedCount();
+        {
+            NextHopGroupKey nhg("10.0.0.1@Ethernet0,10.0.0.5@Ethernet16");
+            NextHopGroupKey same("10.0.0.1@Ethernet0,10.0.0.5@Ethernet16");
+            ASSERT_EQ(NextHopGroupKey::getInternedCount(), count + 1);
+        }
+        ASSERT_EQ(NextHopGroupKey::getInternedCount(), count);
+
+        // Parsed again once released
+        NextHopGroupKey nhg("10.0.0.1@Ethernet0,10.0.0.5@Ethernet16");
+        ASSERT_EQ(nhg.getSize(), 2u);
+        ASSERT_TRUE(nhg.contains("10.0.0.5", string("Ethernet16")));
+    }
+
+    TEST_F(NextHopGroupKeyTest, TableKeys)
+    {
+        map<NextHopGroupKey, int> table;
+        unordered_map<NextHopGroupKey, int> hashTable;
+
+        table[NextHopGroupKey("10.0.0.1@Ethernet0,10.0.0.2@Ethernet4")] = 1;
+        table[NextHopGroupKey("10.0.0.1@Ethernet0")] = 2;
+        hashTable[NextHopGroupKey("10.0.0.1@Ethernet0,10.0.0.2@Ethernet4")] = 1;
+        hashTable[NextHopGroupKey("10.0.0.1@Ethernet0")] = 2;
+
+        NextHopGroupKey nhg("10.0.0.2@Ethernet4,10.0.0.1@Ethernet0");
+        ASSERT_EQ(table.size(), 2u);
+        ASSERT_EQ(table.at(nhg), 1);
+        ASSERT_EQ(hashTable.size(), 2u);
+        ASSERT_EQ(hashTable.at(nhg), 1);
+    }
+}
@@ -0,0 +1,167 @@
+#include "ut_helper.h"
+#include "mock_orchagent_main.h"
+#include "mock_table.h"
+#include "orchscheduler.h"
+
+namespace orchscheduler_test
+{
+    using namespace std;
+
+    class TestOrch : public Orch
+    {
+    public:
+        TestOrch(swss::DBConnector *db, const vector<string> &tableNames)
+            : Orch(db, tableNames)
+        {
+        }
+
+        void doTask(Consumer &consumer) override
+        {
+            m_drainCount[consumer.getTableName()]++;
+            if (m_blocked)
+            {
+                return;
+            }
+            consumer.m_toSync.clear();
+        }
+
+        Consumer *getConsumer(const string &tableName)
+        {
+            return dynamic_cast<Consumer *>(getExecutor(tableName));
+        }
+
+        map<string, int> m_drainCount;
+        bool m_blocked = false;
+    };
+
+    struct OrchSchedulerTest : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_app_db;
+        unique_ptr<TestOrch> m_orch1;
+        unique_ptr<TestOrch> m_orch2;
+        vector<Orch *> m_orchList;
+
+        void SetUp() override
+        {
+            ::testing_db::reset();
+
+            m_app_db = make_shared<swss::DBConnector>("APPL_DB", 0);
+            m_orch1 = unique_ptr<TestOrch>(new TestOrch(m_app_db.get(), { "TEST_TABLE_A", "TEST_TABLE_B" }));
+            m_orch2 = unique_ptr<TestOrch>(new TestOrch(m_app_db.get(), { "TEST_TABLE_C" }));
+            m_orchList = { m_orch1.get(), m_orch2.get() };
+        }
+
+        void TearDown() override
+        {
+            ::testing_db::reset();
+        }
+
+        void addTask(TestOrch *orch, const string &tableName, const string &key)
+        {
+            orch->getConsumer(tableName)->addToSync(
+                KeyOpFieldsValuesTuple(key, SET_COMMAND, { { "field", "value" } }));
+        }
+    };
+
+    TEST_F(OrchSchedulerTest, DrainOnlyPendingConsumers)
+    {
+        OrchScheduler scheduler(m_orchList);
+
+        addTask(m_orch1.get(), "TEST_TABLE_A", "key1");
+        ASSERT_EQ(m_orch1->getPendingConsumers().size(), 1);
+        ASSERT_TRUE(m_orch2->getPendingConsumers().empty());
+
+        scheduler.drain();
+
+        ASSERT_EQ(m_orch1->m_drainCount["TEST_TABLE_A"], 1);
+        ASSERT_EQ(m_orch1->m_drainCount["TEST_TABLE_B"], 0);
+        ASSERT_EQ(m_orch2->m_drainCount["TEST_TABLE_C"], 0);
+        ASSERT_TRUE(m_orch1->getPendingConsumers().empty());
+
+        ASSERT_EQ(scheduler.getCounters().drained, 1);
+        ASSERT_EQ(scheduler.getCounters().skipped, 2);
+
+        // Nothing pending, nothing drained
+        scheduler.drain();
+        ASSERT_EQ(m_orch1->m_drainCount["TEST_TABLE_A"], 1);
+        ASSERT_EQ(scheduler.getCounters().drained, 1);
+        ASSERT_EQ(scheduler.getCounters().skipped, 5);
+    }
+
+    TEST_F(OrchSchedulerTest, RetryBackoff)
+    {
+        OrchScheduler scheduler(m_orchList);
+        m_orch2->m_blocked = true;
+
+        addTask(m_orch2.get(), "TEST_TABLE_C", "key1");
+        scheduler.drain();
+        ASSERT_EQ(m_orch2->m_drainCount["TEST_TABLE_C"], 1);
+
+        // No progress was made, the retry is deferred
+        auto consumer = m_orch2->getConsumer("TEST_TABLE_C");
+        ASSERT_EQ(consumer->m_retryBackoff.count(), RETRY_BACKOFF_MIN_MSECS);
+
+        // A deferred consumer does not shorten the select timeout
+        ASSERT_EQ(scheduler.getTimeout(SELECT_TIMEOUT), SELECT_TIMEOUT);
+
+        consumer->m_retryDue = std::chrono::steady_clock::now() + std::chrono::hours(1);
+        scheduler.drain();
+        ASSERT_EQ(m_orch2->m_drainCount["TEST_TABLE_C"], 1);
+        ASSERT_EQ(scheduler.getCounters().deferred, 1);
+        ASSERT_EQ(scheduler.getTimeout(SELECT_TIMEOUT), SELECT_TIMEOUT);
+
+        // Backoff expired, retried and doubled
+        consumer->m_retryDue = std::chrono::steady_clock::time_point();
+        scheduler.drain();
+        ASSERT_EQ(m_orch2->m_drainCount["TEST_TABLE_C"], 2);
+        ASSERT_EQ(consumer->m_retryBackoff.count(), 2 * RETRY_BACKOFF_MIN_MSECS);
+
+        // New data resets the backoff
+        consumer->m_retryDue = std::chrono::steady_clock::now() + std::chrono::hours(1);
+        addTask(m_orch2.get(), "TEST_TABLE_C", "key2");
+        ASSERT_EQ(scheduler.getTimeout(SELECT_TIMEOUT), 0);
+
+        m_orch2->m_blocked = false;
+        scheduler.drain();
+        ASSERT_EQ(m_orch2->m_drainCount["TEST_TABLE_C"], 3);
+        ASSERT_TRUE(m_orch2->getPendingConsumers().empty());
+        ASSERT_EQ(consumer->m_retryBackoff.count(), 0);
+    }
+
+    TEST_F(OrchSchedulerTest, BackoffPerConsumer)
+    {
+        OrchScheduler scheduler(m_orchList);
+        m_orch2->m_blocked = true;
+
+        addTask(m_orch2.get(), "TEST_TABLE_C", "key1");
+        scheduler.drain();
+
+        // The backoff is capped to the select timeout
+        auto consumer = m_orch2->getConsumer("TEST_TABLE_C");
+        for (int i = 0; i < 16; i++)
+        {
+            consumer->m_retryDue = std::chrono::steady_clock::time_point();
+            scheduler.drain();
+        }
+        ASSERT_EQ(m_orch2->m_drainCount["TEST_TABLE_C"], 17);
+        ASSERT_EQ(consumer->m_retryBackoff.count(), RETRY_BACKOFF_MAX_MSECS);
+        ASSERT_EQ(RETRY_BACKOFF_MAX_MSECS, SELECT_TIMEOUT);
+
+        // Progress of another Orch does not make the retry due
+        consumer->m_retryDue = std::chrono::steady_clock::now() + std::chrono::hours(1);
+        addTask(m_orch1.get(), "TEST_TABLE_A", "key1");
+        scheduler.drain();
+        ASSERT_EQ(m_orch1->m_drainCount["TEST_TABLE_A"], 1);
+        ASSERT_EQ(m_orch2->m_drainCount["TEST_TABLE_C"], 17);
+        ASSERT_EQ(consumer->m_retryBackoff.count(), RETRY_BACKOFF_MAX_MSECS);
+        ASSERT_EQ(scheduler.getTimeout(SELECT_TIMEOUT), SELECT_TIMEOUT);
+
+        // Progress of the consumer itself resets its backoff
+        m_orch2->m_blocked = false;
+        consumer->m_retryDue = std::chrono::steady_clock::time_point();
+        scheduler.drain();
+        ASSERT_EQ(m_orch2->m_drainCount["TEST_TABLE_C"], 18);
+        ASSERT_TRUE(m_orch2->getPendingConsumers().empty());
+        ASSERT_EQ(consumer->m_retryBackoff.count(), 0);
+    }
+}
@@ -0,0 +1,643 @@
+#include <algorithm>
+#include <map>
+#include <random>
+#include <tuple>
+
+#include "ut_helper.h"
+#include "mock_table.h"
+#include "pfcwddetector.h"
+#include "sai_serialize.h"
+
+namespace pfcwddetector_test
+{
+    using namespace std;
+
+    typedef map<string, string> Hash;
+    typedef tuple<string, string, vector<swss::FieldValueTuple>> Event;
+
+    const uint32_t pollMs = 100;
+    const uint32_t detectionTimeUs = 200 * 1000;
+    const uint32_t restorationTimeUs = 400 * 1000;
+
+    /*
+     * pfc_detect_<platform>.lua and pfc_restore.lua transcribed statement by
+     * statement over an in-memory COUNTERS_DB, what the plugins do in redis
+     */
+    struct LuaPfcWd
+    {
+        map<string, Hash> counters_db;
+        string platform;
+
+        bool hget(const string &key, const string &field, string &value)
+        {
+            auto it = counters_db.find(key);
+            if (it == counters_db.end() || it->second.find(field) == it->second.end())
+            {
+                return false;
+            }
+            value = it->second[field];
+            return true;
+        }
+
+        static double tonumber(const string &value)
+        {
+            return strtod(value.c_str(), nullptr);
+        }
+
+        /* Lua tostring() */
+        static string tostring(double value)
+        {
+            char buf[32];
+            snprintf(buf, sizeof(buf), "%.14g", value);
+            return buf;
+        }
+
+        /* A number given to HSET */
+        static string hsetNumber(double value)
+        {
+            char buf[32];
+            snprintf(buf, sizeof(buf), "%.17g", value);
+            return buf;
+        }
+
+        string durationKey(const string &queue_index)
+        {
+            if (platform == "barefoot" || platform == "nephos")
+            {
+                return "SAI_PORT_STAT_PFC_" + queue_index + "_RX_PAUSE_DURATION";
+            }
+            return "SAI_PORT_STAT_PFC_" + queue_index + "_RX_PAUSE_DURATION_US";
+        }
+
+        void detect(const vector<string> &keys, double timestamp_current, vector<Event> &events)
+        {
+            const double poll_time = pollMs * 1000;
+            double effective_poll_time = poll_time;
+            string timestamp_last, timestamp_string, effective_poll_time_lasttime;
+            bool has_timestamp_last = false, has_effective_poll_time_lasttime = false;
+
+            if (platform == "mellanox")
+            {
+                has_timestamp_last = hget("TIMESTAMP", "pfcwd_poll_timestamp_last", timestamp_last);
+                timestamp_string = tostring(timestamp_current);
+                counters_db["TIMESTAMP"]["pfcwd_poll_timestamp_last"] = timestamp_string;
+                has_effective_poll_time_lasttime = hget("TIMESTAMP", "effective_pfcwd_poll_time_last", effective_poll_time_lasttime);
+                if (has_timestamp_last)
+                {
+                    effective_poll_time = (timestamp_current - tonumber(timestamp_last)) * 1000000;
+                    counters_db["TIMESTAMP"]["effective_pfcwd_poll_time_last"] = hsetNumber(effective_poll_time);
+                }
+            }
+
+            for (size_t i = keys.size(); i > 0; i--)
+            {
+                const string key = "COUNTERS:" + keys[i - 1];
+                bool is_deadlock = false;
+                string pfc_wd_status, pfc_wd_action, big_red_switch_mode;
+                hget(key, "PFC_WD_STATUS", pfc_wd_status);
+                hget(key, "PFC_WD_ACTION", pfc_wd_action);
+
+                if (hget(key, "BIG_RED_SWITCH_MODE", big_red_switch_mode) ||
+                    !(pfc_wd_status == "operational" || pfc_wd_action == "alert"))
+                {
+                    continue;
+                }
+
+                string value;
+                if (!hget(key, "PFC_WD_DETECTION_TIME", value))
+                {
+                    continue;
+                }
+                double detection_time = tonumber(value);
+                double time_left = hget(key, "PFC_WD_DETECTION_TIME_LEFT", value) ? tonumber(value) : detection_time;
+
+                string queue_index, port_id;
+                if (!hget("COUNTERS_QUEUE_INDEX_MAP", keys[i - 1], queue_index) ||
+                    !hget("COUNTERS_QUEUE_PORT_MAP", keys[i - 1], port_id))
+                {
+                    continue;
+                }
+                const string port_key = "COUNTERS:" + port_id;
+                const string pfc_rx_pkt_key = "SAI_PORT_STAT_PFC_" + queue_index + "_RX_PKTS";
+                const string pfc_duration_key = durationKey(queue_index);
+
+                string occupancy_str, packets_str, rx_str, duration_str;
+                if (!hget(key, "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", occupancy_str) ||
+                    !hget(key, "SAI_QUEUE_STAT_PACKETS", packets_str) ||
+                    !hget(port_key, pfc_rx_pkt_key, rx_str) ||
+                    !hget(port_key, pfc_duration_key, duration_str))
+                {
+                    continue;
+                }
+                double occupancy_bytes = tonumber(occupancy_str);
+                double packets = tonumber(packets_str);
+                double pfc_rx_packets = tonumber(rx_str);
+                double pfc_duration = tonumber(duration_str);
+
+                string packets_last_str, rx_last_str, duration_last_str, debug_storm;
+                bool has_packets_last = hget(key, "SAI_QUEUE_STAT_PACKETS_last", packets_last_str);
+                bool has_rx_last = hget(port_key, pfc_rx_pkt_key + "_last", rx_last_str);
+                bool has_duration_last = hget(port_key, pfc_duration_key + "_last", duration_last_str);
+                hget(key, "DEBUG_STORM", debug_storm);
+
+                if (has_packets_last && has_rx_last && has_duration_last)
+                {
+                    double packets_last = tonumber(packets_last_str);
+                    double pfc_rx_packets_last = tonumber(rx_last_str);
+                    double pfc_duration_last = tonumber(duration_last_str);
+                    bool storm;
+
+                    if (platform == "mellanox")
+                    {
+                        bool storm_condition = (pfc_duration - pfc_duration_last) > (effective_poll_time * 0.99);
+                        storm = (occupancy_bytes > 0 && packets - packets_last == 0 && storm_condition) ||
+                                (debug_storm == "enabled");
+                    }
+                    else
+                    {
+                        bool storm_condition = (pfc_duration - pfc_duration_last) > (poll_time * 0.8);
+                        storm = (occupancy_bytes > 0 && packets - packets_last == 0 && pfc_rx_packets - pfc_rx_packets_last > 0) ||
+                                (debug_storm == "enabled") ||
+                                (occupancy_bytes == 0 && packets - packets_last == 0 && storm_condition);
+                    }
+
+                    if (storm)
+                    {
+                        if (time_left <= effective_poll_time)
+                        {
+                            vector<swss::FieldValueTuple> values;
+                            if (platform != "nephos")
+                            {
+                                counters_db[port_key].erase(pfc_rx_pkt_key + "_last");
+                                counters_db[port_key].erase(pfc_duration_key + "_last");
+                            }
+                            if (platform == "mellanox")
+                            {
+                                values = {
+                                    { "occupancy", tostring(occupancy_bytes) },
+                                    { "packets", tostring(packets) },
+                                    { "packets_last", tostring(packets_last) },
+                                    { "pfc_rx_packets", tostring(pfc_rx_packets) },
+                                    { "pfc_rx_packets_last", tostring(pfc_rx_packets_last) },
+                                    { "pfc_duration", tostring(pfc_duration) },
+                                    { "pfc_duration_last", tostring(pfc_duration_last) },
+                                    { "timestamp", timestamp_string },
+                                    { "timestamp_last", timestamp_last },
+                                    { "effective_poll_time", tostring(effective_poll_time) },
+                                };
+                                if (has_effective_poll_time_lasttime)
+                                {
+                                    values.push_back({ "effective_pfcwd_poll_time_last", effective_poll_time_lasttime });
+                                }
+                            }
+                            events.emplace_back(keys[i - 1], "storm", values);
+                            is_deadlock = true;
+                            time_left = detection_time;
+                        }
+                        else
+                        {
+                            time_left = time_left - effective_poll_time;
+                        }
+                    }
+                    else
+                    {
+                        if (pfc_wd_action == "alert" && pfc_wd_status != "operational")
+                        {
+                            events.emplace_back(keys[i - 1], "restore", vector<swss::FieldValueTuple>());
+                        }
+                        time_left = detection_time;
+                    }
+                }
+
+                counters_db[key]["SAI_QUEUE_STAT_PACKETS_last"] = hsetNumber(packets);
+                counters_db[key]["PFC_WD_DETECTION_TIME_LEFT"] = hsetNumber(time_left);
+                if (!is_deadlock || platform == "nephos")
+                {
+                    counters_db[port_key][pfc_rx_pkt_key + "_last"] = hsetNumber(pfc_rx_packets);
+                    counters_db[port_key][pfc_duration_key + "_last"] = hsetNumber(pfc_duration);
+                }
+            }
+        }
+
+        void restore(const vector<string> &keys, vector<Event> &events)
+        {
+            const double poll_time = pollMs * 1000;
+
+            for (size_t i = keys.size(); i > 0; i--)
+            {
+                const string key = "COUNTERS:" + keys[i - 1];
+                string pfc_wd_status, restoration_time_str, pfc_wd_action, big_red_switch_mode;
+                hget(key, "PFC_WD_STATUS", pfc_wd_status);
+                bool has_restoration_time = hget(key, "PFC_WD_RESTORATION_TIME", restoration_time_str);
+                hget(key, "PFC_WD_ACTION", pfc_wd_action);
+
+                if (hget(key, "BIG_RED_SWITCH_MODE", big_red_switch_mode) ||
+                    pfc_wd_status == "operational" || pfc_wd_action == "alert" ||
+                    !has_restoration_time || restoration_time_str.empty())
+                {
+                    continue;
+                }
+
+                double restoration_time = tonumber(restoration_time_str);
+                string value;
+                double time_left = hget(key, "PFC_WD_RESTORATION_TIME_LEFT", value) ? tonumber(value) : restoration_time;
+
+                string queue_index, port_id;
+                if (!hget("COUNTERS_QUEUE_INDEX_MAP", keys[i - 1], queue_index) ||
+                    !hget("COUNTERS_QUEUE_PORT_MAP", keys[i - 1], port_id))
+                {
+                    continue;
+                }
+                const string port_key = "COUNTERS:" + port_id;
+                const string pfc_rx_pkt_key = "SAI_PORT_STAT_PFC_" + queue_index + "_RX_PKTS";
+
+                hget(port_key, pfc_rx_pkt_key, value);
+                double pfc_rx_packets = tonumber(value);
+                string rx_last_str, debug_storm;
+                bool has_rx_last = hget(port_key, pfc_rx_pkt_key + "_last", rx_last_str);
+                hget(key, "DEBUG_STORM", debug_storm);
+
+                if (has_rx_last)
+                {
+                    double pfc_rx_packets_last = tonumber(rx_last_str);
+                    if (pfc_rx_packets - pfc_rx_packets_last == 0 && debug_storm != "enabled")
+                    {
+                        if (time_left <= poll_time)
+                        {
+                            events.emplace_back(keys[i - 1], "restore", vector<swss::FieldValueTuple>());
+                            time_left = restoration_time;
+                        }
+                        else
+                        {
+                            time_left = time_left - poll_time;
+                        }
+                    }
+                    else
+                    {
+                        time_left = restoration_time;
+                    }
+                }
+
+                counters_db[key]["PFC_WD_RESTORATION_TIME_LEFT"] = hsetNumber(time_left);
+                counters_db[port_key][pfc_rx_pkt_key + "_last"] = hsetNumber(pfc_rx_packets);
+            }
+        }
+    };
+
+    enum class Traffic
+    {
+        NORMAL,
+        STORM,
+        PAUSED_EMPTY,
+        IDLE,
+    };
+
+    struct SimQueue
+    {
+        sai_object_id_t id;
+        sai_object_id_t portId;
+        uint8_t index;
+        bool alert;
+        bool stormed = false;
+        Traffic traffic = Traffic::NORMAL;
+        bool debugStorm = false;
+
+        uint64_t occupancy = 0;
+        uint64_t packets = 0;
+        uint64_t rxPackets = 0;
+        uint64_t duration = 0;
+    };
+
+    struct PfcWdDetectorTest : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_counters_db;
+        shared_ptr<swss::Table> m_counters;
+        LuaPfcWd m_lua;
+        vector<SimQueue> m_queues;
+        vector<string> m_keys;
+        mt19937 m_random { 4242 };
+        uint64_t m_nowUs = 1700000000ULL * 1000000;
+
+        void SetUp() override
+        {
+            ::testing_db::reset();
+
+            m_counters_db = make_shared<swss::DBConnector>("COUNTERS_DB", 0);
+            m_counters = make_shared<swss::Table>(m_counters_db.get(), COUNTERS_TABLE);
+        }
+
+        void TearDown() override
+        {
+            ::testing_db::reset();
+        }
+
+        void addQueues(PfcWdDetector &detector, size_t ports, uint8_t queuesPerPort)
+        {
+            for (size_t p = 0; p < ports; p++)
+            {
+                for (uint8_t i = 0; i < queuesPerPort; i++)
+                {
+                    SimQueue queue;
+                    queue.id = 0x15000000000000ULL + p * PFC_WD_PRIORITY_MAX + i + 3;
+                    queue.portId = 0x1000000000000ULL + p;
+                    queue.index = static_cast<uint8_t>(i + 3);
+                    queue.alert = (p + i) % 4 == 0;
+                    m_queues.push_back(queue);
+
+                    const string key = sai_serialize_object_id(queue.id);
+                    m_keys.push_back(key);
+                    m_lua.counters_db["COUNTERS_QUEUE_INDEX_MAP"][key] = to_string(queue.index);
+                    m_lua.counters_db["COUNTERS_QUEUE_PORT_MAP"][key] = sai_serialize_object_id(queue.portId);
+
+                    /* As registered by PfcWdSwOrch */
+                    auto &counters = m_lua.counters_db["COUNTERS:" + key];
+                    counters["PFC_WD_DETECTION_TIME"] = to_string(detectionTimeUs);
+                    counters["PFC_WD_RESTORATION_TIME"] = to_string(restorationTimeUs);
+                    counters["PFC_WD_ACTION"] = queue.alert ? "alert" : "drop";
+                    counters["PFC_WD_STATUS"] = "operational";
+
+                    detector.addQueue(queue.id, queue.portId, queue.index, detectionTimeUs, restorationTimeUs, queue.alert);
+                }
+            }
+        }
+
+        /* What syncd writes to COUNTERS at each poll */
+        void updateCounters(uint64_t elapsedUs, bool randomize)
+        {
+            map<sai_object_id_t, vector<swss::FieldValueTuple>> ports;
+
+            for (auto &queue : m_queues)
+            {
+                if (randomize && m_random() % 5 == 0)
+                {
+                    queue.traffic = static_cast<Traffic>(m_random() % 4);
+                }
+                if (randomize && m_random() % 37 == 0)
+                {
+                    queue.debugStorm = !queue.debugStorm;
+                }
+
+                switch (queue.traffic)
+                {
+                    case Traffic::NORMAL:
+                        queue.occupancy = m_random() % 3 ? m_random() % 10000 : 0;
+                        queue.packets += 1 + m_random() % 1000;
+                        queue.rxPackets += m_random() % 2;
+                        queue.duration += m_random() % (elapsedUs / 2);
+                        break;
+                    case Traffic::STORM:
+                        queue.occupancy = 5000 + m_random() % 100;
+                        queue.rxPackets += 10 + m_random() % 100;
+                        queue.duration += elapsedUs;
+                        break;
+                    case Traffic::PAUSED_EMPTY:
+                        queue.occupancy = 0;
+                        queue.duration += elapsedUs;
+                        break;
+                    case Traffic::IDLE:
+                        queue.occupancy = 0;
+                        break;
+                }
+
+                vector<swss::FieldValueTuple> fvs = {
+                    { "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES", to_string(queue.occupancy) },
+                    { "SAI_QUEUE_STAT_PACKETS", to_string(queue.packets) },
+                    { "DEBUG_STORM", queue.debugStorm ? "enabled" : "disabled" },
+                };
+                setCounters(sai_serialize_object_id(queue.id), fvs);
+
+                const string priority = to_string(queue.index);
+                auto &portFvs = ports[queue.portId];
+                portFvs.push_back({ "SAI_PORT_STAT_PFC_" + priority + "_RX_PKTS", to_string(queue.rxPackets) });
+                portFvs.push_back({ "SAI_PORT_STAT_PFC_" + priority + "_RX_PAUSE_DURATION_US", to_string(queue.duration) });
+                portFvs.push_back({ "SAI_PORT_STAT_PFC_" + priority + "_RX_PAUSE_DURATION", to_string(queue.duration) });
+            }
+
+            for (const auto &port : ports)
+            {
+                setCounters(sai_serialize_object_id(port.first), port.second);
+            }
+        }
+
+        void setCounters(const string &key, const vector<swss::FieldValueTuple> &fvs)
+        {
+            m_counters->set(key, fvs);
+            for (const auto &fv : fvs)
+            {
+                m_lua.counters_db["COUNTERS:" + key][fvField(fv)] = fvValue(fv);
+            }
+        }
+
+        double nextPoll(uint64_t &elapsedUs, bool jitter)
+        {
+            elapsedUs = pollMs * 1000 + (jitter ? m_random() % 3000 : 0);
+            m_nowUs += elapsedUs;
+
+            /* As the plugins add the seconds and microseconds of redis TIME */
+            return static_cast<double>(m_nowUs / 1000000) + static_cast<double>(m_nowUs % 1000000) / 1000000;
+        }
+
+        /* What PfcWdSwOrch does with the events of both */
+        void handleEvents(const vector<Event> &events, PfcWdDetector &detector)
+        {
+            for (const auto &event : events)
+            {
+                auto it = find(m_keys.begin(), m_keys.end(), get<0>(event));
+                ASSERT_NE(it, m_keys.end());
+                auto &queue = m_queues[it - m_keys.begin()];
+
+                bool stormed = get<1>(event) == "storm";
+                if (queue.stormed == stormed)
+                {
+                    continue;
+                }
+                queue.stormed = stormed;
+                m_lua.counters_db["COUNTERS:" + get<0>(event)]["PFC_WD_STATUS"] = stormed ? "stormed" : "operational";
+                detector.setStormed(queue.id, stormed);
+            }
+        }
+
+        static vector<Event> toEvents(const vector<PfcWdDetectorEvent> &events)
+        {
+            vector<Event> result;
+            for (const auto &event : events)
+            {
+                result.emplace_back(sai_serialize_object_id(event.queueId), event.event, event.values);
+            }
+            return result;
+        }
+
+        /* Poll both the same way, and check they report the same events */
+        void pollBoth(PfcWdDetector &detector, uint32_t poll, bool jitter, size_t &storms, size_t &restores)
+        {
+            uint64_t elapsedUs = 0;
+            double now = nextPoll(elapsedUs, jitter);
+            updateCounters(elapsedUs, true);
+
+            vector<Event> luaEvents;
+            m_lua.detect(m_keys, now, luaEvents);
+            m_lua.restore(m_keys, luaEvents);
+
+            vector<PfcWdDetectorEvent> nativeEvents;
+            detector.poll(pollMs, now, nativeEvents);
+            auto events = toEvents(nativeEvents);
+
+            sort(luaEvents.begin(), luaEvents.end());
+            sort(events.begin(), events.end());
+            ASSERT_EQ(events, luaEvents) << "poll " << poll;
+
+            for (const auto &event : events)
+            {
+                (get<1>(event) == "storm" ? storms : restores)++;
+            }
+            handleEvents(events, detector);
+        }
+
+        void compareWithLua(const string &platform)
+        {
+            PfcWdDetectorConfig config;
+            ASSERT_TRUE(getPfcWdDetectorConfig(platform, config));
+            m_lua.platform = platform;
+
+            PfcWdDetector detector(m_counters_db.get(), config);
+            addQueues(detector, 16, 2);
+
+            size_t storms = 0, restores = 0;
+            for (uint32_t poll = 0; poll < 500; poll++)
+            {
+                pollBoth(detector, poll, platform == "mellanox", storms, restores);
+                if (HasFatalFailure())
+                {
+                    return;
+                }
+            }
+
+            EXPECT_GT(storms, 0u) << platform;
+            EXPECT_GT(restores, 0u) << platform;
+        }
+    };
+
+    TEST_F(PfcWdDetectorTest, StormAndRestore)
+    {
+        PfcWdDetectorConfig config;
+        ASSERT_TRUE(getPfcWdDetectorConfig("vs", config));
+        PfcWdDetector detector(m_counters_db.get(), config);
+        addQueues(detector, 1, 1);
+
+        auto &queue = m_queues[0];
+        queue.alert = false;
+        detector.addQueue(queue.id, queue.portId, queue.index, detectionTimeUs, restorationTimeUs, false);
+        ASSERT_EQ(detector.getQueueCount(), 1u);
+
+        vector<PfcWdDetectorEvent> events;
+        uint64_t elapsedUs = 0;
+        auto poll = [&](Traffic traffic)
+        {
+            queue.traffic = traffic;
+            double now = nextPoll(elapsedUs, false);
+            updateCounters(elapsedUs, false);
+            events.clear();
+            detector.poll(pollMs, now, events);
+        };
+
+        // First poll only records the counters
+        poll(Traffic::NORMAL);
+        ASSERT_TRUE(events.empty());
+
+        // In storm for the detection time
+        poll(Traffic::STORM);
+        ASSERT_TRUE(events.empty());
+        poll(Traffic::STORM);
+        ASSERT_EQ(events.size(), 1u);
+        ASSERT_EQ(events[0].queueId, queue.id);
+        ASSERT_EQ(events[0].event, PFC_WD_STORM_EVENT);
+        detector.setStormed(queue.id, true);
+
+        // The restoration waits for PFC frames to stop for the restoration time
+        poll(Traffic::STORM);
+        ASSERT_TRUE(events.empty());
+        for (int i = 0; i < 3; i++)
+        {
+            poll(Traffic::IDLE);
+            ASSERT_TRUE(events.empty());
+        }
+        poll(Traffic::IDLE);
+        ASSERT_EQ(events.size(), 1u);
+        ASSERT_EQ(events[0].event, PFC_WD_RESTORE_EVENT);
+        detector.setStormed(queue.id, false);
+
+        // Nothing while the big red switch is on
+        detector.setBigRedSwitch(true);
+        poll(Traffic::STORM);
+        poll(Traffic::STORM);
+        poll(Traffic::STORM);
+        ASSERT_TRUE(events.empty());
+    }
+
+    TEST_F(PfcWdDetectorTest, SameAsLuaVs)
+    {
+        compareWithLua("vs");
+    }
+
+    TEST_F(PfcWdDetectorTest, SameAsLuaBarefoot)
+    {
+        compareWithLua("barefoot");
+    }
+
+    TEST_F(PfcWdDetectorTest, SameAsLuaNephos)
+    {
+        compareWithLua("nephos");
+    }
+
+    TEST_F(PfcWdDetectorTest, SameAsLuaMellanox)
+    {
+        compareWithLua("mellanox");
+    }
+
+    TEST_F(PfcWdDetectorTest, UnsupportedPlatform)
+    {
+        PfcWdDetectorConfig config;
+        ASSERT_FALSE(getPfcWdDetectorConfig("broadcom", config));
+        ASSERT_FALSE(getPfcWdDetectorConfig("cisco-8000", config));
+    }
+
+    TEST_F(PfcWdDetectorTest, AddRemoveQueues)
+    {
+        PfcWdDetectorConfig config;
+        ASSERT_TRUE(getPfcWdDetectorConfig("vs", config));
+        PfcWdDetector detector(m_counters_db.get(), config);
+        addQueues(detector, 3, 2);
+        ASSERT_EQ(detector.getQueueCount(), 6u);
+
+        // Removing all the queues of the first port moves the last port in its place
+        detector.removeQueue(m_queues[0].id);
+        detector.removeQueue(m_queues[1].id);
+        detector.removeQueue(m_queues[1].id);
+        ASSERT_EQ(detector.getQueueCount(), 4u);
+        ASSERT_FALSE(detector.hasQueue(m_queues[0].id));
+        ASSERT_TRUE(detector.hasQueue(m_queues[5].id));
+
+        m_queues.erase(m_queues.begin(), m_queues.begin() + 2);
+        m_keys.erase(m_keys.begin(), m_keys.begin() + 2);
+
+        // The remaining queues still read the counters of their own port
+        vector<PfcWdDetectorEvent> events;
+        uint64_t elapsedUs = 0;
+        for (int i = 0; i < 4; i++)
+        {
+            for (auto &queue : m_queues)
+            {
+                queue.traffic = queue.id == m_queues.back().id && i > 0 ? Traffic::STORM : Traffic::NORMAL;
+            }
+            double now = nextPoll(elapsedUs, false);
+            updateCounters(elapsedUs, false);
+            detector.poll(pollMs, now, events);
+        }
+        ASSERT_EQ(events.size(), 1u);
+        ASSERT_EQ(events[0].queueId, m_queues.back().id);
+
+        // Invalid priority
+        detector.addQueue(0x15000000000999ULL, m_queues[0].portId, PFC_WD_PRIORITY_MAX, detectionTimeUs, restorationTimeUs, false);
+        ASSERT_FALSE(detector.hasQueue(0x15000000000999ULL));
+    }
+}
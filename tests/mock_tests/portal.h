@@ -62,6 +62,46 @@ struct Portal
         {
             crmOrch->getResAvailableCounters();
         }
+
+        static void updateCrmCountersTable(CrmOrch *crmOrch)
+        {
+            crmOrch->updateCrmCountersTable();
+        }
+
+        static bool checkCrmThresholds(CrmOrch *crmOrch)
+        {
+            return crmOrch->checkCrmThresholds();
+        }
+
+        static void updatePollingInterval(CrmOrch *crmOrch, bool nearThreshold)
+        {
+            crmOrch->updatePollingInterval(nearThreshold);
+        }
+
+        static void handleSetCommand(CrmOrch *crmOrch, const std::string &key, const std::vector<swss::FieldValueTuple> &data)
+        {
+            crmOrch->handleSetCommand(key, data);
+        }
+
+        static std::chrono::seconds getTimerInterval(const CrmOrch *crmOrch)
+        {
+            return crmOrch->m_timerInterval;
+        }
+
+        static CrmOrch::CrmResourceEntry &getResource(CrmOrch *crmOrch, CrmResourceType type)
+        {
+            return crmOrch->m_resourcesMap.at(type);
+        }
+
+        static void getAclTableResAvailability(CrmOrch *crmOrch)
+        {
+            crmOrch->getAclTableResAvailability();
+        }
+
+        static void setAclTableBulkGetSupported(CrmOrch *crmOrch, bool supported)
+        {
+            crmOrch->m_aclTableBulkGetSupported = supported;
+        }
     };
 
     struct CoppOrchInternal
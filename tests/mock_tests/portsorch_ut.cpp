@@ -17,6 +17,7 @@
 #include "warm_restart.h"
 #undef private
 
+#include <chrono>
 #include <sstream>
 
 extern redisReply *mockReply;
@@ -1325,6 +1326,254 @@ namespace portsorch_test
         _unhook_sai_queue_api();
     }
 
+    /*
+    * The queues and PGs of the ports are got for all the ports at once, in bulk or one port
+    * at a time when bulk get is not supported, and are the ones a get on each port returns.
+    */
+    TEST_F(PortsOrchTest, PortInitPrefetchedAttributes)
+    {
+        Table portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
+
+        auto &ports = defaultPortList;
+        ASSERT_TRUE(!ports.empty());
+
+        for (const auto &it : ports)
+        {
+            portTable.set(it.first, it.second);
+        }
+        portTable.set("PortConfigDone", { { "count", to_string(ports.size()) } });
+        gPortsOrch->addExistingData(&portTable);
+        static_cast<Orch *>(gPortsOrch)->doTask();
+
+        ASSERT_TRUE(gPortsOrch->m_prefetchedObjectLists.empty());
+        ASSERT_TRUE(gPortsOrch->m_prefetchedMaximumHeadroom.empty());
+
+        vector<sai_object_id_t> portIds;
+        for (const auto &it : ports)
+        {
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(it.first, port));
+            portIds.push_back(port.m_port_id);
+
+            sai_attribute_t attr;
+            attr.id = SAI_PORT_ATTR_QOS_NUMBER_OF_QUEUES;
+            ASSERT_EQ(sai_port_api->get_port_attribute(port.m_port_id, 1, &attr), SAI_STATUS_SUCCESS);
+            vector<sai_object_id_t> queues(attr.value.u32);
+            attr.id = SAI_PORT_ATTR_QOS_QUEUE_LIST;
+            attr.value.objlist.count = static_cast<uint32_t>(queues.size());
+            attr.value.objlist.list = queues.data();
+            ASSERT_EQ(sai_port_api->get_port_attribute(port.m_port_id, 1, &attr), SAI_STATUS_SUCCESS);
+            ASSERT_EQ(port.m_queue_ids, queues);
+            ASSERT_EQ(port.m_queue_lock.size(), queues.size());
+
+            attr.id = SAI_PORT_ATTR_NUMBER_OF_INGRESS_PRIORITY_GROUPS;
+            ASSERT_EQ(sai_port_api->get_port_attribute(port.m_port_id, 1, &attr), SAI_STATUS_SUCCESS);
+            ASSERT_EQ(port.m_priority_group_ids.size(), attr.value.u32);
+        }
+
+        auto bulkGetSupported = gPortsOrch->m_portBulkGetSupported;
+
+        gPortsOrch->m_portBulkGetSupported = true;
+        gPortsOrch->prefetchPortAttributes(portIds);
+        auto objectLists = gPortsOrch->m_prefetchedObjectLists;
+        auto maximumHeadroom = gPortsOrch->m_prefetchedMaximumHeadroom;
+        gPortsOrch->m_prefetchedObjectLists.clear();
+        gPortsOrch->m_prefetchedMaximumHeadroom.clear();
+
+        gPortsOrch->m_portBulkGetSupported = false;
+        gPortsOrch->prefetchPortAttributes(portIds);
+        ASSERT_EQ(gPortsOrch->m_prefetchedObjectLists, objectLists);
+        ASSERT_EQ(gPortsOrch->m_prefetchedMaximumHeadroom, maximumHeadroom);
+        ASSERT_EQ(gPortsOrch->m_prefetchedObjectLists.size(), portIds.size());
+
+        Port port;
+        ASSERT_TRUE(gPortsOrch->getPort(ports.begin()->first, port));
+        vector<sai_object_id_t> queues;
+        ASSERT_TRUE(gPortsOrch->takePrefetchedObjectList(port.m_port_id, SAI_PORT_ATTR_QOS_QUEUE_LIST, queues));
+        ASSERT_EQ(queues, port.m_queue_ids);
+        ASSERT_FALSE(gPortsOrch->takePrefetchedObjectList(port.m_port_id, SAI_PORT_ATTR_QOS_QUEUE_LIST, queues));
+
+        gPortsOrch->m_prefetchedObjectLists.clear();
+        gPortsOrch->m_prefetchedMaximumHeadroom.clear();
+        gPortsOrch->m_portBulkGetSupported = bulkGetSupported;
+    }
+
+    /*
+    * Add 512 ports and 128 LAGs to the port list, indexed by port/LAG OID and
+    * by bridge port OID.
+    */
+    static void addLookupPorts(vector<string> &aliases, vector<sai_object_id_t> &oids,
+                               vector<sai_object_id_t> &bridgePortOids)
+    {
+        const size_t portCount = 512;
+        const size_t lagCount = 128;
+
+        for (size_t i = 0; i < portCount + lagCount; i++)
+        {
+            bool isLag = i >= portCount;
+            string alias = isLag ? "PortChannel" + to_string(i - portCount) : "Ethernet" + to_string(i * 4);
+            Port port(alias, isLag ? Port::LAG : Port::PHY);
+            sai_object_id_t oid = (isLag ? 0x2000000000000 : 0x1000000000000) + i;
+            if (isLag)
+            {
+                port.m_lag_id = oid;
+            }
+            else
+            {
+                port.m_port_id = oid;
+            }
+            port.m_bridge_port_id = 0x3a000000000000 + i;
+
+            gPortsOrch->m_portList[alias] = port;
+            gPortsOrch->saiOidToAlias[oid] = alias;
+            gPortsOrch->saiOidToAlias[port.m_bridge_port_id] = alias;
+
+            aliases.push_back(alias);
+            oids.push_back(oid);
+            bridgePortOids.push_back(port.m_bridge_port_id);
+        }
+    }
+
+    static void removeLookupPorts(const vector<string> &aliases, const vector<sai_object_id_t> &oids,
+                                  const vector<sai_object_id_t> &bridgePortOids)
+    {
+        removeLookupPorts(aliases, oids, bridgePortOids);
+    }
+
+    /*
+    * Cost of the lookups on 512 ports and 128 LAGs. The OID lookups go through
+    * saiOidToAlias, then the alias index of the port list.
+    *
+    * Opt-in: --gtest_also_run_disabled_tests --gtest_filter=PortsOrchTest.DISABLED_PortLookupBenchmark
+    */
+    TEST_F(PortsOrchTest, DISABLED_PortLookupBenchmark)
+    {
+        const size_t rounds = 1000;
+
+        vector<string> aliases;
+        vector<sai_object_id_t> oids;
+        vector<sai_object_id_t> bridgePortOids;
+
+        addLookupPorts(aliases, oids, bridgePortOids);
+
+        auto elapsedUs = [](chrono::steady_clock::time_point start) {
+            return chrono::duration_cast<chrono::microseconds>(chrono::steady_clock::now() - start).count();
+        };
+
+        sai_object_id_t copySum = 0;
+        auto start = chrono::steady_clock::now();
+        for (size_t r = 0; r < rounds; r++)
+        {
+            for (size_t i = 0; i < aliases.size(); i++)
+            {
+                Port port;
+                gPortsOrch->getPort(aliases[i], port);
+                copySum += port.m_bridge_port_id;
+            }
+        }
+        auto copyUs = elapsedUs(start);
+
+        sai_object_id_t aliasSum = 0;
+        start = chrono::steady_clock::now();
+        for (size_t r = 0; r < rounds; r++)
+        {
+            for (size_t i = 0; i < aliases.size(); i++)
+            {
+                aliasSum += gPortsOrch->findPort(aliases[i])->m_bridge_port_id;
+            }
+        }
+        auto aliasUs = elapsedUs(start);
+
+        sai_object_id_t oidSum = 0;
+        start = chrono::steady_clock::now();
+        for (size_t r = 0; r < rounds; r++)
+        {
+            for (size_t i = 0; i < aliases.size(); i++)
+            {
+                oidSum += gPortsOrch->findPort(oids[i])->m_bridge_port_id;
+            }
+        }
+        auto oidUs = elapsedUs(start);
+
+        sai_object_id_t bridgePortSum = 0;
+        start = chrono::steady_clock::now();
+        for (size_t r = 0; r < rounds; r++)
+        {
+            for (size_t i = 0; i < aliases.size(); i++)
+            {
+                bridgePortSum += gPortsOrch->findPortByBridgePortId(bridgePortOids[i])->m_bridge_port_id;
+            }
+        }
+        auto bridgePortUs = elapsedUs(start);
+
+        ASSERT_EQ(copySum, aliasSum);
+        ASSERT_EQ(copySum, oidSum);
+        ASSERT_EQ(copySum, bridgePortSum);
+        cout << "Looked up " << aliases.size() << " ports " << rounds << " times: "
+             << copyUs << " us with getPort(alias), " << aliasUs << " us with findPort(alias), "
+             << oidUs << " us with findPort(oid), " << bridgePortUs << " us with findPortByBridgePortId" << endl;
+
+        removeLookupPorts(aliases, oids, bridgePortOids);
+    }
+
+    /*
+    * Compare the copying lookups with the in-place ones on 512 ports and 128 LAGs,
+    * by alias, by port/LAG OID and by bridge port OID.
+    */
+    TEST_F(PortsOrchTest, PortLookup)
+    {
+        const size_t portCount = 512;
+
+        vector<string> aliases;
+        vector<sai_object_id_t> oids;
+        vector<sai_object_id_t> bridgePortOids;
+
+        addLookupPorts(aliases, oids, bridgePortOids);
+
+        // The in place lookups find the same ports as the copying ones
+        for (size_t i = 0; i < aliases.size(); i++)
+        {
+            Port port;
+            ASSERT_TRUE(gPortsOrch->getPort(aliases[i], port));
+            Port *p = gPortsOrch->findPort(aliases[i]);
+            ASSERT_NE(p, nullptr);
+            ASSERT_EQ(p->m_bridge_port_id, port.m_bridge_port_id);
+
+            ASSERT_TRUE(gPortsOrch->getPort(oids[i], port));
+            ASSERT_EQ(gPortsOrch->findPort(oids[i]), p);
+
+            ASSERT_TRUE(gPortsOrch->getPortByBridgePortId(bridgePortOids[i], port));
+            ASSERT_EQ(gPortsOrch->findPortByBridgePortId(bridgePortOids[i]), p);
+            ASSERT_EQ(port.m_alias, aliases[i]);
+        }
+
+        // Counter updates are seen through the lookups, removed ports are no longer found
+        gPortsOrch->increasePortFdbCount("PortChannel0");
+        Port copy;
+        ASSERT_TRUE(gPortsOrch->getPort("PortChannel0", copy));
+        ASSERT_EQ(copy.m_fdb_count, 1);
+        ASSERT_EQ(gPortsOrch->findPort("PortChannel0")->m_fdb_count, 1);
+        gPortsOrch->decreasePortFdbCount("PortChannel0");
+        ASSERT_EQ(gPortsOrch->findPort("PortChannel0")->m_fdb_count, 0);
+
+        gPortsOrch->m_portList.erase("PortChannel0");
+        gPortsOrch->saiOidToAlias.erase(oids[portCount]);
+        ASSERT_EQ(gPortsOrch->findPort("PortChannel0"), nullptr);
+        ASSERT_EQ(gPortsOrch->findPort(oids[portCount]), nullptr);
+        ASSERT_FALSE(gPortsOrch->getPort("PortChannel0", copy));
+        ASSERT_EQ(gPortsOrch->getAllPorts().count("PortChannel0"), 0);
+
+        gPortsOrch->m_portList["PortChannel0"] = Port("PortChannel0", Port::LAG);
+        ASSERT_NE(gPortsOrch->findPort("PortChannel0"), nullptr);
+
+        for (size_t i = 0; i < aliases.size(); i++)
+        {
+            gPortsOrch->m_portList.erase(aliases[i]);
+            gPortsOrch->saiOidToAlias.erase(oids[i]);
+            gPortsOrch->saiOidToAlias.erase(bridgePortOids[i]);
+        }
+    }
+
     TEST_F(PortsOrchTest, PortPTConfigDefaultTimestampTemplate)
     {
         auto portTable = Table(m_app_db.get(), APP_PORT_TABLE_NAME);
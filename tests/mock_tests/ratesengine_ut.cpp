@@ -0,0 +1,542 @@
+#include "ut_helper.h"
+#include "mock_table.h"
+#include "ratesengine.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cmath>
+#include <map>
+
+namespace ratesengine_test
+{
+    using namespace std;
+
+    typedef map<string, string> Hash;
+
+    /*
+     * port_rates.lua, statement by statement, over an in memory redis: values
+     * are strings, Lua converts them to numbers with strtod and redis stores
+     * the numbers a script gives it with %.17g.
+     */
+    class LuaPortRates
+    {
+    public:
+        map<string, Hash> counters_db;
+        map<string, Hash> appl_db;
+
+        void run(const vector<string> &keys, const string &delta)
+        {
+            if (!hget(counters_db, "RATES:PORT", "PORT_ALPHA", m_alpha))
+            {
+                return;
+            }
+            m_delta = delta;
+
+            for (const auto &port : keys)
+            {
+                compute_rate(port);
+            }
+        }
+
+    private:
+        string m_alpha;
+        string m_delta;
+
+        static bool hget(map<string, Hash> &db, const string &key, const string &field, string &value)
+        {
+            auto it = db.find(key);
+            if (it == db.end() || it->second.find(field) == it->second.end())
+            {
+                return false;
+            }
+            value = it->second[field];
+            return true;
+        }
+
+        static double num(const string &value)
+        {
+            return strtod(value.c_str(), nullptr);
+        }
+
+        static string str(double value)
+        {
+            char buf[32];
+            snprintf(buf, sizeof(buf), "%.17g", value);
+            return buf;
+        }
+
+        string find_interface_name_from_oid(const string &port)
+        {
+            for (const auto &it : counters_db["COUNTERS_PORT_NAME_MAP"])
+            {
+                if (it.second == port)
+                {
+                    return it.first;
+                }
+            }
+            return "0";
+        }
+
+        static void calculate_lane_and_serdes_speed(double count, double speed, double &lane_speed, double &serdes)
+        {
+            serdes = 0;
+            lane_speed = 0;
+
+            if (count == 0 || speed == 0)
+            {
+                return;
+            }
+            if (fmod(speed, count) != 0)
+            {
+                return;
+            }
+
+            lane_speed = floor(speed / count);
+
+            if (lane_speed == 1000)
+                serdes = 1.25e+9;
+            else if (lane_speed == 10000)
+                serdes = 10.3125e+9;
+            else if (lane_speed == 25000)
+                serdes = 25.78125e+9;
+            else if (lane_speed == 50000)
+                serdes = 53.125e+9;
+            else if (lane_speed == 100000)
+                serdes = 106.25e+9;
+        }
+
+        void find_lanes_and_serdes(const string &interface_name, double &count, double &lane_speed, double &serdes)
+        {
+            string lanes, speed;
+
+            serdes = 0;
+            lane_speed = 0;
+            count = 0;
+
+            if (hget(appl_db, "PORT_TABLE:" + interface_name, "lanes", lanes))
+            {
+                hget(appl_db, "PORT_TABLE:" + interface_name, "speed", speed);
+                count = static_cast<double>(std::count(lanes.begin(), lanes.end(), ',')) + 1;
+                calculate_lane_and_serdes_speed(count, num(speed), lane_speed, serdes);
+            }
+        }
+
+        void compute_rate(const string &port)
+        {
+            const string counters = "COUNTERS:" + port;
+            const string rates = "RATES:" + port;
+            const string state_table = "RATES:" + port + ":PORT";
+            const double alpha = num(m_alpha);
+            const double one_minus_alpha = 1.0 - alpha;
+            const double delta = num(m_delta);
+
+            string initialized;
+            hget(counters_db, state_table, "INIT_DONE", initialized);
+
+            string fec_corr_bits, fec_uncorr_frames;
+            bool has_corr_bits = false, has_uncorr_frames = false;
+            double fec_corr_bits_ber_new = -1, fec_uncorr_bits_ber_new = -1;
+            double rs_average_frame_ber = 1e-8;
+            double lanes_speed = 0, serdes_speed = 0, lanes_count = 0;
+
+            string interface_name = find_interface_name_from_oid(port);
+            find_lanes_and_serdes(interface_name, lanes_count, lanes_speed, serdes_speed);
+            has_corr_bits = hget(counters_db, counters, "SAI_PORT_STAT_IF_IN_FEC_CORRECTED_BITS", fec_corr_bits);
+            has_uncorr_frames = hget(counters_db, counters, "SAI_PORT_STAT_IF_IN_FEC_NOT_CORRECTABLE_FRAMES", fec_uncorr_frames);
+
+            string in_ucast_pkts, in_non_ucast_pkts, out_ucast_pkts, out_non_ucast_pkts, in_octets, out_octets;
+            if (!hget(counters_db, counters, "SAI_PORT_STAT_IF_IN_UCAST_PKTS", in_ucast_pkts) ||
+                !hget(counters_db, counters, "SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS", in_non_ucast_pkts) ||
+                !hget(counters_db, counters, "SAI_PORT_STAT_IF_OUT_UCAST_PKTS", out_ucast_pkts) ||
+                !hget(counters_db, counters, "SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS", out_non_ucast_pkts) ||
+                !hget(counters_db, counters, "SAI_PORT_STAT_IF_IN_OCTETS", in_octets) ||
+                !hget(counters_db, counters, "SAI_PORT_STAT_IF_OUT_OCTETS", out_octets))
+            {
+                return;
+            }
+
+            Hash &r = counters_db[rates];
+
+            if (initialized == "DONE" || initialized == "COUNTERS_LAST")
+            {
+                double scale_factor = 1000 / delta;
+                double rx_bps_new = (num(in_octets) - num(r["SAI_PORT_STAT_IF_IN_OCTETS_last"])) * scale_factor;
+                double tx_bps_new = (num(out_octets) - num(r["SAI_PORT_STAT_IF_OUT_OCTETS_last"])) * scale_factor;
+                double rx_pps_new = ((num(in_ucast_pkts) + num(in_non_ucast_pkts)) -
+                                     (num(r["SAI_PORT_STAT_IF_IN_UCAST_PKTS_last"]) + num(r["SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS_last"]))) * scale_factor;
+                double tx_pps_new = ((num(out_ucast_pkts) + num(out_non_ucast_pkts)) -
+                                     (num(r["SAI_PORT_STAT_IF_OUT_UCAST_PKTS_last"]) + num(r["SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS_last"]))) * scale_factor;
+
+                if (initialized == "DONE")
+                {
+                    r["RX_BPS"] = str(alpha * rx_bps_new + one_minus_alpha * num(r["RX_BPS"]));
+                    r["RX_PPS"] = str(alpha * rx_pps_new + one_minus_alpha * num(r["RX_PPS"]));
+                    r["TX_BPS"] = str(alpha * tx_bps_new + one_minus_alpha * num(r["TX_BPS"]));
+                    r["TX_PPS"] = str(alpha * tx_pps_new + one_minus_alpha * num(r["TX_PPS"]));
+                }
+                else
+                {
+                    r["RX_BPS"] = str(rx_bps_new);
+                    r["RX_PPS"] = str(rx_pps_new);
+                    r["TX_BPS"] = str(tx_bps_new);
+                    r["TX_PPS"] = str(tx_pps_new);
+                    counters_db[state_table]["INIT_DONE"] = "DONE";
+                }
+
+                if (has_corr_bits && has_uncorr_frames)
+                {
+                    double serdes_rate_total = lanes_count * serdes_speed * delta / 1000;
+
+                    fec_corr_bits_ber_new = (num(fec_corr_bits) - num(r["SAI_PORT_STAT_IF_FEC_CORRECTED_BITS_last"])) / serdes_rate_total;
+                    fec_uncorr_bits_ber_new = (num(fec_uncorr_frames) - num(r["SAI_PORT_STAT_IF_FEC_NOT_CORRECTABLE_FARMES_last"])) * rs_average_frame_ber / serdes_rate_total;
+                }
+            }
+            else
+            {
+                counters_db[state_table]["INIT_DONE"] = "COUNTERS_LAST";
+            }
+
+            r["SAI_PORT_STAT_IF_IN_UCAST_PKTS_last"] = in_ucast_pkts;
+            r["SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS_last"] = in_non_ucast_pkts;
+            r["SAI_PORT_STAT_IF_OUT_UCAST_PKTS_last"] = out_ucast_pkts;
+            r["SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS_last"] = out_non_ucast_pkts;
+            r["SAI_PORT_STAT_IF_IN_OCTETS_last"] = in_octets;
+            r["SAI_PORT_STAT_IF_OUT_OCTETS_last"] = out_octets;
+
+            if (!has_corr_bits || !has_uncorr_frames)
+            {
+                return;
+            }
+
+            r["SAI_PORT_STAT_IF_FEC_CORRECTED_BITS_last"] = fec_corr_bits;
+            r["SAI_PORT_STAT_IF_FEC_NOT_CORRECTABLE_FARMES_last"] = fec_uncorr_frames;
+            r["FEC_PRE_BER"] = str(fec_corr_bits_ber_new);
+            r["FEC_POST_BER"] = str(fec_uncorr_bits_ber_new);
+        }
+    };
+
+    struct TestPort
+    {
+        string oid;
+        string alias;
+        uint32_t lanes;
+        uint32_t speed;
+        bool fec;
+        uint64_t base;
+    };
+
+    struct RatesEngineTest : public ::testing::Test
+    {
+        shared_ptr<swss::DBConnector> m_counters_db;
+        shared_ptr<swss::Table> m_counters;
+        shared_ptr<swss::Table> m_rates;
+        LuaPortRates m_lua;
+        vector<TestPort> m_ports;
+
+        void SetUp() override
+        {
+            ::testing_db::reset();
+
+            m_counters_db = make_shared<swss::DBConnector>("COUNTERS_DB", 0);
+            m_counters = make_shared<swss::Table>(m_counters_db.get(), "COUNTERS");
+            m_rates = make_shared<swss::Table>(m_counters_db.get(), RATES_TABLE_NAME);
+
+            m_rates->set("PORT", { { "PORT_ALPHA", "0.18" } });
+            m_lua.counters_db["RATES:PORT"]["PORT_ALPHA"] = "0.18";
+
+            m_ports = {
+                { "oid:0x1000000000001", "Ethernet0", 4, 100000, true, 0 },
+                { "oid:0x1000000000002", "Ethernet4", 8, 400000, true, 1000 },
+                { "oid:0x1000000000003", "Ethernet8", 1, 25000, false, 123456789 },
+                /* Counters beyond 2^53 are rounded the same way */
+                { "oid:0x1000000000004", "Ethernet12", 2, 100000, true, 0x7ffffffffffff000 },
+                /* No serdes speed for 20G lanes */
+                { "oid:0x1000000000005", "Ethernet16", 2, 40000, true, 42 },
+            };
+
+            for (const auto &port : m_ports)
+            {
+                m_lua.counters_db["COUNTERS_PORT_NAME_MAP"][port.alias] = port.oid;
+                string lanes;
+                for (uint32_t i = 0; i < port.lanes; i++)
+                {
+                    lanes += (i ? "," : "") + to_string(i);
+                }
+                m_lua.appl_db["PORT_TABLE:" + port.alias]["lanes"] = lanes;
+                m_lua.appl_db["PORT_TABLE:" + port.alias]["speed"] = to_string(port.speed);
+            }
+        }
+
+        /* What syncd writes to COUNTERS at each poll */
+        void updateCounters(uint32_t poll)
+        {
+            for (size_t i = 0; i < m_ports.size(); i++)
+            {
+                const auto &port = m_ports[i];
+                uint64_t n = port.base + poll * (i + 1) * 7919 + (poll * poll * 31) % 1013;
+
+                vector<swss::FieldValueTuple> fvs = {
+                    { "SAI_PORT_STAT_IF_IN_UCAST_PKTS", to_string(n) },
+                    { "SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS", to_string(n / 3) },
+                    { "SAI_PORT_STAT_IF_OUT_UCAST_PKTS", to_string(n + 17) },
+                    { "SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS", to_string(n / 5) },
+                    { "SAI_PORT_STAT_IF_IN_OCTETS", to_string(n * 64) },
+                    { "SAI_PORT_STAT_IF_OUT_OCTETS", to_string(n * 128 + poll) },
+                };
+                if (port.fec)
+                {
+                    fvs.push_back({ "SAI_PORT_STAT_IF_IN_FEC_CORRECTED_BITS", to_string(poll * poll * 1000 + i) });
+                    fvs.push_back({ "SAI_PORT_STAT_IF_IN_FEC_NOT_CORRECTABLE_FRAMES", to_string(poll * i) });
+                }
+
+                m_counters->set(port.oid, fvs);
+                for (const auto &fv : fvs)
+                {
+                    m_lua.counters_db["COUNTERS:" + port.oid][fvField(fv)] = fvValue(fv);
+                }
+            }
+        }
+
+        void expectSameRates(const string &key)
+        {
+            vector<swss::FieldValueTuple> fvs;
+            m_rates->get(key, fvs);
+
+            Hash native;
+            for (const auto &fv : fvs)
+            {
+                native[fvField(fv)] = fvValue(fv);
+            }
+
+            EXPECT_EQ(native, m_lua.counters_db["RATES:" + key]) << key;
+        }
+
+        void expectSameRates()
+        {
+            for (const auto &port : m_ports)
+            {
+                expectSameRates(port.oid);
+                expectSameRates(port.oid + ":PORT");
+            }
+        }
+
+        void addPorts(RatesEngine &engine)
+        {
+            for (const auto &port : m_ports)
+            {
+                engine.addObject(port.oid, port.alias);
+                engine.setLanes(port.oid, port.lanes, port.speed);
+            }
+        }
+
+        vector<string> keys()
+        {
+            vector<string> oids;
+            for (const auto &port : m_ports)
+            {
+                oids.push_back(port.oid);
+            }
+            return oids;
+        }
+    };
+
+    TEST_F(RatesEngineTest, SameRatesAsLua)
+    {
+        RatesEngine engine(m_counters_db.get(), getPortRatesConfig());
+        addPorts(engine);
+        ASSERT_EQ(engine.getObjectCount(), m_ports.size());
+
+        for (uint32_t poll = 1; poll <= 10; poll++)
+        {
+            updateCounters(poll);
+            engine.poll(poll, 1000);
+            m_lua.run(keys(), "1000");
+            expectSameRates();
+        }
+
+        /* The interval changed through FLEX_COUNTER_TABLE */
+        for (uint32_t poll = 11; poll <= 15; poll++)
+        {
+            updateCounters(poll);
+            engine.poll(10 + (poll - 10) * 0.25, 250);
+            m_lua.run(keys(), "250");
+            expectSameRates();
+        }
+
+        vector<swss::FieldValueTuple> fvs;
+        ASSERT_TRUE(m_rates->get(m_ports[0].oid, fvs));
+        string value;
+        ASSERT_TRUE(m_rates->hget(m_ports[0].oid + ":PORT", "INIT_DONE", value));
+        ASSERT_EQ(value, "DONE");
+        ASSERT_TRUE(m_rates->hget(m_ports[0].oid, "FEC_PRE_BER", value));
+        ASSERT_NE(value, "-1");
+        ASSERT_FALSE(m_rates->hget(m_ports[2].oid, "FEC_PRE_BER", value));
+    }
+
+    TEST_F(RatesEngineTest, NoAlpha)
+    {
+        m_rates->del("PORT");
+
+        RatesEngine engine(m_counters_db.get(), getPortRatesConfig());
+        addPorts(engine);
+        updateCounters(1);
+        engine.poll(1, 1000);
+
+        vector<swss::FieldValueTuple> fvs;
+        ASSERT_FALSE(m_rates->get(m_ports[0].oid, fvs));
+    }
+
+    TEST_F(RatesEngineTest, MissingCounters)
+    {
+        RatesEngine engine(m_counters_db.get(), getPortRatesConfig());
+        engine.addObject("oid:0x1000000000099", "Ethernet96");
+        addPorts(engine);
+
+        for (uint32_t poll = 1; poll <= 3; poll++)
+        {
+            updateCounters(poll);
+            engine.poll(poll, 1000);
+            m_lua.run(keys(), "1000");
+        }
+        expectSameRates();
+
+        vector<swss::FieldValueTuple> fvs;
+        ASSERT_FALSE(m_rates->get("oid:0x1000000000099", fvs));
+    }
+
+    TEST_F(RatesEngineTest, AddRemove)
+    {
+        RatesEngine engine(m_counters_db.get(), getPortRatesConfig());
+        addPorts(engine);
+
+        for (uint32_t poll = 1; poll <= 3; poll++)
+        {
+            updateCounters(poll);
+            engine.poll(poll, 1000);
+            m_lua.run(keys(), "1000");
+        }
+
+        /* The last port takes the place of the first one */
+        engine.removeObject(m_ports[0].oid);
+        ASSERT_FALSE(engine.hasObject(m_ports[0].oid));
+        ASSERT_EQ(engine.getObjectCount(), m_ports.size() - 1);
+        auto removed = m_lua.counters_db["RATES:" + m_ports[0].oid];
+        m_ports.erase(m_ports.begin());
+
+        for (uint32_t poll = 4; poll <= 6; poll++)
+        {
+            updateCounters(poll);
+            engine.poll(poll, 1000);
+            m_lua.run(keys(), "1000");
+            expectSameRates();
+        }
+
+        /* A removed port is left as it was */
+        vector<swss::FieldValueTuple> fvs;
+        m_rates->get("oid:0x1000000000001", fvs);
+        ASSERT_EQ(Hash(fvs.begin(), fvs.end()), removed);
+    }
+
+    TEST_F(RatesEngineTest, TakeOverFromLua)
+    {
+        for (uint32_t poll = 1; poll <= 4; poll++)
+        {
+            updateCounters(poll);
+            m_lua.run(keys(), "1000");
+        }
+
+        /* The state the plugin left in RATES */
+        for (const auto &it : m_lua.counters_db)
+        {
+            if (it.first.rfind("RATES:oid:", 0) == 0)
+            {
+                m_rates->set(it.first.substr(strlen("RATES:")), vector<swss::FieldValueTuple>(it.second.begin(), it.second.end()));
+            }
+        }
+
+        RatesEngine engine(m_counters_db.get(), getPortRatesConfig());
+        addPorts(engine);
+
+        for (uint32_t poll = 5; poll <= 8; poll++)
+        {
+            updateCounters(poll);
+            engine.poll(poll, 1000);
+            m_lua.run(keys(), "1000");
+            expectSameRates();
+        }
+    }
+
+    TEST_F(RatesEngineTest, RatesOverTimeBetweenPolls)
+    {
+        RatesEngine engine(m_counters_db.get(), getPortRatesConfig());
+        addPorts(engine);
+
+        /* The counters are not polled at exactly the poll interval */
+        const vector<pair<double, string>> polls = {
+            { 100, "1000" },
+            { 101, "1000" },
+            { 102.5, "1500" },
+            { 103.25, "750" },
+            { 104.25, "1000" },
+            { 110.25, "6000" },
+        };
+
+        for (uint32_t poll = 0; poll < polls.size(); poll++)
+        {
+            updateCounters(poll + 1);
+            engine.poll(polls[poll].first, 1000);
+            m_lua.run(keys(), polls[poll].second);
+            expectSameRates();
+        }
+    }
+
+    TEST_F(RatesEngineTest, LateOrDuplicatePoll)
+    {
+        RatesEngine engine(m_counters_db.get(), getPortRatesConfig());
+        addPorts(engine);
+
+        for (uint32_t poll = 1; poll <= 3; poll++)
+        {
+            updateCounters(poll);
+            engine.poll(poll, 1000);
+            m_lua.run(keys(), "1000");
+        }
+
+        /* Notified again, or after a newer poll, the rates are left as they are */
+        updateCounters(4);
+        engine.poll(3, 1000);
+        engine.poll(2.5, 1000);
+        expectSameRates();
+
+        engine.poll(4, 1000);
+        m_lua.run(keys(), "1000");
+        expectSameRates();
+    }
+
+    TEST_F(RatesEngineTest, ManyPorts)
+    {
+        const size_t count = 512;
+
+        m_ports.clear();
+        for (size_t i = 0; i < count; i++)
+        {
+            char oid[32];
+            snprintf(oid, sizeof(oid), "oid:0x%" PRIx64, static_cast<uint64_t>(0x1000000000000 + i));
+            m_ports.push_back({ oid, "Ethernet" + to_string(i * 4), 4, 100000, true, i * 1000 });
+            m_lua.counters_db["COUNTERS_PORT_NAME_MAP"][m_ports.back().alias] = oid;
+            m_lua.appl_db["PORT_TABLE:" + m_ports.back().alias]["lanes"] = "0,1,2,3";
+            m_lua.appl_db["PORT_TABLE:" + m_ports.back().alias]["speed"] = "100000";
+        }
+
+        RatesEngine engine(m_counters_db.get(), getPortRatesConfig());
+        addPorts(engine);
+
+        for (uint32_t poll = 1; poll <= 5; poll++)
+        {
+            updateCounters(poll);
+            engine.poll(poll, 1000);
+            m_lua.run(keys(), "1000");
+        }
+        expectSameRates();
+    }
+}
@@ -1,6 +1,10 @@
 #include "response_publisher.h"
 
 #include <gtest/gtest.h>
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <fstream>
 
 using namespace swss;
 
@@ -30,3 +34,165 @@ TEST(ResponsePublisher, TestPublishBuffered)
     ASSERT_TRUE(stateTable.hget("SOME_KEY", "field", value));
     ASSERT_EQ(value, "value");
 }
+
+TEST(ResponsePublisher, TestPublishRecorded)
+{
+    std::string fileName = "responsepublisher_ut.rec";
+    std::remove(fileName.c_str());
+
+    auto &recorder = Recorder::Instance().respub;
+    recorder.setRecord(true);
+    recorder.setLocation(".");
+    recorder.setFileName(fileName);
+    recorder.startRec(false);
+
+    ResponsePublisher publisher{"APPL_STATE_DB"};
+    publisher.publish("SOME_TABLE", "SOME_KEY", {{"field", "value"}}, ReturnCode(SAI_STATUS_SUCCESS));
+
+    // Records are written by the recorder thread, flushed as before an abort
+    Recorder::Instance().flush();
+    recorder.setRecord(false);
+
+    std::ifstream ifs(fileName);
+    std::string line;
+    std::vector<std::string> lines;
+    while (std::getline(ifs, line))
+    {
+        lines.push_back(line);
+    }
+
+    // Recording started, notification and DB write
+    ASSERT_EQ(lines.size(), 3);
+    ASSERT_NE(lines[1].find("APPL_DB_SOME_TABLE_RESPONSE_CHANNEL:SOME_KEY|"), std::string::npos);
+    ASSERT_NE(lines[1].find("|field:value"), std::string::npos);
+    ASSERT_NE(lines[2].find("SOME_TABLE:SOME_KEY|SET|field:value"), std::string::npos);
+
+    std::remove(fileName.c_str());
+}
+
+TEST(ResponsePublisher, TestPublishersShareService)
+{
+    ResponsePublisher publisher1{"APPL_STATE_DB"};
+    ResponsePublisher publisher2{"APPL_STATE_DB", /*buffered=*/true};
+
+    ASSERT_EQ(ResponsePublisherService::getInstance("APPL_STATE_DB"),
+              ResponsePublisherService::getInstance("APPL_STATE_DB"));
+    ASSERT_NE(ResponsePublisherService::getInstance("APPL_STATE_DB"),
+              ResponsePublisherService::getInstance("APPL_DB"));
+}
+
+TEST(ResponsePublisher, TestPublishCoalesced)
+{
+    DBConnector conn{"APPL_STATE_DB", 0};
+    Table stateTable{&conn, "COALESCED_TABLE"};
+    std::vector<FieldValueTuple> values;
+    ResponsePublisher publisher{"APPL_STATE_DB", /*buffered=*/true};
+
+    // Updates are merged
+    publisher.publish("COALESCED_TABLE", "KEY1", {{"f1", "v1"}, {"f2", "v2"}}, ReturnCode(SAI_STATUS_SUCCESS));
+    publisher.publish("COALESCED_TABLE", "KEY1", {{"f2", "v3"}, {"f3", "v4"}}, ReturnCode(SAI_STATUS_SUCCESS));
+    // Failures aren't written
+    publisher.publish("COALESCED_TABLE", "KEY1", {{"f1", "v5"}}, ReturnCode(SAI_STATUS_FAILURE));
+    // Replaced, then updated
+    publisher.publish("COALESCED_TABLE", "KEY2", {{"f1", "v1"}}, ReturnCode(SAI_STATUS_SUCCESS));
+    publisher.publish("COALESCED_TABLE", "KEY2", {{"f2", "v2"}}, ReturnCode(SAI_STATUS_SUCCESS), /*replace=*/true);
+    publisher.publish("COALESCED_TABLE", "KEY2", {{"f3", "v3"}}, ReturnCode(SAI_STATUS_SUCCESS));
+    // Deleted
+    publisher.publish("COALESCED_TABLE", "KEY3", {{"f1", "v1"}}, ReturnCode(SAI_STATUS_SUCCESS));
+    publisher.publish("COALESCED_TABLE", "KEY3", {}, ReturnCode(SAI_STATUS_SUCCESS));
+    // Deleted, then set again
+    publisher.publish("COALESCED_TABLE", "KEY4", {{"f1", "v1"}}, ReturnCode(SAI_STATUS_SUCCESS));
+    publisher.publish("COALESCED_TABLE", "KEY4", {}, ReturnCode(SAI_STATUS_SUCCESS));
+    publisher.publish("COALESCED_TABLE", "KEY4", {{"f2", "v2"}}, ReturnCode(SAI_STATUS_SUCCESS));
+
+    // Nothing is written before the flush
+    ASSERT_FALSE(stateTable.get("KEY1", values));
+    publisher.flush();
+
+    ASSERT_TRUE(stateTable.get("KEY1", values));
+    ASSERT_EQ(values, (std::vector<FieldValueTuple>{{"f1", "v1"}, {"f2", "v3"}, {"f3", "v4"}}));
+    ASSERT_TRUE(stateTable.get("KEY2", values));
+    ASSERT_EQ(values, (std::vector<FieldValueTuple>{{"f2", "v2"}, {"f3", "v3"}}));
+    ASSERT_FALSE(stateTable.get("KEY3", values));
+    ASSERT_TRUE(stateTable.get("KEY4", values));
+    ASSERT_EQ(values, (std::vector<FieldValueTuple>{{"f2", "v2"}}));
+
+    // Writes on top of the flushed entries
+    publisher.publish("COALESCED_TABLE", "KEY1", {{"f1", "v6"}}, ReturnCode(SAI_STATUS_SUCCESS));
+    publisher.publish("COALESCED_TABLE", "KEY2", {}, ReturnCode(SAI_STATUS_SUCCESS));
+    publisher.flush();
+
+    ASSERT_TRUE(stateTable.get("KEY1", values));
+    ASSERT_EQ(values, (std::vector<FieldValueTuple>{{"f1", "v6"}, {"f2", "v3"}, {"f3", "v4"}}));
+    ASSERT_FALSE(stateTable.get("KEY2", values));
+}
+
+TEST(ResponsePublisher, TestPublishRouteResponses)
+{
+    const int routes = 512;
+    const int routesPerIteration = 256;
+    DBConnector conn{"APPL_STATE_DB", 0};
+    Table stateTable{&conn, "ROUTE_TABLE"};
+    std::vector<FieldValueTuple> values;
+    // Unbuffered like most orchs, only flushAll sends the responses
+    ResponsePublisher publisher{"APPL_STATE_DB"};
+
+    ResponsePublisher::setDeferredFlush(true);
+
+    for (int i = 0; i < routes; i++)
+    {
+        std::string prefix = "10." + std::to_string(i / 256 % 256) + "." + std::to_string(i % 256) + ".0/24";
+        // Route added, then its next hops updated in the same iteration
+        publisher.publish("ROUTE_TABLE", prefix, {{"protocol", "bgp"}, {"nexthop", "10.0.0.1"}},
+                          ReturnCode(SAI_STATUS_SUCCESS));
+        publisher.publish("ROUTE_TABLE", prefix, {{"nexthop", "10.0.0.1,10.0.0.3"}}, ReturnCode(SAI_STATUS_SUCCESS));
+        if ((i + 1) % routesPerIteration == 0)
+        {
+            ResponsePublisher::flushAll();
+        }
+        else
+        {
+            // Deferred until the end of the iteration
+            ASSERT_FALSE(stateTable.get(prefix, values));
+        }
+    }
+
+    ResponsePublisher::setDeferredFlush(false);
+
+    for (int i = 0; i < routes; i++)
+    {
+        std::string prefix = "10." + std::to_string(i / 256 % 256) + "." + std::to_string(i % 256) + ".0/24";
+        ASSERT_TRUE(stateTable.get(prefix, values));
+        ASSERT_EQ(values, (std::vector<FieldValueTuple>{{"protocol", "bgp"}, {"nexthop", "10.0.0.1,10.0.0.3"}}));
+    }
+}
+
+// Opt-in: --gtest_also_run_disabled_tests --gtest_filter=ResponsePublisher.DISABLED_BenchmarkRouteResponses
+TEST(ResponsePublisher, DISABLED_BenchmarkRouteResponses)
+{
+    const int routes = 4096;
+    const int routesPerIteration = 256;
+    ResponsePublisher publisher{"APPL_STATE_DB"};
+
+    ResponsePublisher::setDeferredFlush(true);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < routes; i++)
+    {
+        std::string prefix = "10." + std::to_string(i / 256 % 256) + "." + std::to_string(i % 256) + ".0/24";
+        publisher.publish("ROUTE_TABLE", prefix, {{"protocol", "bgp"}}, ReturnCode(SAI_STATUS_SUCCESS));
+        publisher.publish("ROUTE_TABLE", prefix, {{"protocol", "bgp"}}, ReturnCode(SAI_STATUS_SUCCESS));
+        if ((i + 1) % routesPerIteration == 0)
+        {
+            ResponsePublisher::flushAll();
+        }
+    }
+
+    ResponsePublisher::setDeferredFlush(false);
+    publisher.flush();
+    auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    std::cout << 2 * routes << " route responses in " << duration.count() << "us, "
+              << 2 * routes * 1000000.0 / static_cast<double>(std::max<int64_t>(duration.count(), 1))
+              << " notifications/sec" << std::endl;
+}
@@ -551,4 +551,65 @@ namespace routeorch_test
         ASSERT_EQ(current_create_count, create_route_count);
         ASSERT_EQ(current_set_count, set_route_count);
     }
+
+    TEST_F(RouteOrchTest, RouteOrchTestNextHopFlagUpdates)
+    {
+        std::deque<KeyOpFieldsValuesTuple> entries;
+        entries.push_back({"Ethernet0:10.0.0.4", "SET", { {"neigh", "00:00:0a:00:00:04"},
+                                                          {"family", "IPv4"}}});
+        auto consumer = dynamic_cast<Consumer *>(gNeighOrch->getExecutor(APP_NEIGH_TABLE_NAME));
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gNeighOrch)->doTask();
+
+        entries.clear();
+        entries.push_back({"2.2.2.0/24", "SET", { {"ifname", "Ethernet0,Ethernet0"},
+                                                  {"nexthop", "10.0.0.2,10.0.0.3"}}});
+        entries.push_back({"3.3.3.0/24", "SET", { {"ifname", "Ethernet0,Ethernet0"},
+                                                  {"nexthop", "10.0.0.2,10.0.0.4"}}});
+        entries.push_back({"4.4.4.0/24", "SET", { {"ifname", "Ethernet0,Ethernet0"},
+                                                  {"nexthop", "10.0.0.3,10.0.0.4"}}});
+        consumer = dynamic_cast<Consumer *>(gRouteOrch->getExecutor(APP_ROUTE_TABLE_NAME));
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+
+        ASSERT_TRUE(gRouteOrch->hasNextHopGroup(NextHopGroupKey("10.0.0.2@Ethernet0,10.0.0.3@Ethernet0")));
+        ASSERT_TRUE(gRouteOrch->hasNextHopGroup(NextHopGroupKey("10.0.0.2@Ethernet0,10.0.0.4@Ethernet0")));
+        ASSERT_TRUE(gRouteOrch->hasNextHopGroup(NextHopGroupKey("10.0.0.3@Ethernet0,10.0.0.4@Ethernet0")));
+
+        // Only the groups with the next hop get their member removed and added back
+        NextHopKey nexthop("10.0.0.2", string("Ethernet0"));
+        uint32_t count;
+        ASSERT_TRUE(gRouteOrch->invalidnexthopinNextHopGroup(nexthop, count));
+        ASSERT_EQ(count, 2u);
+        ASSERT_TRUE(gRouteOrch->validnexthopinNextHopGroup(nexthop, count));
+        ASSERT_EQ(count, 2u);
+
+        // A removed group is no longer updated
+        entries.clear();
+        entries.push_back({"2.2.2.0/24", "DEL", { {} }});
+        consumer->addToSync(entries);
+        static_cast<Orch *>(gRouteOrch)->doTask();
+        ASSERT_FALSE(gRouteOrch->hasNextHopGroup(NextHopGroupKey("10.0.0.2@Ethernet0,10.0.0.3@Ethernet0")));
+
+        ASSERT_TRUE(gRouteOrch->invalidnexthopinNextHopGroup(nexthop, count));
+        ASSERT_EQ(count, 1u);
+        ASSERT_TRUE(gRouteOrch->validnexthopinNextHopGroup(nexthop, count));
+        ASSERT_EQ(count, 1u);
+
+        // The next hops on an interface follow its state
+        ASSERT_TRUE(gNeighOrch->ifChangeInformNextHop("Ethernet0", false));
+        for (auto ip : { "10.0.0.2", "10.0.0.3", "10.0.0.4" })
+        {
+            ASSERT_TRUE(gNeighOrch->isNextHopFlagSet(NextHopKey(ip, string("Ethernet0")), NHFLAGS_IFDOWN));
+        }
+
+        ASSERT_TRUE(gNeighOrch->ifChangeInformNextHop("Ethernet0", true));
+        for (auto ip : { "10.0.0.2", "10.0.0.3", "10.0.0.4" })
+        {
+            ASSERT_FALSE(gNeighOrch->isNextHopFlagSet(NextHopKey(ip, string("Ethernet0")), NHFLAGS_IFDOWN));
+        }
+
+        // Nothing to update on an interface without next hops
+        ASSERT_TRUE(gNeighOrch->ifChangeInformNextHop("Ethernet8", false));
+    }
 }
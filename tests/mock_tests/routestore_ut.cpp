@@ -0,0 +1,360 @@
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <random>
+#include <set>
+#include <malloc.h>
+#include <unistd.h>
+
+#include "ut_helper.h"
+#include "routestore.h"
+
+namespace routestore_test
+{
+    using namespace std;
+
+    typedef map<IpPrefix, RouteNhg> RouteTable;
+
+    struct RouteStoreTest : public ::testing::Test
+    {
+        vector<RouteNhg> m_nhgs;
+        mt19937 m_rand;
+
+        RouteStoreTest()
+        {
+            for (int i = 1; i <= 8; i++)
+            {
+                string nexthops = "10.0.0." + to_string(i) + "@Ethernet" + to_string(4 * i) +
+                                  ",10.0.1." + to_string(i) + "@Ethernet" + to_string(4 * i + 64);
+                m_nhgs.emplace_back(NextHopGroupKey(nexthops), "");
+            }
+            m_nhgs.emplace_back(NextHopGroupKey(), "group1");
+            m_nhgs.emplace_back(NextHopGroupKey(), "group2");
+        }
+
+        IpPrefix randomV4Prefix(int minLength = 8)
+        {
+            int len = minLength + (int)(m_rand() % (33 - minLength));
+            uint32_t mask = len ? ~0U << (32 - len) : 0;
+            ip_addr_t ip;
+            ip.family = AF_INET;
+            ip.ip_addr.ipv4_addr = htonl((uint32_t)m_rand() & mask);
+            return IpPrefix(ip, len);
+        }
+
+        IpPrefix randomV6Prefix(int minLength = 16)
+        {
+            int len = minLength + (int)(m_rand() % (129 - minLength));
+            ip_addr_t ip;
+            ip.family = AF_INET6;
+            for (int i = 0; i < 16; i++)
+            {
+                int bits = min(8, max(0, len - 8 * i));
+                ip.ip_addr.ipv6_addr[i] = (uint8_t)(m_rand() & (0xff00 >> bits));
+            }
+            return IpPrefix(ip, len);
+        }
+
+        /* Bytes of the process in memory, after the freed heap went back to the system */
+        static size_t getResidentMemory()
+        {
+            malloc_trim(0);
+
+            size_t size = 0, resident = 0;
+            ifstream statm("/proc/self/statm");
+            statm >> size >> resident;
+            return resident * (size_t)sysconf(_SC_PAGESIZE);
+        }
+
+        const RouteNhg &randomNhg()
+        {
+            return m_nhgs[m_rand() % m_nhgs.size()];
+        }
+
+        void checkSame(const RouteStore &store, const RouteTable &table)
+        {
+            ASSERT_EQ(store.size(), table.size());
+
+            // IPv4 routes first, then IPv6, each in the order of the map
+            vector<RouteStore::value_type> expected;
+            for (bool v4 : { true, false })
+            {
+                for (const auto &route : table)
+                {
+                    if (route.first.isV4() == v4)
+                    {
+                        expected.push_back(route);
+                    }
+                }
+            }
+
+            size_t i = 0;
+            for (const auto &route : store)
+            {
+                ASSERT_LT(i, expected.size());
+                ASSERT_EQ(route.first, expected[i].first);
+                ASSERT_EQ(route.second, expected[i].second);
+                i++;
+            }
+            ASSERT_EQ(i, expected.size());
+        }
+    };
+
+    TEST_F(RouteStoreTest, SetFindErase)
+    {
+        RouteStore store;
+        ASSERT_TRUE(store.empty());
+        ASSERT_EQ(store.begin(), store.end());
+
+        IpPrefix v4("192.168.0.0/16");
+        IpPrefix v6("2001:db8::/32");
+        store.set(v4, m_nhgs[0]);
+        store.set(v6, m_nhgs[1]);
+        store.set(IpPrefix("0.0.0.0/0"), RouteNhg());
+
+        ASSERT_EQ(store.size(), 3u);
+        ASSERT_EQ(store.at(v4), m_nhgs[0]);
+        ASSERT_EQ(store.at(v6), m_nhgs[1]);
+        ASSERT_EQ(store.at(IpPrefix("0.0.0.0/0")), RouteNhg());
+        ASSERT_EQ(store.find(v4)->first, v4);
+        ASSERT_EQ(store.find(v6)->second, m_nhgs[1]);
+        ASSERT_EQ(store.find(IpPrefix("192.168.0.0/24")), store.end());
+        ASSERT_EQ(store.find(IpPrefix("2001:db8::/48")), store.end());
+        ASSERT_THROW(store.at(IpPrefix("10.0.0.0/8")), out_of_range);
+
+        // Update of the next hop group
+        store.set(v4, m_nhgs[8]);
+        ASSERT_EQ(store.size(), 3u);
+        ASSERT_EQ(store.at(v4), m_nhgs[8]);
+        ASSERT_EQ(store.at(v4).nhg_index, "group1");
+
+        ASSERT_EQ(store.erase(v4), 1u);
+        ASSERT_EQ(store.erase(v4), 0u);
+        ASSERT_EQ(store.find(v4), store.end());
+        ASSERT_EQ(store.size(), 2u);
+
+        store.clear();
+        ASSERT_TRUE(store.empty());
+        ASSERT_EQ(store.find(v6), store.end());
+    }
+
+    TEST_F(RouteStoreTest, SharedNextHopGroups)
+    {
+        RouteStore store;
+        size_t emptyMemory = store.getMemoryUsage();
+
+        vector<IpPrefix> prefixes;
+        for (int i = 0; i < 1000; i++)
+        {
+            prefixes.push_back(randomV4Prefix());
+            store.set(prefixes.back(), m_nhgs[i % 2]);
+        }
+
+        // The routes with the same next hop group share it
+        const RouteNhg *nhgs[2] = { &store.at(prefixes[0]), &store.at(prefixes[1]) };
+        for (const auto &route : store)
+        {
+            const RouteNhg &nhg = store.at(route.first);
+            ASSERT_TRUE(&nhg == nhgs[0] || &nhg == nhgs[1]);
+        }
+
+        // A released next hop group is reused
+        store.set(prefixes[0], m_nhgs[2]);
+        for (size_t i = 1; i < prefixes.size(); i++)
+        {
+            store.erase(prefixes[i]);
+        }
+        store.set(prefixes[1], m_nhgs[3]);
+        ASSERT_EQ(store.size(), 2u);
+        ASSERT_TRUE(&store.at(prefixes[1]) == nhgs[0] || &store.at(prefixes[1]) == nhgs[1]);
+        ASSERT_EQ(store.at(prefixes[1]), m_nhgs[3]);
+
+        store.erase(prefixes[0]);
+        store.erase(prefixes[1]);
+        ASSERT_TRUE(store.empty());
+        ASSERT_LT(store.getMemoryUsage(), emptyMemory + 1024);
+    }
+
+    TEST_F(RouteStoreTest, SameAsMap)
+    {
+        RouteStore store;
+        RouteTable table;
+        vector<IpPrefix> prefixes;
+
+        // Enough routes to split and merge chunks, with updates and removals
+        for (int i = 0; i < 20000; i++)
+        {
+            IpPrefix prefix = i % 3 ? randomV4Prefix() : randomV6Prefix();
+            const RouteNhg &nhg = randomNhg();
+            store.set(prefix, nhg);
+            table[prefix] = nhg;
+            prefixes.push_back(prefix);
+        }
+        checkSame(store, table);
+
+        for (int i = 0; i < 30000; i++)
+        {
+            const IpPrefix &prefix = prefixes[m_rand() % prefixes.size()];
+            if (m_rand() % 2)
+            {
+                ASSERT_EQ(store.erase(prefix), table.erase(prefix));
+            }
+            else
+            {
+                const RouteNhg &nhg = randomNhg();
+                store.set(prefix, nhg);
+                table[prefix] = nhg;
+            }
+        }
+        checkSame(store, table);
+
+        for (const auto &prefix : prefixes)
+        {
+            auto it = table.find(prefix);
+            if (it == table.end())
+            {
+                ASSERT_EQ(store.find(prefix), store.end());
+            }
+            else
+            {
+                ASSERT_EQ(store.at(prefix), it->second);
+            }
+        }
+
+        // Routes added in order
+        store.clear();
+        table.clear();
+        for (uint32_t i = 0; i < 5000; i++)
+        {
+            ip_addr_t ip;
+            ip.family = AF_INET;
+            ip.ip_addr.ipv4_addr = htonl(0x0a000000 + (i << 8));
+            store.set(IpPrefix(ip, 24), m_nhgs[0]);
+            table[IpPrefix(ip, 24)] = m_nhgs[0];
+            ip.ip_addr.ipv4_addr = htonl(0x0affffff - i);
+            store.set(IpPrefix(ip, 32), m_nhgs[1]);
+            table[IpPrefix(ip, 32)] = m_nhgs[1];
+        }
+        checkSame(store, table);
+    }
+
+    TEST_F(RouteStoreTest, CoveringRoutes)
+    {
+        RouteStore store;
+
+        for (int i = 0; i < 5000; i++)
+        {
+            IpPrefix prefix = i % 2 ? randomV4Prefix(0) : randomV6Prefix(0);
+            store.set(prefix, randomNhg());
+        }
+        store.set(IpPrefix("10.1.0.0/16"), m_nhgs[0]);
+        store.set(IpPrefix("10.1.2.0/24"), m_nhgs[1]);
+        store.set(IpPrefix("10.1.2.3/32"), m_nhgs[2]);
+        store.set(IpPrefix("2001:db8::/32"), m_nhgs[3]);
+        store.set(IpPrefix("2001:db8::1/128"), m_nhgs[4]);
+        // Host bits are set in the prefix of a route, as in APPL_DB
+        store.set(IpPrefix("10.1.2.1/24"), m_nhgs[5]);
+        store.set(IpPrefix("2001:db8::5/64"), m_nhgs[6]);
+
+        vector<IpAddress> addresses = { IpAddress("10.1.2.3"), IpAddress("10.1.3.1"), IpAddress("2001:db8::1"),
+                                        IpAddress("2001:db8:1::1") };
+        for (int i = 0; i < 200; i++)
+        {
+            addresses.push_back(randomV4Prefix(32).getIp());
+            addresses.push_back(randomV6Prefix(128).getIp());
+        }
+
+        for (const auto &address : addresses)
+        {
+            RouteTable expected;
+            for (const auto &route : store)
+            {
+                if (route.first.isAddressInSubnet(address))
+                {
+                    expected.emplace(route.first, route.second);
+                }
+            }
+
+            RouteTable routes;
+            store.getCoveringRoutes(address, routes);
+            ASSERT_EQ(routes, expected) << address.to_string();
+        }
+
+        RouteTable routes;
+        store.getCoveringRoutes(IpAddress("10.1.2.3"), routes);
+        ASSERT_EQ(routes.at(IpPrefix("10.1.2.3/32")), m_nhgs[2]);
+        ASSERT_EQ(routes.at(IpPrefix("10.1.2.1/24")), m_nhgs[5]);
+        ASSERT_EQ(routes.rbegin()->first, IpPrefix("10.1.2.3/32"));
+    }
+
+    // Opt-in: --gtest_also_run_disabled_tests --gtest_filter=RouteStoreTest.DISABLED_Benchmark
+    TEST_F(RouteStoreTest, DISABLED_Benchmark)
+    {
+        // About the size of full Internet tables, one VRF per family
+        for (bool v4 : { true, false })
+        {
+            const size_t count = v4 ? 1000000 : 2000000;
+
+            set<IpPrefix> unique;
+            while (unique.size() < count)
+            {
+                unique.insert(v4 ? randomV4Prefix() : randomV6Prefix());
+            }
+            vector<IpPrefix> prefixes(unique.begin(), unique.end());
+            unique.clear();
+            shuffle(prefixes.begin(), prefixes.end(), m_rand);
+            vector<IpPrefix> lookups = prefixes;
+            shuffle(lookups.begin(), lookups.end(), m_rand);
+
+            // Each container is measured by the resident memory it adds, the route store first
+            size_t startMemory = getResidentMemory();
+            RouteStore store;
+            auto start = chrono::steady_clock::now();
+            for (size_t i = 0; i < prefixes.size(); i++)
+            {
+                store.set(prefixes[i], m_nhgs[i % m_nhgs.size()]);
+            }
+            auto storeSetTime = chrono::steady_clock::now() - start;
+            size_t storeMemory = getResidentMemory() - startMemory;
+
+            startMemory = getResidentMemory();
+            RouteTable table;
+            start = chrono::steady_clock::now();
+            for (size_t i = 0; i < prefixes.size(); i++)
+            {
+                table[prefixes[i]] = m_nhgs[i % m_nhgs.size()];
+            }
+            auto mapSetTime = chrono::steady_clock::now() - start;
+            size_t mapMemory = getResidentMemory() - startMemory;
+
+            size_t found = 0;
+            start = chrono::steady_clock::now();
+            for (const auto &prefix : lookups)
+            {
+                found += table.find(prefix) != table.end();
+            }
+            auto mapFindTime = chrono::steady_clock::now() - start;
+            start = chrono::steady_clock::now();
+            for (const auto &prefix : lookups)
+            {
+                found += store.find(prefix) != store.end();
+            }
+            auto storeFindTime = chrono::steady_clock::now() - start;
+
+            ASSERT_EQ(store.size(), table.size());
+            ASSERT_EQ(found, 2 * lookups.size());
+
+            cout << (v4 ? "IPv4" : "IPv6") << " routes of a VRF, " << table.size() << " routes: map "
+                 << mapMemory / table.size() << " resident bytes per route, set "
+                 << chrono::duration_cast<chrono::milliseconds>(mapSetTime).count() << " ms, find "
+                 << chrono::duration_cast<chrono::milliseconds>(mapFindTime).count() << " ms; route store "
+                 << storeMemory / store.size() << " resident bytes per route, set "
+                 << chrono::duration_cast<chrono::milliseconds>(storeSetTime).count() << " ms, find "
+                 << chrono::duration_cast<chrono::milliseconds>(storeFindTime).count() << " ms" << endl;
+
+            ASSERT_LT(storeMemory * 3, mapMemory);
+        }
+    }
+}
@@ -0,0 +1,113 @@
+#include "ut_helper.h"
+#include "taskworkerpool.h"
+#include "dash_api/vnet_mapping.pb.h"
+
+#include <chrono>
+#include <stdexcept>
+
+namespace taskworkerpool_test
+{
+    using namespace std;
+    using namespace swss;
+
+    TEST(TaskWorkerPoolTest, RunsAllTasks)
+    {
+        TaskWorkerPool pool(3);
+
+        for (size_t count : {0, 10, 255, 256, 10000})
+        {
+            vector<size_t> results(count, 0);
+            pool.run(count, [&](size_t i) { results[i] = i * i + 1; });
+
+            for (size_t i = 0; i < count; i++)
+            {
+                ASSERT_EQ(results[i], i * i + 1);
+            }
+        }
+    }
+
+    TEST(TaskWorkerPoolTest, RethrowsException)
+    {
+        TaskWorkerPool pool(2);
+
+        EXPECT_THROW(pool.run(1000, [](size_t i) {
+            if (i == 777)
+            {
+                throw runtime_error("task failed");
+            }
+        }), runtime_error);
+
+        // The pool is still usable
+        vector<size_t> results(1000, 0);
+        pool.run(results.size(), [&](size_t i) { results[i] = i; });
+        EXPECT_EQ(results[999], 999);
+    }
+
+    TEST(TaskWorkerPoolTest, DecodeVnetMappings)
+    {
+        const uint32_t mappings = 200000;
+        SyncMap toSync;
+
+        for (uint32_t i = 0; i < mappings; i++)
+        {
+            dash::vnet_mapping::VnetMapping mapping;
+            mapping.set_routing_type(dash::route_type::RoutingType::ROUTING_TYPE_VNET_ENCAP);
+            mapping.mutable_underlay_ip()->set_ipv4(0x0a000000 + i);
+            mapping.set_mac_address(string("\x00\x11\x22\x33\x44\x55", 6));
+            mapping.set_use_dst_vni(i % 2);
+
+            string key = "Vnet1:20." + to_string(i >> 16) + "." + to_string((i >> 8) & 0xff) + "." + to_string(i & 0xff);
+            if (i % 1000 == 1)
+            {
+                toSync.emplace(key, KeyOpFieldsValuesTuple{key, DEL_COMMAND, {}});
+            }
+            else if (i % 1000 == 2)
+            {
+                toSync.emplace(key, KeyOpFieldsValuesTuple{key, SET_COMMAND, {{"pb", "invalid"}}});
+            }
+            else
+            {
+                toSync.emplace(key, KeyOpFieldsValuesTuple{key, SET_COMMAND, {{"pb", mapping.SerializeAsString()}}});
+            }
+        }
+
+        // On the calling thread, as the orchs did
+        auto start = chrono::steady_clock::now();
+        vector<dash::vnet_mapping::VnetMapping> serial(toSync.size());
+        size_t index = 0;
+        for (const auto &it : toSync)
+        {
+            if (kfvOp(it.second) == SET_COMMAND)
+            {
+                parsePbMessage(kfvFieldsValues(it.second), serial[index]);
+            }
+            index++;
+        }
+        auto serialDuration = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+
+        start = chrono::steady_clock::now();
+        auto decoded = decodePbMessages<dash::vnet_mapping::VnetMapping>(toSync);
+        auto poolDuration = chrono::duration_cast<chrono::milliseconds>(chrono::steady_clock::now() - start);
+
+        cout << mappings << " VNET mappings decoded in " << serialDuration.count() << "ms on the main thread, "
+             << poolDuration.count() << "ms with " << TaskWorkerPool::getInstance().getThreadCount() << " workers" << endl;
+
+        ASSERT_EQ(decoded.size(), toSync.size());
+        index = 0;
+        for (const auto &it : toSync)
+        {
+            const auto &result = decoded[index];
+            if (kfvOp(it.second) == DEL_COMMAND || fvValue(kfvFieldsValues(it.second)[0]) == "invalid")
+            {
+                ASSERT_FALSE(result.parsed) << kfvKey(it.second);
+            }
+            else
+            {
+                ASSERT_TRUE(result.parsed) << kfvKey(it.second);
+                ASSERT_EQ(result.msg.SerializeAsString(), serial[index].SerializeAsString());
+                ASSERT_EQ(result.msg.SerializeAsString(), fvValue(kfvFieldsValues(it.second)[0]));
+            }
+            index++;
+        }
+    }
+}
@@ -0,0 +1,108 @@
+import time
+import pytest
+import buffer_model
+
+BUFFERMGRD_SH = "/usr/bin/buffermgrd.sh"
+HEADROOM_LUA = "/usr/share/swss/buffer_headroom_vs.lua"
+POOL_LUA = "/usr/share/swss/buffer_pool_vs.lua"
+
+
+@pytest.fixture(scope="class")
+def native_buffer(dvs):
+    # calculate the headroom and pool sizes in buffermgrd, the plugins are run by the tests only
+    dvs.runcmd("cp {0} {0}_native_ut_backup".format(BUFFERMGRD_SH))
+    dvs.runcmd("sed -i.bak 's/\/usr\/bin\/buffermgrd /\/usr\/bin\/buffermgrd -N /g' " + BUFFERMGRD_SH)
+    buffer_model.enable_dynamic_buffer(dvs.get_config_db(), dvs.runcmd)
+    dvs.runcmd("supervisorctl restart buffermgrd")
+    time.sleep(20)
+
+    _, cmdline = dvs.runcmd("pgrep -a buffermgrd")
+    assert " -N" in cmdline, "buffermgrd is not calculating natively: " + cmdline
+
+    yield
+
+    dvs.runcmd("cp {0}_native_ut_backup {0}".format(BUFFERMGRD_SH))
+    buffer_model.disable_dynamic_buffer(dvs.get_config_db(), dvs.runcmd)
+
+
+@pytest.mark.usefixtures("native_buffer")
+class TestBufferNative(object):
+    def setup_db(self, dvs):
+        self.app_db = dvs.get_app_db()
+        self.config_db = dvs.get_config_db()
+
+        port = self.config_db.wait_for_entry("PORT", "Ethernet0")
+        self.original_speed = port["speed"]
+        self.mtu = port.get("mtu", "9100")
+        self.lanes = str(len(port["lanes"].split(",")))
+        self.original_cable_lengths = self.config_db.wait_for_entry("CABLE_LENGTH", "AZURE")
+
+    def cleanup_db(self, dvs):
+        self.config_db.delete_entry("BUFFER_PG", "Ethernet0|3-4")
+        self.app_db.wait_for_deleted_entry("BUFFER_PG_TABLE", "Ethernet0:3-4")
+        dvs.port_field_set("Ethernet0", "speed", self.original_speed)
+        self.config_db.update_entry("CABLE_LENGTH", "AZURE", self.original_cable_lengths)
+
+    def set_lossless_pg(self, dvs, speed, cable_length):
+        cable_lengths = self.config_db.get_entry("CABLE_LENGTH", "AZURE")
+        cable_lengths["Ethernet0"] = cable_length
+        self.config_db.update_entry("CABLE_LENGTH", "AZURE", cable_lengths)
+        dvs.port_field_set("Ethernet0", "speed", speed)
+        self.config_db.update_entry("BUFFER_PG", "Ethernet0|3-4", {"profile": "NULL"})
+
+        profile = "pg_lossless_" + speed + "_" + cable_length + "_profile"
+        self.app_db.wait_for_field_match("BUFFER_PG_TABLE", "Ethernet0:3-4", {"profile": profile})
+        return profile
+
+    def run_lua(self, dvs, script, keys=[], argv=[]):
+        _, output = dvs.runcmd(["redis-cli", "--eval", script] + keys + [","] + argv)
+        return [line for line in output.splitlines() if line and not line.startswith("debug:")]
+
+    def test_SameHeadroomAsLua(self, dvs, testlog):
+        self.setup_db(dvs)
+        dvs.port_admin_set("Ethernet0", "up")
+
+        try:
+            for speed in ["10000", "25000", "50000", "100000"]:
+                for cable_length in ["5m", "40m", "300m"]:
+                    profile = self.set_lossless_pg(dvs, speed, cable_length)
+                    native = self.app_db.wait_for_entry("BUFFER_PROFILE_TABLE", profile)
+
+                    lua = self.run_lua(dvs, HEADROOM_LUA, [profile], [speed, cable_length, self.mtu, "0", self.lanes])
+                    lua = dict(line.split(":", 1) for line in lua)
+                    for field in ["xon", "xoff", "size"]:
+                        assert native[field] == lua[field], "{} of {}".format(field, profile)
+        finally:
+            self.cleanup_db(dvs)
+            dvs.port_admin_set("Ethernet0", "down")
+
+    def test_SamePoolSizesAsLua(self, dvs, testlog):
+        self.setup_db(dvs)
+        dvs.port_admin_set("Ethernet0", "up")
+
+        try:
+            for speed, cable_length in [("100000", "5m"), ("25000", "300m")]:
+                self.set_lossless_pg(dvs, speed, cable_length)
+
+                # the pools are recalculated on the next timer tick of buffermgrd
+                mismatches = None
+                for _ in range(30):
+                    time.sleep(1)
+                    mismatches = []
+                    for line in self.run_lua(dvs, POOL_LUA):
+                        values = line.split(":")
+                        pool = self.app_db.get_entry("BUFFER_POOL_TABLE", values[0])
+                        if pool.get("size") != values[1] or (len(values) > 2 and pool.get("xoff") != values[2]):
+                            mismatches.append((line, pool))
+                    if not mismatches:
+                        break
+                assert not mismatches, "Pool sizes differ from {}: {}".format(POOL_LUA, mismatches)
+        finally:
+            self.cleanup_db(dvs)
+            dvs.port_admin_set("Ethernet0", "down")
+
+
+# Add Dummy always-pass test at end as workaroud
+# for issue when Flaky fail on final test it invokes module tear-down before retrying
+def test_nonflaky_dummy():
+    pass
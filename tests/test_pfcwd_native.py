@@ -0,0 +1,113 @@
+import json
+import time
+import pytest
+
+PFC_DETECT_LUA = "/usr/share/swss/pfc_detect_vs.lua"
+PFC_RESTORE_LUA = "/usr/share/swss/pfc_restore.lua"
+PFC_WD_POLL_CHANNEL = "PFC_WD_POLL"
+POLL_INTERVAL = "200"
+PORT = "Ethernet0"
+QUEUE = 3
+
+# traffic of each poll: queue packets, queue occupancy, PFC frames received by the port
+NORMAL = (100, 0, 0)
+STORM = (0, 100, 10)
+IDLE = (0, 0, 0)
+TRAFFIC = [NORMAL, STORM, STORM, STORM, IDLE, IDLE, NORMAL, STORM, NORMAL]
+
+
+class TestPfcWdNative(object):
+    @pytest.fixture(scope="class")
+    def native_detection(self, dvs):
+        # detect the PFC storms in orchagent
+        dvs.runcmd("cp /usr/bin/orchagent.sh /usr/bin/orchagent.sh_pfcwd_ut_backup")
+        dvs.runcmd("sed -i.bak 's/\/usr\/bin\/orchagent /\/usr\/bin\/orchagent -W native /g' /usr/bin/orchagent.sh")
+        dvs.stop_swss()
+        dvs.start_swss()
+
+        _, cmdline = dvs.runcmd("pgrep -a orchagent")
+        assert "-W native" in cmdline, "orchagent is not detecting natively: " + cmdline
+
+        config_db = dvs.get_config_db()
+        counters_db = dvs.get_counters_db()
+
+        self.orig_cable_len = config_db.get_entry("CABLE_LENGTH", "AZURE")[PORT]
+        config_db.update_entry("CABLE_LENGTH", "AZURE", {PORT: "5m"})
+        dvs.port_admin_set(PORT, "up")
+        config_db.update_entry("FLEX_COUNTER_TABLE", "PFCWD", {"FLEX_COUNTER_STATUS": "enable"})
+        config_db.update_entry("FLEX_COUNTER_TABLE", "QUEUE", {"FLEX_COUNTER_STATUS": "enable"})
+        config_db.create_entry("PORT_QOS_MAP", PORT, {"pfcwd_sw_enable": str(QUEUE), "pfc_enable": str(QUEUE)})
+
+        # syncd polls the counters once, then leaves the values written by the test
+        config_db.update_entry("PFC_WD", "GLOBAL", {"POLL_INTERVAL": "3600000"})
+        config_db.update_entry("PFC_WD", PORT, {"action": "drop", "detection_time": "400", "restoration_time": "400"})
+
+        queue_oid = counters_db.wait_for_entry("COUNTERS_QUEUE_NAME_MAP", "")[PORT + ":" + str(QUEUE)]
+        port_oid = counters_db.wait_for_entry("COUNTERS_PORT_NAME_MAP", "")[PORT]
+        counters_db.wait_for_field_match("COUNTERS", queue_oid, {"PFC_WD_STATUS": "operational"})
+        time.sleep(2)
+
+        yield queue_oid, port_oid
+
+        config_db.delete_entry("PFC_WD", PORT)
+        config_db.delete_entry("PORT_QOS_MAP", PORT)
+        config_db.update_entry("FLEX_COUNTER_TABLE", "PFCWD", {"FLEX_COUNTER_STATUS": "disable"})
+        config_db.update_entry("FLEX_COUNTER_TABLE", "QUEUE", {"FLEX_COUNTER_STATUS": "disable"})
+        config_db.update_entry("CABLE_LENGTH", "AZURE", {PORT: self.orig_cable_len})
+        dvs.port_admin_set(PORT, "down")
+
+        dvs.runcmd("cp /usr/bin/orchagent.sh_pfcwd_ut_backup /usr/bin/orchagent.sh")
+        dvs.stop_swss()
+        dvs.start_swss()
+
+    def set_counters(self, dvs, queue_oid, port_oid, step):
+        packets = 1000 + sum(traffic[0] for traffic in TRAFFIC[:step + 1])
+        rx_packets = sum(traffic[2] for traffic in TRAFFIC[:step + 1])
+
+        counters_db = dvs.get_counters_db()
+        counters_db.update_entry("COUNTERS", queue_oid, {"SAI_QUEUE_STAT_PACKETS": str(packets),
+                                                         "SAI_QUEUE_STAT_CURR_OCCUPANCY_BYTES": str(TRAFFIC[step][1])})
+        counters_db.update_entry("COUNTERS", port_oid, {"SAI_PORT_STAT_PFC_%d_RX_PKTS" % QUEUE: str(rx_packets),
+                                                        "SAI_PORT_STAT_PFC_%d_RX_PAUSE_DURATION_US" % QUEUE: "0"})
+
+    def get_status(self, dvs, queue_oid):
+        return dvs.get_counters_db().get_entry("COUNTERS", queue_oid)["PFC_WD_STATUS"]
+
+    def poll_native(self, dvs, timestamp):
+        # what the pfc_wd_poll.lua plugin publishes after syncd polled the counters
+        dvs.runcmd(["redis-cli", "-n", "2", "PUBLISH", PFC_WD_POLL_CHANNEL,
+                    json.dumps(["poll", "%d.000000" % timestamp, "interval", POLL_INTERVAL])])
+
+    def poll_lua(self, dvs, queue_oid):
+        # the plugins syncd runs after each poll, in the same order
+        for script in [PFC_DETECT_LUA, PFC_RESTORE_LUA]:
+            dvs.runcmd(["redis-cli", "--eval", script, queue_oid, ",", "2", "COUNTERS", POLL_INTERVAL])
+
+    def test_SameStormsAsLua(self, dvs, testlog, native_detection):
+        queue_oid, port_oid = native_detection
+        counters_db = dvs.get_counters_db()
+
+        timestamp = int(time.time()) + 10
+        native = []
+        for step in range(len(TRAFFIC)):
+            self.set_counters(dvs, queue_oid, port_oid, step)
+            self.poll_native(dvs, timestamp + step)
+            time.sleep(1)
+            native.append(self.get_status(dvs, queue_oid))
+
+        assert "stormed" in native
+        assert native[-1] == "operational"
+
+        # the plugins over the same counters, from the state they keep in COUNTERS
+        for step in range(len(TRAFFIC)):
+            self.set_counters(dvs, queue_oid, port_oid, step)
+            self.poll_lua(dvs, queue_oid)
+            counters_db.wait_for_field_match("COUNTERS", queue_oid, {"PFC_WD_STATUS": native[step]})
+            time.sleep(1)
+            assert self.get_status(dvs, queue_oid) == native[step], "poll %d" % step
+
+
+# Add Dummy always-pass test at end as workaroud
+# for issue when Flaky fail on final test it invokes module tear-down before retrying
+def test_nonflaky_dummy():
+    pass
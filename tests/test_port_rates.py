@@ -0,0 +1,137 @@
+import json
+import time
+import pytest
+
+PORT = "Ethernet0"
+PORT_RATES_LUA = "/usr/share/swss/port_rates.lua"
+PORT_RATES_POLL_CHANNEL = "PORT_RATES_POLL"
+
+
+def counters(step):
+    n = 1000000 + step * 7919 + (step * step * 31) % 1013
+    return {
+        "SAI_PORT_STAT_IF_IN_UCAST_PKTS": str(n),
+        "SAI_PORT_STAT_IF_IN_NON_UCAST_PKTS": str(n // 3),
+        "SAI_PORT_STAT_IF_OUT_UCAST_PKTS": str(n + 17),
+        "SAI_PORT_STAT_IF_OUT_NON_UCAST_PKTS": str(n // 5),
+        "SAI_PORT_STAT_IF_IN_OCTETS": str(n * 64),
+        "SAI_PORT_STAT_IF_OUT_OCTETS": str(n * 128 + step),
+        "SAI_PORT_STAT_IF_IN_FEC_CORRECTED_BITS": str(step * step * 1000),
+        "SAI_PORT_STAT_IF_IN_FEC_NOT_CORRECTABLE_FRAMES": str(step * 3),
+    }
+
+
+def as_numbers(entry):
+    # redis may store the numbers given by a script in their shortest form
+    return {field: value if field == "INIT_DONE" else float(value) for field, value in entry.items()}
+
+
+class TestPortRates(object):
+    @pytest.fixture(scope="class")
+    def native_rates(self, dvs):
+        # compute the port rates in orchagent
+        dvs.runcmd("cp /usr/bin/orchagent.sh /usr/bin/orchagent.sh_rates_ut_backup")
+        dvs.runcmd("sed -i.bak 's/\/usr\/bin\/orchagent /\/usr\/bin\/orchagent -R native /g' /usr/bin/orchagent.sh")
+        dvs.stop_swss()
+        dvs.start_swss()
+
+        config_db = dvs.get_config_db()
+        counters_db = dvs.get_counters_db()
+
+        # syncd polls the counters once, then leaves the values written by the test
+        config_db.update_entry("FLEX_COUNTER_TABLE", "PORT", {"FLEX_COUNTER_STATUS": "enable", "POLL_INTERVAL": "3600000"})
+        counters_db.update_entry("RATES", "PORT", {"PORT_ALPHA": "0.18", "PORT_SMOOTH_INTERVAL": "10"})
+        oid = None
+        for _ in range(30):
+            oid = counters_db.db_connection.hget("COUNTERS_PORT_NAME_MAP", PORT)
+            if oid:
+                break
+            time.sleep(1)
+        assert oid, "No port counters for " + PORT
+        time.sleep(2)
+
+        yield oid
+
+        config_db.delete_entry("FLEX_COUNTER_TABLE", "PORT")
+        dvs.runcmd("cp /usr/bin/orchagent.sh_rates_ut_backup /usr/bin/orchagent.sh")
+        dvs.stop_swss()
+        dvs.start_swss()
+
+    def set_counters(self, dvs, oid, step):
+        dvs.get_counters_db().update_entry("COUNTERS", oid, counters(step))
+
+    def poll_native(self, dvs, oid, step, timestamp):
+        # what the port_rates_poll.lua plugin publishes after syncd polled the counters
+        dvs.runcmd(["redis-cli", "-n", "2", "PUBLISH", PORT_RATES_POLL_CHANNEL,
+                    json.dumps(["poll", "%d.000000" % timestamp, "interval", "1000"])])
+        dvs.get_counters_db().wait_for_field_match("RATES", oid,
+                                                   {"SAI_PORT_STAT_IF_IN_OCTETS_last": counters(step)["SAI_PORT_STAT_IF_IN_OCTETS"]})
+
+    def poll_lua(self, dvs, oid):
+        dvs.runcmd(["redis-cli", "--eval", PORT_RATES_LUA, oid, ",", "2", "COUNTERS", "1000"])
+
+    def get_rates(self, dvs, oid):
+        counters_db = dvs.get_counters_db()
+        return counters_db.get_entry("RATES", oid), counters_db.get_entry("RATES", oid + ":PORT")
+
+    def set_rates(self, dvs, oid, rates):
+        counters_db = dvs.get_counters_db()
+        counters_db.delete_entry("RATES", oid)
+        counters_db.delete_entry("RATES", oid + ":PORT")
+        counters_db.create_entry("RATES", oid, rates[0])
+        counters_db.create_entry("RATES", oid + ":PORT", rates[1])
+
+    def test_SameRatesAsLua(self, dvs, testlog, native_rates):
+        oid = native_rates
+
+        # newer than the poll of syncd, the rates are computed over 1s from the next poll on
+        timestamp = int(time.time()) + 10
+        self.set_counters(dvs, oid, 0)
+        self.poll_native(dvs, oid, 0, timestamp)
+        start = self.get_rates(dvs, oid)
+
+        native = []
+        for step in range(1, 6):
+            self.set_counters(dvs, oid, step)
+            self.poll_native(dvs, oid, step, timestamp + step)
+            native.append(self.get_rates(dvs, oid))
+
+        # the plugin from the same state, over the same counters
+        self.set_rates(dvs, oid, start)
+        for step in range(1, 6):
+            self.set_counters(dvs, oid, step)
+            self.poll_lua(dvs, oid)
+            lua = self.get_rates(dvs, oid)
+
+            assert as_numbers(native[step - 1][0]) == as_numbers(lua[0])
+            assert native[step - 1][1] == lua[1]
+
+        assert native[-1][1]["INIT_DONE"] == "DONE"
+
+    def test_CountersDisabled(self, dvs, testlog, native_rates):
+        oid = native_rates
+        config_db = dvs.get_config_db()
+
+        timestamp = int(time.time()) + 100
+        self.set_counters(dvs, oid, 10)
+        self.poll_native(dvs, oid, 10, timestamp)
+        rates = self.get_rates(dvs, oid)
+
+        # a poll notified after the port counters were disabled is not computed
+        config_db.update_entry("FLEX_COUNTER_TABLE", "PORT", {"FLEX_COUNTER_STATUS": "disable"})
+        time.sleep(2)
+        self.set_counters(dvs, oid, 11)
+        dvs.runcmd(["redis-cli", "-n", "2", "PUBLISH", PORT_RATES_POLL_CHANNEL,
+                    json.dumps(["poll", "%d.000000" % (timestamp + 1), "interval", "1000"])])
+        time.sleep(2)
+        assert self.get_rates(dvs, oid) == rates
+
+        config_db.update_entry("FLEX_COUNTER_TABLE", "PORT", {"FLEX_COUNTER_STATUS": "enable"})
+        time.sleep(2)
+        self.poll_native(dvs, oid, 11, timestamp + 2)
+
+
+# Add Dummy always-pass test at end as workaroud
+# for issue when Flaky fail on final test it invokes module tear-down before retrying
+def test_nonflaky_dummy():
+    pass